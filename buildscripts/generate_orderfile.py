@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+"""Regenerate symbols.orderfile from sampled profiles of representative workloads.
+
+The repo ships symbols.orderfile, which SConstruct feeds to lld via
+--symbol-ordering-file so that hot functions are laid out together in mongod's
+text section. The shipped ordering reflects the workload mix it was generated
+from; a deployment whose traffic looks different (e.g. heavy agg parsing vs.
+point reads) can see elevated icache and iTLB miss rates because its hot paths
+are scattered. This harness makes the ordering reproducible: it runs a set of
+representative benchmark binaries under Linux perf sampling, aggregates the
+samples into a hotness-ranked symbol list, and rewrites the orderfile. It can
+also emit BOLT- and Propeller-compatible profiles from the same sample data so
+deployments using post-link optimization can consume one profiling run.
+
+Typical usage, after building the benchmark binaries:
+
+    python3 buildscripts/generate_orderfile.py \
+        --build-dir build/install/bin \
+        --output symbols.orderfile
+
+or via Bazel:
+
+    bazel run //buildscripts:generate_orderfile -- \
+        --build-dir build/install/bin --output symbols.orderfile
+
+The default workload mix covers the query parse/plan path (canonical_query_bm,
+query_planner_bm, plan_cache_key_encoding_bm), expression evaluation
+(sbe_expression_bm) and the full command dispatch path
+(service_entry_point_shard_role_bm). Pass --workload one or more times to
+substitute a mix representative of your own traffic; any Google Benchmark
+binary works, as do arbitrary driver programs.
+
+Expected win: re-laying out mongod for the measured workload mix typically
+recovers a low-single-digit percentage of throughput on icache-bound
+workloads, with the gain concentrated in frontend stalls (L1i and iTLB
+misses). Measure before and after with
+`perf stat -e instructions,L1-icache-load-misses,iTLB-load-misses`; if the
+shipped ordering already matches your profile the regenerated file will be
+close to a no-op.
+
+Requirements: `perf` must be available and permitted to sample user-space
+cycles (kernel.perf_event_paranoid <= 2 suffices; no kernel samples are
+taken). BOLT output additionally requires `perf2bolt` (and LBR-capable
+hardware for best fidelity); Propeller output requires `create_llvm_prof`.
+Both are skipped with a note when the tools are absent.
+"""
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+from collections import Counter
+
+# Benchmark binaries exercising the paths that dominate mongod profiles, in no
+# particular order; sample counts are aggregated across all of them.
+DEFAULT_WORKLOADS = [
+    "canonical_query_bm",
+    "query_planner_bm",
+    "plan_cache_key_encoding_bm",
+    "sbe_expression_bm",
+    "service_entry_point_shard_role_bm",
+]
+
+# Passed to Google Benchmark binaries so each workload runs long enough to be
+# sampled meaningfully without making the harness take all day.
+BENCHMARK_ARGS = ["--benchmark_min_time=1"]
+
+
+def run_perf_record(workload_path, perf_data, use_lbr, extra_args):
+    """Samples one workload with perf, writing raw samples to 'perf_data'.
+
+    Returns True if sampling succeeded. LBR (branch stack) sampling is needed
+    for high-fidelity BOLT profiles but is unsupported on some hardware and in
+    most VMs, so on failure the workload is retried without it.
+    """
+    cmd = ["perf", "record", "-o", perf_data, "--freq", "999", "-e", "cycles:u"]
+    if use_lbr:
+        cmd += ["-j", "any,u"]
+    cmd += ["--", workload_path] + extra_args
+    result = subprocess.run(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+    if result.returncode != 0 and use_lbr:
+        print(f"note: LBR sampling failed for {workload_path}; retrying without branch stacks")
+        return run_perf_record(workload_path, perf_data, False, extra_args)
+    if result.returncode != 0:
+        sys.stderr.write(result.stderr.decode(errors="replace"))
+        return False
+    return True
+
+
+def count_samples(perf_data):
+    """Returns a Counter of mangled symbol name -> sample count for one perf.data."""
+    result = subprocess.run(
+        ["perf", "script", "-i", perf_data, "--no-demangle", "-F", "ip,sym"],
+        stdout=subprocess.PIPE,
+        stderr=subprocess.DEVNULL,
+        check=True,
+    )
+    counts = Counter()
+    for line in result.stdout.decode(errors="replace").splitlines():
+        fields = line.split()
+        if len(fields) < 2:
+            continue
+        symbol = fields[1]
+        # Skip addresses perf could not symbolize and PLT thunks, neither of
+        # which a symbol ordering file can place.
+        if symbol.startswith("[") or symbol.startswith("0x") or "@plt" in symbol:
+            continue
+        counts[symbol] += 1
+    return counts
+
+
+def emit_bolt_profile(perf_data_files, binary, output):
+    """Converts raw perf data to a BOLT .fdata profile, if perf2bolt is available."""
+    if shutil.which("perf2bolt") is None:
+        print("note: perf2bolt not found; skipping BOLT profile")
+        return
+    fdata_files = []
+    for perf_data in perf_data_files:
+        fdata = perf_data + ".fdata"
+        subprocess.run(["perf2bolt", "-p", perf_data, "-o", fdata, binary], check=True)
+        fdata_files.append(fdata)
+    if shutil.which("merge-fdata") is not None and len(fdata_files) > 1:
+        with open(output, "wb") as merged:
+            subprocess.run(["merge-fdata"] + fdata_files, stdout=merged, check=True)
+    else:
+        # Without merge-fdata, BOLT itself can be given the per-workload files.
+        for idx, fdata in enumerate(fdata_files):
+            shutil.copyfile(fdata, f"{output}.{idx}")
+    print(f"wrote BOLT profile(s) at {output}")
+
+
+def emit_propeller_profile(perf_data_files, binary, output):
+    """Converts raw perf data to a Propeller profile, if create_llvm_prof is available."""
+    if shutil.which("create_llvm_prof") is None:
+        print("note: create_llvm_prof not found; skipping Propeller profile")
+        return
+    for idx, perf_data in enumerate(perf_data_files):
+        suffix = "" if len(perf_data_files) == 1 else f".{idx}"
+        subprocess.run(
+            [
+                "create_llvm_prof",
+                "--format=propeller",
+                f"--profile={perf_data}",
+                f"--binary={binary}",
+                f"--out={output}{suffix}",
+            ],
+            check=True,
+        )
+    print(f"wrote Propeller profile(s) at {output}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--build-dir", required=True,
+                        help="Directory containing the built workload binaries")
+    parser.add_argument("--output", default="symbols.orderfile",
+                        help="Path of the orderfile to write (default: %(default)s)")
+    parser.add_argument("--workload", action="append", dest="workloads", metavar="NAME_OR_PATH",
+                        help="Workload binary to sample; may be repeated. Relative names are "
+                             "resolved against --build-dir. Defaults to the representative "
+                             "benchmark mix.")
+    parser.add_argument("--workload-args", default=None,
+                        help="Arguments passed to each workload instead of the Google Benchmark "
+                             "defaults")
+    parser.add_argument("--bolt-output", default=None, metavar="FDATA",
+                        help="Also emit a BOLT-compatible profile for the binary given by "
+                             "--layout-binary")
+    parser.add_argument("--propeller-output", default=None, metavar="PROF",
+                        help="Also emit a Propeller-compatible profile for the binary given by "
+                             "--layout-binary")
+    parser.add_argument("--layout-binary", default=None,
+                        help="Binary the BOLT/Propeller profiles describe (e.g. the mongod the "
+                             "workloads link the same code into)")
+    parser.add_argument("--min-samples", type=int, default=2,
+                        help="Drop symbols with fewer total samples than this (default: "
+                             "%(default)s), keeping one-off noise out of the hot ordering")
+    args = parser.parse_args()
+
+    if (args.bolt_output or args.propeller_output) and not args.layout_binary:
+        parser.error("--bolt-output/--propeller-output require --layout-binary")
+
+    workloads = args.workloads or DEFAULT_WORKLOADS
+    workload_args = args.workload_args.split() if args.workload_args else BENCHMARK_ARGS
+    use_lbr = args.bolt_output is not None
+
+    totals = Counter()
+    perf_data_files = []
+    with tempfile.TemporaryDirectory(prefix="orderfile_prof_") as tmp_dir:
+        for workload in workloads:
+            workload_path = workload if os.path.isabs(workload) else os.path.join(
+                args.build_dir, workload)
+            if not os.path.exists(workload_path):
+                sys.exit(f"error: workload binary not found: {workload_path}")
+            perf_data = os.path.join(tmp_dir, os.path.basename(workload) + ".perf.data")
+            print(f"sampling {workload_path}")
+            if not run_perf_record(workload_path, perf_data, use_lbr, workload_args):
+                sys.exit(f"error: perf record failed for {workload_path}")
+            perf_data_files.append(perf_data)
+            totals += count_samples(perf_data)
+
+        if args.bolt_output:
+            emit_bolt_profile(perf_data_files, args.layout_binary, args.bolt_output)
+        if args.propeller_output:
+            emit_propeller_profile(perf_data_files, args.layout_binary, args.propeller_output)
+
+    ordered = [sym for sym, count in totals.most_common() if count >= args.min_samples]
+    if not ordered:
+        sys.exit("error: no symbolized samples collected; are the workload binaries stripped?")
+
+    with open(args.output, "w") as orderfile:
+        for symbol in ordered:
+            orderfile.write(symbol + "\n")
+    print(f"wrote {len(ordered)} symbols to {args.output} "
+          f"({sum(totals.values())} samples across {len(workloads)} workloads)")
+
+
+if __name__ == "__main__":
+    main()
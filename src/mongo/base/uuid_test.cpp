@@ -32,6 +32,7 @@
 #include <utility>
 
 #include <absl/container/node_hash_map.h>
+#include <absl/hash/hash.h>
 
 #include "mongo/base/data_range.h"
 #include "mongo/base/error_codes.h"
@@ -204,13 +205,13 @@ TEST(UUIDTest, toBSONUsingBSONMacro) {
 }
 
 TEST(UUIDTest, allBitsFlipForHashes) {
-    // The Hash function is generated using bytes from the UUID itself, which are already randomly
-    // generated (except for two bytes, which are set to the same value for all UUIDs). This test
-    // ensures that each bit of the generated hashes is set and unset at least once.
+    // The Hash function hashes all bytes of the UUID, which are already randomly generated (except
+    // for two bytes, which are set to the same value for all UUIDs). This test ensures that each
+    // bit of the generated hashes is set and unset at least once.
     UUID::Hash hashGenerator = UUID::Hash{};
     auto startingHash = hashGenerator(UUID::gen());
     size_t accumulator = 0;
-    size_t target = std::numeric_limits<uint32_t>::max();
+    size_t target = std::numeric_limits<size_t>::max();
 
     // Running this test locally usually results in the loop terminating after about 7-10
     // iterations, maxIterations is set to be about 50x this amount to give some wiggle room for
@@ -232,7 +233,7 @@ TEST(UUIDTest, UUIDConsistentHash) {
 
     // Note this may fail in the future if the hash is changed, but this test will serve as a
     // safeguard to signal that the behavior has changed.
-    ASSERT_EQUALS(uuid.toCDR().read<BigEndian<uint32_t>>(), hash);
+    ASSERT_EQUALS(absl::Hash<UUID>{}(uuid), hash);
 }
 
 }  // namespace
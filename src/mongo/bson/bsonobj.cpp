@@ -359,6 +359,9 @@ std::string BSONObj::jsonString(JsonStringFormat format,
                                 size_t writeLimit,
                                 BSONObj* outTruncationResult) const {
     fmt::memory_buffer buffer;
+    // Size the output once up front: JSON text typically runs somewhat larger than the BSON it
+    // was generated from, and large documents otherwise pay for repeated buffer doubling.
+    buffer.reserve(static_cast<size_t>(objsize()) + static_cast<size_t>(objsize()) / 2);
     BSONObj truncation = jsonStringBuffer(format, pretty, isArray, buffer);
     if (outTruncationResult) {
         *outTruncationResult = truncation;
@@ -396,6 +399,12 @@ int BSONObj::woCompare(const BSONObj& r,
     if (r.isEmpty())
         return 1;
 
+    // Byte-identical objects are equal under any ordering, rules or string comparator. Sort-heavy
+    // workloads over homogeneous collections compare many duplicate keys, and this skips the
+    // element-wise re-parse for all of them.
+    if (objsize() == r.objsize() && memcmp(objdata(), r.objdata(), objsize()) == 0)
+        return 0;
+
     BSONObjIterator i(*this);
     BSONObjIterator j(r);
     unsigned mask = 1;
@@ -427,6 +436,10 @@ int BSONObj::woCompare(const BSONObj& r,
                        const BSONObj& idxKey,
                        ComparisonRulesSet rules,
                        const StringDataComparator* comparator) const {
+    // See the Ordering-based overload above: identical bytes always compare equal.
+    if (objsize() == r.objsize() && memcmp(objdata(), r.objdata(), objsize()) == 0)
+        return 0;
+
     return (rules & ComparisonRules::kIgnoreFieldOrder)
         ? compareObjects<BSONObjIteratorSorted>(*this, r, idxKey, rules, comparator)
         : compareObjects<BSONObjIterator>(*this, r, idxKey, rules, comparator);
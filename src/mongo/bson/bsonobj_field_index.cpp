@@ -0,0 +1,69 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/bson/bsonobj_field_index.h"
+
+#include "mongo/bson/bsonobjiterator.h"
+
+namespace mongo {
+
+BSONElement BSONObjFieldIndex::getField(StringData name) const {
+    if (!_built) {
+        // Answer from the linear scan while it is still cheap. Count the fields as we go so the
+        // table is only built once a lookup actually pays for a long scan.
+        uint32_t fieldsScanned = 0;
+        BSONObjIterator it(_obj);
+        while (it.more() && fieldsScanned < kMinFieldsToIndex) {
+            BSONElement e = it.next();
+            if (e.fieldNameStringData() == name)
+                return e;
+            ++fieldsScanned;
+        }
+        if (!it.more())
+            return BSONElement();
+        _build();
+    }
+
+    auto entry = _offsets.find(name);
+    if (entry == _offsets.end())
+        return BSONElement();
+    return BSONElement(_obj.objdata() + entry->second);
+}
+
+void BSONObjFieldIndex::_build() const {
+    for (auto&& e : _obj) {
+        // try_emplace keeps the first occurrence of a duplicate field name, matching the
+        // first-wins behavior of BSONObj::getField().
+        _offsets.try_emplace(e.fieldNameStringData(),
+                             static_cast<uint32_t>(e.rawdata() - _obj.objdata()));
+    }
+    _built = true;
+}
+
+}  // namespace mongo
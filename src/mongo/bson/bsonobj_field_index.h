@@ -0,0 +1,92 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+
+/**
+ * Accelerates repeated field lookups into a single BSONObj. BSONObj::getField() is a linear scan,
+ * which is the right tradeoff for one-shot lookups and small objects, but quadratic for callers
+ * that probe the same wide object many times (projection and update paths over documents with
+ * hundreds of top-level fields).
+ *
+ * The index is built lazily: lookups that hit within the first kMinFieldsToIndex fields are
+ * answered by the normal linear scan without paying for a side table. The first lookup that scans
+ * past that prefix builds a hash table from field name to element offset, after which getField()
+ * and hasField() are O(1).
+ *
+ * The field name keys point into the object's buffer, so this class keeps its own reference to
+ * the BSONObj and must not outlive an unowned object's backing buffer — the same lifetime
+ * contract as the BSONObj itself.
+ */
+class BSONObjFieldIndex {
+public:
+    // Objects at most this wide never build a table; the plain scan is cheaper.
+    static constexpr uint32_t kMinFieldsToIndex = 8;
+
+    explicit BSONObjFieldIndex(BSONObj obj) : _obj(std::move(obj)) {}
+
+    /**
+     * Returns the element with the given field name, or an eoo() element if there is none. For
+     * duplicate field names the first occurrence wins, matching BSONObj::getField().
+     */
+    BSONElement getField(StringData name) const;
+
+    bool hasField(StringData name) const {
+        return !getField(name).eoo();
+    }
+
+    BSONElement operator[](StringData name) const {
+        return getField(name);
+    }
+
+    const BSONObj& obj() const {
+        return _obj;
+    }
+
+private:
+    void _build() const;
+
+    BSONObj _obj;
+
+    // Maps field name (pointing into _obj's buffer) to the element's offset from objdata().
+    // Populated by _build() on the first lookup that scans past kMinFieldsToIndex fields.
+    mutable StringDataMap<uint32_t> _offsets;
+    mutable bool _built = false;
+};
+
+}  // namespace mongo
@@ -0,0 +1,92 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/bson/bsonobj_field_index.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/unittest/framework.h"
+
+namespace {
+
+using namespace mongo;
+
+BSONObj makeWideObj(int numFields) {
+    BSONObjBuilder bob;
+    for (int i = 0; i < numFields; ++i) {
+        bob.append("field" + std::to_string(i), i);
+    }
+    return bob.obj();
+}
+
+TEST(BSONObjFieldIndex, SmallObjectLookups) {
+    auto obj = BSON("a" << 1 << "b"
+                        << "two"
+                        << "c" << 3.0);
+    BSONObjFieldIndex idx(obj);
+    ASSERT_EQ(idx.getField("a").numberInt(), 1);
+    ASSERT_EQ(idx.getField("c").numberDouble(), 3.0);
+    ASSERT_TRUE(idx.getField("missing").eoo());
+    ASSERT_TRUE(idx.hasField("b"));
+    ASSERT_FALSE(idx.hasField("d"));
+}
+
+TEST(BSONObjFieldIndex, WideObjectLookupsMatchLinearScan) {
+    const int kNumFields = 4 * BSONObjFieldIndex::kMinFieldsToIndex;
+    auto obj = makeWideObj(kNumFields);
+    BSONObjFieldIndex idx(obj);
+    for (int i = kNumFields - 1; i >= 0; --i) {
+        auto name = "field" + std::to_string(i);
+        ASSERT_EQ(idx.getField(name).numberInt(), obj.getField(name).numberInt());
+    }
+    ASSERT_TRUE(idx.getField("field" + std::to_string(kNumFields)).eoo());
+}
+
+TEST(BSONObjFieldIndex, RepeatedMissesStayMisses) {
+    auto obj = makeWideObj(3 * BSONObjFieldIndex::kMinFieldsToIndex);
+    BSONObjFieldIndex idx(obj);
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(idx.getField("nope").eoo());
+    }
+}
+
+TEST(BSONObjFieldIndex, DuplicateFieldNamesFirstOccurrenceWins) {
+    BSONObjBuilder bob;
+    for (int i = 0; i < static_cast<int>(2 * BSONObjFieldIndex::kMinFieldsToIndex); ++i) {
+        bob.append("field" + std::to_string(i), i);
+    }
+    bob.append("field1", 9999);  // Duplicate of an early field.
+    auto obj = bob.obj();
+
+    BSONObjFieldIndex idx(obj);
+    // Force the table to build with a long-scanning lookup, then check the duplicate.
+    ASSERT_FALSE(idx.hasField("missing"));
+    ASSERT_EQ(idx.getField("field1").numberInt(), obj.getField("field1").numberInt());
+}
+
+}  // namespace
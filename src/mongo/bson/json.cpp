@@ -43,11 +43,13 @@
 
 #include <boost/move/utility_core.hpp>
 
+#include "mongo/base/data_view.h"
 #include "mongo/base/error_codes.h"
 #include "mongo/base/parse_number.h"
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/bsontypes.h"
 #include "mongo/bson/timestamp.h"
+#include "mongo/platform/bits.h"
 #include "mongo/platform/decimal128.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/base64.h"
@@ -1340,6 +1342,47 @@ Status JParse::quotedString(std::string* result) {
     return Status::OK();
 }
 
+namespace {
+
+/**
+ * Returns the length of the prefix of [p, end) that contains no 'terminal' byte, no backslash and
+ * no control character, i.e. the run of string content that chars() below may copy verbatim.
+ * Scans a word at a time: string bodies dominate bulk JSON parsing, so this is its hottest loop.
+ */
+size_t plainCharsPrefix(const char* p, const char* end, char terminal) {
+    constexpr uint64_t kLowBits = 0x0101010101010101ull;
+    constexpr uint64_t kHighBits = 0x8080808080808080ull;
+    // Zero bytes in 'w' produce a set high bit in the classic SWAR zero-byte test.
+    auto zeroBytes = [&](uint64_t w) {
+        return (w - kLowBits) & ~w & kHighBits;
+    };
+    const uint64_t terminalPattern = kLowBits * static_cast<uint8_t>(terminal);
+    constexpr uint64_t kBackslashPattern = kLowBits * static_cast<uint8_t>('\\');
+
+    size_t len = 0;
+    while (p + len + sizeof(uint64_t) <= end) {
+        uint64_t word = ConstDataView(p + len).read<LittleEndian<uint64_t>>();
+        // A byte is special if it equals the terminal or a backslash (zero after xor), or is a
+        // control character. The latter uses the SWAR unsigned 'byte < 0x20' test: setting the
+        // high bit of each byte before subtracting keeps borrows from crossing byte lanes, and
+        // masking with ~word rejects bytes that had their high bit set to begin with.
+        uint64_t special = zeroBytes(word ^ terminalPattern) | zeroBytes(word ^ kBackslashPattern) |
+            (~((word | kHighBits) - kLowBits * 0x20) & ~word & kHighBits);
+        if (special)
+            return len + (countTrailingZerosNonZero64(special) >> 3);
+        len += sizeof(uint64_t);
+    }
+    while (p + len < end) {
+        uint8_t c = static_cast<uint8_t>(p[len]);
+        if (c == static_cast<uint8_t>(terminal) || c == '\\' || c < 0x20)
+            break;
+        ++len;
+    }
+    return len;
+}
+
+}  // namespace
+
 /*
  * terminalSet are characters that signal end of string (e.g.) [ :\0]
  * allowedSet are the characters that are allowed, if this is set
@@ -1350,8 +1393,20 @@ Status JParse::chars(std::string* result, const char* terminalSet, const char* a
         return parseError("Unexpected end of input");
     }
     const char* q = _input;
+    // For quoted strings (a single terminal character and no allowed-set filtering), bulk-copy
+    // runs of ordinary characters and only fall into the per-character loop for escapes,
+    // terminals and control characters.
+    const bool bulkCopyable =
+        allowedSet == nullptr && terminalSet[0] != '\0' && terminalSet[1] == '\0';
     while (q < _input_end && !match(*q, terminalSet)) {
         MONGO_JSON_DEBUG("q: " << q);
+        if (bulkCopyable) {
+            if (size_t run = plainCharsPrefix(q, _input_end, terminalSet[0])) {
+                result->append(q, run);
+                q += run;
+                continue;
+            }
+        }
         if (allowedSet != nullptr) {
             if (!match(*q, allowedSet)) {
                 _input = q;
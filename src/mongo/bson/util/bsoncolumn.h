@@ -478,6 +478,121 @@ private:
     Element _last = CMaterializer::materializeMissing(*_allocator);
 };
 
+/**
+ * Implements Appendable for columns known to contain a single scalar type, writing decoded values
+ * straight into a caller-provided contiguous buffer. No BSONElement is materialized and no
+ * ElementStorage allocation takes place. Any value of another type, any missing value, and any
+ * interleaved (object) data fails the decode with an exception.
+ *
+ * T must be one of double, int64_t or Timestamp; these are the scalar types stored by
+ * time-series measurements that profit from allocation-free decodes.
+ */
+template <typename T>
+class ScalarSpanBuffer {
+public:
+    static constexpr bool kCollectsPositionInfo = false;
+
+    explicit ScalarSpanBuffer(std::span<T> out) : _out(out) {}
+
+    void eof() {}
+
+    void append(T val) {
+        _push(val);
+    }
+
+    template <typename U>
+    void append(U&&) {
+        uasserted(10968401, "BSONColumn does not contain the requested scalar type");
+    }
+
+    template <typename U>
+    void append(const BSONElement& val) {
+        if constexpr (std::is_same_v<U, T>) {
+            _push(_extract(val));
+        } else {
+            uasserted(10968402, "BSONColumn does not contain the requested scalar type");
+        }
+    }
+
+    void appendPreallocated(const BSONElement& val) {
+        _push(_extract(val));
+    }
+
+    void appendMissing() {
+        uasserted(10968403, "BSONColumn contains missing values");
+    }
+
+    void appendLast() {
+        uassert(10968404, "BSONColumn contains missing values", _lastValid);
+        _push(_last);
+    }
+
+    bool isLastMissing() {
+        return !_lastValid;
+    }
+
+    template <typename U>
+    void setLast(const BSONElement& val) {
+        if constexpr (std::is_same_v<U, T>) {
+            if (!val.eoo()) {
+                _last = _extract(val);
+                _lastValid = true;
+                return;
+            }
+        }
+        _lastValid = false;
+    }
+
+    void appendPositionInfo(int32_t n) {}
+
+    ElementStorage& getAllocator() {
+        // Only interleaved (object) data needs element storage, which a single-scalar-type
+        // column cannot contain.
+        uasserted(10968405, "BSONColumn does not contain the requested scalar type");
+    }
+
+    /**
+     * Number of values written to the output span so far.
+     */
+    size_t size() const {
+        return _pos;
+    }
+
+private:
+    static T _extract(const BSONElement& elem) {
+        if constexpr (std::is_same_v<T, double>) {
+            uassert(10968406,
+                    "BSONColumn does not contain the requested scalar type",
+                    elem.type() == NumberDouble);
+            return elem.Double();
+        } else if constexpr (std::is_same_v<T, int64_t>) {
+            uassert(10968407,
+                    "BSONColumn does not contain the requested scalar type",
+                    elem.type() == NumberLong);
+            return elem.Long();
+        } else {
+            static_assert(std::is_same_v<T, Timestamp>,
+                          "unsupported scalar type for span-based BSONColumn decompression");
+            uassert(10968408,
+                    "BSONColumn does not contain the requested scalar type",
+                    elem.type() == bsonTimestamp);
+            return elem.timestamp();
+        }
+    }
+
+    void _push(T val) {
+        uassert(10968409, "Output span too small for BSONColumn decompression", _pos < _out.size());
+        _out[_pos++] = val;
+        _last = val;
+        _lastValid = true;
+    }
+
+    std::span<T> _out;
+    size_t _pos = 0;
+    T _last{};
+    bool _lastValid = false;
+};
+
 class BSONColumnBlockBased {
 
 public:
@@ -511,6 +626,21 @@ public:
     void decompress(boost::intrusive_ptr<ElementStorage> allocator,
                     std::span<std::pair<Path, Container&>> paths) const;
 
+    /**
+     * Decompresses the entire column directly into the caller-provided contiguous buffer,
+     * bypassing BSONElement materialization. Returns the number of values written.
+     *
+     * T must be one of double, int64_t or Timestamp, and every value in the column must be
+     * present and of the matching BSON type; throws otherwise, as it does when 'out' is too
+     * small to hold the whole column.
+     */
+    template <typename T>
+    size_t decompressAllTo(std::span<T> out) const {
+        ScalarSpanBuffer<T> buffer(out);
+        decompress(buffer);
+        return buffer.size();
+    }
+
     /*
      * Decompress entire BSONColumn using the iteration-based implementation. This is used for
      * testing and production uses should eventually be replaced.
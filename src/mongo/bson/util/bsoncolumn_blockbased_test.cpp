@@ -1010,6 +1010,81 @@ TEST_F(BSONColumnBlockBasedTest, DecompressMissingPathWithMinKey) {
     }
 }
 
+TEST_F(BSONColumnBlockBasedTest, DecompressAllToDoubleSpan) {
+    BSONColumnBuilder cb;
+    std::vector<double> values;
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(i * 1.25);
+        cb.append(BSON("0" << values.back()).firstElement());
+    }
+
+    BSONColumnBlockBased col{cb.finalize()};
+    std::vector<double> out(values.size());
+    ASSERT_EQ(col.decompressAllTo(std::span<double>(out)), values.size());
+    ASSERT_EQ(out, values);
+}
+
+TEST_F(BSONColumnBlockBasedTest, DecompressAllToInt64Span) {
+    BSONColumnBuilder cb;
+    std::vector<int64_t> values;
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(static_cast<int64_t>(i) * 1000);
+        cb.append(BSON("0" << static_cast<long long>(values.back())).firstElement());
+    }
+
+    BSONColumnBlockBased col{cb.finalize()};
+    std::vector<int64_t> out(values.size());
+    ASSERT_EQ(col.decompressAllTo(std::span<int64_t>(out)), values.size());
+    ASSERT_EQ(out, values);
+}
+
+TEST_F(BSONColumnBlockBasedTest, DecompressAllToTimestampSpan) {
+    BSONColumnBuilder cb;
+    std::vector<Timestamp> values;
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(Timestamp(1700000000 + i, i));
+        cb.append(BSON("0" << values.back()).firstElement());
+    }
+
+    BSONColumnBlockBased col{cb.finalize()};
+    std::vector<Timestamp> out(values.size());
+    ASSERT_EQ(col.decompressAllTo(std::span<Timestamp>(out)), values.size());
+    ASSERT_EQ(out, values);
+}
+
+TEST_F(BSONColumnBlockBasedTest, DecompressAllToRejectsMismatchedType) {
+    BSONColumnBuilder cb;
+    for (int i = 0; i < 10; ++i) {
+        cb.append(BSON("0" << i * 1.0).firstElement());
+    }
+
+    BSONColumnBlockBased col{cb.finalize()};
+    std::vector<int64_t> out(10);
+    ASSERT_THROWS(col.decompressAllTo(std::span<int64_t>(out)), DBException);
+}
+
+TEST_F(BSONColumnBlockBasedTest, DecompressAllToRejectsMissingValues) {
+    BSONColumnBuilder cb;
+    cb.append(BSON("0" << 1.0).firstElement());
+    cb.skip();
+    cb.append(BSON("0" << 2.0).firstElement());
+
+    BSONColumnBlockBased col{cb.finalize()};
+    std::vector<double> out(3);
+    ASSERT_THROWS(col.decompressAllTo(std::span<double>(out)), DBException);
+}
+
+TEST_F(BSONColumnBlockBasedTest, DecompressAllToRejectsShortOutputSpan) {
+    BSONColumnBuilder cb;
+    for (int i = 0; i < 10; ++i) {
+        cb.append(BSON("0" << i * 1.0).firstElement());
+    }
+
+    BSONColumnBlockBased col{cb.finalize()};
+    std::vector<double> out(5);
+    ASSERT_THROWS(col.decompressAllTo(std::span<double>(out)), DBException);
+}
+
 }  // namespace
 }  // namespace bsoncolumn
 }  // namespace mongo
@@ -37,6 +37,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <vector>
 
 #include "mongo/base/data_type_endian.h"
 #include "mongo/base/data_view.h"
@@ -400,6 +401,29 @@ T sum(const char* buffer, size_t size, uint64_t& prevNonRLE);
  */
 template <typename T>
 T prefixSum(const char* buffer, size_t size, T& prefix, uint64_t& prevNonRLE);
+
+/**
+ * Evaluates the inclusive range predicate ['low', 'high'] against the cumulative values (deltas
+ * applied on top of 'prefix') for multiple simple8b blocks in a buffer. Appends one entry per
+ * element to 'matches' in encoded order; missing elements never match. Blocks whose selector bit
+ * width proves that no contained value can reach the range are accounted for with a block sum and
+ * skipped without decoding individual slots, as are RLE blocks.
+ *
+ * 'prefix' should contain the value prior to the first delta and is updated to the last cumulative
+ * value. 'prevNonRLE' should be initialized to 'kSingleSkip' for the first buffer. If the caller
+ * filters multiple buffers both should be passed along between the calls. The block skipping
+ * assumes that the cumulative values do not overflow int64, which holds for any valid delta
+ * encoding of 64-bit values.
+ *
+ * Returns the number of elements appended to 'matches'.
+ */
+inline size_t filterInRange(const char* buffer,
+                            size_t size,
+                            int64_t& prefix,
+                            uint64_t& prevNonRLE,
+                            int64_t low,
+                            int64_t high,
+                            std::vector<bool>& matches);
 }  // namespace simple8b
 
 }  // namespace mongo
@@ -1189,6 +1189,94 @@ T decodeAndPrefixSum(uint64_t encoded, T& prefix, uint64_t* prevNonRLE) {
     return 0;
 }
 
+// Number of slots and largest possible delta magnitude per slot for each base selector. Zig-zag
+// encoding makes the representable delta range symmetric around zero so a single magnitude bounds
+// the values reachable within a block. Selectors 7 and 8 may carry extended encodings where the
+// count field shifts values far beyond the plain slot range, so they are marked non-skippable with
+// a count of 0 and always take the decode path. The RLE selector is handled separately.
+struct SelectorBlockBounds {
+    int8_t count = 0;
+    int64_t maxAbsDelta = 0;
+};
+static constexpr std::array<SelectorBlockBounds, 16> kSelectorBlockBounds = []() {
+    std::array<SelectorBlockBounds, 16> bounds{};
+    bounds[1] = {60, 0};
+    bounds[2] = {30, (1ll << 1) - 1};
+    bounds[3] = {20, (1ll << 2) - 1};
+    bounds[4] = {15, (1ll << 3) - 1};
+    bounds[5] = {12, (1ll << 4) - 1};
+    bounds[6] = {10, (1ll << 5) - 1};
+    bounds[9] = {6, (1ll << 9) - 1};
+    bounds[10] = {5, (1ll << 11) - 1};
+    bounds[11] = {4, (1ll << 14) - 1};
+    bounds[12] = {3, (1ll << 19) - 1};
+    bounds[13] = {2, (1ll << 29) - 1};
+    bounds[14] = {1, (1ll << 59) - 1};
+    return bounds;
+}();
+
+// Appends one match flag per element in a simple8b block to 'matches', skipping slot decoding when
+// the selector's delta bounds prove that no cumulative value in the block can fall inside
+// ['low', 'high']. Writes last encountered non-rle block in 'prevNonRLE'.
+inline size_t decodeAndFilterInRange(uint64_t encoded,
+                                     int64_t& prefix,
+                                     uint64_t* prevNonRLE,
+                                     int64_t low,
+                                     int64_t high,
+                                     std::vector<bool>& matches) {
+    auto selector = encoded & simple8b_internal::kBaseSelectorMask;
+
+    if (selector == simple8b_internal::kRleSelector) {
+        // The values of an RLE block form an arithmetic progression that is fully known without
+        // decoding any slots.
+        int64_t last = decodeLastSlot<int64_t>(*prevNonRLE);
+        size_t num = (((encoded >> 4) & 0xf) + 1) * simple8b_internal::kRleMultiplier;
+        if (last == kMissing) {
+            matches.insert(matches.end(), num, false);
+            return num;
+        }
+
+        int128_t first = static_cast<int128_t>(prefix) + last;
+        int128_t final = static_cast<int128_t>(prefix) + static_cast<int128_t>(last) * num;
+        int128_t lo = first < final ? first : final;
+        int128_t hi = first < final ? final : first;
+        if (hi < static_cast<int128_t>(low) || lo > static_cast<int128_t>(high)) {
+            matches.insert(matches.end(), num, false);
+            prefix = add(prefix, last * num);
+            return num;
+        }
+
+        for (size_t i = 0; i < num; ++i) {
+            prefix = add(prefix, last);
+            matches.push_back(prefix >= low && prefix <= high);
+        }
+        return num;
+    }
+
+    const auto& bounds = kSelectorBlockBounds[selector];
+    if (bounds.count > 0) {
+        // No slot can move the cumulative value by more than 'maxAbsDelta', so the whole block
+        // stays within 'reach' of the incoming prefix.
+        int128_t reach = static_cast<int128_t>(bounds.maxAbsDelta) * bounds.count;
+        if (static_cast<int128_t>(prefix) + reach < static_cast<int128_t>(low) ||
+            static_cast<int128_t>(prefix) - reach > static_cast<int128_t>(high)) {
+            prefix = add(prefix, decodeAndSum<int64_t>(encoded, prevNonRLE));
+            matches.insert(matches.end(), bounds.count, false);
+            return bounds.count;
+        }
+    }
+
+    return decodeAndVisit<int64_t>(
+        encoded,
+        prevNonRLE,
+        [&](int64_t v) {
+            prefix = add(prefix, v);
+            matches.push_back(prefix >= low && prefix <= high);
+        },
+        [&]() { matches.push_back(prefix >= low && prefix <= high); },
+        [&]() { matches.push_back(false); });
+}
+
 }  // namespace
 
 template <typename T, typename Visit, typename VisitZero, typename VisitMissing>
@@ -1247,4 +1335,22 @@ T prefixSum(const char* buffer, size_t size, T& prefix, uint64_t& prevNonRLE) {
     return sum;
 }
 
+inline size_t filterInRange(const char* buffer,
+                            size_t size,
+                            int64_t& prefix,
+                            uint64_t& prevNonRLE,
+                            int64_t low,
+                            int64_t high,
+                            std::vector<bool>& matches) {
+    invariant(size % 8 == 0);
+    const char* end = buffer + size;
+    size_t numElements = 0;
+    while (buffer != end) {
+        uint64_t encoded = ConstDataView(buffer).read<LittleEndian<uint64_t>>();
+        numElements += decodeAndFilterInRange(encoded, prefix, &prevNonRLE, low, high, matches);
+        buffer += sizeof(uint64_t);
+    }
+    return numElements;
+}
+
 }  // namespace mongo::simple8b
@@ -563,16 +563,26 @@ uint64_t Simple8bBuilder<T, Allocator>::_encode(Func func,
     uint8_t integersCoded = kIntsStoreForSelector[extensionType][selectorIdx];
     uint64_t unshiftedMask = kDecodeMask[extensionType][selectorIdx];
     uint8_t bitsForTrailingZeros = kTrailingZeroBitSize[extensionType];
-    for (uint8_t i = 0; i < integersCoded; ++i) {
-        uint8_t shiftSize =
-            (bitsPerInteger + bitsForTrailingZeros) * i + kSelectorBits + bitShiftExtension;
-        uint64_t currEncodedWord;
-        if (_pendingValues[i].isSkip()) {
-            currEncodedWord = unshiftedMask;
-        } else {
-            currEncodedWord = func(_pendingValues[i]);
+    const uint8_t bitsPerSlot = bitsPerInteger + bitsForTrailingZeros;
+    uint8_t shiftSize = kSelectorBits + bitShiftExtension;
+    // Encoding is this builder's hottest loop, so keep the common all-values case free of the
+    // per-slot skip branch and accumulate the shift instead of multiplying per slot.
+    if (std::none_of(_pendingValues.begin(),
+                     _pendingValues.begin() + integersCoded,
+                     [](const PendingValue& v) { return v.isSkip(); })) {
+        for (uint8_t i = 0; i < integersCoded; ++i, shiftSize += bitsPerSlot) {
+            encodedWord |= func(_pendingValues[i]) << shiftSize;
+        }
+    } else {
+        for (uint8_t i = 0; i < integersCoded; ++i, shiftSize += bitsPerSlot) {
+            uint64_t currEncodedWord;
+            if (_pendingValues[i].isSkip()) {
+                currEncodedWord = unshiftedMask;
+            } else {
+                currEncodedWord = func(_pendingValues[i]);
+            }
+            encodedWord |= currEncodedWord << shiftSize;
         }
-        encodedWord |= currEncodedWord << shiftSize;
     }
     if (extensionType != kBaseSelector) {
         encodedWord |= (uint64_t(selectorIdx) << kSelectorBits);
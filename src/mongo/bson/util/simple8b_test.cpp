@@ -175,6 +175,68 @@ void testSimple8b(const std::vector<boost::optional<T>>& expectedValues,
         else
             ASSERT_EQ(boost::none, decodedValues[i]);
     }
+
+    // Test filterInRange against a naively computed selection over the cumulative values. Ranges
+    // are chosen below so that both the block-skipping and the decoding paths are exercised.
+    if constexpr (std::is_same_v<make_signed_t<T>, int64_t>) {
+        auto testFilterInRange = [&](int64_t low, int64_t high) {
+            std::vector<bool> expectedMatches;
+            int64_t value = 0;
+            for (auto&& val : expectedValues) {
+                if (val) {
+                    value = add(value, Simple8bTypeUtil::decodeInt(*val));
+                    expectedMatches.push_back(value >= low && value <= high);
+                } else {
+                    expectedMatches.push_back(false);
+                }
+            }
+
+            int64_t prefix = 0;
+            uint64_t prev = 0xE;  // Tests in this file assume that the previous value was '0'.
+                                  // This is different semantics from BSONColumn.
+            std::vector<bool> matches;
+            size_t numFiltered =
+                simple8b::filterInRange(reinterpret_cast<const char*>(expectedBinary.data()),
+                                        expectedBinary.size(),
+                                        prefix,
+                                        prev,
+                                        low,
+                                        high,
+                                        matches);
+            ASSERT_EQ(expectedValues.size(), numFiltered);
+            ASSERT_EQ(expectedMatches.size(), matches.size());
+            for (size_t i = 0; i < matches.size(); ++i) {
+                ASSERT_EQ(expectedMatches[i], matches[i]);
+            }
+            // Skipped blocks must still advance the prefix by their sum.
+            ASSERT_EQ(value, prefix);
+        };
+
+        int64_t minValue = std::numeric_limits<int64_t>::max();
+        int64_t maxValue = std::numeric_limits<int64_t>::min();
+        int64_t value = 0;
+        for (auto&& val : expectedValues) {
+            if (val) {
+                value = add(value, Simple8bTypeUtil::decodeInt(*val));
+                if (value < minValue)
+                    minValue = value;
+                if (value > maxValue)
+                    maxValue = value;
+            }
+        }
+
+        // Ranges covering all values, only the smallest value, and no values at all.
+        testFilterInRange(std::numeric_limits<int64_t>::min(),
+                          std::numeric_limits<int64_t>::max());
+        testFilterInRange(minValue, maxValue);
+        testFilterInRange(minValue, minValue);
+        if (maxValue < std::numeric_limits<int64_t>::max()) {
+            testFilterInRange(maxValue + 1, std::numeric_limits<int64_t>::max());
+        }
+        if (minValue > std::numeric_limits<int64_t>::min()) {
+            testFilterInRange(std::numeric_limits<int64_t>::min(), minValue - 1);
+        }
+    }
 }
 
 template <typename T>
@@ -1450,6 +1512,50 @@ TEST(Simple8b, RLELargeCount) {
     testSimple8b(expectedInts, expectedBinary);
 }
 
+TEST(Simple8b, FilterInRangeAcrossBuffers) {
+    // Values with large deltas so that multiple simple8b blocks are produced, with cumulative
+    // values stepping far enough that a narrow range is provably unreachable for some blocks.
+    std::vector<boost::optional<uint64_t>> values;
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(Simple8bTypeUtil::encodeInt64(1000));
+    }
+
+    auto [buffer, size] = buildSimple8b(values);
+    ASSERT_GT(size, 8);
+
+    // Filtering the buffer in one call and in two calls with carried-over state must produce the
+    // same selection. Split at an 8-byte boundary roughly in the middle.
+    int64_t low = 10'000;
+    int64_t high = 20'000;
+
+    int64_t prefix = 0;
+    uint64_t prev = 0xE;
+    std::vector<bool> expectedMatches;
+    size_t total =
+        simple8b::filterInRange(buffer.get(), size, prefix, prev, low, high, expectedMatches);
+    ASSERT_EQ(total, values.size());
+
+    size_t split = (size / 2) & ~size_t{7};
+    prefix = 0;
+    prev = 0xE;
+    std::vector<bool> matches;
+    size_t first = simple8b::filterInRange(buffer.get(), split, prefix, prev, low, high, matches);
+    size_t second = simple8b::filterInRange(
+        buffer.get() + split, size - split, prefix, prev, low, high, matches);
+    ASSERT_EQ(first + second, total);
+    ASSERT_EQ(expectedMatches.size(), matches.size());
+    for (size_t i = 0; i < matches.size(); ++i) {
+        ASSERT_EQ(expectedMatches[i], matches[i]);
+    }
+
+    // Values are 1000, 2000, ..., 100000 so exactly values 10000..20000 match.
+    size_t numMatches = 0;
+    for (auto&& m : expectedMatches) {
+        numMatches += m;
+    }
+    ASSERT_EQ(numMatches, 11);
+}
+
 TEST(Simple8b, ValueTooLarge) {
     // This value needs 61 bits which it too large for Simple8b
     uint64_t value = 0x1FFFFFFFFFFFFFFF;
@@ -187,6 +187,15 @@ public:
         return _serverAddress;
     }
 
+    /**
+     * Sends 'toSend' without waiting for the reply. A caller may issue several say() calls
+     * before collecting the replies with recv(), which matches each reply to its request via
+     * the responseTo header field. This is the extent of request pipelining this client
+     * supports: replies must be collected in request order on the same thread. Callers that
+     * need many concurrent requests per connection should use the async egress path
+     * (executor::ConnectionPool over the task executors) rather than holding one of these
+     * connections per outstanding command.
+     */
     void say(Message& toSend, bool isRetry = false, std::string* actualServer = nullptr) override;
     Message recv(int lastRequestId) override;
 
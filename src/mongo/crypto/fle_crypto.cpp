@@ -2891,7 +2891,7 @@ std::vector<std::vector<FLEEdgeCountInfo>> ESCCollection::getTags(
             }
         }
 
-        countInfoSets.emplace_back(countInfos);
+        countInfoSets.emplace_back(std::move(countInfos));
     }
 
     return countInfoSets;
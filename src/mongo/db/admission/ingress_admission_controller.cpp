@@ -33,6 +33,7 @@
 
 #include "mongo/db/admission/ingress_admission_context.h"
 #include "mongo/db/admission/ingress_admission_control_gen.h"
+#include "mongo/db/curop.h"
 #include "mongo/db/service_context.h"
 #include "mongo/util/decorable.h"
 
@@ -51,26 +52,53 @@ const ConstructorActionRegistererType<ServiceContext> onServiceContextCreate{
 IngressAdmissionController::IngressAdmissionController() {}
 
 void IngressAdmissionController::init() {
-    _ticketHolder =
-        std::make_unique<SemaphoreTicketHolder>(&getIngressAdmissionController.owner(*this),
-                                                gIngressAdmissionControllerTicketPoolSize.load(),
-                                                false,
-                                                SemaphoreTicketHolder::ResizePolicy::kImmediate);
+    auto makePool = [&](int32_t size) {
+        return std::make_unique<SemaphoreTicketHolder>(
+            &getIngressAdmissionController.owner(*this),
+            size,
+            false,
+            SemaphoreTicketHolder::ResizePolicy::kImmediate);
+    };
+    _ticketHolder = makePool(gIngressAdmissionControllerTicketPoolSize.load());
+    _readTicketHolder = makePool(gIngressAdmissionControllerReadTicketPoolSize.load());
+    _writeTicketHolder = makePool(gIngressAdmissionControllerWriteTicketPoolSize.load());
 }
 
 IngressAdmissionController& IngressAdmissionController::get(OperationContext* opCtx) {
     return getIngressAdmissionController(opCtx->getServiceContext());
 }
 
+SemaphoreTicketHolder* IngressAdmissionController::_poolFor(OperationContext* opCtx) const {
+    switch (CurOp::get(opCtx)->getLogicalOp()) {
+        case LogicalOp::opQuery:
+        case LogicalOp::opGetMore:
+            if (gIngressAdmissionControllerReadTicketPoolSize.load() > 0) {
+                return _readTicketHolder.get();
+            }
+            break;
+        case LogicalOp::opInsert:
+        case LogicalOp::opUpdate:
+        case LogicalOp::opDelete:
+            if (gIngressAdmissionControllerWriteTicketPoolSize.load() > 0) {
+                return _writeTicketHolder.get();
+            }
+            break;
+        default:
+            break;
+    }
+    return _ticketHolder.get();
+}
+
 Ticket IngressAdmissionController::admitOperation(OperationContext* opCtx) {
     auto& admCtx = IngressAdmissionContext::get(opCtx);
+    auto* pool = _poolFor(opCtx);
 
     // Try to get the ticket without waiting
-    if (auto ticket = _ticketHolder->tryAcquire(&admCtx)) {
+    if (auto ticket = pool->tryAcquire(&admCtx)) {
         return std::move(*ticket);
     }
 
-    return _ticketHolder->waitForTicket(opCtx, &admCtx);
+    return pool->waitForTicket(opCtx, &admCtx);
 }
 
 void IngressAdmissionController::resizeTicketPool(OperationContext* opCtx, int32_t newSize) {
@@ -79,6 +107,14 @@ void IngressAdmissionController::resizeTicketPool(OperationContext* opCtx, int32
 
 void IngressAdmissionController::appendStats(BSONObjBuilder& b) const {
     _ticketHolder->appendStats(b);
+    if (gIngressAdmissionControllerReadTicketPoolSize.load() > 0) {
+        BSONObjBuilder sub(b.subobjStart("readClass"));
+        _readTicketHolder->appendStats(sub);
+    }
+    if (gIngressAdmissionControllerWriteTicketPoolSize.load() > 0) {
+        BSONObjBuilder sub(b.subobjStart("writeClass"));
+        _writeTicketHolder->appendStats(sub);
+    }
 }
 
 Status IngressAdmissionController::onUpdateTicketPoolSize(int32_t newValue) try {
@@ -93,4 +129,32 @@ Status IngressAdmissionController::onUpdateTicketPoolSize(int32_t newValue) try
     return ex.toStatus();
 }
 
+Status IngressAdmissionController::onUpdateReadTicketPoolSize(int32_t newValue) try {
+    if (auto client = Client::getCurrent()) {
+        auto opCtx = client->getOperationContext();
+        auto& controller = getIngressAdmissionController(client->getServiceContext());
+        uassert(9706400,
+                "Failed to resize read ticket pool",
+                controller._readTicketHolder->resize(opCtx, newValue));
+    }
+
+    return Status::OK();
+} catch (const DBException& ex) {
+    return ex.toStatus();
+}
+
+Status IngressAdmissionController::onUpdateWriteTicketPoolSize(int32_t newValue) try {
+    if (auto client = Client::getCurrent()) {
+        auto opCtx = client->getOperationContext();
+        auto& controller = getIngressAdmissionController(client->getServiceContext());
+        uassert(9706401,
+                "Failed to resize write ticket pool",
+                controller._writeTicketHolder->resize(opCtx, newValue));
+    }
+
+    return Status::OK();
+} catch (const DBException& ex) {
+    return ex.toStatus();
+}
+
 }  // namespace mongo
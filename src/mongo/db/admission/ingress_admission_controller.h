@@ -52,6 +52,11 @@ public:
      * acquired, or the operation is interrupted, in which case it throws an AssertionException.
      * Operations with kExempt admission priority will always acquire a ticket without waiting and
      * without reducing the number of available tickets.
+     *
+     * Reads and writes are admitted from their own ticket pools when the corresponding pool size
+     * server parameter is set, so that one class of operations queueing up cannot delay the other.
+     * All other operations, and all operations when the dedicated pools are disabled, share the
+     * main pool.
      */
     Ticket admitOperation(OperationContext* opCtx);
 
@@ -71,6 +76,13 @@ public:
      */
     static Status onUpdateTicketPoolSize(int newValue);
 
+    /**
+     * Called automatically when the values of the server parameters that control the sizes of the
+     * dedicated read and write ticket pools change.
+     */
+    static Status onUpdateReadTicketPoolSize(int newValue);
+    static Status onUpdateWriteTicketPoolSize(int newValue);
+
     /**
      * Initialize the IngressAdmissionController after the ServiceContext is constructed. This will
      * be called automatically during static initialization.
@@ -78,7 +90,15 @@ public:
     void init();
 
 private:
+    /**
+     * Returns the ticket pool the operation should be admitted from, based on its logical
+     * operation type and on which dedicated pools are enabled.
+     */
+    SemaphoreTicketHolder* _poolFor(OperationContext* opCtx) const;
+
     std::unique_ptr<SemaphoreTicketHolder> _ticketHolder{nullptr};
+    std::unique_ptr<SemaphoreTicketHolder> _readTicketHolder{nullptr};
+    std::unique_ptr<SemaphoreTicketHolder> _writeTicketHolder{nullptr};
 };
 
 }  // namespace mongo
@@ -136,6 +136,8 @@ void ThroughputProbing::_run(Client* client) {
         // Initialize on first iteration.
         if (_prevNumFinishedProcessing < 0) {
             _prevNumFinishedProcessing = numFinishedProcessing;
+            _prevTimeQueuedMicros =
+                _readTicketHolder->timeQueuedMicros() + _writeTicketHolder->timeQueuedMicros();
             _timer.reset();
             return;
         }
@@ -148,8 +150,23 @@ void ThroughputProbing::_run(Client* client) {
             return;
         }
 
-        auto throughput = (numFinishedProcessing - _prevNumFinishedProcessing) /
-            static_cast<double>(elapsed.count());
+        auto finished = numFinishedProcessing - _prevNumFinishedProcessing;
+        auto throughput = finished / static_cast<double>(elapsed.count());
+
+        // When a target queueing latency is configured, discount the throughput reading by how
+        // far the average time operations spent queued for a ticket exceeded the target over
+        // this interval. Probes are then compared on the discounted score, so a concurrency
+        // level that buys marginally more throughput at the cost of disproportionate queueing
+        // delay loses to one that keeps queue waits near the target.
+        if (auto targetMicros =
+                durationCount<Microseconds>(Milliseconds(gTargetQueueingLatencyMillis.load()));
+            targetMicros > 0 && finished > 0) {
+            auto timeQueuedMicros =
+                _readTicketHolder->timeQueuedMicros() + _writeTicketHolder->timeQueuedMicros();
+            auto avgQueuedMicros =
+                (timeQueuedMicros - _prevTimeQueuedMicros) / static_cast<double>(finished);
+            throughput /= 1 + (avgQueuedMicros / targetMicros);
+        }
 
         switch (_state) {
             case ProbingState::kStable:
@@ -167,6 +184,8 @@ void ThroughputProbing::_run(Client* client) {
         // cause-effect relationship.
         _prevNumFinishedProcessing = _readTicketHolder->numFinishedProcessing() +
             _writeTicketHolder->numFinishedProcessing();
+        _prevTimeQueuedMicros =
+            _readTicketHolder->timeQueuedMicros() + _writeTicketHolder->timeQueuedMicros();
         _timer.reset();
     } catch (const DBException& e) {
         LOGV2_WARNING(9999993, "Throughput Probing: shutting down", "error"_attr = e.toStatus());
@@ -100,6 +100,7 @@ private:
     Timer _timer;
 
     int64_t _prevNumFinishedProcessing = -1;
+    int64_t _prevTimeQueuedMicros = 0;
 
     struct Stats {
         void serialize(BSONObjBuilder& builder) const;
@@ -39,7 +39,9 @@
 #include "mongo/db/concurrency/lock_manager_defs.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/tenant_id.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/util/concurrency/ticketholder.h"
+#include "mongo/util/duration.h"
 
 namespace mongo {
 namespace admission {
@@ -84,6 +86,20 @@ public:
      */
     TicketHolder* getTicketHolder(LockMode mode);
 
+    /**
+     * The backoff low-priority readers observe before queueing for a ticket. Flow control's
+     * periodic job raises this on secondaries whose applied optime is trailing the majority
+     * commit point, so that eligible reads yield storage engine resources to the oplog applier;
+     * it is zero (no backoff) whenever the node is healthy.
+     */
+    void setLowPriorityReadsBackoff(Milliseconds backoff) {
+        _lowPriorityReadsBackoffMillis.store(durationCount<Milliseconds>(backoff));
+    }
+
+    Milliseconds lowPriorityReadsBackoff() const {
+        return Milliseconds(_lowPriorityReadsBackoffMillis.loadRelaxed());
+    }
+
     void appendStats(BSONObjBuilder& b);
 
     /**
@@ -106,6 +122,9 @@ protected:
      * Holds tickets for MODE_X/MODE_IX global lock requests.
      */
     std::unique_ptr<TicketHolder> _writeTicketHolder;
+
+private:
+    AtomicWord<int64_t> _lowPriorityReadsBackoffMillis{0};
 };
 
 class FixedTicketHolderManager : public TicketHolderManager {
@@ -870,6 +870,35 @@ bool AuthorizationSessionImpl::isAuthorizedForClusterActions(
 bool AuthorizationSessionImpl::_isAuthorizedForPrivilege(const Privilege& privilege) {
     _contract.addPrivilege(privilege);
 
+    // The outcome of a privilege check is a pure function of the authenticated user's
+    // privilege set, so results may be reused until that user changes. Every login, logout,
+    // and user refresh funnels through _updateInternalAuthorizationState(), which clears the
+    // cache. While the localhost exception is active the default privilege set varies with
+    // external state, so those results are never cached.
+    const bool cacheable =
+        _authenticatedUser != boost::none && !_externalState->shouldAllowLocalhost();
+    if (cacheable) {
+        for (const auto& entry : _privilegeCheckCache) {
+            if (entry.privilege.getResourcePattern() == privilege.getResourcePattern() &&
+                entry.privilege.getActions() == privilege.getActions()) {
+                return entry.authorized;
+            }
+        }
+    }
+
+    const bool authorized = _computeAuthorizedForPrivilege(privilege);
+
+    if (cacheable) {
+        if (_privilegeCheckCache.size() >= kMaxPrivilegeCheckCacheSize) {
+            _privilegeCheckCache.erase(_privilegeCheckCache.begin());
+        }
+        _privilegeCheckCache.push_back({privilege, authorized});
+    }
+
+    return authorized;
+}
+
+bool AuthorizationSessionImpl::_computeAuthorizedForPrivilege(const Privilege& privilege) {
     const auto& rp = privilege.getResourcePattern();
     auth::ResourcePatternSearchList search(rp);
     ActionSet unmetRequirements = privilege.getActions();
@@ -1081,6 +1110,10 @@ void AuthorizationSessionImpl::verifyContract(const AuthorizationContract* contr
 }
 
 void AuthorizationSessionImpl::_updateInternalAuthorizationState() {
+    // The memoized privilege check results are only valid for the user they were computed
+    // against; drop them whenever the authenticated user state changes.
+    _privilegeCheckCache.clear();
+
     // Update the authenticated role names vector to reflect current state.
     _authenticatedRoleNames.clear();
     if (_authenticatedUser == boost::none) {
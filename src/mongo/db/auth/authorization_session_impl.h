@@ -217,8 +217,15 @@ private:
     // Checks if this connection is authorized for the given Privilege, ignoring whether or not
     // we should even be doing authorization checks in general.  Note: this may acquire a read
     // lock on the admin database (to update out-of-date user privilege information).
+    // Memoizes its result in _privilegeCheckCache so that repeated checks against the same
+    // privilege (e.g. a stream of getMores over one cursor) avoid re-walking the user's
+    // privilege set.
     bool _isAuthorizedForPrivilege(const Privilege& privilege);
 
+    // Evaluates the given Privilege against the default and user-held privileges without
+    // consulting or populating _privilegeCheckCache.
+    bool _computeAuthorizedForPrivilege(const Privilege& privilege);
+
     std::tuple<std::shared_ptr<UserName>*, std::vector<RoleName>*> _getImpersonations() override {
         return std::make_tuple(&_impersonatedUserName, &_impersonatedRoleNames);
     }
@@ -247,6 +254,18 @@ private:
     // It is a union of ClusterResource and AnyResource permissions.
     ActionSet _nonTenantClusterActions;
 
+    // Memoized results of recent privilege checks for the current authenticated user.
+    // Sessions check a small number of distinct privileges repeatedly, so a short flat
+    // vector probed linearly beats a hashed container here (ActionSet has no hasher).
+    // Cleared by _updateInternalAuthorizationState() whenever the user state changes,
+    // and bypassed entirely while the localhost exception is active.
+    struct CachedPrivilegeCheck {
+        Privilege privilege;
+        bool authorized;
+    };
+    static constexpr size_t kMaxPrivilegeCheckCacheSize = 8;
+    std::vector<CachedPrivilegeCheck> _privilegeCheckCache;
+
     // The expiration time for this session, expressed as a Unix timestamp. After this time passes,
     // the session will be expired and requests will fail until the expiration time is refreshed.
     // If boost::none, then the session never expires (default behavior).
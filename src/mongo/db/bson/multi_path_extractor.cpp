@@ -0,0 +1,104 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/bson/multi_path_extractor.h"
+
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+namespace dotted_path_support {
+
+MultiPathExtractor::MultiPathExtractor(std::vector<std::string> paths)
+    : _paths(std::move(paths)) {
+    // Edge labels are StringData views into '_paths'; the vector must not be touched after this
+    // point or the views would dangle.
+    _nodes.emplace_back();
+    for (size_t i = 0; i < _paths.size(); ++i) {
+        size_t node = 0;
+        StringData remaining = _paths[i];
+        while (true) {
+            auto dot = remaining.find('.');
+            if (dot == std::string::npos) {
+                auto& terminal = _nodes[_getOrAddChild(node, remaining)];
+                dassert(terminal.outputIndex == -1);  // Paths must be distinct.
+                terminal.outputIndex = static_cast<int>(i);
+                break;
+            }
+
+            // A literal field named after the entire remaining dotted path also satisfies it,
+            // matching extractElementAtPath().
+            auto& literal = _nodes[_getOrAddChild(node, remaining)];
+            if (literal.outputIndex == -1) {
+                literal.outputIndex = static_cast<int>(i);
+            }
+
+            node = _getOrAddChild(node, remaining.substr(0, dot));
+            remaining = remaining.substr(dot + 1);
+        }
+    }
+}
+
+size_t MultiPathExtractor::_getOrAddChild(size_t parent, StringData label) {
+    auto [it, inserted] = _nodes[parent].children.try_emplace(label, _nodes.size());
+    if (inserted) {
+        // Note this may reallocate '_nodes', invalidating any Node references held by callers.
+        _nodes.emplace_back();
+    }
+    return it->second;
+}
+
+void MultiPathExtractor::extract(const BSONObj& obj, BSONElement* out) const {
+    for (size_t i = 0; i < _paths.size(); ++i) {
+        out[i] = BSONElement();
+    }
+    _extractInto(obj, 0, out);
+}
+
+void MultiPathExtractor::_extractInto(const BSONObj& obj,
+                                      size_t nodeIndex,
+                                      BSONElement* out) const {
+    const auto& children = _nodes[nodeIndex].children;
+    for (auto&& elem : obj) {
+        auto it = children.find(elem.fieldNameStringData());
+        if (it == children.end()) {
+            continue;
+        }
+
+        const auto& child = _nodes[it->second];
+        if (child.outputIndex >= 0 && out[child.outputIndex].eoo()) {
+            out[child.outputIndex] = elem;
+        }
+        if (!child.children.empty() && elem.type() == Object) {
+            _extractInto(elem.embeddedObject(), it->second, out);
+        }
+    }
+}
+
+}  // namespace dotted_path_support
+}  // namespace mongo
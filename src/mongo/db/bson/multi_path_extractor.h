@@ -0,0 +1,93 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+namespace dotted_path_support {
+
+/**
+ * Extracts several dotted paths from a document in a single traversal.
+ *
+ * Callers that need N paths out of the same document (shard keys, index key patterns,
+ * projections) today run N independent extractElementAtPath() walks. This class compiles the
+ * path set into a trie once, at construction, so each extraction is one pass over the document
+ * that fills all outputs.
+ *
+ * Path semantics match extractElementAtPath(): at every level a literal field whose name equals
+ * the entire remaining dotted path also satisfies it, and traversal descends through embedded
+ * objects only, not through arrays. The one divergence is for degenerate documents that contain
+ * both forms (e.g. {"a.b": 1, a: {b: 2}}): here the first satisfying element in document order
+ * wins, whereas extractElementAtPath() always prefers the literal field.
+ *
+ * Paths must be distinct. Construction is not cheap, so instances are meant to be built once per
+ * pattern and reused across many documents.
+ */
+class MultiPathExtractor {
+public:
+    explicit MultiPathExtractor(std::vector<std::string> paths);
+
+    size_t numPaths() const {
+        return _paths.size();
+    }
+
+    /**
+     * Walks 'obj' once and fills 'out[i]' with the element found at the i-th path, in the order
+     * the paths were given at construction, or with BSONElement() when a path has no match.
+     * 'out' must have room for numPaths() elements.
+     */
+    void extract(const BSONObj& obj, BSONElement* out) const;
+
+private:
+    struct Node {
+        // Maps a field name (a substring of one of the owned '_paths' strings) to the index of
+        // the child node in '_nodes'.
+        StringDataMap<size_t> children;
+
+        // Output slot filled when a matching element ends at this node, or -1.
+        int outputIndex = -1;
+    };
+
+    size_t _getOrAddChild(size_t parent, StringData label);
+    void _extractInto(const BSONObj& obj, size_t nodeIndex, BSONElement* out) const;
+
+    std::vector<std::string> _paths;  // Owns the storage behind all trie edge labels.
+    std::vector<Node> _nodes;
+};
+
+}  // namespace dotted_path_support
+}  // namespace mongo
@@ -0,0 +1,139 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/bson/multi_path_extractor.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+using dotted_path_support::MultiPathExtractor;
+
+TEST(MultiPathExtractor, ExtractsTopLevelFields) {
+    MultiPathExtractor extractor({"a", "c"});
+    BSONObj obj = BSON("a" << 1 << "b" << 2 << "c" << 3);
+
+    std::vector<BSONElement> out(extractor.numPaths());
+    extractor.extract(obj, out.data());
+
+    ASSERT_EQ(out[0].numberInt(), 1);
+    ASSERT_EQ(out[1].numberInt(), 3);
+}
+
+TEST(MultiPathExtractor, ExtractsNestedPathsSharingAPrefix) {
+    MultiPathExtractor extractor({"a.b", "a.c", "d"});
+    BSONObj obj = BSON("a" << BSON("b" << 1 << "c" << 2) << "d" << 3);
+
+    std::vector<BSONElement> out(extractor.numPaths());
+    extractor.extract(obj, out.data());
+
+    ASSERT_EQ(out[0].numberInt(), 1);
+    ASSERT_EQ(out[1].numberInt(), 2);
+    ASSERT_EQ(out[2].numberInt(), 3);
+}
+
+TEST(MultiPathExtractor, MatchesLiteralDottedFieldName) {
+    MultiPathExtractor extractor({"a.b"});
+    BSONObj obj = BSON("a.b" << 1);
+
+    std::vector<BSONElement> out(extractor.numPaths());
+    extractor.extract(obj, out.data());
+
+    ASSERT_EQ(out[0].numberInt(), 1);
+}
+
+TEST(MultiPathExtractor, MissingPathsYieldEoo) {
+    MultiPathExtractor extractor({"a", "x.y"});
+    BSONObj obj = BSON("a" << 1 << "x" << BSON("z" << 2));
+
+    std::vector<BSONElement> out(extractor.numPaths());
+    extractor.extract(obj, out.data());
+
+    ASSERT_EQ(out[0].numberInt(), 1);
+    ASSERT_TRUE(out[1].eoo());
+}
+
+TEST(MultiPathExtractor, DoesNotTraverseArrays) {
+    MultiPathExtractor extractor({"a.b"});
+    BSONObj obj = BSON("a" << BSON_ARRAY(BSON("b" << 1)));
+
+    std::vector<BSONElement> out(extractor.numPaths());
+    extractor.extract(obj, out.data());
+
+    ASSERT_TRUE(out[0].eoo());
+}
+
+TEST(MultiPathExtractor, PathThatIsAPrefixOfAnotherPath) {
+    MultiPathExtractor extractor({"a", "a.b"});
+    BSONObj obj = BSON("a" << BSON("b" << 1));
+
+    std::vector<BSONElement> out(extractor.numPaths());
+    extractor.extract(obj, out.data());
+
+    ASSERT_BSONOBJ_EQ(out[0].Obj(), BSON("b" << 1));
+    ASSERT_EQ(out[1].numberInt(), 1);
+}
+
+TEST(MultiPathExtractor, FirstElementInDocumentOrderWins) {
+    MultiPathExtractor extractor({"a"});
+    BSONObjBuilder bob;
+    bob.append("a", 1);
+    bob.append("a", 2);
+    BSONObj obj = bob.obj();
+
+    std::vector<BSONElement> out(extractor.numPaths());
+    extractor.extract(obj, out.data());
+
+    ASSERT_EQ(out[0].numberInt(), 1);
+}
+
+TEST(MultiPathExtractor, ReusableAcrossDocuments) {
+    MultiPathExtractor extractor({"a.b.c"});
+    std::vector<BSONElement> out(extractor.numPaths());
+
+    extractor.extract(BSON("a" << BSON("b" << BSON("c" << 1))), out.data());
+    ASSERT_EQ(out[0].numberInt(), 1);
+
+    extractor.extract(BSON("a" << BSON("b.c" << 2)), out.data());
+    ASSERT_EQ(out[0].numberInt(), 2);
+
+    extractor.extract(BSON("a" << 3), out.data());
+    ASSERT_TRUE(out[0].eoo());
+}
+
+}  // namespace
+}  // namespace mongo
@@ -33,12 +33,14 @@
 #include <memory>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
 
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/timestamp.h"
+#include "mongo/db/catalog/capped_collection_truncate_markers.h"
 #include "mongo/db/catalog/collection_options.h"
 #include "mongo/db/catalog/index_catalog.h"
 #include "mongo/db/concurrency/lock_manager_defs.h"
@@ -57,6 +59,7 @@
 #include "mongo/stdx/mutex.h"
 #include "mongo/util/assert_util_core.h"
 #include "mongo/util/decorable.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 namespace collection_internal {
@@ -103,6 +106,13 @@ struct CappedCollectionState {
     Mutex cappedFirstRecordMutex =
         MONGO_MAKE_LATCH("CappedCollectionState::cappedFirstRecordMutex");
     RecordId cappedFirstRecord;
+
+    // Truncate markers for collections whose cap is maintained by the capped truncation job
+    // rather than by inline deletes. Null until the job initialises them, and always null for
+    // collections that must delete inline. The mutex only guards the pointer; the markers object
+    // synchronises internally.
+    Mutex truncateMarkersMutex = MONGO_MAKE_LATCH("CappedCollectionState::truncateMarkersMutex");
+    std::shared_ptr<CappedCollectionTruncateMarkers> truncateMarkers;
 };
 
 const auto cappedCollectionState =
@@ -131,6 +141,55 @@ bool shouldDeferCappedDeletesToOplogApplication(OperationContext* opCtx,
     return false;
 }
 
+bool recordCappedInsertForTruncateMarkers(OperationContext* opCtx,
+                                          const CollectionPtr& collection,
+                                          const std::vector<Record>& records) {
+    if (!collection->isCapped() || collection->ns().isReplicated()) {
+        return false;
+    }
+
+    auto truncateMarkers = getCappedTruncateMarkers(collection);
+    if (!truncateMarkers) {
+        return false;
+    }
+
+    // The collection may have become ineligible for marker-based maintenance since the markers
+    // were installed (e.g. an index build started). Keep accounting against the markers until the
+    // capped truncation job notices and clears them; truncation stops immediately, so at worst the
+    // collection temporarily exceeds its cap.
+    int64_t bytesInserted = 0;
+    for (const auto& record : records) {
+        bytesInserted += record.data.size();
+    }
+    truncateMarkers->updateCurrentMarkerAfterInsertOnCommit(opCtx,
+                                                            bytesInserted,
+                                                            records.back().id,
+                                                            Date_t::now(),
+                                                            static_cast<int64_t>(records.size()));
+    return true;
+}
+
+std::shared_ptr<CappedCollectionTruncateMarkers> getCappedTruncateMarkers(
+    const CollectionPtr& collection) {
+    auto& ccs = cappedCollectionState(*collection->getSharedDecorations());
+    stdx::lock_guard<Latch> lk(ccs.truncateMarkersMutex);
+    return ccs.truncateMarkers;
+}
+
+void installCappedTruncateMarkers(
+    const CollectionPtr& collection,
+    std::shared_ptr<CappedCollectionTruncateMarkers> truncateMarkers) {
+    auto& ccs = cappedCollectionState(*collection->getSharedDecorations());
+    stdx::lock_guard<Latch> lk(ccs.truncateMarkersMutex);
+    ccs.truncateMarkers = std::move(truncateMarkers);
+}
+
+void clearCappedTruncateMarkers(const CollectionPtr& collection) {
+    auto& ccs = cappedCollectionState(*collection->getSharedDecorations());
+    stdx::lock_guard<Latch> lk(ccs.truncateMarkersMutex);
+    ccs.truncateMarkers.reset();
+}
+
 void cappedDeleteUntilBelowConfiguredMaximum(OperationContext* opCtx,
                                              const CollectionPtr& collection,
                                              const RecordId& justInserted) {
@@ -292,6 +351,10 @@ void cappedTruncateAfter(OperationContext* opCtx,
             // strategy. We can consider adding either keysDeleted or a new metric reporting
             // document removal if justified by user demand.
         });
+
+    // Any truncate markers refer to boundaries that may no longer exist; drop them and let the
+    // capped truncation job rebuild them from the remaining documents.
+    clearCappedTruncateMarkers(collection);
 }
 
 }  // namespace collection_internal
@@ -29,16 +29,57 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/record_id.h"
+#include "mongo/db/storage/record_store.h"
 
 namespace mongo {
+
+class CappedCollectionTruncateMarkers;
+
 namespace collection_internal {
 
 bool shouldDeferCappedDeletesToOplogApplication(OperationContext* opCtx,
                                                 const CollectionPtr& collection);
 
+/**
+ * Accounts the just-inserted 'records' against the truncate markers of a capped collection
+ * maintained by the capped truncation job, which truncates whole marker ranges off the insert
+ * path.
+ *
+ * Returns false if the collection does not maintain its cap with truncate markers, in which case
+ * the caller must reclaim space with 'cappedDeleteUntilBelowConfiguredMaximum'.
+ */
+bool recordCappedInsertForTruncateMarkers(OperationContext* opCtx,
+                                          const CollectionPtr& collection,
+                                          const std::vector<Record>& records);
+
+/**
+ * Returns the truncate markers installed on 'collection' by the capped truncation job, or null if
+ * the collection maintains its cap with inline deletes.
+ */
+std::shared_ptr<CappedCollectionTruncateMarkers> getCappedTruncateMarkers(
+    const CollectionPtr& collection);
+
+/**
+ * Installs truncate markers on 'collection'. Once installed, inserts stop performing inline capped
+ * deletes and only account their size against the markers.
+ */
+void installCappedTruncateMarkers(const CollectionPtr& collection,
+                                  std::shared_ptr<CappedCollectionTruncateMarkers> truncateMarkers);
+
+/**
+ * Removes any truncate markers installed on 'collection' so that inserts fall back to inline
+ * capped deletes until the capped truncation job rebuilds them. Called when the marker boundaries
+ * are invalidated (e.g. the collection is emptied) or the collection becomes ineligible for
+ * marker-based maintenance.
+ */
+void clearCappedTruncateMarkers(const CollectionPtr& collection);
+
 /**
  * If the collection is capped and the current data size or number of records exceeds cappedMaxSize
  * or cappedMaxDocs respectively, this method will block and delete as many documents as necessary
@@ -39,6 +39,9 @@
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobj.h"
+#include "mongo/db/catalog/capped_collection_maintenance.h"
+#include "mongo/db/catalog/capped_collection_truncate_markers.h"
+#include "mongo/db/catalog/capped_collection_truncation.h"
 #include "mongo/db/catalog/capped_visibility.h"
 #include "mongo/db/catalog/catalog_control.h"
 #include "mongo/db/catalog/collection.h"
@@ -570,5 +573,74 @@ TEST_F(CappedCollectionTest, SeekOplogWithReadTimestamp) {
     }
 }
 
+TEST_F(CappedCollectionTest, TruncateMarkersMaintainCap) {
+    NamespaceString nss =
+        NamespaceString::createNamespaceString_forTest("local.capped_truncate_markers");
+    const long long cappedSize = 64 * 1024;
+    makeCapped(nss, cappedSize);
+
+    // An unreplicated capped collection without indexes is eligible for marker-based maintenance.
+    // The maintenance round installs the (initially empty) truncate markers.
+    {
+        auto opCtx = newOperationContext();
+        maintainCappedCollectionWithTruncateMarkers(opCtx.get(), nss);
+
+        AutoGetCollection ac(opCtx.get(), nss, MODE_IS);
+        const CollectionPtr& coll = ac.getCollection();
+        ASSERT_TRUE(CappedCollectionTruncateMarkers::shouldUseTruncateMarkers(coll));
+        ASSERT_TRUE(collection_internal::getCappedTruncateMarkers(coll));
+    }
+
+    // With markers installed, inserts no longer delete inline and the collection grows beyond its
+    // cap.
+    {
+        auto opCtx = newOperationContext();
+        AutoGetCollection ac(opCtx.get(), nss, MODE_IX);
+        const CollectionPtr& coll = ac.getCollection();
+        const std::string padding(1024, 'x');
+        for (int i = 1; i <= 128; i++) {
+            WriteUnitOfWork wuow(opCtx.get());
+            auto cappedObserver = coll->getCappedVisibilityObserver();
+            cappedObserver->registerWriter(shard_role_details::getRecoveryUnit(opCtx.get()));
+            coll->registerCappedInsert(opCtx.get(), RecordId(i));
+            ASSERT_OK(collection_internal::insertDocument(
+                opCtx.get(),
+                coll,
+                InsertStatement(BSON("_id" << i << "padding" << padding), RecordId(i)),
+                nullptr));
+            wuow.commit();
+        }
+        ASSERT_GT(coll->dataSize(opCtx.get()), cappedSize);
+    }
+
+    // The next maintenance round truncates whole marker ranges until the collection is back under
+    // its cap, removing the oldest records and retaining the newest.
+    {
+        auto opCtx = newOperationContext();
+        maintainCappedCollectionWithTruncateMarkers(opCtx.get(), nss);
+
+        AutoGetCollection ac(opCtx.get(), nss, MODE_IS);
+        const CollectionPtr& coll = ac.getCollection();
+        ASSERT_GT(coll->numRecords(opCtx.get()), 0);
+        ASSERT_LTE(coll->dataSize(opCtx.get()), cappedSize);
+
+        auto cursor = coll->getCursor(opCtx.get());
+        auto oldest = cursor->next();
+        ASSERT(oldest);
+        ASSERT_GT(oldest->id, RecordId(1));
+    }
+}
+
+TEST_F(CappedCollectionTest, TruncateMarkersIneligibleForReplicatedNamespace) {
+    NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.capped_replicated");
+    makeCapped(nss);
+
+    auto opCtx = newOperationContext();
+    AutoGetCollection ac(opCtx.get(), nss, MODE_IS);
+    // Deletes from replicated capped collections must be replicated document-by-document, so the
+    // collection must keep deleting inline.
+    ASSERT_FALSE(CappedCollectionTruncateMarkers::shouldUseTruncateMarkers(ac.getCollection()));
+}
+
 }  // namespace
 }  // namespace mongo
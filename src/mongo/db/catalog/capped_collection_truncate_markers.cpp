@@ -0,0 +1,128 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/catalog/capped_collection_truncate_markers.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "mongo/db/catalog/capped_collection_truncate_markers_gen.h"
+#include "mongo/db/catalog/collection_options.h"
+#include "mongo/db/catalog/index_catalog.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/storage/key_format.h"
+#include "mongo/db/storage/record_store.h"
+
+namespace mongo {
+namespace {
+
+// A full marker represents roughly 1/16th of the configured cap. The lower bound avoids
+// degenerating into per-document markers for tiny caps; the upper bound keeps the data awaiting
+// truncation, and therefore the size overshoot between truncation passes, bounded for very large
+// caps.
+constexpr int64_t kCapFractionPerMarker = 16;
+constexpr int64_t kMinBytesPerMarker = 4 * 1024;
+constexpr int64_t kMaxBytesPerMarker = 64 * 1024 * 1024;
+
+}  // namespace
+
+CappedCollectionTruncateMarkers::CappedCollectionTruncateMarkers(std::deque<Marker> markers,
+                                                                 int64_t leftoverRecordsCount,
+                                                                 int64_t leftoverRecordsBytes,
+                                                                 int64_t minBytesPerMarker,
+                                                                 int64_t cappedMaxDocs,
+                                                                 int64_t cappedMaxSize)
+    : CollectionTruncateMarkers(
+          std::move(markers), leftoverRecordsCount, leftoverRecordsBytes, minBytesPerMarker),
+      _cappedMaxDocs(cappedMaxDocs),
+      _cappedMaxSize(cappedMaxSize) {}
+
+bool CappedCollectionTruncateMarkers::shouldUseTruncateMarkers(const CollectionPtr& collection) {
+    if (!gCappedCollectionTruncateMarkersEnabled) {
+        return false;
+    }
+
+    if (!collection->isCapped() || collection->getClusteredInfo()) {
+        return false;
+    }
+
+    const auto& nss = collection->ns();
+    // Deletes from replicated capped collections produce one oplog entry per removed document so
+    // that secondaries stay consistent; their excess documents cannot be reclaimed by untracked
+    // range truncation. The oplog has its own truncate marker mechanism in the storage engine.
+    if (nss.isOplog() || nss.isReplicated()) {
+        return false;
+    }
+
+    if (collection->needsCappedLock()) {
+        return false;
+    }
+
+    // Range truncation bypasses the index catalog, so the collection must not have any indexes,
+    // whether ready or in progress.
+    if (collection->getIndexCatalog()->numIndexesTotal() > 0) {
+        return false;
+    }
+
+    return collection->getRecordStore()->keyFormat() == KeyFormat::Long;
+}
+
+int64_t CappedCollectionTruncateMarkers::minBytesPerMarker(const CollectionPtr& collection) {
+    return std::clamp(
+        static_cast<int64_t>(collection->getCollectionOptions().cappedSize) / kCapFractionPerMarker,
+        kMinBytesPerMarker,
+        kMaxBytesPerMarker);
+}
+
+void CappedCollectionTruncateMarkers::refreshCollectionSize(OperationContext* opCtx,
+                                                            const CollectionPtr& collection) {
+    _snapshotRecords.store(collection->numRecords(opCtx));
+    _snapshotBytes.store(collection->dataSize(opCtx));
+}
+
+void CappedCollectionTruncateMarkers::recordRangeTruncated(int64_t recordsTruncated,
+                                                           int64_t bytesTruncated) {
+    _snapshotRecords.fetchAndSubtract(recordsTruncated);
+    _snapshotBytes.fetchAndSubtract(bytesTruncated);
+}
+
+bool CappedCollectionTruncateMarkers::_hasExcessMarkers(OperationContext* opCtx) const {
+    if (getMarkers().empty()) {
+        // The most recent data, accounted against the partial marker, is never truncated.
+        return false;
+    }
+
+    if (_snapshotBytes.load() > _cappedMaxSize) {
+        return true;
+    }
+
+    return _cappedMaxDocs > 0 && _snapshotRecords.load() > _cappedMaxDocs;
+}
+
+}  // namespace mongo
@@ -0,0 +1,108 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/storage/collection_truncate_markers.h"
+#include "mongo/platform/atomic_word.h"
+
+namespace mongo {
+
+/**
+ * Truncate markers for user capped collections whose excess documents can be reclaimed by range
+ * truncation instead of by deleting documents one at a time on the insert path.
+ *
+ * Only collections that satisfy 'shouldUseTruncateMarkers()' may be maintained this way: the
+ * collection must be unreplicated (replicated capped collections must generate a delete oplog
+ * entry per removed document, so secondaries stay consistent) and must not have any indexes
+ * (range truncation bypasses the index catalog). This covers the event-log style capped
+ * collections, such as 'system.profile' and the startup log, where inline capped deletes
+ * serialize concurrent inserters.
+ *
+ * Inserts only account their size against the current partial marker; the capped truncation job
+ * truncates whole marker ranges once the collection exceeds its cap. The markers deque is only a
+ * set of truncation points: the per-marker record and byte counts are approximate and are used
+ * solely as size adjustment hints for the record store.
+ */
+class CappedCollectionTruncateMarkers final : public CollectionTruncateMarkers {
+public:
+    CappedCollectionTruncateMarkers(std::deque<Marker> markers,
+                                    int64_t leftoverRecordsCount,
+                                    int64_t leftoverRecordsBytes,
+                                    int64_t minBytesPerMarker,
+                                    int64_t cappedMaxDocs,
+                                    int64_t cappedMaxSize);
+
+    /**
+     * Returns true if 'collection' may maintain its cap with truncate markers rather than with
+     * inline capped deletes.
+     */
+    static bool shouldUseTruncateMarkers(const CollectionPtr& collection);
+
+    /**
+     * Returns the minimum number of bytes a full marker for 'collection' should contain, a
+     * fraction of the configured cap with bounds so that tiny caps do not degenerate into
+     * per-document markers and very large caps do not accumulate excessive data before it becomes
+     * reclaimable. The data awaiting truncation, and therefore the size overshoot between
+     * truncation passes, is bounded by this value.
+     */
+    static int64_t minBytesPerMarker(const CollectionPtr& collection);
+
+    /**
+     * Refreshes the collection size snapshot that the excess-marker check compares against the
+     * cap. The snapshot, rather than insert-path bookkeeping, is the authority on whether the
+     * collection is over its cap so that user deletes and crash-recovered sizes are accounted for.
+     */
+    void refreshCollectionSize(OperationContext* opCtx, const CollectionPtr& collection);
+
+    /**
+     * Subtracts a truncated marker range from the collection size snapshot so that a truncation
+     * pass converges without re-reading the collection size.
+     */
+    void recordRangeTruncated(int64_t recordsTruncated, int64_t bytesTruncated);
+
+private:
+    bool _hasExcessMarkers(OperationContext* opCtx) const override;
+
+    const int64_t _cappedMaxDocs;
+    const int64_t _cappedMaxSize;
+
+    // Collection size as of the last 'refreshCollectionSize()' call, minus any ranges truncated
+    // since then.
+    AtomicWord<int64_t> _snapshotRecords;
+    AtomicWord<int64_t> _snapshotBytes;
+};
+
+}  // namespace mongo
@@ -0,0 +1,249 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/catalog/capped_collection_truncation.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "mongo/db/catalog/capped_collection_maintenance.h"
+#include "mongo/db/catalog/capped_collection_truncate_markers.h"
+#include "mongo/db/catalog/capped_collection_truncate_markers_gen.h"
+#include "mongo/db/catalog/collection_catalog.h"
+#include "mongo/db/catalog/collection_options.h"
+#include "mongo/db/client.h"
+#include "mongo/db/concurrency/d_concurrency.h"
+#include "mongo/db/concurrency/exception_util.h"
+#include "mongo/db/concurrency/lock_manager_defs.h"
+#include "mongo/db/shard_role.h"
+#include "mongo/db/storage/collection_truncate_markers.h"
+#include "mongo/db/storage/record_store.h"
+#include "mongo/db/storage/write_unit_of_work.h"
+#include "mongo/logv2/log.h"
+#include "mongo/logv2/log_attr.h"
+#include "mongo/logv2/log_component.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/decorable.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/periodic_runner.h"
+#include "mongo/util/time_support.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
+
+namespace mongo {
+namespace {
+
+/**
+ * Returns the namespaces of capped collections that may be maintained with truncate markers. The
+ * cheap namespace-level checks are sufficient here; 'maintainCappedCollectionWithTruncateMarkers'
+ * re-evaluates full eligibility under the collection lock.
+ */
+std::vector<NamespaceString> candidateCollections(OperationContext* opCtx) {
+    std::vector<NamespaceString> candidates;
+    Lock::GlobalLock globalLock(opCtx, MODE_IS);
+    auto catalog = CollectionCatalog::get(opCtx);
+    for (const auto& dbName : catalog->getAllDbNames()) {
+        for (auto&& collection : catalog->range(dbName)) {
+            if (collection->isCapped() && !collection->ns().isOplog() &&
+                !collection->ns().isReplicated()) {
+                candidates.push_back(collection->ns());
+            }
+        }
+    }
+    return candidates;
+}
+
+/**
+ * Builds the initial set of markers for 'collection' by scanning or sampling it, depending on its
+ * size. Only runs on the background job, never on the insert path.
+ */
+std::shared_ptr<CappedCollectionTruncateMarkers> createTruncateMarkers(
+    OperationContext* opCtx, const CollectionAcquisition& collection) {
+    const auto& collectionPtr = collection.getCollectionPtr();
+    const auto& options = collectionPtr->getCollectionOptions();
+    const auto minBytesPerMarker =
+        CappedCollectionTruncateMarkers::minBytesPerMarker(collectionPtr);
+
+    YieldableCollectionIterator iterator{opCtx, collection};
+    auto initialSetOfMarkers = CollectionTruncateMarkers::createFromCollectionIterator(
+        opCtx,
+        iterator,
+        collectionPtr->ns(),
+        minBytesPerMarker,
+        [](const Record& record) {
+            // Capped collections have no per-document wall time to recover. Markers only expire by
+            // size, so the current time is good enough.
+            return CollectionTruncateMarkers::RecordIdAndWallTime{record.id, Date_t::now()};
+        });
+
+    LOGV2_DEBUG(8777700,
+                1,
+                "Created truncate markers for capped collection",
+                logAttrs(collectionPtr->ns()),
+                "markers"_attr = initialSetOfMarkers.markers.size(),
+                "method"_attr = CollectionTruncateMarkers::toString(initialSetOfMarkers.methodUsed),
+                "timeTaken"_attr = initialSetOfMarkers.timeTaken);
+
+    auto truncateMarkers =
+        std::make_shared<CappedCollectionTruncateMarkers>(std::move(initialSetOfMarkers.markers),
+                                                          initialSetOfMarkers.leftoverRecordsCount,
+                                                          initialSetOfMarkers.leftoverRecordsBytes,
+                                                          minBytesPerMarker,
+                                                          options.cappedMaxDocs,
+                                                          options.cappedSize);
+    truncateMarkers->refreshCollectionSize(opCtx, collectionPtr);
+    return truncateMarkers;
+}
+
+void truncateExcessMarkers(Client* client) {
+    try {
+        auto uniqueOpCtx = client->makeOperationContext();
+        auto opCtx = uniqueOpCtx.get();
+
+        for (const auto& nss : candidateCollections(opCtx)) {
+            try {
+                maintainCappedCollectionWithTruncateMarkers(opCtx, nss);
+            } catch (const ExceptionForCat<ErrorCategory::Interruption>&) {
+                throw;
+            } catch (const DBException& ex) {
+                // The collection may have been dropped or otherwise invalidated since we sampled
+                // the catalog; skip it and keep maintaining the remaining collections.
+                LOGV2_DEBUG(8777701,
+                            2,
+                            "Skipping capped collection truncation",
+                            logAttrs(nss),
+                            "error"_attr = ex.toStatus());
+            }
+        }
+    } catch (const DBException& ex) {
+        LOGV2_WARNING(8777702,
+                      "Periodic capped collection truncation job was interrupted",
+                      "error"_attr = ex.toStatus());
+    }
+}
+
+/**
+ * Defines a periodic background job that truncates excess truncate-marker ranges from capped
+ * collections maintained with truncate markers. The job runs every
+ * 'cappedCollectionTruncationPeriodSecs'.
+ */
+class CappedCollectionTruncation {
+public:
+    CappedCollectionTruncation(ServiceContext* serviceContext) {
+        const auto period = Seconds{gCappedCollectionTruncationPeriodSecs};
+        _jobAnchor = serviceContext->getPeriodicRunner()->makeJob({"CappedCollectionTruncation",
+                                                                   truncateExcessMarkers,
+                                                                   period,
+                                                                   true /*isKillableByStepdown*/});
+        _jobAnchor.start();
+    }
+
+    static void start(ServiceContext* serviceContext) {
+        auto& cappedCollectionTruncation = _serviceDecoration(serviceContext);
+        cappedCollectionTruncation = std::make_unique<CappedCollectionTruncation>(serviceContext);
+    }
+
+    static void shutdown(ServiceContext* serviceContext) {
+        auto& cappedCollectionTruncation = _serviceDecoration(serviceContext);
+        if (cappedCollectionTruncation) {
+            cappedCollectionTruncation->_jobAnchor.stop();
+            cappedCollectionTruncation.reset();
+        }
+    }
+
+private:
+    inline static const auto _serviceDecoration =
+        ServiceContext::declareDecoration<std::unique_ptr<CappedCollectionTruncation>>();
+
+    PeriodicJobAnchor _jobAnchor;
+};
+
+}  // namespace
+
+void maintainCappedCollectionWithTruncateMarkers(OperationContext* opCtx,
+                                                 const NamespaceString& nss) {
+    const auto collection = acquireCollection(
+        opCtx,
+        CollectionAcquisitionRequest::fromOpCtx(opCtx, nss, AcquisitionPrerequisites::kWrite),
+        MODE_IX);
+    if (!collection.exists()) {
+        return;
+    }
+
+    const auto& collectionPtr = collection.getCollectionPtr();
+    if (!CappedCollectionTruncateMarkers::shouldUseTruncateMarkers(collectionPtr)) {
+        // The collection may have become ineligible since markers were installed (e.g. an index
+        // was created); drop them so that inserts fall back to inline capped deletes.
+        collection_internal::clearCappedTruncateMarkers(collectionPtr);
+        return;
+    }
+
+    auto truncateMarkers = collection_internal::getCappedTruncateMarkers(collectionPtr);
+    if (!truncateMarkers) {
+        truncateMarkers = createTruncateMarkers(opCtx, collection);
+        collection_internal::installCappedTruncateMarkers(collectionPtr, truncateMarkers);
+    } else {
+        truncateMarkers->refreshCollectionSize(opCtx, collectionPtr);
+    }
+
+    // Eligibility is stable while the collection lock is held: creating an index requires a
+    // stronger lock mode, so no index can appear between the check above and the truncation below.
+    while (auto marker = truncateMarkers->peekOldestMarkerIfNeeded(opCtx)) {
+        writeConflictRetry(opCtx, "cappedCollectionRangeTruncate", nss, [&] {
+            WriteUnitOfWork wuow(opCtx);
+            auto rs = collectionPtr->getRecordStore();
+            // Truncate from the beginning of the collection to cover any leftover documents below
+            // the oldest marker boundary.
+            invariantStatusOK(rs->rangeTruncate(
+                opCtx, RecordId(), marker->lastRecord, -marker->bytes, -marker->records));
+            wuow.commit();
+        });
+        truncateMarkers->popOldestMarker();
+        truncateMarkers->recordRangeTruncated(marker->records, marker->bytes);
+
+        LOGV2_DEBUG(8777703,
+                    3,
+                    "Truncated excess marker range from capped collection",
+                    logAttrs(nss),
+                    "lastRecord"_attr = marker->lastRecord,
+                    "bytes"_attr = marker->bytes,
+                    "records"_attr = marker->records);
+    }
+}
+
+void startCappedCollectionTruncation(ServiceContext* serviceContext) {
+    CappedCollectionTruncation::start(serviceContext);
+}
+
+void shutdownCappedCollectionTruncation(ServiceContext* serviceContext) {
+    CappedCollectionTruncation::shutdown(serviceContext);
+}
+
+}  // namespace mongo
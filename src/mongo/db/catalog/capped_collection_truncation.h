@@ -0,0 +1,58 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+
+namespace mongo {
+
+/**
+ * Performs one round of truncate-marker maintenance for the capped collection 'nss': initialises
+ * truncate markers if the collection is eligible but has none yet, and truncates any excess whole
+ * marker ranges. Clears installed markers if the collection has become ineligible. Exposed for
+ * tests; production maintenance runs through the periodic job below.
+ */
+void maintainCappedCollectionWithTruncateMarkers(OperationContext* opCtx,
+                                                 const NamespaceString& nss);
+
+/**
+ * Starts the periodic job that maintains the cap of eligible capped collections by truncating
+ * whole truncate-marker ranges, keeping capped inserts free of inline deletes.
+ */
+void startCappedCollectionTruncation(ServiceContext* serviceContext);
+
+/**
+ * Shuts down the capped collection truncation job if it is running.
+ */
+void shutdownCappedCollectionTruncation(ServiceContext* serviceContext);
+
+}  // namespace mongo
@@ -78,9 +78,9 @@
 #include "mongo/logv2/redaction.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
-#include "mongo/platform/rwmutex.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/epoch_reclamation.h"
 #include "mongo/util/database_name_util.h"
 #include "mongo/util/decorable.h"
 #include "mongo/util/namespace_string_util.h"
@@ -114,28 +114,23 @@ constexpr auto kNumDurableCatalogScansDueToMissingMapping = "numScansDueToMissin
 class LatestCollectionCatalog {
 public:
     std::shared_ptr<CollectionCatalog> load() const {
-        std::shared_lock lk(_mutex);  // NOLINT
-        return _catalog;
+        return _catalog.loadShared();
     }
 
     bool compareAndSet(const std::shared_ptr<CollectionCatalog>& oldCatalog,
                        std::shared_ptr<CollectionCatalog>&& newCatalog) {
-        std::lock_guard lk(_mutex);
-        if (oldCatalog != _catalog)
-            return false;
-        _catalog = std::move(newCatalog);
-        return true;
+        return _catalog.compareAndSet(oldCatalog, std::move(newCatalog));
     }
 
     void store(std::shared_ptr<CollectionCatalog>&& newCatalog) {
-        std::lock_guard lk(_mutex);
-        _catalog = std::move(newCatalog);
+        _catalog.store(std::move(newCatalog));
     }
 
 private:
-    mutable RWMutex _mutex;
-    // TODO SERVER-56428: Replace with std::atomic<std::shared_ptr> when supported in our toolchain
-    std::shared_ptr<CollectionCatalog> _catalog = std::make_shared<CollectionCatalog>();
+    // Epoch-based reclamation keeps load() from contending with other readers on a mutex; the
+    // returned reference is still counted since callers stash catalogs for as long as a snapshot
+    // is open.
+    EpochVersioned<CollectionCatalog> _catalog{std::make_shared<CollectionCatalog>()};
 };
 const ServiceContext::Decoration<LatestCollectionCatalog> getCatalogStore =
     ServiceContext::declareDecoration<LatestCollectionCatalog>();
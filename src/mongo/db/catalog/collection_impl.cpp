@@ -1681,6 +1681,18 @@ bool CollectionImpl::isIndexMultikey(OperationContext* opCtx,
             }
             return index.multikey;
         }
+
+        // A concurrent multikey writer is committing. The cached state is merged only after a
+        // durable multikey write commits and the flag only ever becomes true, so a cached 'true'
+        // can be returned without consulting the durable catalog when the caller does not need
+        // path-level information. Path-level reads must observe the durable state as of their
+        // snapshot and fall through to the durable catalog below.
+        if (!multikeyPaths) {
+            stdx::lock_guard lock(index.multikeyMutex);
+            if (index.multikey) {
+                return true;
+            }
+        }
     }
 
     // We need to read from the durable catalog if there are concurrent multikey writers to avoid
@@ -1724,6 +1736,36 @@ bool CollectionImpl::setIndexIsMultikey(OperationContext* opCtx,
                                 << " ; actual : " << _metadata->findIndexOffset(indexName));
     }
 
+    // Fast path: if the cached metadata already records every requested multikey component, then
+    // so does the durable catalog, because the cached state is merged only after a durable
+    // multikey write commits and multikey state never recedes. This lets a storm of concurrent
+    // first-array inserts settle as soon as the first writer's commit has been merged, instead of
+    // every subsequent writer re-reading, copying and re-writing the catalog document.
+    {
+        const auto& index = _metadata->indexes[offset];
+        stdx::lock_guard lock(index.multikeyMutex);
+        if (index.multikey) {
+            if (index.multikeyPaths.empty()) {
+                if (multikeyPaths.empty()) {
+                    return false;
+                }
+            } else if (multikeyPaths.size() == index.multikeyPaths.size()) {
+                bool somePathIsMultikey = false;
+                bool allPathsCovered = true;
+                for (size_t i = 0; i < multikeyPaths.size() && allPathsCovered; ++i) {
+                    somePathIsMultikey = somePathIsMultikey || !multikeyPaths[i].empty();
+                    allPathsCovered = std::includes(index.multikeyPaths[i].begin(),
+                                                    index.multikeyPaths[i].end(),
+                                                    multikeyPaths[i].begin(),
+                                                    multikeyPaths[i].end());
+                }
+                if (allPathsCovered && somePathIsMultikey) {
+                    return false;
+                }
+            }
+        }
+    }
+
     auto setMultikey = [offset,
                         multikeyPaths](const BSONCollectionCatalogEntry::MetaData& metadata) {
         auto* index = &metadata.indexes[offset];
@@ -454,6 +454,39 @@ TEST_F(CollectionTest, SetIndexIsMultikey) {
     }
 }
 
+TEST_F(CollectionTest, SetIndexIsMultikeyOnlyUpdatesCatalogForNewPathComponents) {
+    NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.t");
+    auto indexName = "myindex"_sd;
+    makeCollectionForMultikey(nss, indexName);
+
+    auto opCtx = operationContext();
+    AutoGetCollection autoColl(opCtx, nss, MODE_IX);
+    const auto& coll = autoColl.getCollection();
+    ASSERT(coll);
+    {
+        WriteUnitOfWork wuow(opCtx);
+        ASSERT(coll->setIndexIsMultikey(opCtx, indexName, {{0}}));
+        wuow.commit();
+    }
+    {
+        // Path components which are already recorded do not change the metadata.
+        WriteUnitOfWork wuow(opCtx);
+        ASSERT_FALSE(coll->setIndexIsMultikey(opCtx, indexName, {{0}}));
+        wuow.commit();
+    }
+    {
+        // A new path component does.
+        WriteUnitOfWork wuow(opCtx);
+        ASSERT(coll->setIndexIsMultikey(opCtx, indexName, {{0, 1}}));
+        wuow.commit();
+    }
+    {
+        WriteUnitOfWork wuow(opCtx);
+        ASSERT_FALSE(coll->setIndexIsMultikey(opCtx, indexName, {{1}}));
+        wuow.commit();
+    }
+}
+
 TEST_F(CollectionTest, SetIndexIsMultikeyRemovesUncommittedChangesOnRollback) {
     NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.t");
     auto indexName = "myindex"_sd;
@@ -399,7 +399,12 @@ Status insertDocumentsImpl(OperationContext* opCtx,
             /*defaultFromMigrate=*/fromMigrate);
     }
 
-    cappedDeleteUntilBelowConfiguredMaximum(opCtx, collection, records.begin()->id);
+    // Collections maintained with truncate markers only account the insert against their markers
+    // here; the capped truncation job reclaims excess marker ranges off the insert path. All other
+    // capped collections delete excess documents inline.
+    if (!recordCappedInsertForTruncateMarkers(opCtx, collection, records)) {
+        cappedDeleteUntilBelowConfiguredMaximum(opCtx, collection, records.begin()->id);
+    }
 
     return Status::OK();
 }
@@ -480,7 +485,10 @@ Status insertDocumentForBulkLoader(OperationContext* opCtx,
         /*fromMigrate=*/std::vector<bool>(inserts.size(), false),
         /*defaultFromMigrate=*/false);
 
-    cappedDeleteUntilBelowConfiguredMaximum(opCtx, collection, loc.getValue());
+    if (!recordCappedInsertForTruncateMarkers(
+            opCtx, collection, {Record{loc.getValue(), RecordData(doc.objdata(), doc.objsize())}})) {
+        cappedDeleteUntilBelowConfiguredMaximum(opCtx, collection, loc.getValue());
+    }
 
     // Capture the recordStore here instead of the CollectionPtr object itself, because the record
     // store's lifetime is controlled by the collection IX lock held on the write paths, whereas the
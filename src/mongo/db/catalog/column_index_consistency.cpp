@@ -73,24 +73,29 @@ int64_t ColumnIndexConsistency::traverseIndex(OperationContext* opCtx,
     // Traverse the index in this for loop.
     for (auto cell = csiCursor->seekAtOrPast("", ColumnStore::kNullRowId); cell;
          cell = csiCursor->next()) {
-        {
-            stdx::unique_lock<Client> lk(*opCtx->getClient());
-            _progress.get(lk)->hit();
-        }
-
         if (_firstPhase) {
             addIndexEntry(cell.get());
         } else {
             _updateSuspectList(cell.get(), results);
         }
 
-        if (++numIndexEntries % kInterruptIntervalNumRecords == 0) {
+        if (++numIndexEntries % kProgressUpdateIntervalNumRecords == 0) {
+            stdx::unique_lock<Client> lk(*opCtx->getClient());
+            _progress.get(lk)->hit(static_cast<int>(kProgressUpdateIntervalNumRecords));
+        }
+
+        if (numIndexEntries % kInterruptIntervalNumRecords == 0) {
             // Periodically checks for interrupts and yields.
             opCtx->checkForInterrupt();
             _validateState->yieldCursors(opCtx);
         }
     }
 
+    if (const auto remainder = numIndexEntries % kProgressUpdateIntervalNumRecords) {
+        stdx::unique_lock<Client> lk(*opCtx->getClient());
+        _progress.get(lk)->hit(static_cast<int>(remainder));
+    }
+
     _investigateSuspects(opCtx, index);
 
     return numIndexEntries;
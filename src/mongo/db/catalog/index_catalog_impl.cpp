@@ -1690,12 +1690,11 @@ const IndexDescriptor* IndexCatalogImpl::refreshEntry(OperationContext* opCtx,
 
 
 Status IndexCatalogImpl::_indexFilteredRecords(OperationContext* opCtx,
+                                               SharedBufferFragmentBuilder& pooledBuilder,
                                                const CollectionPtr& coll,
                                                const IndexCatalogEntry* index,
                                                const std::vector<BsonRecord>& bsonRecords,
                                                int64_t* keysInsertedOut) const {
-    SharedBufferFragmentBuilder pooledBuilder(key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
-
     InsertDeleteOptions options;
     prepareInsertDeleteOptions(opCtx, coll->ns(), index->descriptor(), &options);
 
@@ -1704,6 +1703,7 @@ Status IndexCatalogImpl::_indexFilteredRecords(OperationContext* opCtx,
 }
 
 Status IndexCatalogImpl::_indexRecords(OperationContext* opCtx,
+                                       SharedBufferFragmentBuilder& pooledBuilder,
                                        const CollectionPtr& coll,
                                        const IndexCatalogEntry* index,
                                        const std::vector<BsonRecord>& bsonRecords,
@@ -1722,7 +1722,8 @@ Status IndexCatalogImpl::_indexRecords(OperationContext* opCtx,
 
     const MatchExpression* filter = index->getFilterExpression();
     if (!filter)
-        return _indexFilteredRecords(opCtx, coll, index, bsonRecords, keysInsertedOut);
+        return _indexFilteredRecords(
+            opCtx, pooledBuilder, coll, index, bsonRecords, keysInsertedOut);
 
     std::vector<BsonRecord> filteredBsonRecords;
     for (const auto& bsonRecord : bsonRecords) {
@@ -1730,10 +1731,12 @@ Status IndexCatalogImpl::_indexRecords(OperationContext* opCtx,
             filteredBsonRecords.push_back(bsonRecord);
     }
 
-    return _indexFilteredRecords(opCtx, coll, index, filteredBsonRecords, keysInsertedOut);
+    return _indexFilteredRecords(
+        opCtx, pooledBuilder, coll, index, filteredBsonRecords, keysInsertedOut);
 }
 
 Status IndexCatalogImpl::_updateRecord(OperationContext* const opCtx,
+                                       SharedBufferFragmentBuilder& pooledBuilder,
                                        const CollectionPtr& coll,
                                        const IndexCatalogEntry* index,
                                        const BSONObj& oldDoc,
@@ -1756,7 +1759,6 @@ Status IndexCatalogImpl::_updateRecord(OperationContext* const opCtx,
             return Status::OK();
         }
     }
-    SharedBufferFragmentBuilder pooledBuilder(key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
 
     InsertDeleteOptions options;
     prepareInsertDeleteOptions(opCtx, coll->ns(), index->descriptor(), &options);
@@ -1785,6 +1787,7 @@ Status IndexCatalogImpl::_updateRecord(OperationContext* const opCtx,
 }
 
 void IndexCatalogImpl::_unindexRecord(OperationContext* opCtx,
+                                      SharedBufferFragmentBuilder& pooledBuilder,
                                       const CollectionPtr& collection,
                                       const IndexCatalogEntry* entry,
                                       const BSONObj& obj,
@@ -1808,8 +1811,6 @@ void IndexCatalogImpl::_unindexRecord(OperationContext* opCtx,
         }
     }
 
-    SharedBufferFragmentBuilder pooledBuilder(key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
-
     InsertDeleteOptions options;
     prepareInsertDeleteOptions(opCtx, collection->ns(), entry->descriptor(), &options);
 
@@ -1839,6 +1840,10 @@ Status IndexCatalogImpl::indexRecords(OperationContext* opCtx,
     // changes to the _mdb_catalog document with in timestamp order updates.
     MultikeyPathTracker& tracker = MultikeyPathTracker::get(opCtx);
 
+    // All indexes draw their generated keys from one pooled builder so that indexing a batch of
+    // records performs a single arena allocation rather than one per index.
+    SharedBufferFragmentBuilder pooledBuilder(key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
+
     // Take care when choosing to aggregate multikey writes. This code will only* track multikey
     // when:
     // * No parent is tracking multikey and*
@@ -1866,13 +1871,15 @@ Status IndexCatalogImpl::indexRecords(OperationContext* opCtx,
             stopTrackingMultikeyChanges.dismiss();
         }
         for (auto&& it : _readyIndexes) {
-            Status s = _indexRecords(opCtx, coll, it.get(), bsonRecords, keysInsertedOut);
+            Status s =
+                _indexRecords(opCtx, pooledBuilder, coll, it.get(), bsonRecords, keysInsertedOut);
             if (!s.isOK())
                 return s;
         }
 
         for (auto&& it : _buildingIndexes) {
-            Status s = _indexRecords(opCtx, coll, it.get(), bsonRecords, keysInsertedOut);
+            Status s =
+                _indexRecords(opCtx, pooledBuilder, coll, it.get(), bsonRecords, keysInsertedOut);
             if (!s.isOK())
                 return s;
         }
@@ -1919,6 +1926,9 @@ Status IndexCatalogImpl::updateRecord(OperationContext* const opCtx,
 
     const size_t numIndexesToUpdate = _readyIndexes.size() + _buildingIndexes.size();
     if (numIndexesToUpdate > 0) {
+        SharedBufferFragmentBuilder pooledBuilder(
+            key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
+
         mongo::doc_diff::BitVector toUpdate;
         if (opDiff) {
             std::vector<const UpdateIndexData*> allIndexPaths;
@@ -1945,8 +1955,15 @@ Status IndexCatalogImpl::updateRecord(OperationContext* const opCtx,
                 ? (_readyIndexes.begin() + pos)->get()
                 : (_buildingIndexes.begin() + (pos - _readyIndexes.size()))->get();
 
-            auto status = _updateRecord(
-                opCtx, coll, entry, oldDoc, newDoc, recordId, keysInsertedOut, keysDeletedOut);
+            auto status = _updateRecord(opCtx,
+                                        pooledBuilder,
+                                        coll,
+                                        entry,
+                                        oldDoc,
+                                        newDoc,
+                                        recordId,
+                                        keysInsertedOut,
+                                        keysDeletedOut);
             if (!status.isOK()) {
                 return status;
             }
@@ -1966,14 +1983,23 @@ void IndexCatalogImpl::unindexRecord(OperationContext* opCtx,
         *keysDeletedOut = 0;
     }
 
+    SharedBufferFragmentBuilder pooledBuilder(key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
+
     for (IndexCatalogEntryContainer::const_iterator it = _readyIndexes.begin();
          it != _readyIndexes.end();
          ++it) {
         const IndexCatalogEntry* entry = it->get();
 
         bool logIfError = !noWarn;
-        _unindexRecord(
-            opCtx, collection, entry, obj, loc, logIfError, keysDeletedOut, checkRecordId);
+        _unindexRecord(opCtx,
+                       pooledBuilder,
+                       collection,
+                       entry,
+                       obj,
+                       loc,
+                       logIfError,
+                       keysDeletedOut,
+                       checkRecordId);
     }
 
     for (IndexCatalogEntryContainer::const_iterator it = _buildingIndexes.begin();
@@ -1983,8 +2009,15 @@ void IndexCatalogImpl::unindexRecord(OperationContext* opCtx,
 
         // If it's a background index, we DO NOT want to log anything.
         bool logIfError = entry->isReady() ? !noWarn : false;
-        _unindexRecord(
-            opCtx, collection, entry, obj, loc, logIfError, keysDeletedOut, checkRecordId);
+        _unindexRecord(opCtx,
+                       pooledBuilder,
+                       collection,
+                       entry,
+                       obj,
+                       loc,
+                       logIfError,
+                       keysDeletedOut,
+                       checkRecordId);
     }
 }
 
@@ -57,6 +57,7 @@
 #include "mongo/db/server_options.h"
 #include "mongo/db/storage/key_string.h"
 #include "mongo/db/storage/record_store.h"
+#include "mongo/util/shared_buffer_fragment.h"
 
 namespace mongo {
 
@@ -307,19 +308,25 @@ private:
      */
     std::string _getAccessMethodName(const BSONObj& keyPattern) const;
 
+    // The per-index helpers below share one pooled key string builder per operation, passed in by
+    // the public entry points, so that key generation for every index of a record (or batch of
+    // records) allocates from a single arena.
     Status _indexFilteredRecords(OperationContext* opCtx,
+                                 SharedBufferFragmentBuilder& pooledBuilder,
                                  const CollectionPtr& coll,
                                  const IndexCatalogEntry* index,
                                  const std::vector<BsonRecord>& bsonRecords,
                                  int64_t* keysInsertedOut) const;
 
     Status _indexRecords(OperationContext* opCtx,
+                         SharedBufferFragmentBuilder& pooledBuilder,
                          const CollectionPtr& coll,
                          const IndexCatalogEntry* index,
                          const std::vector<BsonRecord>& bsonRecords,
                          int64_t* keysInsertedOut) const;
 
     Status _updateRecord(OperationContext* opCtx,
+                         SharedBufferFragmentBuilder& pooledBuilder,
                          const CollectionPtr& coll,
                          const IndexCatalogEntry* index,
                          const BSONObj& oldDoc,
@@ -329,6 +336,7 @@ private:
                          int64_t* keysDeletedOut) const;
 
     void _unindexRecord(OperationContext* opCtx,
+                        SharedBufferFragmentBuilder& pooledBuilder,
                         const CollectionPtr& collection,
                         const IndexCatalogEntry* entry,
                         const BSONObj& obj,
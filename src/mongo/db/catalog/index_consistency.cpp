@@ -97,6 +97,7 @@
 namespace mongo {
 
 const long long IndexConsistency::kInterruptIntervalNumRecords = 4096;
+const long long IndexConsistency::kProgressUpdateIntervalNumRecords = 128;
 const size_t IndexConsistency::kNumHashBuckets = 1U << 16;
 
 namespace {
@@ -832,13 +833,14 @@ int64_t KeyStringIndexConsistency::traverseIndex(OperationContext* opCtx,
                 results->valid = false;
             }
         }
-        {
-            stdx::unique_lock<Client> lk(*opCtx->getClient());
-            _progress.get(lk)->hit();
-        }
         numKeys++;
         prevIndexKeyStringEntry = indexEntry;
 
+        if (numKeys % kProgressUpdateIntervalNumRecords == 0) {
+            stdx::unique_lock<Client> lk(*opCtx->getClient());
+            _progress.get(lk)->hit(static_cast<int>(kProgressUpdateIntervalNumRecords));
+        }
+
         if (numKeys % kInterruptIntervalNumRecords == 0) {
             // Periodically checks for interrupts and yields.
             opCtx->checkForInterrupt();
@@ -859,6 +861,11 @@ int64_t KeyStringIndexConsistency::traverseIndex(OperationContext* opCtx,
         }
     }
 
+    if (const auto remainder = numKeys % kProgressUpdateIntervalNumRecords) {
+        stdx::unique_lock<Client> lk(*opCtx->getClient());
+        _progress.get(lk)->hit(static_cast<int>(remainder));
+    }
+
     if (results && this->getMultikeyMetadataPathCount(&indexInfo) > 0) {
         results->errors.push_back(str::stream()
                                   << "Index '" << descriptor->indexName()
@@ -116,6 +116,10 @@ class IndexConsistency {
 
 public:
     static const long long kInterruptIntervalNumRecords;
+    // Updating the progress meter requires the Client lock, so the traversal loops batch their
+    // updates to one every 'kProgressUpdateIntervalNumRecords' records or index keys rather than
+    // taking the lock for each one.
+    static const long long kProgressUpdateIntervalNumRecords;
     static const size_t kNumHashBuckets;
 
     IndexConsistency(OperationContext* opCtx,
@@ -738,6 +738,20 @@ void MultiIndexBlock::_doCollectionScan(OperationContext* opCtx,
     const auto onSuppressedError =
         makeOnSuppressedErrorFn(saveCursorBeforeWrite, restoreCursorAfterWrite);
 
+    // Refresh the progress meter every few records rather than paying a storage-engine size
+    // lookup and two client lock acquisitions per record scanned. The meter remains responsive
+    // while the refresh cost disappears from the scan loop. The exact record count is still
+    // tracked locally, since the scan failpoints match on it.
+    constexpr int64_t kProgressRefreshInterval = 128;
+    int64_t recordsScanned = progress->get(WithLock::withoutLock())->hits();
+    int64_t recordsSinceProgressRefresh = 0;
+    auto refreshProgress = [&] {
+        stdx::unique_lock<Client> lk(*opCtx->getClient());
+        progress->get(lk)->setTotalWhileRunning(collection->numRecords(opCtx));
+        progress->get(lk)->hit(static_cast<int>(recordsSinceProgressRefresh));
+        recordsSinceProgressRefresh = 0;
+    };
+
     RecordId loc;
     PlanExecutor::ExecState state;
     while (PlanExecutor::ADVANCED == (state = exec->getNext(&objToIndex, &loc)) ||
@@ -748,17 +762,12 @@ void MultiIndexBlock::_doCollectionScan(OperationContext* opCtx,
             continue;
         }
 
-        {
-            stdx::unique_lock<Client> lk(*opCtx->getClient());
-            progress->get(lk)->setTotalWhileRunning(collection->numRecords(opCtx));
-        }
-
         uassertStatusOK(
             _failPointHangDuringBuild(opCtx,
                                       &hangIndexBuildDuringCollectionScanPhaseBeforeInsertion,
                                       "before",
                                       objToIndex,
-                                      progress->get(WithLock::withoutLock())->hits()));
+                                      recordsScanned));
 
         // The external sorter is not part of the storage engine and therefore does not need
         // a WriteUnitOfWork to write keys. In case there are constraint violations being
@@ -775,15 +784,17 @@ void MultiIndexBlock::_doCollectionScan(OperationContext* opCtx,
                                   &hangIndexBuildDuringCollectionScanPhaseAfterInsertion,
                                   "after",
                                   objToIndex,
-                                  progress->get(WithLock::withoutLock())->hits())
+                                  recordsScanned)
             .ignore();
 
-        {
-            stdx::unique_lock<Client> lk(*opCtx->getClient());
-            // Go to the next document.
-            progress->get(lk)->hit();
+        // Go to the next document.
+        ++recordsScanned;
+        if (++recordsSinceProgressRefresh >= kProgressRefreshInterval) {
+            refreshProgress();
         }
     }
+
+    refreshProgress();
 }
 
 Status MultiIndexBlock::insertSingleDocumentForInitialSyncOrRecovery(
@@ -796,6 +796,7 @@ void ValidateAdaptor::traverseRecordStore(OperationContext* opCtx,
     long long nInvalid = 0;
     long long nNonCompliantDocuments = 0;
     long long numCorruptRecordsSizeBytes = 0;
+    long long recordsSinceProgressUpdate = 0;
 
     ON_BLOCK_EXIT([&]() {
         output->appendNumber("nInvalidDocuments", nInvalid);
@@ -803,6 +804,7 @@ void ValidateAdaptor::traverseRecordStore(OperationContext* opCtx,
         output->appendNumber("nrecords", _numRecords);
         {
             stdx::unique_lock<Client> lk(*opCtx->getClient());
+            _progress.get(lk)->hit(static_cast<int>(recordsSinceProgressUpdate));
             _progress.get(lk)->finished();
         }
     });
@@ -842,9 +844,10 @@ void ValidateAdaptor::traverseRecordStore(OperationContext* opCtx,
              traverseRecordStoreCursor->seekExact(opCtx, _validateState->getFirstRecordId());
          record;
          record = traverseRecordStoreCursor->next(opCtx)) {
-        {
+        if (++recordsSinceProgressUpdate >= IndexConsistency::kProgressUpdateIntervalNumRecords) {
             stdx::unique_lock<Client> lk(*opCtx->getClient());
-            _progress.get(lk)->hit();
+            _progress.get(lk)->hit(static_cast<int>(recordsSinceProgressUpdate));
+            recordsSinceProgressUpdate = 0;
         }
         ++_numRecords;
         auto dataSize = record->data.size();
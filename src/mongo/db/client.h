@@ -50,6 +50,7 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/service_context.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/atomic.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/random.h"
 #include "mongo/stdx/thread.h"
@@ -233,6 +234,17 @@ public:
         return _opCtx;
     }
 
+    /**
+     * Returns whether this client currently has an OperationContext attached, without taking the
+     * client lock. The answer may be stale by the time the caller acts on it, so this is only
+     * suitable as a pre-filter when scanning many clients (e.g. currentOp skipping idle
+     * connections); callers that need the operation context itself must lock the client and use
+     * getOperationContext().
+     */
+    bool mayHaveOperationContext() const {
+        return _hasOperationContext.loadRelaxed();
+    }
+
     // TODO(spencer): SERVER-10228 SERVER-14779 Remove this/move it fully into OperationContext.
     bool isInDirectClient() const {
         return _inDirectClient;
@@ -444,6 +456,10 @@ private:
     // If != NULL, then contains the currently active OperationContext
     OperationContext* _opCtx = nullptr;
 
+    // Lock-free mirror of whether '_opCtx' is set, maintained by _setOperationContext(). Lets
+    // scans over all clients skip those with no operation without taking each client's lock.
+    Atomic<bool> _hasOperationContext{false};
+
     // If the active system client operation is allowed to be killed.
     bool _systemOperationKillable = true;
 
@@ -318,6 +318,30 @@ public:
         _lastKnownCommittedOpTime = std::move(lastCommittedOpTime);
     }
 
+    /**
+     * Returns/records the byte budget used by this cursor's getMore replies when adaptive reply
+     * sizing is enabled (see 'internalQueryGetMoreAdaptiveReplyBudgetMinBytes'). A value of zero
+     * means no budget has been recorded yet and the fixed default budget applies.
+     */
+    std::size_t getReplyByteBudget() const {
+        return _replyByteBudget;
+    }
+
+    void setReplyByteBudget(std::size_t byteBudget) {
+        _replyByteBudget = byteBudget;
+    }
+
+    /**
+     * Returns/records the number of bytes returned in this cursor's most recent getMore reply.
+     */
+    std::size_t getLastReplyBytes() const {
+        return _lastReplyBytes;
+    }
+
+    void setLastReplyBytes(std::size_t lastReplyBytes) {
+        _lastReplyBytes = lastReplyBytes;
+    }
+
     friend std::size_t partitionOf(const ClientCursor* cursor) {
         return cursor->cursorid();
     }
@@ -486,6 +510,12 @@ private:
     Date_t _lastUseDate;
     Date_t _createdDate;
 
+    // Bookkeeping for adaptive getMore reply sizing. The budget and the size of the most recent
+    // reply are recorded when a batch is returned, and compared against the time the client took
+    // to request the next batch in order to grow or shrink the budget of that batch.
+    std::size_t _replyByteBudget = 0;
+    std::size_t _lastReplyBytes = 0;
+
     // A string with the plan summary of the cursor's query.
     std::string _planSummary;
 
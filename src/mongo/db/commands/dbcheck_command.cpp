@@ -84,6 +84,7 @@
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/storage/flow_control.h"
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/sorted_data_interface.h"
 #include "mongo/db/storage/write_unit_of_work.h"
@@ -198,6 +199,22 @@ WriteConcernOptions _getBatchWriteConcern(
     return batchWriteConcern;
 }
 
+/**
+ * Returns the rate limit for dbCheck batch reads. While flow control reports majority commit
+ * point lag, the configured rate is clamped to 'maxDbCheckMBperSecWhenLagged' so that background
+ * verification does not compete with replication catch-up.
+ */
+int _getMaxDbCheckMBperSec(ServiceContext* service) {
+    auto rate = gMaxDbCheckMBperSec.load();
+    auto flowControl = FlowControl::get(service);
+    if (flowControl && flowControl->isLagged()) {
+        const auto laggedRate = gMaxDbCheckMBperSecWhenLagged.load();
+        // A rate of 0 means unthrottled, which must not survive while lagged.
+        rate = rate == 0 ? laggedRate : std::min(rate, laggedRate);
+    }
+    return rate;
+}
+
 BSONObj DbCheckCollectionInfo::toBSON() const {
     BSONObjBuilder builder;
     builder.append("dbcheck",
@@ -431,8 +448,8 @@ std::unique_ptr<DbCheckRun> singleCollectionRun(OperationContext* opCtx,
                               maxBatchTimeMillis,
                               _getBatchWriteConcern(opCtx, invocation.getBatchWriteConcern()),
                               secondaryIndexCheckParameters,
-                              {opCtx, [&]() {
-                                   return gMaxDbCheckMBperSec.load();
+                              {opCtx, [service = opCtx->getServiceContext()]() {
+                                   return _getMaxDbCheckMBperSec(service);
                                }}};
     auto result = std::make_unique<DbCheckRun>();
     result->push_back(info);
@@ -470,8 +487,8 @@ std::unique_ptr<DbCheckRun> fullDatabaseRun(OperationContext* opCtx,
                                    maxBatchTimeMillis,
                                    _getBatchWriteConcern(opCtx, invocation.getBatchWriteConcern()),
                                    boost::none,
-                                   {opCtx, [&]() {
-                                        return gMaxDbCheckMBperSec.load();
+                                   {opCtx, [service = opCtx->getServiceContext()]() {
+                                        return _getMaxDbCheckMBperSec(service);
                                     }}};
         result->push_back(info);
         return true;
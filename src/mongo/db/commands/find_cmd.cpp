@@ -97,6 +97,7 @@
 #include "mongo/db/query/find_command.h"
 #include "mongo/db/query/find_common.h"
 #include "mongo/db/query/get_executor.h"
+#include "mongo/db/query/getmore_command_gen.h"
 #include "mongo/db/query/parsed_find_command.h"
 #include "mongo/db/query/plan_executor.h"
 #include "mongo/db/query/plan_explainer.h"
@@ -960,6 +961,22 @@ public:
                 : boost::none;
             firstBatch.done(cursorId, nss, metrics, respSc);
 
+            if (cursorId != 0 && opCtx->isExhaust() && !opCtx->inMultiDocumentTransaction()) {
+                // Begin the exhaust stream directly from the initial find by synthesizing the
+                // getMore that the client would otherwise have to send to start it. The session
+                // workflow re-dispatches this invocation after each batch is sunk to the network,
+                // so subsequent batches are pushed without waiting on a client round trip.
+                GetMoreCommandRequest getMoreRequest(cursorId, std::string{nss.coll()});
+                if (auto nextBatchSize = originalFC.getBatchSize(); nextBatchSize.value_or(0) > 0) {
+                    getMoreRequest.setBatchSize(nextBatchSize);
+                }
+                replyBuilder->setNextInvocation(
+                    OpMsgRequestBuilder::create(auth::ValidatedTenancyScope::get(opCtx),
+                                                nss.dbName(),
+                                                getMoreRequest.toBSON())
+                        .body.getOwned());
+            }
+
             // Increment this metric once we have generated a response and we know it will return
             // documents.
             auto& metricsCollector = ResourceConsumption::MetricsCollector::get(opCtx);
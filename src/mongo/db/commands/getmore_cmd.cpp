@@ -27,6 +27,7 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <boost/optional.hpp>
 #include <cstddef>
 #include <cstdint>
@@ -84,6 +85,7 @@
 #include "mongo/db/query/plan_executor.h"
 #include "mongo/db/query/plan_explainer.h"
 #include "mongo/db/query/plan_summary_stats.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_stats/query_stats.h"
 #include "mongo/db/read_concern.h"
 #include "mongo/db/read_concern_support_result.h"
@@ -140,6 +142,51 @@ MONGO_FAIL_POINT_DEFINE(getMoreHangAfterPinCursor);
 // The timeout when waiting for linearizable read concern on a getMore command.
 static constexpr Milliseconds kLinearizableReadConcernTimeout{15000};
 
+// Consumption-cadence thresholds for adaptive getMore reply sizing. A client that requests the
+// next batch within the fast threshold is keeping the cursor busy, so its reply byte budget may
+// grow back toward the default; one that takes longer than the slow threshold is trickling
+// through its results, so buffering a full default-sized batch for it only ties up server memory.
+static constexpr Milliseconds kAdaptiveReplyFastConsumerThreshold{100};
+static constexpr Seconds kAdaptiveReplySlowConsumerThreshold{10};
+
+/**
+ * Computes the maximum number of reply bytes this getMore may buffer for 'cursor'. This is the
+ * fixed FindCommon::kMaxBytesToReturnToClientAtOnce budget unless adaptive reply sizing is
+ * enabled via 'internalQueryGetMoreAdaptiveReplyBudgetMinBytes'. When it is, the budget halves
+ * (down to the configured floor) each time the client takes longer than the slow-consumer
+ * threshold to come back for the next batch, and doubles (up to the default) when a batch that
+ * substantially filled its budget is consumed within the fast-consumer threshold. Since the
+ * cursor's last-use date is only refreshed when it is checked back in, the gap from it to 'now'
+ * measures the client-side round trip plus consumption time of the previous batch.
+ */
+size_t computeReplyByteBudget(const ClientCursor& cursor, Date_t now) {
+    const auto floor =
+        static_cast<size_t>(internalQueryGetMoreAdaptiveReplyBudgetMinBytes.load());
+    if (floor == 0 || floor >= FindCommon::kMaxBytesToReturnToClientAtOnce) {
+        return FindCommon::kMaxBytesToReturnToClientAtOnce;
+    }
+
+    auto budget = cursor.getReplyByteBudget();
+    if (budget == 0 || budget > FindCommon::kMaxBytesToReturnToClientAtOnce) {
+        budget = FindCommon::kMaxBytesToReturnToClientAtOnce;
+    }
+
+    // Only adapt once a previous getMore reply's consumption time can be measured; the first
+    // getMore follows the originating command's reply, whose size we do not track.
+    if (cursor.getLastReplyBytes() == 0) {
+        return budget;
+    }
+
+    const auto consumptionGap = now - cursor.getLastUseDate();
+    if (consumptionGap > kAdaptiveReplySlowConsumerThreshold) {
+        budget = std::max(budget / 2, floor);
+    } else if (consumptionGap < kAdaptiveReplyFastConsumerThreshold &&
+               cursor.getLastReplyBytes() * 2 >= budget) {
+        budget = std::min(budget * 2, FindCommon::kMaxBytesToReturnToClientAtOnce);
+    }
+    return budget;
+}
+
 // getMore can run with any readConcern, because cursor-creating commands like find can run with any
 // readConcern.  However, since getMore automatically uses the readConcern of the command that
 // created the cursor, it is not appropriate to apply the default readConcern (just as
@@ -448,6 +495,7 @@ public:
                             ClientCursor* cursor,
                             PlanExecutor* exec,
                             const size_t batchSize,
+                            const size_t replyByteBudget,
                             const bool isTailable,
                             CursorResponseBuilder* nextBatch,
                             uint64_t* numResults,
@@ -489,7 +537,8 @@ public:
                                                       nextBatch,
                                                       docUnitsReturned,
                                                       pbrt,
-                                                      failedToAppend});
+                                                      failedToAppend,
+                                                      replyByteBudget});
             }
 
             // Use the resume token generated by the last execution of the plan that didn't stash a
@@ -512,6 +561,7 @@ public:
         bool generateBatch(OperationContext* opCtx,
                            ClientCursor* cursor,
                            const GetMoreCommandRequest& cmd,
+                           const size_t replyByteBudget,
                            const bool isTailable,
                            CursorResponseBuilder* nextBatch,
                            uint64_t* numResults,
@@ -532,6 +582,7 @@ public:
                                       cursor,
                                       exec,
                                       batchSize,
+                                      replyByteBudget,
                                       isTailable,
                                       nextBatch,
                                       numResults,
@@ -782,9 +833,21 @@ public:
                     nss);
             });
 
+            // Choose the reply byte budget before generating the batch. The cursor's last-use
+            // date still reflects when the previous batch was checked back in, so it can be
+            // compared against the current time to gauge how quickly the client consumed it.
+            // Tailable cursors are excluded: long gaps between their batches reflect the data
+            // arrival rate, not the client's consumption rate.
+            const auto replyByteBudget = cursorPin->isTailable()
+                ? FindCommon::kMaxBytesToReturnToClientAtOnce
+                : computeReplyByteBudget(
+                      *cursorPin.getCursor(),
+                      opCtx->getServiceContext()->getPreciseClockSource()->now());
+
             const auto shouldSaveCursor = generateBatch(opCtx,
                                                         cursorPin.getCursor(),
                                                         _cmd,
+                                                        replyByteBudget,
                                                         cursorPin->isTailable(),
                                                         &nextBatch,
                                                         &numResults,
@@ -818,6 +881,11 @@ public:
 
                 cursorPin->setLeftoverMaxTimeMicros(opCtx->getRemainingMaxTimeMicros());
 
+                // Record this reply's budget and size so the next getMore can adapt the budget to
+                // the client's consumption cadence.
+                cursorPin->setReplyByteBudget(replyByteBudget);
+                cursorPin->setLastReplyBytes(nextBatch.bytesUsed());
+
                 if (opCtx->isExhaust() && clientsLastKnownCommittedOpTime(opCtx)) {
                     // Update the cursor's lastKnownCommittedOpTime to the current
                     // lastCommittedOpTime. The lastCommittedOpTime now may be staler than the
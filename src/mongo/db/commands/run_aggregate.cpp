@@ -397,6 +397,14 @@ bool getFirstBatch(OperationContext* opCtx,
 
         invariant(state == PlanExecutor::ADVANCED);
 
+        if (objCount == 0) {
+            // Reserve space for the rest of the batch based on the size of the first document.
+            // This avoids repeatedly growing (and re-copying) the reply buffer while assembling
+            // large batches.
+            responseBuilder.reserveReplyBuffer(FindCommon::getBytesToReserveForGetMoreReply(
+                expCtx->isTailable(), nextDoc.objsize(), batchSize));
+        }
+
         // If adding this object will cause us to exceed the message size limit, then we stash it
         // for later.
         if (!FindCommon::haveSpaceForNext(nextDoc, objCount, responseBuilder.bytesUsed())) {
@@ -31,7 +31,9 @@
 
 
 #include "mongo/base/string_data.h"
+#include "mongo/db/service_context.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/clock_source.h"
 
 namespace mongo {
 
@@ -39,6 +41,22 @@ namespace {
 constexpr auto kTimingSection = "timing"_sd;
 }  // namespace
 
+BSONObj ServerStatusSection::_generateSectionCached(OperationContext* opCtx,
+                                                    const BSONElement& configElement,
+                                                    Milliseconds budget) const {
+    stdx::lock_guard<Latch> lk(_cacheMutex);
+    const auto now = opCtx->getServiceContext()->getFastClockSource()->now();
+    if (_cacheGeneratedAt == Date_t{} || now - _cacheGeneratedAt > budget) {
+        auto section = generateSection(opCtx, configElement);
+        if (section.isEmpty()) {
+            return section;
+        }
+        _cachedSection = section.getOwned();
+        _cacheGeneratedAt = now;
+    }
+    return _cachedSection;
+}
+
 ServerStatusSectionRegistry* ServerStatusSectionRegistry::instance() {
     static ServerStatusSectionRegistry instance;
     return &instance;
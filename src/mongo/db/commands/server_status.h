@@ -41,6 +41,9 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
@@ -88,6 +91,26 @@ public:
         return Status::OK();
     }
 
+    /**
+     * Sections that are expensive to generate may declare a staleness budget: an upper bound on
+     * how stale a previously generated result may be while still being served. When the budget is
+     * non-zero, the default appendSection() below caches the generated BSON and reuses it for
+     * invocations that arrive within the budget, so that concurrent or high-frequency monitoring
+     * polls coalesce onto one generation instead of each contending for the underlying data
+     * structures.
+     *
+     * Only invocations without section-specific configuration (a missing 'configElement') consult
+     * the cache, since generateSection() output may depend on the configuration; passing any
+     * configuration always generates fresh output. checkAuthForOperation() is still consulted per
+     * invocation by the serverStatus command, so cached results are only served to authorized
+     * callers.
+     *
+     * The default of zero disables caching and generates the section on every invocation.
+     */
+    virtual Milliseconds stalenessBudget() const {
+        return Milliseconds{0};
+    }
+
     /**
      * actually generate the result
      *
@@ -115,15 +138,34 @@ public:
     virtual void appendSection(OperationContext* opCtx,
                                const BSONElement& configElement,
                                BSONObjBuilder* result) const {
-        const auto ret = generateSection(opCtx, configElement);
+        const auto budget = stalenessBudget();
+        const auto ret = (budget > Milliseconds{0} && configElement.eoo())
+            ? _generateSectionCached(opCtx, configElement, budget)
+            : generateSection(opCtx, configElement);
         if (ret.isEmpty())
             return;
         result->append(getSectionName(), ret);
     }
 
 private:
+    /**
+     * Returns the cached result of generateSection(), regenerating it first if the cached value
+     * is older than 'budget'. Generation happens under '_cacheMutex', so concurrent callers wait
+     * for a single regeneration and then share its result. Empty results (a section that could
+     * not currently be generated) are returned but not cached, so the next caller retries.
+     */
+    BSONObj _generateSectionCached(OperationContext* opCtx,
+                                   const BSONElement& configElement,
+                                   Milliseconds budget) const;
+
     const std::string _sectionName;
     const ClusterRole _role;
+
+    // Guards the cached section result below. Only sections with a non-zero staleness budget use
+    // the cache.
+    mutable Mutex _cacheMutex = MONGO_MAKE_LATCH("ServerStatusSection::_cacheMutex");
+    mutable Date_t _cacheGeneratedAt;
+    mutable BSONObj _cachedSection;
 };
 
 /**
@@ -995,6 +995,23 @@ bool Locker::_acquireTicket(OperationContext* opCtx, LockMode mode, Date_t deadl
         // hole.
         invariant(!shard_role_details::getRecoveryUnit(opCtx)->isTimestamped());
 
+        // On a read-pressured secondary - one whose applied optime is trailing the majority
+        // commit point - eligible low-priority reads back off before queueing for a ticket so the
+        // oplog applier gets first claim on storage engine resources. The backoff is interruptible
+        // and deadline-aware: operations without room for it before their deadline skip it.
+        if (reader &&
+            ExecutionAdmissionContext::get(opCtx).getPriority() ==
+                AdmissionContext::Priority::kLow &&
+            !opCtx->uninterruptibleLocksRequested_DO_NOT_USE()) {  // NOLINT
+            if (auto backoff = _ticketHolderManager->lowPriorityReadsBackoff();
+                backoff > Milliseconds(0)) {
+                const auto backoffUntil = Date_t::now() + backoff;
+                if (backoffUntil < deadline) {
+                    opCtx->sleepUntil(backoffUntil);
+                }
+            }
+        }
+
         _ticket = [&]() {
             ExecutionAdmissionContext* admCtx = &ExecutionAdmissionContext::get(opCtx);
             if (opCtx->uninterruptibleLocksRequested_DO_NOT_USE()) {  // NOLINT
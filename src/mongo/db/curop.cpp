@@ -32,6 +32,7 @@
 #include "mongo/db/curop.h"
 
 #include <absl/container/flat_hash_set.h>
+#include <algorithm>
 #include <boost/optional.hpp>
 #include <fmt/format.h>
 #include <ostream>
@@ -115,6 +116,42 @@ BSONObj serializeDollarDbInOpDescription(boost::optional<TenantId> tenantId,
     return newCmdObj;
 }
 
+/**
+ * Parses a W3C 'traceparent' value ("00-<16 byte trace id>-<8 byte parent id>-<flags>", all
+ * lowercase hex) and returns the trace and parent ids, or boost::none if 'value' is not a valid
+ * version-00 traceparent. Drivers attach trace context via the 'comment' field - either as the
+ * whole comment string or as a 'traceparent' field of a comment object - and the comment is
+ * forwarded verbatim to the shards, so surfacing the parsed ids on every node links one client
+ * request's slow-op lines across the cluster.
+ */
+boost::optional<std::pair<StringData, StringData>> parseTraceparent(StringData value) {
+    // version(2) '-' traceId(32) '-' parentId(16) '-' flags(2)
+    constexpr size_t kLength = 55;
+    if (value.size() != kLength || value[2] != '-' || value[35] != '-' || value[52] != '-') {
+        return boost::none;
+    }
+
+    auto isLowerHex = [](StringData s) {
+        return std::all_of(s.begin(), s.end(), [](char c) {
+            return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f');
+        });
+    };
+    auto isAllZero = [](StringData s) {
+        return std::all_of(s.begin(), s.end(), [](char c) { return c == '0'; });
+    };
+
+    const StringData version = value.substr(0, 2);
+    const StringData traceId = value.substr(3, 32);
+    const StringData parentId = value.substr(36, 16);
+    const StringData flags = value.substr(53, 2);
+    if (version != "00" || !isLowerHex(traceId) || !isLowerHex(parentId) || !isLowerHex(flags) ||
+        isAllZero(traceId) || isAllZero(parentId)) {
+        return boost::none;
+    }
+
+    return std::make_pair(traceId, parentId);
+}
+
 MONGO_INITIALIZER(InitGlobalQueueLookupTable)(InitializerContext*) {
     gQueueMetricsRegistry["ingress"] = [](OperationContext* opCtx) {
         return &IngressAdmissionContext::get(opCtx);
@@ -218,7 +255,7 @@ private:
 };
 
 const OperationContext::Decoration<CurOp::CurOpStack> CurOp::_curopStack =
-    OperationContext::declareDecoration<CurOp::CurOpStack>();
+    OperationContext::declareDecoration<CurOp::CurOpStack>(DecorationAccess::kHot);
 
 void CurOp::push(OperationContext* opCtx) {
     _curopStack(opCtx).push(this);
@@ -1360,6 +1397,30 @@ void OpDebug::report(OperationContext* opCtx,
         pAttrs->add("remoteOpWaitMillis", durationCount<Milliseconds>(*remoteOpWaitTime));
     }
 
+    // If the client attached a W3C trace context through the comment, surface the ids as
+    // first-class attributes so log tooling can join this line with the client's trace and with
+    // the corresponding lines on other nodes. Parsing happens only for operations that are being
+    // logged, never on the regular operation path.
+    if (auto comment = opCtx->getComment()) {
+        auto traceparent = [&]() -> boost::optional<StringData> {
+            if (comment->type() == BSONType::String) {
+                return comment->valueStringData();
+            }
+            if (comment->type() == BSONType::Object) {
+                if (auto tp = comment->Obj()["traceparent"]; tp.type() == BSONType::String) {
+                    return tp.valueStringData();
+                }
+            }
+            return boost::none;
+        }();
+        if (traceparent) {
+            if (auto ids = parseTraceparent(*traceparent)) {
+                pAttrs->addDeepCopy("traceId", std::string{ids->first});
+                pAttrs->addDeepCopy("parentSpanId", std::string{ids->second});
+            }
+        }
+    }
+
     BSONObjBuilder queuesBuilder;
     for (auto&& [queueName, lookup] : gQueueMetricsRegistry) {
         AdmissionContext* admCtx = lookup(opCtx);
@@ -1376,6 +1437,49 @@ void OpDebug::report(OperationContext* opCtx,
 
     pAttrs->add("queues", queuesBuilder.obj());
 
+    // Roll the phase timers reported in the flat attributes above into one nested breakdown:
+    // total time divides into time spent working and time spent blocked, with blocked time
+    // attributed to its cause. Only non-zero phases are emitted. The flat attributes remain
+    // authoritative; this view saves fleet tooling from re-deriving the hierarchy per log line.
+    {
+        BSONObjBuilder blocked;
+        if (lockStats) {
+            if (auto micros = lockStats->getCumulativeWaitTimeMicros(); micros > 0) {
+                blocked.append("lockWaitMicros", micros);
+            }
+        }
+        if (auto queued = durationCount<Microseconds>(
+                ExecutionAdmissionContext::get(opCtx).totalTimeQueuedMicros());
+            queued > 0) {
+            blocked.append("ticketWaitMicros", queued);
+        }
+        if (flowControlStats.timeAcquiringMicros > 0) {
+            blocked.append("flowControlWaitMicros", flowControlStats.timeAcquiringMicros);
+        }
+        if (prepareConflictDurationMillis > Milliseconds::zero()) {
+            blocked.append("prepareConflictWaitMicros",
+                           durationCount<Microseconds>(prepareConflictDurationMillis));
+        }
+        if (waitForWriteConcernDurationMillis > Milliseconds::zero()) {
+            blocked.append("writeConcernWaitMicros",
+                           durationCount<Microseconds>(waitForWriteConcernDurationMillis));
+        }
+
+        BSONObjBuilder breakdown;
+        if (workingTimeMillis > Milliseconds::zero()) {
+            breakdown.append("workingMicros", durationCount<Microseconds>(workingTimeMillis));
+        }
+        if (planningTime > Microseconds::zero()) {
+            breakdown.append("planningMicros", durationCount<Microseconds>(planningTime));
+        }
+        if (auto blockedObj = blocked.obj(); !blockedObj.isEmpty()) {
+            breakdown.append("blocked", blockedObj);
+        }
+        if (auto breakdownObj = breakdown.obj(); !breakdownObj.isEmpty()) {
+            pAttrs->add("durationBreakdown", breakdownObj);
+        }
+    }
+
     if (gFeatureFlagLogSlowOpsBasedOnTimeWorking.isEnabled(
             serverGlobalParams.featureCompatibility.acquireFCVSnapshot())) {
         // workingMillis should always be present for any operation
@@ -82,7 +82,7 @@
 #include "mongo/util/progress_meter.h"
 #include "mongo/util/serialization_context.h"
 #include "mongo/util/string_map.h"
-#include "mongo/util/system_tick_source.h"
+#include "mongo/util/tsc_tick_source.h"
 #include "mongo/util/tick_source.h"
 
 #ifndef MONGO_CONFIG_USE_RAW_LATCHES
@@ -1268,7 +1268,7 @@ private:
 
     SharedUserAcquisitionStats _userAcquisitionStats{std::make_shared<UserAcquisitionStats>()};
 
-    TickSource* _tickSource = globalSystemTickSource();
+    TickSource* _tickSource = globalDefaultTickSource();
     // These values are used to calculate the amount of time spent planning a query.
     std::atomic<TickSource::Tick> _queryPlanningStart{0};  // NOLINT
     std::atomic<TickSource::Tick> _queryPlanningEnd{0};    // NOLINT
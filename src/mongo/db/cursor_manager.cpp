@@ -73,7 +73,7 @@
 namespace mongo {
 namespace {
 
-constexpr int kNumPartitions = 16;
+constexpr int kNumPartitions = 64;
 
 const auto serviceCursorManager =
     ServiceContext::declareDecoration<std::unique_ptr<CursorManager>>();
@@ -198,41 +198,54 @@ StatusWith<ClientCursorPin> CursorManager::pinCursor(
     CursorId id,
     const std::function<void(const ClientCursor&)>& checkPinAllowed,
     AuthCheck checkSessionAuth) {
-    auto lockedPartition = _cursorMap->lockOnePartition(id);
-    auto it = lockedPartition->find(id);
-    if (it == lockedPartition->end()) {
-        return {ErrorCodes::CursorNotFound, str::stream() << "cursor id " << id << " not found"};
-    }
+    ClientCursor* cursor;
+    {
+        auto lockedPartition = _cursorMap->lockOnePartition(id);
+        auto it = lockedPartition->find(id);
+        if (it == lockedPartition->end()) {
+            return {ErrorCodes::CursorNotFound,
+                    str::stream() << "cursor id " << id << " not found"};
+        }
 
-    ClientCursor* cursor = it->second;
-    uassert(ErrorCodes::CursorInUse,
-            str::stream() << "cursor id " << id << " is already in use",
-            !cursor->_operationUsingCursor);
-    if (cursor->getExecutor()->isMarkedAsKilled()) {
-        // This cursor was killed while it was idle.
-        Status error = cursor->getExecutor()->getKillStatus();
-        LOGV2_DEBUG(8928403,
-                    2,
-                    "Cursor was killed while it was idle",
-                    "cursorId"_attr = cursor->cursorid(),
-                    "killStatus"_attr = error);
-        deregisterAndDestroyCursor(std::move(lockedPartition),
-                                   opCtx,
-                                   std::unique_ptr<ClientCursor, ClientCursor::Deleter>(cursor));
-        return error;
-    }
+        cursor = it->second;
+        uassert(ErrorCodes::CursorInUse,
+                str::stream() << "cursor id " << id << " is already in use",
+                !cursor->_operationUsingCursor);
+        if (cursor->getExecutor()->isMarkedAsKilled()) {
+            // This cursor was killed while it was idle.
+            Status error = cursor->getExecutor()->getKillStatus();
+            LOGV2_DEBUG(8928403,
+                        2,
+                        "Cursor was killed while it was idle",
+                        "cursorId"_attr = cursor->cursorid(),
+                        "killStatus"_attr = error);
+            deregisterAndDestroyCursor(
+                std::move(lockedPartition),
+                opCtx,
+                std::unique_ptr<ClientCursor, ClientCursor::Deleter>(cursor));
+            return error;
+        }
 
-    if (checkSessionAuth == kCheckSession) {
-        auto cursorPrivilegeStatus = checkCursorSessionPrivilege(opCtx, cursor->getSessionId());
-        if (!cursorPrivilegeStatus.isOK()) {
-            return cursorPrivilegeStatus;
+        if (checkSessionAuth == kCheckSession) {
+            auto cursorPrivilegeStatus = checkCursorSessionPrivilege(opCtx, cursor->getSessionId());
+            if (!cursorPrivilegeStatus.isOK()) {
+                return cursorPrivilegeStatus;
+            }
+        }
+
+        if (checkPinAllowed) {
+            checkPinAllowed(*cursor);
         }
-    }
 
-    if (checkPinAllowed) {
-        checkPinAllowed(*cursor);
+        cursor->_operationUsingCursor = opCtx;
     }
 
+    // The cursor is now claimed by this operation, so the partition lock is no longer needed:
+    // other operations cannot pin the cursor, and killCursor() interacts with an in-use cursor
+    // only by interrupting '_operationUsingCursor' and marking the cursor kill pending. Keeping
+    // the remaining work outside the critical section keeps getMore storms from serializing on
+    // the partition lock.
+
     // Pass along the original queryHash and planCacheKey for slow query logging.
     CurOp::get(opCtx)->debug().queryHash = cursor->_queryHash;
     CurOp::get(opCtx)->debug().planCacheKey = cursor->_planCacheKey;
@@ -242,10 +255,12 @@ StatusWith<ClientCursorPin> CursorManager::pinCursor(
     CurOp::get(opCtx)->debug().queryStatsInfo.willNeverExhaust =
         cursor->_queryStatsWillNeverExhaust;
 
-    cursor->_operationUsingCursor = opCtx;
+    LOGV2_DEBUG(8928404, 2, "Pinning cursor", "cursorId"_attr = cursor->cursorid());
+    auto pin = ClientCursorPin(opCtx, cursor, this);
 
     // We use pinning of a cursor as a proxy for active, user-initiated use of a cursor.  Therefore,
-    // we pass down to the logical session cache and vivify the record (updating last use).
+    // we pass down to the logical session cache and vivify the record (updating last use). On
+    // failure the pin's destructor checks the cursor back in.
     if (cursor->getSessionId()) {
         auto vivifyCursorStatus =
             LogicalSessionCache::get(opCtx)->vivify(opCtx, cursor->getSessionId().value());
@@ -254,8 +269,6 @@ StatusWith<ClientCursorPin> CursorManager::pinCursor(
         }
     }
 
-    LOGV2_DEBUG(8928404, 2, "Pinning cursor", "cursorId"_attr = cursor->cursorid());
-    auto pin = ClientCursorPin(opCtx, cursor, this);
     pin.unstashResourcesOntoOperationContext();
     return StatusWith(std::move(pin));
 }
@@ -281,6 +281,14 @@ PlanStage::StageState BatchedDeleteStage::_deleteBatch(WorkingSetID* out) {
         return saveRet;
     }
 
+    // Delete in RecordId order. When the deletes are driven by an index scan (e.g. a TTL pass)
+    // the staged documents arrive in index order, and deleting them that way walks the record
+    // store randomly; sorting the batch turns those accesses near-sequential. Each staged delete
+    // is re-validated against the query before it is executed, so the order is free to change.
+    if (_stagedDeletesBuffer.size() > 1) {
+        _stagedDeletesBuffer.sortByRecordId();
+    }
+
     std::set<WorkingSetID> recordsToSkip;
     unsigned int docsDeleted = 0;
     unsigned int bytesDeleted = 0;
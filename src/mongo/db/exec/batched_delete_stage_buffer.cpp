@@ -80,6 +80,12 @@ void BatchedDeleteStageBuffer::erase(const std::set<WorkingSetID>& idsToRemove)
                   _buffer.end());
 }
 
+void BatchedDeleteStageBuffer::sortByRecordId() {
+    std::sort(_buffer.begin(), _buffer.end(), [&](WorkingSetID lhs, WorkingSetID rhs) {
+        return _ws->get(lhs)->recordId < _ws->get(rhs)->recordId;
+    });
+}
+
 void BatchedDeleteStageBuffer::clear() {
     for (auto& workingSetMemberId : _buffer) {
         _ws->free(workingSetMemberId);
@@ -75,6 +75,13 @@ public:
      */
     void erase(const std::set<WorkingSetID>& idsToRemove);
 
+    /**
+     * Reorders the staged deletes by the RecordId of their WorkingSetMembers, so that committing
+     * the batch walks the record store (and indexes whose keys correlate with RecordId order) in
+     * near-sequential order rather than in the order the documents were staged.
+     */
+    void sortByRecordId();
+
     /**
      * Clears the buffer and frees up resources of the WorkingSetMembers associated with the removed
      * entries.
@@ -45,7 +45,6 @@
 #include "mongo/db/client.h"
 #include "mongo/db/exec/collection_scan.h"
 #include "mongo/db/exec/collection_scan_common.h"
-#include "mongo/db/exec/filter.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
@@ -165,6 +164,10 @@ CollectionScan::CollectionScan(ExpressionContext* expCtx,
 
 namespace {
 
+// Number of records pulled from the record cursor per nextBatch() call when batched reads are in
+// use. Kept modest so that scans with a stop bound do not read far past it.
+constexpr size_t kScanBatchSize = 64;
+
 /**
  * Returns the first document (owned) in the collection using the cursor 'newCursor' assuming that
  * the cursor has not been used and is unpositioned.
@@ -240,6 +243,14 @@ void CollectionScan::initCursor(OperationContext* opCtx,
     }
 }
 
+bool CollectionScan::useBatchedReads(const CollectionPtr& collPtr) const {
+    // Buffered records are returned across work() calls, so the cursor's position runs ahead of
+    // the last record this stage returned. That is unacceptable for tailable cursors, which must
+    // be able to reposition to the last returned record, and for capped collections and oplog
+    // timestamp tracking, where visibility depends on reading one record at a time.
+    return !_params.tailable && !_params.shouldTrackLatestOplogTimestamp && !collPtr->isCapped();
+}
+
 PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
     if (MONGO_unlikely(hangCollScanDoWork.shouldFail())) {
         hangCollScanDoWork.pauseWhileSet();
@@ -257,6 +268,7 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
     }
 
     boost::optional<Record> record;
+    bool servedFromBatch = false;
     const bool needToMakeCursor = !_cursor;
     const auto& collPtr = collectionPtr();
 
@@ -264,6 +276,12 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
         expCtx(),
         "CollectionScan",
         [&] {
+            if (_batchIndex < _batch.size()) {
+                record = _batch.at(_batchIndex++);
+                servedFromBatch = true;
+                return PlanStage::ADVANCED;
+            }
+
             if (needToMakeCursor) {
                 const bool forward = _params.direction == CollectionScanParams::FORWARD;
 
@@ -349,6 +367,17 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
                 }
             }
 
+            if (useBatchedReads(collPtr)) {
+                if (_cursor->nextBatch(&_batch, kScanBatchSize) > 0) {
+                    _batchSnapshotId =
+                        shard_role_details::getRecoveryUnit(opCtx())->getSnapshotId();
+                    record = _batch.at(0);
+                    _batchIndex = 1;
+                    servedFromBatch = true;
+                }
+                return PlanStage::ADVANCED;
+            }
+
             record = _cursor->next();
             return PlanStage::ADVANCED;
         },
@@ -388,14 +417,7 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
         setLatestOplogEntryTimestamp(*record);
     }
 
-    WorkingSetID id = _workingSet->allocate();
-    WorkingSetMember* member = _workingSet->get(id);
-    member->recordId = std::move(record->id);
-    member->resetDocument(shard_role_details::getRecoveryUnit(opCtx())->getSnapshotId(),
-                          record->data.releaseToBson());
-    _workingSet->transitionToRecordIdAndObj(id);
-
-    return returnIfMatches(member, id, out);
+    return returnIfMatches(*record, servedFromBatch, out);
 }
 
 void CollectionScan::setLatestOplogEntryTimestampToReadTimestamp() {
@@ -469,7 +491,7 @@ bool shouldIncludeEndRecord(const CollectionScanParams& params) {
         params.boundInclusion == CollectionScanParams::ScanBoundInclusion::kIncludeEndRecordOnly;
 }
 
-bool pastEndOfRange(const CollectionScanParams& params, const WorkingSetMember& member) {
+bool pastEndOfRange(const CollectionScanParams& params, const RecordId& recordId) {
     if (params.direction == CollectionScanParams::FORWARD) {
         // A forward scan ends with the maxRecord when it is specified.
         if (!params.maxRecord) {
@@ -477,8 +499,8 @@ bool pastEndOfRange(const CollectionScanParams& params, const WorkingSetMember&
         }
 
         const auto& endRecord = params.maxRecord->recordId();
-        return member.recordId > endRecord ||
-            (member.recordId == endRecord && !shouldIncludeEndRecord(params));
+        return recordId > endRecord ||
+            (recordId == endRecord && !shouldIncludeEndRecord(params));
     } else {
         // A backward scan ends with the minRecord when it is specified.
         if (!params.minRecord) {
@@ -486,12 +508,11 @@ bool pastEndOfRange(const CollectionScanParams& params, const WorkingSetMember&
         }
         const auto& endRecord = params.minRecord->recordId();
 
-        return member.recordId < endRecord ||
-            (member.recordId == endRecord && !shouldIncludeEndRecord(params));
+        return recordId < endRecord || (recordId == endRecord && !shouldIncludeEndRecord(params));
     }
 }
 
-bool beforeStartOfRange(const CollectionScanParams& params, const WorkingSetMember& member) {
+bool beforeStartOfRange(const CollectionScanParams& params, const RecordId& recordId) {
     if (params.direction == CollectionScanParams::FORWARD) {
         // A forward scan begins with the minRecord when it is specified.
         if (!params.minRecord) {
@@ -499,36 +520,38 @@ bool beforeStartOfRange(const CollectionScanParams& params, const WorkingSetMemb
         }
 
         const auto& startRecord = params.minRecord->recordId();
-        return member.recordId < startRecord ||
-            (member.recordId == startRecord && !shouldIncludeStartRecord(params));
+        return recordId < startRecord ||
+            (recordId == startRecord && !shouldIncludeStartRecord(params));
     } else {
         // A backward scan begins with the maxRecord when specified.
         if (!params.maxRecord) {
             return false;
         }
         const auto& startRecord = params.maxRecord->recordId();
-        return member.recordId > startRecord ||
-            (member.recordId == startRecord && !shouldIncludeStartRecord(params));
+        return recordId > startRecord ||
+            (recordId == startRecord && !shouldIncludeStartRecord(params));
     }
 }
 }  // namespace
 
-PlanStage::StageState CollectionScan::returnIfMatches(WorkingSetMember* member,
-                                                      WorkingSetID memberID,
+PlanStage::StageState CollectionScan::returnIfMatches(Record& record,
+                                                      bool servedFromBatch,
                                                       WorkingSetID* out) {
     ++_specificStats.docsTested;
 
     // The 'maxRecord' bound is always inclusive, even if the query predicate is
     // an exclusive inequality like $lt. In such cases, we rely on '_filter' to either
     // exclude or include the endpoints as required by the user's query.
-    if (pastEndOfRange(_params, *member)) {
-        _workingSet->free(memberID);
+    if (pastEndOfRange(_params, record.id)) {
         _commonStats.isEOF = true;
         return PlanStage::IS_EOF;
     }
 
-    if (!Filter::passes(member, _filter)) {
-        _workingSet->free(memberID);
+    // Evaluate the filter against the raw record data before materializing a WorkingSetMember,
+    // so that records the filter rejects (e.g. the irrelevant oplog entries scanned by a
+    // single-collection change stream resuming on a busy cluster) do not pay for WorkingSet
+    // allocation and document ownership transfer.
+    if (_filter && !_filter->matchesBSON(record.data.toBson())) {
         if (_params.shouldReturnEofOnFilterMismatch) {
             _commonStats.isEOF = true;
             return PlanStage::IS_EOF;
@@ -538,7 +561,18 @@ PlanStage::StageState CollectionScan::returnIfMatches(WorkingSetMember* member,
     if (_params.stopApplyingFilterAfterFirstMatch) {
         _filter = nullptr;
     }
-    *out = memberID;
+
+    WorkingSetID id = _workingSet->allocate();
+    WorkingSetMember* member = _workingSet->get(id);
+    member->recordId = std::move(record.id);
+    // Records served from the read-ahead batch were fetched under the snapshot that was open when
+    // the batch was filled, which may be older than the current one if the plan has yielded since.
+    member->resetDocument(servedFromBatch
+                              ? _batchSnapshotId
+                              : shard_role_details::getRecoveryUnit(opCtx())->getSnapshotId(),
+                          record.data.releaseToBson());
+    _workingSet->transitionToRecordIdAndObj(id);
+    *out = id;
     return PlanStage::ADVANCED;
 }
 
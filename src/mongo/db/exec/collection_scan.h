@@ -103,10 +103,11 @@ protected:
 
 private:
     /**
-     * If the member (with id memberID) passes our filter, set *out to memberID and return that
-     * ADVANCED.  Otherwise, free memberID and return NEED_TIME.
+     * If 'record' passes our filter, materialize it into a WorkingSetMember, set *out to the
+     * member's id and return ADVANCED. Otherwise return NEED_TIME without touching the
+     * WorkingSet. The filter is evaluated against the raw record data.
      */
-    StageState returnIfMatches(WorkingSetMember* member, WorkingSetID memberID, WorkingSetID* out);
+    StageState returnIfMatches(Record& record, bool servedFromBatch, WorkingSetID* out);
 
     /**
      * Sets '_latestOplogEntryTimestamp' to the current read timestamp, if available. This is
@@ -126,6 +127,13 @@ private:
      */
     void initCursor(OperationContext* opCtx, const CollectionPtr& collPtr, bool forward);
 
+    /**
+     * Returns whether this scan may pull records from the cursor in batches rather than one at a
+     * time. Batched records are buffered in the stage and returned across work() calls, which is
+     * only legal when the cursor never needs to be repositioned to the last returned record.
+     */
+    bool useBatchedReads(const CollectionPtr& collPtr) const;
+
     // WorkingSet is not owned by us.
     WorkingSet* _workingSet;
 
@@ -138,6 +146,12 @@ private:
 
     RecordId _lastSeenId;  // Null if nothing has been returned from _cursor yet.
 
+    // Records read ahead through SeekableRecordCursor::nextBatch() but not yet returned, along
+    // with the snapshot they were read under. Only used when useBatchedReads() is true.
+    RecordBatch _batch;
+    size_t _batchIndex = 0;
+    SnapshotId _batchSnapshotId;
+
     // If _params.shouldTrackLatestOplogTimestamp is set and the collection is the oplog or a change
     // collection, this is the latest timestamp seen by the collection scan. For change collections,
     // on EOF we advance this timestamp to the latest timestamp in the global oplog.
@@ -27,18 +27,26 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
 
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/exec/count.h"
+#include "mongo/db/exec/count_scan.h"
 #include "mongo/util/assert_util_core.h"
 
 namespace mongo {
 
 using std::unique_ptr;
 
+namespace {
+// Number of index keys counted per CountScan::bulkCount() round. Bounds how long we go between
+// interrupt and yield checks while counting in bulk.
+constexpr long long kBulkCountBatchSize = 256;
+}  // namespace
+
 // static
 const char* CountStage::kStageType = "COUNT";
 
@@ -53,6 +61,10 @@ CountStage::CountStage(ExpressionContext* expCtx,
     invariant(_limit >= 0);
     invariant(child);
     _children.emplace_back(child);
+
+    if (child->stageType() == STAGE_COUNT_SCAN) {
+        _countScan = static_cast<CountScan*>(child);
+    }
 }
 
 bool CountStage::isEOF() {
@@ -75,6 +87,34 @@ PlanStage::StageState CountStage::doWork(WorkingSetID* out) {
     // For cases where we can't ask the record store directly, we should always have a child stage
     // from which we can retrieve results.
     invariant(child());
+
+    if (_countScan) {
+        // Count keys in bulk, straight off the index cursor, rather than round-tripping one
+        // working set member per key. Cap the batch so that we never count past the limit.
+        long long cap = kBulkCountBatchSize;
+        if (_limit > 0) {
+            cap = std::min(cap, _leftToSkip + _limit - _specificStats.nCounted);
+        }
+
+        long long counted = 0;
+        PlanStage::StageState state = _countScan->bulkCount(cap, &counted);
+
+        // Apply this round's keys to the skip before the count, even if the scan hit EOF or must
+        // yield: the keys have already been consumed from the index.
+        const long long skipped = std::min(counted, _leftToSkip);
+        _leftToSkip -= skipped;
+        _specificStats.nSkipped += skipped;
+        _specificStats.nCounted += counted - skipped;
+
+        if (PlanStage::IS_EOF == state) {
+            _commonStats.isEOF = true;
+            return PlanStage::IS_EOF;
+        } else if (PlanStage::NEED_YIELD == state) {
+            return PlanStage::NEED_YIELD;
+        }
+        return PlanStage::NEED_TIME;
+    }
+
     WorkingSetID id = WorkingSet::INVALID_ID;
     PlanStage::StageState state = child()->work(&id);
 
@@ -39,6 +39,8 @@
 
 namespace mongo {
 
+class CountScan;
+
 /**
  * Stage used by the count command. This stage sits at the root of a plan tree and counts the number
  * of results returned by its child stage.
@@ -86,6 +88,11 @@ private:
     // by us.
     WorkingSet* _ws;
 
+    // Set when our direct child is a CountScan, in which case we count keys in bulk via
+    // CountScan::bulkCount() rather than pulling one working set member per key. Null otherwise.
+    // Not owned by us; points into '_children'.
+    CountScan* _countScan = nullptr;
+
     CountStats _specificStats;
 };
 
@@ -183,6 +183,83 @@ PlanStage::StageState CountScan::doWork(WorkingSetID* out) {
     return PlanStage::ADVANCED;
 }
 
+PlanStage::StageState CountScan::bulkCount(long long cap, long long* counted) {
+    if (_commonStats.isEOF)
+        return PlanStage::IS_EOF;
+
+    // This method bypasses the work() wrapper, so account for the dispatch here. Each key examined
+    // is still reflected in the specific stats.
+    ++_commonStats.works;
+
+    bool exhausted = false;
+    const bool needInit = !_cursor;
+
+    const auto ret = handlePlanStageYield(
+        expCtx(),
+        "CountScan",
+        [&] {
+            boost::optional<IndexKeyEntry> entry;
+            if (needInit) {
+                // First access. Perform cursor init.
+                _cursor = indexAccessMethod()->newCursor(opCtx());
+                _cursor->setEndPosition(_endKey, _endKeyInclusive);
+
+                key_string::Builder builder(
+                    indexAccessMethod()->getSortedDataInterface()->getKeyStringVersion());
+                auto keyStringForSeek = IndexEntryComparison::makeKeyStringFromBSONKeyForSeek(
+                    _startKey,
+                    indexAccessMethod()->getSortedDataInterface()->getOrdering(),
+                    true, /* forward */
+                    _startKeyInclusive,
+                    builder);
+                entry = _cursor->seek(keyStringForSeek,
+                                      SortedDataInterface::Cursor::KeyInclusion::kExclude);
+            } else {
+                entry = _cursor->next(SortedDataInterface::Cursor::KeyInclusion::kExclude);
+            }
+
+            for (long long reported = 0;;) {
+                if (!entry) {
+                    exhausted = true;
+                    break;
+                }
+
+                ++_specificStats.keysExamined;
+
+                if (!_shouldDedup || _returned.insert(entry->loc).second) {
+                    ++(*counted);
+                    if (++reported >= cap) {
+                        break;
+                    }
+                }
+
+                entry = _cursor->next(SortedDataInterface::Cursor::KeyInclusion::kExclude);
+            }
+            return PlanStage::ADVANCED;
+        },
+        [&] {
+            // yieldHandler
+            if (needInit) {
+                // Release our cursor and try again next time.
+                _cursor.reset();
+            }
+        });
+
+    if (ret != PlanStage::ADVANCED) {
+        ++_commonStats.needYield;
+        return ret;
+    }
+
+    if (exhausted) {
+        _commonStats.isEOF = true;
+        _cursor.reset();
+        return PlanStage::IS_EOF;
+    }
+
+    ++_commonStats.needTime;
+    return PlanStage::NEED_TIME;
+}
+
 bool CountScan::isEOF() {
     return _commonStats.isEOF;
 }
@@ -114,6 +114,18 @@ public:
     void doDetachFromOperationContext() final;
     void doReattachToOperationContext() final;
 
+    /**
+     * Counts up to 'cap' further keys in the scan's range directly off the index cursor, without
+     * materializing a working set member per key. Keys are accumulated into '*counted' as they are
+     * examined, so partial progress is preserved when the scan must yield mid-batch.
+     *
+     * Returns NEED_TIME while the scan may have more keys, NEED_YIELD if the storage engine
+     * requires a yield, and IS_EOF once the range is exhausted. Used by CountStage when this stage
+     * is its direct child and the per-key result protocol is pure overhead; doWork() remains for
+     * all other callers (e.g. when a trial period stage sits in between).
+     */
+    StageState bulkCount(long long cap, long long* counted);
+
     StageType stageType() const final {
         return STAGE_COUNT_SCAN;
     }
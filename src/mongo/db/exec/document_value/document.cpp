@@ -215,9 +215,26 @@ Position DocumentStorage::findField(T field, LookupPolicy policy) const {
         return pos;
     }
 
-    for (auto&& bsonElement : _bson) {
-        if (field == bsonElement.fieldNameStringData()) {
-            return const_cast<DocumentStorage*>(this)->constructInCache(bsonElement);
+    // Resume the scan of the backing BSON where the previous cache-miss lookup left off, wrapping
+    // around once so that every element is still visited exactly once.
+    auto cacheAndResumeAfter = [&](const BSONElement& elem) {
+        _bsonScanStart = (elem.rawdata() + elem.size()) - _bson.objdata();
+        return const_cast<DocumentStorage*>(this)->constructInCache(elem);
+    };
+
+    const char* const firstElem = _bson.objdata() + sizeof(int32_t);
+    const char* const scanStart = _bson.objdata() + _bsonScanStart;
+
+    for (BSONElement elem(scanStart); !elem.eoo();
+         elem = BSONElement(elem.rawdata() + elem.size())) {
+        if (field == elem.fieldNameStringData()) {
+            return cacheAndResumeAfter(elem);
+        }
+    }
+    for (BSONElement elem(firstElem); elem.rawdata() != scanStart;
+         elem = BSONElement(elem.rawdata() + elem.size())) {
+        if (field == elem.fieldNameStringData()) {
+            return cacheAndResumeAfter(elem);
         }
     }
 
@@ -392,6 +409,7 @@ intrusive_ptr<DocumentStorage> DocumentStorage::clone() const {
         dassert(out->_numFields == _numFields);
     }
 
+    out->_bsonScanStart = _bsonScanStart;
     out->_haveLazyLoadedMetadata = _haveLazyLoadedMetadata;
     out->_metadataFields = _metadataFields;
     out->_snapshottedSize = _snapshottedSize;
@@ -415,6 +433,7 @@ DocumentStorage::~DocumentStorage() {
 void DocumentStorage::reset(const BSONObj& bson, bool bsonHasMetadata) {
     _bson = bson;
     _numBytesFromBSONInCache = 0;
+    _bsonScanStart = sizeof(int32_t);
     _bsonHasMetadata = bsonHasMetadata;
     _modified = false;
     _snapshottedSize = 0;
@@ -110,5 +110,17 @@ void BM_FieldNameHasher(benchmark::State& state) {
 
 BENCHMARK(BM_FieldNameHasher)->RangeMultiplier(2)->Range(1, 1 << 8);
 
+/**
+ * Benchmarks string Value materialization around the inline short-string threshold: lengths at or
+ * below the threshold stay in ValueStorage, longer ones allocate a ref-counted buffer.
+ */
+void BM_valueStringMaterialization(benchmark::State& state) {
+    const std::string str(state.range(0), 'x');
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Value(StringData(str)));
+    }
+}
+
+BENCHMARK(BM_valueStringMaterialization)->DenseRange(4, 24, 4);
 
 }  // namespace mongo
@@ -727,6 +727,12 @@ private:
     // whole backing BSON, but only the portion of backing BSON that's not already in the cache.
     uint32_t _numBytesFromBSONInCache = 0;
 
+    // Byte offset into '_bson' at which the next cache-miss field lookup resumes its scan of the
+    // backing BSON. Lookups tend to arrive in document order, so resuming the scan (and wrapping
+    // around once) makes a sequence of first-time lookups cost one pass over the BSON in total
+    // rather than one pass per field.
+    mutable uint32_t _bsonScanStart = sizeof(int32_t);
+
     // Tracks whether or not the metadata has been lazy-loaded from the backing '_bson' object. If
     // so, then no attempt will be made to load the metadata again, even if the metadata has been
     // released by a call to 'releaseMetadata()'.
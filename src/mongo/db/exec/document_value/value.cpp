@@ -78,7 +78,7 @@ void ValueStorage::putString(StringData s) {
     const size_t sizeNoNUL = s.size();
     if (sizeNoNUL <= sizeof(shortStrStorage)) {
         shortStr = true;
-        shortStrSize = s.size();
+        shortStrSize = static_cast<uint8_t>(s.size());
         s.copyTo(shortStrStorage, false);  // no NUL
 
         // All memory is zeroed before this is called, so we know that
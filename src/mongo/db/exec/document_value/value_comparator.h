@@ -33,6 +33,7 @@
 #include <map>
 #include <set>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 
 #include "mongo/base/string_data.h"
@@ -203,6 +204,18 @@ public:
         return stdx::unordered_map<Value, T, Hasher, EqualTo>(0, Hasher(this), EqualTo(this));
     }
 
+    /**
+     * Construct an empty unordered map from Value to type T whose equivalence classes are given by
+     * this comparator, backed by an open-addressing table that stores its entries contiguously.
+     * Unlike the node-based map above, pointers and iterators into the map are invalidated by
+     * rehashing, so callers must not hold them across inserts. This comparator must outlive the
+     * returned map.
+     */
+    template <typename T>
+    absl::flat_hash_map<Value, T, Hasher, EqualTo> makeFlatUnorderedValueMap() const {
+        return absl::flat_hash_map<Value, T, Hasher, EqualTo>(0, Hasher(this), EqualTo(this));
+    }
+
 private:
     const StringDataComparator* _stringComparator = nullptr;
 };
@@ -227,4 +240,8 @@ template <typename T>
 using ValueUnorderedMap =
     stdx::unordered_map<Value, T, ValueComparator::Hasher, ValueComparator::EqualTo>;
 
+template <typename T>
+using ValueFlatUnorderedMap =
+    absl::flat_hash_map<Value, T, ValueComparator::Hasher, ValueComparator::EqualTo>;
+
 }  // namespace mongo
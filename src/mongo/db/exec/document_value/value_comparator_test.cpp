@@ -278,6 +278,18 @@ TEST(ValueComparatorTest, UnorderedMapOfValueRespectsCollation) {
     ASSERT_EQ(map[Value("fooZ"_sd)], 3);
 }
 
+TEST(ValueComparatorTest, FlatUnorderedMapOfValueRespectsCollation) {
+    CollatorInterfaceMock toLowerCollator(CollatorInterfaceMock::MockType::kToLowerString);
+    ValueComparator valueCmp(&toLowerCollator);
+    auto map = valueCmp.makeFlatUnorderedValueMap<int>();
+    map[Value("foo"_sd)] = 1;
+    map[Value("FOO"_sd)] = 2;
+    map[Value("FOOz"_sd)] = 3;
+    ASSERT_EQ(map.size(), 2U);
+    ASSERT_EQ(map[Value("FoO"_sd)], 2);
+    ASSERT_EQ(map[Value("fooZ"_sd)], 3);
+}
+
 TEST(ValueComparatorTest, ComparingCodeWScopeShouldNotRespectCollation) {
     const CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kAlwaysEqual);
     const ValueComparator comparator(&collator);
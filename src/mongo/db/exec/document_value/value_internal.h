@@ -332,6 +332,7 @@ public:
 
     StringData getString() const {
         if (shortStr) {
+            MONGO_STATIC_ASSERT(sizeof(shortStrStorage) < (1 << 4));  // Must fit the 4-bit size.
             return StringData(shortStrStorage, shortStrSize);
         } else {
             dassert(typeid(*genericRCPtr) == typeid(const RCString));
@@ -440,9 +441,10 @@ public:
 
             // bytes[1]
             struct {
-                uint8_t refCounter : 1;  // bit 0: true if we need to refCount
-                uint8_t shortStr : 1;    // bit 1: true if we are using short strings
-                uint8_t reservedFlags : 6;
+                uint8_t refCounter : 1;    // bit 0: true if we need to refCount
+                uint8_t shortStr : 1;      // bit 1: true if we are using short strings
+                uint8_t shortStrSize : 4;  // bits 2-5: length when shortStr, NUL not included
+                uint8_t reservedFlags : 2;
             };
 
             // bytes[2:15]
@@ -450,8 +452,9 @@ public:
                 unsigned char oid[12];
 
                 struct {
-                    char shortStrSize;  // TODO Consider moving into flags union (4 bits)
-                    char shortStrStorage[sizeof(bytes) - 3 /*offset*/ - 1 /*NUL byte*/];
+                    // Keeping the size in the flags byte above frees this byte for one more
+                    // character of inline storage.
+                    char shortStrStorage[sizeof(bytes) - 2 /*offset*/ - 1 /*NUL byte*/];
                     union {
                         char nulTerminator;
                     };
@@ -154,9 +154,20 @@ private:
         bab->append(element);
     }
     void _applyToRemainingFields(BSONObjIterator& it, BSONObjBuilder* bob) const {
-        // We processed all exclusions, rest of the elements are added to the output.
+        // We processed all exclusions, rest of the elements are added to the output. They are
+        // contiguous in the source buffer, so they are copied as a single range instead of one
+        // element at a time.
+        const char* runStart = nullptr;
+        int runLen = 0;
         while (it.more()) {
-            bob->append(it.next());
+            const BSONElement element = it.next();
+            if (!runStart) {
+                runStart = element.rawdata();
+            }
+            runLen += element.size();
+        }
+        if (runStart) {
+            bob->bb().appendBuf(runStart, runLen);
         }
     }
 
@@ -27,6 +27,7 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -37,6 +38,7 @@
 #include "mongo/db/exec/filter.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/query/plan_executor_impl.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/util/assert_util.h"
 
 namespace {
@@ -58,7 +60,8 @@ FetchStage::FetchStage(ExpressionContext* expCtx,
     : RequiresCollectionStage(kStageType, expCtx, collection),
       _ws(ws),
       _filter((filter && !filter->isTriviallyTrue()) ? filter : nullptr),
-      _idRetrying(WorkingSet::INVALID_ID) {
+      _idRetrying(WorkingSet::INVALID_ID),
+      _readaheadWindow(std::max(internalQueryFetchReadaheadWindow.load(), 0)) {
     _children.emplace_back(std::move(child));
 }
 
@@ -70,9 +73,58 @@ bool FetchStage::isEOF() {
         return false;
     }
 
+    if (!_readahead.empty()) {
+        return false;
+    }
+
     return child()->isEOF();
 }
 
+PlanStage::StageState FetchStage::nextFromReadahead(WorkingSetID* out) {
+    if (_readahead.empty()) {
+        std::vector<RecordId> toPrefetch;
+
+        // Bound the number of child work() calls as well as the number of buffered entries, so a
+        // stream of NEED_TIME results still returns control for interrupt and yield checks.
+        for (size_t works = 0; works < _readaheadWindow && _readahead.size() < _readaheadWindow;
+             ++works) {
+            WorkingSetID id = WorkingSet::INVALID_ID;
+            const StageState status = child()->work(&id);
+
+            if (PlanStage::ADVANCED == status) {
+                WorkingSetMember* member = _ws->get(id);
+                if (!member->hasObj() && member->hasRecordId()) {
+                    toPrefetch.push_back(member->recordId);
+                }
+                _readahead.push_back(id);
+                continue;
+            }
+            if (PlanStage::NEED_TIME == status) {
+                continue;
+            }
+            // EOF or a yield request ends the window. Buffered entries must be delivered first;
+            // the ending condition will surface again once the buffer is drained.
+            if (_readahead.empty()) {
+                return status;
+            }
+            break;
+        }
+
+        if (_readahead.empty()) {
+            return PlanStage::NEED_TIME;
+        }
+
+        // Warming a single record's page is no cheaper than letting the fetch read it.
+        if (toPrefetch.size() > 1) {
+            collectionPtr()->getRecordStore()->prefetchRecords(opCtx(), toPrefetch);
+        }
+    }
+
+    *out = _readahead.front();
+    _readahead.pop_front();
+    return PlanStage::ADVANCED;
+}
+
 PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
     if (MONGO_unlikely(hangFetchDoWork.shouldFail())) {
         hangFetchDoWork.pauseWhileSet();
@@ -86,7 +138,7 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
     WorkingSetID id;
     StageState status;
     if (_idRetrying == WorkingSet::INVALID_ID) {
-        status = child()->work(&id);
+        status = _readaheadWindow > 0 ? nextFromReadahead(&id) : child()->work(&id);
     } else {
         status = ADVANCED;
         id = _idRetrying;
@@ -140,6 +192,11 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
 }
 
 void FetchStage::doSaveStateRequiresCollection() {
+    // Buffered readahead members may carry objects backed by storage-engine memory.
+    for (const WorkingSetID id : _readahead) {
+        _ws->get(id)->makeObjOwnedIfNeeded();
+    }
+
     if (_cursor) {
         _cursor->saveUnpositioned();
     }
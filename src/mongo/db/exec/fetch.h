@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
 
 #include "mongo/db/exec/plan_stage.h"
@@ -93,9 +94,23 @@ private:
      */
     StageState returnIfMatches(WorkingSetMember* member, WorkingSetID memberID, WorkingSetID* out);
 
+    /**
+     * Runs the child up to '_readaheadWindow' entries ahead, hints the record store to warm the
+     * pages backing the buffered RecordIds, and pops the next buffered result into '*out'.
+     */
+    StageState nextFromReadahead(WorkingSetID* out);
+
     // Used to fetch Records from _collection.
     std::unique_ptr<SeekableRecordCursor> _cursor;
 
+    // Size of the readahead window, from 'internalQueryFetchReadaheadWindow'. 0 means readahead
+    // is disabled and the child is worked one entry at a time.
+    const size_t _readaheadWindow;
+
+    // Results pulled ahead from the child, in child order. Index keys in these members are owned,
+    // so they survive yields; the fetch itself re-establishes that each record still matches.
+    std::deque<WorkingSetID> _readahead;
+
     // _ws is not owned by us.
     WorkingSet* _ws;
 
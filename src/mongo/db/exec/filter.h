@@ -43,7 +43,7 @@ namespace mongo {
 class WorkingSetMatchableDocument : public MatchableDocument {
 public:
     WorkingSetMatchableDocument(WorkingSetMember* wsm)
-        : _wsm(wsm), _obj(_wsm->doc.value().toBson()) {}
+        : _wsm(wsm), _obj(_wsm->doc.value().toBson()), _iteratorUsed(false) {}
 
     // This is only called by a $where query.  The query system must be smart enough to realize
     // that it should do a fetch beforehand.
@@ -55,7 +55,15 @@ public:
         // BSONElementIterator does some interesting things with arrays that I don't think
         // SimpleArrayElementIterator does.
         if (_wsm->hasObj()) {
-            return new BSONElementIterator(path, _obj);
+            // Reuse the inline iterator when it is not already in use so that each predicate
+            // evaluated against this document does not pay for a heap allocation, mirroring
+            // BSONMatchableDocument.
+            if (_iteratorUsed) {
+                return new BSONElementIterator(path, _obj);
+            }
+            _iteratorUsed = true;
+            _iterator.reset(path, _obj);
+            return &_iterator;
         }
 
         // NOTE: This (kind of) duplicates code in WorkingSetMember::getFieldDotted.
@@ -90,12 +98,18 @@ public:
     }
 
     void releaseIterator(ElementIterator* iterator) const final {
-        delete iterator;
+        if (iterator == &_iterator) {
+            _iteratorUsed = false;
+        } else {
+            delete iterator;
+        }
     }
 
 private:
     WorkingSetMember* _wsm;
     BSONObj _obj;
+    mutable BSONElementIterator _iterator;
+    mutable bool _iteratorUsed;
 };
 
 class IndexKeyMatchableDocument : public MatchableDocument {
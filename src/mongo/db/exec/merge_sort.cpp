@@ -58,7 +58,7 @@ MergeSortStage::MergeSortStage(ExpressionContext* expCtx,
       _pattern(params.pattern),
       _collator(params.collator),
       _dedup(params.dedup),
-      _merging(StageWithValueComparison(ws, params.pattern, params.collator)) {}
+      _merging(StageWithValueComparison(params.pattern)) {}
 
 void MergeSortStage::addChild(std::unique_ptr<PlanStage> child) {
     _children.emplace_back(std::move(child));
@@ -122,6 +122,9 @@ PlanStage::StageState MergeSortStage::doWork(WorkingSetID* out) {
             value.stage = child;
             // Ensure that the BSONObj underlying the WorkingSetMember is owned in case we yield.
             member->makeObjOwnedIfNeeded();
+            // Extract the sort key once, up front, so that comparisons inside the priority queue
+            // don't have to.
+            extractSortKey(member, &value);
             _mergingData.push_front(value);
 
             // Insert the result (indirectly) into our priority queue.
@@ -162,69 +165,51 @@ PlanStage::StageState MergeSortStage::doWork(WorkingSetID* out) {
     return PlanStage::ADVANCED;
 }
 
+void MergeSortStage::extractSortKey(WorkingSetMember* member, StageWithValue* value) {
+    // Sort key parts extracted from a fetched document are not collation-encoded, unlike parts
+    // coming directly from an index key, so encode them here when the query is collated. After
+    // this every comparison between cached key parts is a plain bitwise compare, matching how
+    // index keys of a collated index compare to one another.
+    const bool needsCollationEncoding = _collator != nullptr && member->hasObj();
+
+    BSONObjIterator it(_pattern);
+    while (it.more()) {
+        BSONElement patternElt = it.next();
+
+        BSONElement elt;
+        MONGO_verify(member->getFieldDotted(patternElt.fieldName(), &elt));
+
+        // Encode the sort key part only if it contains some value.
+        if (needsCollationEncoding && elt.ok()) {
+            BSONObjBuilder objectBuilder;
+            CollationIndexKey::collationAwareIndexKeyAppend(elt, _collator, &objectBuilder);
+            value->encodedKeyBacking.push_back(objectBuilder.obj());
+            elt = value->encodedKeyBacking.back().firstElement();
+        }
+
+        value->sortKeyParts.push_back(elt);
+    }
+}
+
 // Is lhs less than rhs?  Note that priority_queue is a max heap by default so we invert
 // the return from the expected value.
 bool MergeSortStage::StageWithValueComparison::operator()(const MergingRef& lhs,
                                                           const MergingRef& rhs) {
-    WorkingSetMember* lhsMember = _ws->get(lhs->id);
-    WorkingSetMember* rhsMember = _ws->get(rhs->id);
-
     BSONObjIterator it(_pattern);
+    size_t keyPartIdx = 0;
     while (it.more()) {
         BSONElement patternElt = it.next();
-        string fn = patternElt.fieldName();
-
-        BSONElement lhsElt;
-        MONGO_verify(lhsMember->getFieldDotted(fn, &lhsElt));
-
-        // Determine if the left-hand side sort key part comes from an index key.
-        auto lhsIsFromIndexKey = !lhsMember->hasObj();
-
-        BSONElement rhsElt;
-        MONGO_verify(rhsMember->getFieldDotted(fn, &rhsElt));
-
-        // Determine if the right-hand side sort key part comes from an index key.
-        auto rhsIsFromIndexKey = !rhsMember->hasObj();
-
-        // A collator to use for comparing the sort keys. We need a collator when values of both
-        // operands are supplied from a document and the query is collated. Otherwise bit-wise
-        // comparison should be used.
-        const CollatorInterface* collatorToUse = nullptr;
-        BSONObj collationEncodedKeyPart;  // A backing storage for a collation-encoded key part
-                                          // (according to collator '_collator') of one of the
-                                          // operands - either 'lhsElt' or 'rhsElt'.
-
-        if (nullptr == _collator || (lhsIsFromIndexKey && rhsIsFromIndexKey)) {
-            // Either the query has no collation or both sort key parts come directly from index
-            // keys. If the query has no collation, then the query planner should have guaranteed
-            // that we don't need to perform any collation-aware comparisons here. If both sort key
-            // parts come from index keys, we may need to respect a collation but the index keys are
-            // already collation-encoded, therefore we don't need to perform a collation-aware
-            // comparison here.
-        } else if (!lhsIsFromIndexKey && !rhsIsFromIndexKey) {
-            // Both sort key parts were extracted from fetched documents. These parts are not
-            // collation-encoded, so we will need to perform a collation-aware comparison.
-            collatorToUse = _collator;
-        } else {
-            // One of the sort key parts was extracted from fetched documents. Encode that part
-            // using the query's collation.
-            auto& keyPartFetchedFromDocument = rhsIsFromIndexKey ? lhsElt : rhsElt;
-
-            // Encode the sort key part only if it contains some value.
-            if (keyPartFetchedFromDocument.ok()) {
-                collationEncodedKeyPart = encodeKeyPartWithCollation(keyPartFetchedFromDocument);
-                keyPartFetchedFromDocument = collationEncodedKeyPart.firstElement();
-            }
-        }
 
-        // false means don't compare field name.
-        int x = lhsElt.woCompare(rhsElt, false, collatorToUse);
+        // The cached key parts have already been collation-encoded where necessary, so comparing
+        // them bitwise is always correct. false means don't compare field name.
+        int x = lhs->sortKeyParts[keyPartIdx].woCompare(rhs->sortKeyParts[keyPartIdx], false);
         if (-1 == patternElt.number()) {
             x = -x;
         }
         if (x != 0) {
             return x > 0;
         }
+        ++keyPartIdx;
     }
 
     // A comparator for use with sort is required to model a strict weak ordering, so
@@ -233,13 +218,6 @@ bool MergeSortStage::StageWithValueComparison::operator()(const MergingRef& lhs,
     return false;
 }
 
-BSONObj MergeSortStage::StageWithValueComparison::encodeKeyPartWithCollation(
-    const BSONElement& keyPart) {
-    BSONObjBuilder objectBuilder;
-    CollationIndexKey::collationAwareIndexKeyAppend(keyPart, _collator, &objectBuilder);
-    return objectBuilder.obj();
-}
-
 unique_ptr<PlanStageStats> MergeSortStage::getStats() {
     _commonStats.isEOF = isEOF();
 
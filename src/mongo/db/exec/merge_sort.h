@@ -88,6 +88,16 @@ private:
         StageWithValue() : id(WorkingSet::INVALID_ID), stage(nullptr) {}
         WorkingSetID id;
         PlanStage* stage;
+
+        // The sort key parts for this result, one entry per field of the sort pattern. They are
+        // extracted (and collation-encoded where required) once, when the result is buffered, so
+        // that the O(log n) heap comparisons per advance are simple bitwise element compares
+        // rather than repeated getFieldDotted() walks over the working set member.
+        std::vector<BSONElement> sortKeyParts;
+
+        // Backing storage for any collation-encoded entries of 'sortKeyParts'. All other entries
+        // point into the working set member's owned object or index key data.
+        std::vector<BSONObj> encodedKeyBacking;
     };
 
     // This stage maintains a priority queue of results from each child stage so that it can quickly
@@ -95,25 +105,26 @@ private:
     // MergingRef, an iterator which refers to a buffered (WorkingSetMember, child stage) pair.
     typedef std::list<StageWithValue>::iterator MergingRef;
 
-    // The comparison function used in our priority queue.
+    // The comparison function used in our priority queue. Compares the sort key parts cached on
+    // the buffered results; any collation encoding has already been applied by extractSortKey().
     class StageWithValueComparison {
     public:
-        StageWithValueComparison(WorkingSet* ws, BSONObj pattern, const CollatorInterface* collator)
-            : _ws(ws), _pattern(pattern), _collator(collator) {}
+        StageWithValueComparison(BSONObj pattern) : _pattern(pattern) {}
 
         // Is lhs less than rhs?  Note that priority_queue is a max heap by default so we invert
         // the return from the expected value.
         bool operator()(const MergingRef& lhs, const MergingRef& rhs);
 
     private:
-        // Encodes sort key part 'keyPart' according to the collation of the query.
-        BSONObj encodeKeyPartWithCollation(const BSONElement& keyPart);
-
-        WorkingSet* _ws;
         BSONObj _pattern;
-        const CollatorInterface* _collator;
     };
 
+    /**
+     * Extracts the sort key parts for 'member' into 'value', collation-encoding any parts that
+     * come from a fetched document rather than an index key.
+     */
+    void extractSortKey(WorkingSetMember* member, StageWithValue* value);
+
     // Not owned by us.
     WorkingSet* _ws;
 
@@ -243,11 +243,19 @@ Status MultiPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
                                              internalQueryPlanEvaluationCollFraction.load());
     size_t numResults = trial_period::getTrialPeriodNumToReturn(*_query);
 
+    // Working each candidate for several consecutive calls per round keeps its stage tree and
+    // working set hot in cache and amortizes the per-round yield checks, without changing the
+    // overall work budget or how plan_ranker scores the candidates.
+    const size_t quantum =
+        static_cast<size_t>(std::max(internalQueryMultiPlanWorkQuantum.load(), 1));
+
     try {
         // Work the plans, stopping when a plan hits EOF or returns some fixed number of results.
         size_t ix = 0;
-        for (; ix < numWorks; ++ix) {
-            bool moreToDo = workAllPlans(numResults, yieldPolicy);
+        for (; ix < numWorks;) {
+            const size_t roundWorks = std::min(quantum, numWorks - ix);
+            bool moreToDo = workAllPlans(numResults, yieldPolicy, roundWorks);
+            ix += roundWorks;
             if (!moreToDo) {
                 break;
             }
@@ -314,7 +322,7 @@ Status MultiPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
     return Status::OK();
 }
 
-bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolicy) {
+bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolicy, size_t quantum) {
     bool doneWorking = false;
 
     for (size_t ix = 0; ix < _candidates.size(); ++ix) {
@@ -326,59 +334,63 @@ bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolic
         // Might need to yield between calls to work due to the timer elapsing.
         tryYield(yieldPolicy);
 
-        WorkingSetID id = WorkingSet::INVALID_ID;
-        PlanStage::StageState state;
-        try {
-            state = candidate.root->work(&id);
-        } catch (const ExceptionFor<ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed>& ex) {
-            // If a candidate fails due to exceeding allowed resource consumption, then mark the
-            // candidate as failed but proceed with the multi-plan trial period. The MultiPlanStage
-            // as a whole only fails if _all_ candidates hit their resource consumption limit, or if
-            // a different, query-fatal error code is thrown.
-            candidate.status = ex.toStatus();
-            ++_failureCount;
-
-            // If all children have failed, then rethrow. Otherwise, swallow the error and move onto
-            // the next candidate plan.
-            if (_failureCount == _candidates.size()) {
-                throw;
-            }
-
-            continue;
-        }
-
-        if (PlanStage::ADVANCED == state) {
-            // Save result for later.
-            WorkingSetMember* member = candidate.data->get(id);
-            // Ensure that the BSONObj underlying the WorkingSetMember is owned in case we choose to
-            // return the results from the 'candidate' plan.
-            member->makeObjOwnedIfNeeded();
-            candidate.results.push_back(id);
+        for (size_t q = 0; q < quantum; ++q) {
+            WorkingSetID id = WorkingSet::INVALID_ID;
+            PlanStage::StageState state;
+            try {
+                state = candidate.root->work(&id);
+            } catch (const ExceptionFor<ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed>& ex) {
+                // If a candidate fails due to exceeding allowed resource consumption, then mark the
+                // candidate as failed but proceed with the multi-plan trial period. The
+                // MultiPlanStage as a whole only fails if _all_ candidates hit their resource
+                // consumption limit, or if a different, query-fatal error code is thrown.
+                candidate.status = ex.toStatus();
+                ++_failureCount;
+
+                // If all children have failed, then rethrow. Otherwise, swallow the error and move
+                // onto the next candidate plan.
+                if (_failureCount == _candidates.size()) {
+                    throw;
+                }
 
-            // Once a plan returns enough results, stop working.
-            if (candidate.results.size() >= numResults) {
-                doneWorking = true;
-            }
-        } else if (PlanStage::IS_EOF == state) {
-            // First plan to hit EOF wins automatically.  Stop evaluating other plans.
-            // Assumes that the ranking will pick this plan.
-            doneWorking = true;
-        } else if (PlanStage::NEED_YIELD == state) {
-            invariant(id == WorkingSet::INVALID_ID);
-            // Run-time plan selection occurs before a WriteUnitOfWork is opened and it's not
-            // subject to TemporarilyUnavailableException's.
-            invariant(!expCtx()->getTemporarilyUnavailableException());
-            if (!yieldPolicy->canAutoYield()) {
-                throwWriteConflictException(
-                    "Write conflict during multi-planning selection period "
-                    "and yielding is disabled.");
+                break;
             }
 
-            if (yieldPolicy->canAutoYield()) {
-                yieldPolicy->forceYield();
+            if (PlanStage::ADVANCED == state) {
+                // Save result for later.
+                WorkingSetMember* member = candidate.data->get(id);
+                // Ensure that the BSONObj underlying the WorkingSetMember is owned in case we
+                // choose to return the results from the 'candidate' plan.
+                member->makeObjOwnedIfNeeded();
+                candidate.results.push_back(id);
+
+                // Once a plan returns enough results, stop working.
+                if (candidate.results.size() >= numResults) {
+                    doneWorking = true;
+                    break;
+                }
+            } else if (PlanStage::IS_EOF == state) {
+                // First plan to hit EOF wins automatically.  Stop evaluating other plans.
+                // Assumes that the ranking will pick this plan.
+                doneWorking = true;
+                break;
+            } else if (PlanStage::NEED_YIELD == state) {
+                invariant(id == WorkingSet::INVALID_ID);
+                // Run-time plan selection occurs before a WriteUnitOfWork is opened and it's not
+                // subject to TemporarilyUnavailableException's.
+                invariant(!expCtx()->getTemporarilyUnavailableException());
+                if (!yieldPolicy->canAutoYield()) {
+                    throwWriteConflictException(
+                        "Write conflict during multi-planning selection period "
+                        "and yielding is disabled.");
+                }
+
+                if (yieldPolicy->canAutoYield()) {
+                    yieldPolicy->forceYield();
+                }
+
+                tryYield(yieldPolicy);
             }
-
-            tryYield(yieldPolicy);
         }
     }
 
@@ -180,12 +180,13 @@ private:
     //
 
     /**
-     * Calls work on each child plan in a round-robin fashion. We stop when any plan hits EOF
-     * or returns 'numResults' results.
+     * Calls work on each child plan in a round-robin fashion, giving each plan up to 'quantum'
+     * consecutive work() calls per round. We stop when any plan hits EOF or returns 'numResults'
+     * results.
      *
      * Returns true if we need to keep working the plans and false otherwise.
      */
-    bool workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolicy);
+    bool workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolicy, size_t quantum);
 
     /**
      * Checks whether we need to perform either a timing-based yield or a yield for a document
@@ -37,6 +37,28 @@
 
 
 namespace mongo {
+PlanStage::StageState PlanStage::workBatch(WorkingSetBatch* out) {
+    const size_t workBudget = out->remainingCapacity();
+    for (size_t i = 0; i < workBudget; ++i) {
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        const StageState state = work(&id);
+
+        if (StageState::ADVANCED == state) {
+            out->push(id);
+            if (out->full()) {
+                return StageState::ADVANCED;
+            }
+        } else if (StageState::NEED_TIME != state) {
+            // EOF or a yield request ends the batch. If results are already buffered they must be
+            // delivered first; the ending condition will surface again on the next call.
+            return out->empty() ? state : StageState::ADVANCED;
+        }
+    }
+
+    // The work budget was exhausted by NEED_TIME results before the batch filled up.
+    return out->empty() ? StageState::NEED_TIME : StageState::ADVANCED;
+}
+
 void PlanStage::saveState() {
     ++_commonStats.yields;
     for (auto&& child : _children) {
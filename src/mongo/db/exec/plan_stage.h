@@ -40,6 +40,7 @@
 #include "mongo/db/exec/plan_stats.h"
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set.h"
+#include "mongo/db/exec/working_set_batch.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/expression_context.h"
 #include "mongo/db/query/plan_summary_stats.h"
@@ -127,6 +128,15 @@ public:
         invariant(expCtx);
         if (expCtx->explain || expCtx->mayDbProfile) {
             markShouldCollectTimingInfo();
+        } else if (auto stride = internalQueryExecStatsSampleStride.load();
+                   MONGO_unlikely(stride > 1)) {
+            // Nobody is going to read the exact per-stage counters for this operation, so collect
+            // them in sampled mode: only every Nth work() call updates the counters, incrementing
+            // in steps of N so that the reported totals remain approximately correct. Operations
+            // that need exact stats (explain, profiling, multi planning) collect them at full
+            // fidelity; see markShouldCollectTimingInfo().
+            _statsSampleStride = static_cast<size_t>(stride);
+            _worksUntilNextSample = _statsSampleStride;
         }
     }
 
@@ -207,7 +217,20 @@ public:
     StageState work(WorkingSetID* out) {
         auto optTimer(getOptTimer());
 
-        ++_commonStats.works;
+        if (MONGO_unlikely(_statsSampleStride > 1) && --_worksUntilNextSample > 0) {
+            // Sampled stats mode: this call is not sampled, so skip all counter maintenance. The
+            // next sampled call accounts for the skipped ones by incrementing in stride-sized
+            // steps below.
+            try {
+                return doWork(out);
+            } catch (...) {
+                _commonStats.failed = true;
+                throw;
+            }
+        }
+        _worksUntilNextSample = _statsSampleStride;
+
+        _commonStats.works += _statsSampleStride;
 
         StageState workResult;
         try {
@@ -218,16 +241,36 @@ public:
         }
 
         if (StageState::ADVANCED == workResult) {
-            ++_commonStats.advanced;
+            _commonStats.advanced += _statsSampleStride;
         } else if (StageState::NEED_TIME == workResult) {
-            ++_commonStats.needTime;
+            _commonStats.needTime += _statsSampleStride;
         } else if (StageState::NEED_YIELD == workResult) {
-            ++_commonStats.needYield;
+            _commonStats.needYield += _statsSampleStride;
         }
 
         return workResult;
     }
 
+    /**
+     * Batched variant of work(). Appends consecutive ADVANCED results to 'out' until the batch is
+     * full, amortizing the per-document virtual dispatch through the stage tree over the whole
+     * batch for stages that override it.
+     *
+     * Returns ADVANCED if at least one result was appended during this call. Otherwise returns
+     * the state the last work() call would have returned. A non-ADVANCED state is never reported
+     * while results were buffered; the condition that produced it (EOF, a yield request) is
+     * rediscovered by the next call. Unlike work(), a NEED_YIELD result does not transport a
+     * WorkingSetID; no batching caller relies on the fetch-on-yield contract.
+     *
+     * The number of underlying work() calls per invocation is bounded by the batch's remaining
+     * capacity, so a long run of NEED_TIME results (e.g. a scan whose filter rejects most
+     * documents) still returns control to the caller for interrupt and yield checks.
+     *
+     * The default implementation loops work(), so stages that do not override workBatch() compose
+     * transparently with batching parents.
+     */
+    virtual StageState workBatch(WorkingSetBatch* out);
+
     /**
      * Returns true if no more work can be done on the query / out of results.
      */
@@ -364,6 +407,12 @@ public:
         } else {
             _commonStats.executionTime.precision = QueryExecTimerPrecision::kMillis;
         }
+
+        // Timing info is only requested when the stats are actually going to be consumed (explain,
+        // profiling, plan ranking during multi planning), so also switch counter collection back
+        // to full fidelity in case this stage was constructed in sampled mode.
+        _statsSampleStride = 1;
+        _worksUntilNextSample = 1;
     }
 
 protected:
@@ -437,6 +486,12 @@ protected:
     Children _children;
     mongo::CommonStats _commonStats;
 
+    // Controls sampled collection of the CommonStats counters maintained by work(). A stride of 1
+    // (the default) updates the counters on every call; a stride of N > 1 updates them on every
+    // Nth call only, in increments of N. See the constructor for how the mode is selected.
+    size_t _statsSampleStride = 1;
+    size_t _worksUntilNextSample = 1;
+
 private:
     OperationContext* _opCtx;
 
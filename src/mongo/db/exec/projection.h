@@ -68,6 +68,12 @@ public:
     bool isEOF() final;
     StageState doWork(WorkingSetID* out) final;
 
+    /**
+     * Pulls a whole batch from the child with a single dispatch and projects each buffered member
+     * in place.
+     */
+    StageState workBatch(WorkingSetBatch* out) final;
+
     std::unique_ptr<PlanStageStats> getStats() final;
 
     const SpecificStats* getSpecificStats() const final {
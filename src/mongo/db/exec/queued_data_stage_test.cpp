@@ -126,4 +126,52 @@ TEST_F(QueuedDataStageTest, ValidateStats) {
     unique_ptr<PlanStageStats> allStats(mock->getStats());
     ASSERT_TRUE(stats->isEOF);
 }
+
+//
+// Exercises the default PlanStage::workBatch() implementation, which loops work().
+//
+TEST_F(QueuedDataStageTest, WorkBatchDrainsQueuedResults) {
+    WorkingSet ws;
+    auto expCtx = make_intrusive<ExpressionContext>(opCtx(), nullptr, kNss);
+    auto mock = std::make_unique<QueuedDataStage>(expCtx.get(), &ws);
+
+    const size_t kNumResults = 5;
+    for (size_t i = 0; i < kNumResults; i++) {
+        mock->pushBack(ws.allocate());
+    }
+
+    // A batch bigger than the queue collects everything in one call and reports EOF on the next.
+    WorkingSetBatch batch(kNumResults + 1);
+    ASSERT_EQUALS(mock->workBatch(&batch), PlanStage::ADVANCED);
+    ASSERT_EQUALS(batch.size(), kNumResults);
+    ASSERT_EQUALS(mock->getCommonStats()->advanced, kNumResults);
+    for (size_t i = 0; i < kNumResults; i++) {
+        ASSERT_FALSE(batch.empty());
+        batch.pop();
+    }
+    ASSERT_TRUE(batch.empty());
+    ASSERT_EQUALS(mock->workBatch(&batch), PlanStage::IS_EOF);
+}
+
+TEST_F(QueuedDataStageTest, WorkBatchStopsWhenFull) {
+    WorkingSet ws;
+    auto expCtx = make_intrusive<ExpressionContext>(opCtx(), nullptr, kNss);
+    auto mock = std::make_unique<QueuedDataStage>(expCtx.get(), &ws);
+
+    for (size_t i = 0; i < 4; i++) {
+        mock->pushBack(ws.allocate());
+    }
+
+    WorkingSetBatch batch(3);
+    ASSERT_EQUALS(mock->workBatch(&batch), PlanStage::ADVANCED);
+    ASSERT_TRUE(batch.full());
+    ASSERT_EQUALS(batch.size(), 3U);
+
+    // Draining the batch recycles it for the remaining result.
+    while (!batch.empty()) {
+        batch.pop();
+    }
+    ASSERT_EQUALS(mock->workBatch(&batch), PlanStage::ADVANCED);
+    ASSERT_EQUALS(batch.size(), 1U);
+}
 }  // namespace
@@ -1049,6 +1049,7 @@ std::unique_ptr<sbe::PlanStage> SBENodeLowering::walk(const ABT& abtn,
                                           std::move(innerKeys),
                                           std::move(innerProjects),
                                           collatorSlot,
+                                          false /* allowDiskUse */,
                                           _yieldPolicy,
                                           getPlanNodeId(n));
 }
@@ -572,6 +572,73 @@ TEST_F(HashAggStageTest, HashAggBasicCountSpill) {
     stage->close();
 }
 
+TEST_F(HashAggStageTest, HashAggCountPartialSpill) {
+    // Size the memory budget so that the hash table reaches well past the minimum size for partial
+    // spilling before the first spill triggers, exercising the path that evicts only half of the
+    // groups and keeps aggregating into the rest.
+    auto defaultInternalQuerySBEAggApproxMemoryUseInBytesBeforeSpill =
+        internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill.load();
+    internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill.store(4096);
+    ON_BLOCK_EXIT([&] {
+        internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill.store(
+            defaultInternalQuerySBEAggApproxMemoryUseInBytesBeforeSpill);
+    });
+
+    auto ctx = makeCompileCtx();
+
+    // Build a scan over 400 distinct keys, each appearing twice.
+    BSONArrayBuilder bab;
+    for (int i = 0; i < 800; ++i) {
+        bab.append(i % 400);
+    }
+    auto [inputTag, inputVal] = stage_builder::makeValue(bab.arr());
+    auto [scanSlot, scanStage] = generateVirtualScan(inputTag, inputVal);
+
+    // Build a HashAggStage, group by the scanSlot and compute a simple count.
+    auto countsSlot = generateSlotId();
+    auto spillSlot = generateSlotId();
+    auto stage = makeS<HashAggStage>(
+        std::move(scanStage),
+        makeSV(scanSlot),
+        makeAggExprVector(
+            countsSlot,
+            nullptr,
+            stage_builder::makeFunction(
+                "sum",
+                makeE<EConstant>(value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(1)))),
+        makeSV(),  // Seek slot
+        true,
+        boost::none,
+        true /* allowDiskUse */,
+        makeSlotExprPairVec(
+            spillSlot, stage_builder::makeFunction("sum", stage_builder::makeVariable(spillSlot))),
+        nullptr /* yieldPolicy */,
+        kEmptyPlanNodeId);
+
+    // Prepare the tree and get the 'SlotAccessor' for the output slot.
+    auto resultAccessor = prepareTree(ctx.get(), stage.get(), countsSlot);
+
+    // Even though some groups were evicted mid-build while others stayed resident, every group
+    // must come out with the correct count after merging.
+    size_t numResults = 0;
+    while (stage->getNext() == PlanState::ADVANCED) {
+        auto [resTag, resVal] = resultAccessor->getViewOfValue();
+        ASSERT_EQ(value::TypeTags::NumberInt64, resTag);
+        ASSERT_EQ(2, value::bitcastTo<int64_t>(resVal));
+        ++numResults;
+    }
+    ASSERT_EQ(400, numResults);
+
+    auto stats = static_cast<const HashAggStats*>(stage->getSpecificStats());
+    ASSERT_TRUE(stats->usedDisk);
+    // At least one mid-build spill plus the final flush of the resident groups.
+    ASSERT_GTE(stats->spills, 2);
+    // Every group reaches the record store eventually, some as multiple partial aggregates.
+    ASSERT_GTE(stats->spilledRecords, 400);
+
+    stage->close();
+}
+
 TEST_F(HashAggStageTest, HashAggBasicCountNoSpillIfNoMemCheck) {
     // We estimate the size of result row like {int64, int64} at 50B. Set the memory threshold to
     // 64B so that exactly one row fits in memory and spill would be required. At the same time, set
@@ -43,6 +43,7 @@
 #include <absl/container/inlined_vector.h>
 #include <boost/optional/optional.hpp>
 
+#include "mongo/base/error_codes.h"
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/db/exec/sbe/expressions/compile_ctx.h"
@@ -54,10 +55,12 @@
 #include "mongo/db/exec/sbe/values/value.h"
 #include "mongo/db/query/collation/collator_interface.h"
 #include "mongo/db/query/collation/collator_interface_mock.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/sbe_stage_builder_helpers.h"
 #include "mongo/db/query/stage_types.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo::sbe {
 
@@ -100,6 +103,7 @@ TEST_F(HashJoinStageTest, HashJoinCollationTest) {
                                      makeSV(innerCondSlot),
                                      makeSV(),
                                      boost::optional<value::SlotId>{useCollator, collatorSlot},
+                                     false /* allowDiskUse */,
                                      nullptr /* yieldPolicy */,
                                      kEmptyPlanNodeId);
 
@@ -159,4 +163,103 @@ TEST_F(HashJoinStageTest, HashJoinCollationTest) {
     }
 }
 
+TEST_F(HashJoinStageTest, HashJoinSpillTest) {
+    // Set the memory threshold low enough that every build-side row triggers a spill, so that all
+    // matches have to be recovered from the spill table.
+    auto defaultMemoryLimit = internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.load();
+    internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.store(1);
+    ON_BLOCK_EXIT([&] {
+        internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.store(defaultMemoryLimit);
+    });
+
+    auto ctx = makeCompileCtx();
+
+    // Note the duplicate outer key, which makes consecutive spills append to the same record.
+    auto [outerTag, outerVal] = stage_builder::makeValue(BSON_ARRAY(1 << 2 << 3 << 2));
+    auto [outerCondSlot, outerStage] = generateVirtualScan(outerTag, outerVal);
+
+    auto [innerTag, innerVal] = stage_builder::makeValue(BSON_ARRAY(2 << 1 << 4));
+    auto [innerCondSlot, innerStage] = generateVirtualScan(innerTag, innerVal);
+
+    auto stage = makeS<HashJoinStage>(std::move(outerStage),
+                                      std::move(innerStage),
+                                      makeSV(outerCondSlot),
+                                      makeSV(),
+                                      makeSV(innerCondSlot),
+                                      makeSV(),
+                                      boost::none /* collatorSlot */,
+                                      true /* allowDiskUse */,
+                                      nullptr /* yieldPolicy */,
+                                      kEmptyPlanNodeId);
+
+    auto resultAccessors =
+        prepareTree(ctx.get(), stage.get(), makeSV(innerCondSlot, outerCondSlot));
+
+    // After running the join we expect to get back pairs of the keys that were matched up, with
+    // the outer key 2 matched twice.
+    std::vector<std::pair<int, int>> expectedVec = {{2, 2}, {2, 2}, {1, 1}};
+
+    auto [resultsTag, resultsVal] = getAllResultsMulti(stage.get(), resultAccessors);
+    value::ValueGuard resultsGuard{resultsTag, resultsVal};
+    ASSERT_EQ(resultsTag, value::TypeTags::Array);
+    auto resultsView = value::getArrayView(resultsVal);
+
+    ASSERT_EQ(resultsView->size(), expectedVec.size());
+    for (const auto& [inner, outer] : expectedVec) {
+        auto [expectedTag, expectedVal] = stage_builder::makeValue(BSON_ARRAY(inner << outer));
+        bool found = false;
+        for (size_t i = 0; i < resultsView->size(); i++) {
+            auto [tag, val] = resultsView->getAt(i);
+            auto [cmpTag, cmpVal] = compareValue(expectedTag, expectedVal, tag, val);
+            if (cmpTag == value::TypeTags::NumberInt32 && value::bitcastTo<int32_t>(cmpVal) == 0) {
+                found = true;
+                break;
+            }
+        }
+
+        ASSERT_TRUE(found);
+
+        releaseValue(expectedTag, expectedVal);
+    }
+
+    // Every insert exceeds the budget, so we expect one spill per build-side row.
+    auto stats = static_cast<const HashJoinStats*>(stage->getSpecificStats());
+    ASSERT_TRUE(stats->usedDisk);
+    ASSERT_EQ(stats->spills, 4);
+    ASSERT_EQ(stats->spilledRecords, 4);
+}
+
+TEST_F(HashJoinStageTest, HashJoinMemoryLimitNoDiskUseTest) {
+    // Set the memory threshold low enough that the first build-side row exceeds it. Since disk use
+    // is not allowed, opening the stage must fail rather than spill.
+    auto defaultMemoryLimit = internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.load();
+    internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.store(1);
+    ON_BLOCK_EXIT([&] {
+        internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.store(defaultMemoryLimit);
+    });
+
+    auto ctx = makeCompileCtx();
+
+    auto [outerTag, outerVal] = stage_builder::makeValue(BSON_ARRAY(1 << 2 << 3));
+    auto [outerCondSlot, outerStage] = generateVirtualScan(outerTag, outerVal);
+
+    auto [innerTag, innerVal] = stage_builder::makeValue(BSON_ARRAY(2 << 1));
+    auto [innerCondSlot, innerStage] = generateVirtualScan(innerTag, innerVal);
+
+    auto stage = makeS<HashJoinStage>(std::move(outerStage),
+                                      std::move(innerStage),
+                                      makeSV(outerCondSlot),
+                                      makeSV(),
+                                      makeSV(innerCondSlot),
+                                      makeSV(),
+                                      boost::none /* collatorSlot */,
+                                      false /* allowDiskUse */,
+                                      nullptr /* yieldPolicy */,
+                                      kEmptyPlanNodeId);
+
+    ASSERT_THROWS_CODE(prepareTree(ctx.get(), stage.get(), makeSV(innerCondSlot, outerCondSlot)),
+                       DBException,
+                       ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed);
+}
+
 }  // namespace mongo::sbe
@@ -272,4 +272,68 @@ TEST_F(HashLookupStageTest, BasicTests) {
                  BSONArray(fromjson(R"""([
          ])""")));
 }
+
+TEST_F(HashLookupStageTest, BloomFilterStats) {
+    // Runs a join where only one of the four outer keys has a match and returns the stage's
+    // specific stats.
+    auto runJoin = [&](bool useBloomFilter) {
+        auto knobDefault = internalQuerySlotBasedExecutionHashLookupUseBloomFilter.load();
+        internalQuerySlotBasedExecutionHashLookupUseBloomFilter.store(useBloomFilter);
+        ON_BLOCK_EXIT(
+            [&] { internalQuerySlotBasedExecutionHashLookupUseBloomFilter.store(knobDefault); });
+
+        auto ctx = makeCompileCtx();
+        auto [outerScanSlots, outerScanStage] = generateVirtualScanMulti(2,
+                                                                         BSONArray(fromjson(R"""([
+              [{_id: 1}, 1],
+              [{_id: 2}, 5],
+              [{_id: 3}, 6],
+              [{_id: 4}, 7]
+         ])""")));
+        auto [innerScanSlots, innerScanStage] = generateVirtualScanMulti(2,
+                                                                         BSONArray(fromjson(R"""([
+              [{_id: 11}, 1],
+              [{_id: 12}, 2]
+         ])""")));
+
+        value::SlotId lookupStageOutputSlot = generateSlotId();
+        SlotExprPair agg = std::make_pair(
+            lookupStageOutputSlot,
+            stage_builder::makeFunction("addToArray", makeE<EVariable>(innerScanSlots[0])));
+        auto lookupStage = makeS<HashLookupStage>(std::move(outerScanStage),
+                                                  std::move(innerScanStage),
+                                                  outerScanSlots[1],
+                                                  innerScanSlots[1],
+                                                  innerScanSlots[0],
+                                                  std::move(agg),
+                                                  boost::none /* collatorSlot */,
+                                                  kEmptyPlanNodeId);
+
+        auto resultAccessor = prepareTree(ctx.get(), lookupStage.get(), lookupStageOutputSlot);
+        lookupStage->open(false);
+        size_t numMatched = 0;
+        while (lookupStage->getNext() == PlanState::ADVANCED) {
+            auto [tag, val] = resultAccessor->getViewOfValue();
+            if (tag != value::TypeTags::Nothing) {
+                numMatched++;
+            }
+        }
+        HashLookupStats stats = *static_cast<const HashLookupStats*>(
+            lookupStage->getSpecificStats());
+        lookupStage->close();
+
+        ASSERT_EQ(1, numMatched);
+        return stats;
+    };
+
+    auto statsFiltered = runJoin(true /* useBloomFilter */);
+    ASSERT_EQ(4, statsFiltered.htProbes);
+    // The three unmatched keys must be skipped by the filter. A false positive could in principle
+    // let one through, but with two bits set out of half a million the probability is negligible.
+    ASSERT_EQ(3, statsFiltered.bloomFilterSkips);
+
+    auto statsUnfiltered = runJoin(false /* useBloomFilter */);
+    ASSERT_EQ(4, statsUnfiltered.htProbes);
+    ASSERT_EQ(0, statsUnfiltered.bloomFilterSkips);
+}
 }  // namespace mongo::sbe
@@ -317,4 +317,67 @@ TEST_F(MkObjStageTest, MakeObjProjectWithRoot) {
 TEST_F(MkObjStageTest, MakeBsonObjProjectWithRoot) {
     testProjectWithRoot<MakeBsonObjStage>();
 }
+
+TEST_F(MkObjStageTest, MakeBsonObjOutputBufferSink) {
+    auto [inputTag, inputVal] = value::makeNewArray();
+    value::ValueGuard inputGuard{inputTag, inputVal};
+    {
+        auto inputView = value::getArrayView(inputVal);
+        addBsonObjToArray(inputView, BSON("a" << 1 << "b" << 2 << "c" << 3));
+        addBsonObjToArray(inputView, BSON("a" << 4 << "b" << 5));
+        addBsonObjToArray(inputView, BSON("b" << 6));
+    }
+
+    inputGuard.reset();
+    auto [scanSlot, scanStage] = generateVirtualScan(inputTag, inputVal);
+
+    auto objOutSlotId = generateSlotId();
+    auto mkobj = makeS<MakeBsonObjStage>(std::move(scanStage),
+                                         objOutSlotId,
+                                         scanSlot,
+                                         MakeBsonObjStage::FieldBehavior::keep,
+                                         std::vector<std::string>{"a", "b"},
+                                         std::vector<std::string>{},
+                                         value::SlotVector{},
+                                         false,  // force new
+                                         false,  // return old
+                                         kEmptyPlanNodeId);
+
+    BufBuilder outputBuffer;
+    static_cast<MakeBsonObjStage*>(mkobj.get())->setOutputBuffer(&outputBuffer);
+
+    auto ctx = makeCompileCtx();
+    auto resultAccessor = prepareTree(ctx.get(), mkobj.get(), objOutSlotId);
+
+    const std::vector<BSONObj> expected = {
+        BSON("a" << 1 << "b" << 2), BSON("a" << 4 << "b" << 5), BSON("b" << 6)};
+
+    mkobj->open(false);
+    size_t numResults = 0;
+    int priorLen = 0;
+    while (mkobj->getNext() == PlanState::ADVANCED) {
+        ASSERT_LT(numResults, expected.size());
+        auto [tag, val] = resultAccessor->getViewOfValue();
+        ASSERT_EQ(value::TypeTags::bsonObject, tag);
+        // Each row must be serialized at the tail of the sink buffer, not into a private
+        // per-row allocation.
+        const char* data = value::bitcastTo<const char*>(val);
+        ASSERT_EQ(static_cast<const void*>(outputBuffer.buf() + priorLen),
+                  static_cast<const void*>(data));
+        ASSERT_BSONOBJ_EQ(expected[numResults], BSONObj(data));
+        priorLen = outputBuffer.len();
+        ++numResults;
+    }
+    ASSERT_EQ(expected.size(), numResults);
+    mkobj->close();
+
+    // The buffer now holds the whole batch as concatenated BSON objects.
+    const char* pos = outputBuffer.buf();
+    for (const auto& obj : expected) {
+        ASSERT_BSONOBJ_EQ(obj, BSONObj(pos));
+        pos += BSONObj(pos).objsize();
+    }
+    ASSERT_EQ(static_cast<const void*>(outputBuffer.buf() + outputBuffer.len()),
+              static_cast<const void*>(pos));
+}
 }  // namespace mongo::sbe
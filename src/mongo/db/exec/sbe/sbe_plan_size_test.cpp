@@ -172,6 +172,7 @@ TEST_F(PlanSizeTest, HashJoin) {
                                       mockSV(),
                                       makeSV(),
                                       generateSlotId(),
+                                      false /* allowDiskUse */,
                                       nullptr /* yieldPolicy */,
                                       kEmptyPlanNodeId);
     assertPlanSize(*stage);
@@ -726,11 +726,11 @@ void BlockHashAggStage::open(bool reOpen) {
         if (!_ht->empty()) {
             if (_forceIncreasedSpilling) {
                 // Spill for every row that appears in the hash table.
-                spill(memoryCheckData);
+                spill(memoryCheckData, true /*spillEverything*/);
             } else {
                 // Estimates how much memory is being used. If we estimate that the hash table
-                // exceeds the allotted memory budget, its contents are spilled to the
-                // '_recordStore' and '_ht' is cleared.
+                // exceeds the allotted memory budget, some or all of its contents are spilled to
+                // the '_recordStore' and removed from '_ht'.
                 checkMemoryUsageAndSpillIfNecessary(memoryCheckData);
             }
         }
@@ -750,7 +750,7 @@ void BlockHashAggStage::open(bool reOpen) {
     // store.
     if (_recordStore) {
         if (!_ht->empty()) {
-            spill(memoryCheckData);
+            spill(memoryCheckData, true /*spillEverything*/);
         }
 
         _specificStats.spilledDataStorageSize = _recordStore->rs()->storageSize(_opCtx);
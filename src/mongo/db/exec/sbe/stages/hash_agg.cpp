@@ -347,11 +347,11 @@ void HashAggStage::open(bool reOpen) {
                 if (_forceIncreasedSpilling && !newKey) {
                     // If configured to spill more than usual, we spill after seeing the same key
                     // twice.
-                    spill(memoryCheckData);
+                    spill(memoryCheckData, true /*spillEverything*/);
                 } else {
                     // Estimates how much memory is being used. If we estimate that the hash table
-                    // exceeds the allotted memory budget, its contents are spilled to the
-                    // '_recordStore' and '_ht' is cleared.
+                    // exceeds the allotted memory budget, some or all of its contents are spilled
+                    // to the '_recordStore' and removed from '_ht'.
                     checkMemoryUsageAndSpillIfNecessary(memoryCheckData);
                 }
             }
@@ -371,7 +371,7 @@ void HashAggStage::open(bool reOpen) {
         // store.
         if (_recordStore) {
             if (!_ht->empty()) {
-                spill(memoryCheckData);
+                spill(memoryCheckData, true /*spillEverything*/);
             }
 
             _specificStats.spilledDataStorageSize = _recordStore->rs()->storageSize(_opCtx);
@@ -36,12 +36,15 @@
 #include <boost/optional/optional.hpp>
 
 #include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/exec/sbe/expressions/compile_ctx.h"
 #include "mongo/db/exec/sbe/size_estimator.h"
 #include "mongo/db/exec/sbe/stages/hash_join.h"
 #include "mongo/db/exec/sbe/values/value.h"
 #include "mongo/db/query/collation/collator_interface.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/bufreader.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
@@ -53,6 +56,7 @@ HashJoinStage::HashJoinStage(std::unique_ptr<PlanStage> outer,
                              value::SlotVector innerCond,
                              value::SlotVector innerProjects,
                              boost::optional<value::SlotId> collatorSlot,
+                             bool allowDiskUse,
                              PlanYieldPolicy* yieldPolicy,
                              PlanNodeId planNodeId,
                              bool participateInTrialRunTracking)
@@ -62,6 +66,7 @@ HashJoinStage::HashJoinStage(std::unique_ptr<PlanStage> outer,
       _innerCond(std::move(innerCond)),
       _innerProjects(std::move(innerProjects)),
       _collatorSlot(collatorSlot),
+      _allowDiskUse(allowDiskUse),
       _probeKey(0) {
     if (_outerCond.size() != _innerCond.size()) {
         uasserted(4822823, "left and right size do not match");
@@ -79,6 +84,7 @@ std::unique_ptr<PlanStage> HashJoinStage::clone() const {
                                            _innerCond,
                                            _innerProjects,
                                            _collatorSlot,
+                                           _allowDiskUse,
                                            _yieldPolicy,
                                            _commonStats.nodeId,
                                            participateInTrialRunTracking());
@@ -138,6 +144,7 @@ value::SlotAccessor* HashJoinStage::getAccessor(CompileCtx& ctx, value::SlotId s
 void HashJoinStage::open(bool reOpen) {
     auto optTimer(getOptTimer(_opCtx));
 
+    _collator = nullptr;
     if (_collatorAccessor) {
         auto [tag, collatorVal] = _collatorAccessor->getViewOfValue();
         uassert(5402504, "collatorSlot must be of collator type", tag == value::TypeTags::collator);
@@ -145,10 +152,18 @@ void HashJoinStage::open(bool reOpen) {
         const value::MaterializedRowHasher hasher(collatorView);
         const value::MaterializedRowEq equator(collatorView);
         _ht.emplace(0, hasher, equator);
+        _spilledMatches.emplace(0, hasher, equator);
+        _collator = collatorView;
     } else {
         _ht.emplace();
+        _spilledMatches.emplace();
     }
 
+    _recordStore.reset();
+    _htMemUsage = 0;
+    _probeSpillConsumed = true;
+    _memoryUseInBytesBeforeSpill = internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.load();
+
     _commonStats.opens++;
     _children[0]->open(reOpen);
     // Insert the outer side into the hash table.
@@ -161,6 +176,7 @@ void HashJoinStage::open(bool reOpen) {
         for (auto& p : _inOuterKeyAccessors) {
             auto [tag, val] = p->getCopyOfValue();
             key.reset(idx++, true, tag, val);
+            _htMemUsage += size_estimator::estimate(tag, val);
         }
 
         idx = 0;
@@ -168,13 +184,21 @@ void HashJoinStage::open(bool reOpen) {
         for (auto& p : _inOuterProjectAccessors) {
             auto [tag, val] = p->getCopyOfValue();
             project.reset(idx++, true, tag, val);
+            _htMemUsage += size_estimator::estimate(tag, val);
         }
 
+        _htMemUsage += sizeof(TableType::value_type);
         _ht->emplace(std::move(key), std::move(project));
+
+        checkMemoryUsageAndSpillIfNecessary();
     }
 
     _children[0]->close();
 
+    if (_recordStore) {
+        _specificStats.spilledDataStorageSize = _recordStore->rs()->storageSize(_opCtx);
+    }
+
     _children[1]->open(reOpen);
 
     _htIt = _ht->end();
@@ -189,49 +213,178 @@ PlanState HashJoinStage::getNext() {
         ++_htIt;
     }
 
-    if (_htIt == _htItEnd) {
-        while (_htIt == _htItEnd) {
-            auto state = _children[1]->getNext();
-            if (state == PlanState::IS_EOF) {
-                // LEFT and OUTER joins should enumerate "non-returned" rows here.
-                return trackPlanState(state);
+    while (_htIt == _htItEnd) {
+        if (_recordStore && !_probeSpillConsumed) {
+            // The in-memory matches for the current probe key are exhausted, so surface any rows
+            // for the same key that were spilled while building the table.
+            _probeSpillConsumed = true;
+            if (feedSpilledMatches()) {
+                break;
             }
+        }
 
-            // Copy keys in order to do the lookup.
-            size_t idx = 0;
-            for (auto& p : _inInnerKeyAccessors) {
-                auto [tag, val] = p->getViewOfValue();
-                _probeKey.reset(idx++, false, tag, val);
-            }
+        auto state = _children[1]->getNext();
+        if (state == PlanState::IS_EOF) {
+            // LEFT and OUTER joins should enumerate "non-returned" rows here.
+            return trackPlanState(state);
+        }
 
-            auto [low, hi] = _ht->equal_range(_probeKey);
-            _htIt = low;
-            _htItEnd = hi;
-            // If _htIt == _htItEnd (i.e. no match) then RIGHT and OUTER joins
-            // should enumerate "non-returned" rows here.
+        // Copy keys in order to do the lookup.
+        size_t idx = 0;
+        for (auto& p : _inInnerKeyAccessors) {
+            auto [tag, val] = p->getViewOfValue();
+            _probeKey.reset(idx++, false, tag, val);
         }
+
+        auto [low, hi] = _ht->equal_range(_probeKey);
+        _htIt = low;
+        _htItEnd = hi;
+        _probeSpillConsumed = !_recordStore;
+        // If _htIt == _htItEnd (i.e. no match) then RIGHT and OUTER joins
+        // should enumerate "non-returned" rows here.
     }
 
     return trackPlanState(PlanState::ADVANCED);
 }
 
+RecordId HashJoinStage::serializeKeyForRecordStore(const value::MaterializedRow& key) const {
+    key_string::Builder kb{key_string::Version::kLatestVersion};
+    if (!_collator) {
+        return encodeKeyString(kb, key).first;
+    }
+
+    // Normalize string components with the collator so that keys which are equal under the
+    // collation map to the same record id.
+    value::MaterializedRow normalized{key.size()};
+    for (size_t idx = 0; idx < key.size(); ++idx) {
+        auto [tag, val] = key.getViewOfValue(idx);
+        if (value::isString(tag)) {
+            auto [strTag, strVal] = value::makeNewString(
+                _collator->getComparisonKey(value::getStringView(tag, val)).getKeyData());
+            normalized.reset(idx, true, strTag, strVal);
+        } else {
+            normalized.reset(idx, false, tag, val);
+        }
+    }
+    return encodeKeyString(kb, normalized).first;
+}
+
+void HashJoinStage::checkMemoryUsageAndSpillIfNecessary() {
+    if (MONGO_likely(_htMemUsage <= _memoryUseInBytesBeforeSpill)) {
+        return;
+    }
+
+    uassert(ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed,
+            str::stream() << "Exceeded memory limit of " << _memoryUseInBytesBeforeSpill
+                          << " bytes for the build side of a hash join, but did not allow external "
+                             "spilling; pass allowDiskUse:true to opt in",
+            _allowDiskUse);
+
+    spillTableToDisk();
+}
+
+void HashJoinStage::spillTableToDisk() {
+    if (!_recordStore) {
+        assertIgnorePrepareConflictsBehavior(_opCtx);
+        _recordStore = std::make_unique<SpillingStore>(_opCtx);
+        _specificStats.usedDisk = true;
+    }
+    ++_specificStats.spills;
+
+    // Elements with equivalent keys are adjacent within the table, so we can write one record per
+    // distinct key holding every row for that key.
+    for (auto it = _ht->begin(); it != _ht->end();) {
+        auto rid = serializeKeyForRecordStore(it->first);
+
+        BufBuilder buf;
+        RecordData previouslySpilled;
+        const bool update = _recordStore->findRecord(_opCtx, rid, &previouslySpilled);
+        if (update) {
+            // We have spilled rows for this key before; the new rows are appended to them.
+            buf.appendBuf(previouslySpilled.data(), previouslySpilled.size());
+        }
+        const auto priorLen = buf.len();
+
+        const auto& keyRow = it->first;
+        do {
+            it->first.serializeForSorter(buf);
+            it->second.serializeForSorter(buf);
+            ++_specificStats.spilledRecords;
+            ++it;
+        } while (it != _ht->end() && _ht->key_eq()(it->first, keyRow));
+
+        _specificStats.spilledBytes += buf.len() - priorLen;
+        _recordStore->upsertToRecordStore(_opCtx, rid, buf, update);
+    }
+
+    _ht->clear();
+    _htMemUsage = 0;
+}
+
+bool HashJoinStage::feedSpilledMatches() {
+    RecordData record;
+    if (!_recordStore->findRecord(_opCtx, serializeKeyForRecordStore(_probeKey), &record)) {
+        return false;
+    }
+
+    _spilledMatches->clear();
+    BufReader reader(record.data(), record.size());
+    while (reader.remaining() > 0) {
+        auto key = value::MaterializedRow::deserializeForSorter(reader, {});
+        auto project = value::MaterializedRow::deserializeForSorter(reader, {});
+        _spilledMatches->emplace(std::move(key), std::move(project));
+    }
+
+    _htIt = _spilledMatches->begin();
+    _htItEnd = _spilledMatches->end();
+    return _htIt != _htItEnd;
+}
+
 void HashJoinStage::close() {
     auto optTimer(getOptTimer(_opCtx));
 
     trackClose();
     _children[1]->close();
     _ht = boost::none;
+    _spilledMatches = boost::none;
+    _recordStore.reset();
+}
+
+void HashJoinStage::doSaveState(bool relinquishCursor) {
+    if (_recordStore) {
+        _recordStore->saveState();
+    }
+}
+
+void HashJoinStage::doRestoreState(bool relinquishCursor) {
+    if (_recordStore) {
+        _recordStore->restoreState();
+    }
 }
 
 std::unique_ptr<PlanStageStats> HashJoinStage::getStats(bool includeDebugInfo) const {
     auto ret = std::make_unique<PlanStageStats>(_commonStats);
+    ret->specific = std::make_unique<HashJoinStats>(_specificStats);
+
+    if (includeDebugInfo) {
+        BSONObjBuilder bob;
+        // Spilling stats.
+        bob.appendBool("usedDisk", _specificStats.usedDisk);
+        bob.appendNumber("spills", _specificStats.spills);
+        bob.appendNumber("spilledBytes", _specificStats.spilledBytes);
+        bob.appendNumber("spilledRecords", _specificStats.spilledRecords);
+        bob.appendNumber("spilledDataStorageSize", _specificStats.spilledDataStorageSize);
+
+        ret->debugInfo = bob.obj();
+    }
+
     ret->children.emplace_back(_children[0]->getStats(includeDebugInfo));
     ret->children.emplace_back(_children[1]->getStats(includeDebugInfo));
     return ret;
 }
 
 const SpecificStats* HashJoinStage::getSpecificStats() const {
-    return nullptr;
+    return &_specificStats;
 }
 
 std::vector<DebugPrinter::Block> HashJoinStage::debugPrint() const {
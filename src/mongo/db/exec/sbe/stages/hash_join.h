@@ -41,8 +41,10 @@
 #include "mongo/db/exec/sbe/stages/plan_stats.h"
 #include "mongo/db/exec/sbe/stages/stages.h"
 #include "mongo/db/exec/sbe/util/debug_print.h"
+#include "mongo/db/exec/sbe/util/spilling.h"
 #include "mongo/db/exec/sbe/values/row.h"
 #include "mongo/db/exec/sbe/values/slot.h"
+#include "mongo/db/query/collation/collator_interface.h"
 #include "mongo/db/query/stage_types.h"
 
 namespace mongo::sbe {
@@ -62,6 +64,13 @@ namespace mongo::sbe {
  * for string equality. For example, this can be used to perform a case-insensitive join on string
  * values.
  *
+ * The 'allowDiskUse' flag controls whether this stage can spill. If the estimated size of the hash
+ * table crosses its memory budget and spilling is not allowed, the query fails with
+ * 'QueryExceededMemoryLimitNoDiskUseAllowed'. Otherwise the table's contents are written out to a
+ * temporary record store, keyed by the key-string encoding of the join key, and the build phase
+ * continues with an empty table. Probing then consults both the in-memory table and the spill
+ * table.
+ *
  * Debug string representation:
  *
  *   hj collatorSlot?
@@ -77,6 +86,7 @@ public:
                   value::SlotVector innerCond,
                   value::SlotVector innerProjects,
                   boost::optional<value::SlotId> collatorSlot,
+                  bool allowDiskUse,
                   PlanYieldPolicy* yieldPolicy,
                   PlanNodeId planNodeId,
                   bool participateInTrialRunTracking = true);
@@ -94,6 +104,10 @@ public:
     std::vector<DebugPrinter::Block> debugPrint() const final;
     size_t estimateCompileTimeSize() const final;
 
+protected:
+    void doSaveState(bool relinquishCursor) override;
+    void doRestoreState(bool relinquishCursor) override;
+
 private:
     using TableType = std::unordered_multimap<value::MaterializedRow,  // NOLINT
                                               value::MaterializedRow,
@@ -103,11 +117,37 @@ private:
     using HashKeyAccessor = value::MaterializedRowKeyAccessor<TableType::iterator>;
     using HashProjectAccessor = value::MaterializedRowValueAccessor<TableType::iterator>;
 
+    /**
+     * Encodes 'key' to the record id under which its rows are spilled. String components are
+     * normalized with the collator, if any, so that keys which are equal under the collation share
+     * a record.
+     */
+    RecordId serializeKeyForRecordStore(const value::MaterializedRow& key) const;
+
+    /**
+     * Checks the memory budget after a build-side row has been added to '_ht' and spills the
+     * table's contents if the budget has been exceeded.
+     */
+    void checkMemoryUsageAndSpillIfNecessary();
+
+    /**
+     * Writes the entire contents of '_ht' to '_recordStore', merging with rows spilled for the
+     * same keys earlier, and clears the table.
+     */
+    void spillTableToDisk();
+
+    /**
+     * Recovers the rows spilled for the current probe key, if any, into '_spilledMatches' and
+     * positions '_htIt' over them. Returns whether any spilled matches were found.
+     */
+    bool feedSpilledMatches();
+
     const value::SlotVector _outerCond;
     const value::SlotVector _outerProjects;
     const value::SlotVector _innerCond;
     const value::SlotVector _innerProjects;
     const boost::optional<value::SlotId> _collatorSlot;
+    const bool _allowDiskUse;
 
     // All defined values from the outer side (i.e. they come from the hash table).
     value::SlotAccessorMap _outOuterAccessors;
@@ -136,5 +176,28 @@ private:
     boost::optional<TableType> _ht;
     TableType::iterator _htIt;
     TableType::iterator _htItEnd;
+
+    // Collator in effect for the join, if any. Set when the stage is opened.
+    const CollatorInterface* _collator{nullptr};
+
+    // Approximate memory footprint of '_ht' in bytes, maintained while building the table.
+    long long _htMemUsage{0};
+
+    // Memory budget for '_ht', captured from the query knob when the stage is opened.
+    long long _memoryUseInBytesBeforeSpill{0};
+
+    // Build-side rows evicted from '_ht' when it exceeded its memory budget. Only set if this
+    // stage has spilled.
+    std::unique_ptr<SpillingStore> _recordStore;
+
+    // Holds the matches recovered from '_recordStore' for the current probe key. This has the same
+    // type as '_ht' so that the output accessors, which are bound to '_htIt', can surface spilled
+    // rows unchanged.
+    boost::optional<TableType> _spilledMatches;
+
+    // False while rows spilled for the current probe key may remain to be surfaced.
+    bool _probeSpillConsumed{true};
+
+    HashJoinStats _specificStats;
 };
 }  // namespace mongo::sbe
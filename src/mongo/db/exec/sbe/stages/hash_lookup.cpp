@@ -259,6 +259,9 @@ std::unique_ptr<PlanStageStats> HashLookupStage::getStats(bool includeDebugInfo)
         bob.appendBool("usedDisk", specificStats->usedDisk)
             .appendNumber("spilledRecords", specificStats->getSpilledRecords())
             .appendNumber("spilledBytesApprox", specificStats->getSpilledBytesApprox());
+        // Bloom filter effectiveness stats.
+        bob.appendNumber("htProbes", specificStats->htProbes)
+            .appendNumber("bloomFilterSkips", specificStats->bloomFilterSkips);
         ret->debugInfo = bob.obj();
     }
     return ret;
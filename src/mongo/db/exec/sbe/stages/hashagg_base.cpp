@@ -177,14 +177,14 @@ int64_t HashAggBaseStage<Derived>::spillRowToDisk(const value::MaterializedRow&
 }
 
 template <class Derived>
-void HashAggBaseStage<Derived>::spill(MemoryCheckData& mcd) {
+void HashAggBaseStage<Derived>::spill(MemoryCheckData& mcd, bool spillEverything) {
     uassert(ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed,
             "Exceeded memory limit for $group, but didn't allow external spilling;"
             " pass allowDiskUse:true to opt in",
             _allowDiskUse);
 
-    // Since we flush the entire hash table to disk, we also clear any state related to estimating
-    // memory consumption.
+    // Since spilling substantially changes the hash table's memory footprint, also clear any state
+    // related to estimating memory consumption.
     mcd.reset();
 
     if (!_recordStore) {
@@ -193,12 +193,30 @@ void HashAggBaseStage<Derived>::spill(MemoryCheckData& mcd) {
 
     int64_t spilledBytes = 0;
     int64_t spilledRecords = 0;
-    for (auto&& it : *_ht) {
-        spilledBytes += spillRowToDisk(it.first, it.second);
-        spilledRecords++;
+    if (spillEverything || _ht->size() < kMinTableSizeForPartialSpill) {
+        for (auto&& it : *_ht) {
+            spilledBytes += spillRowToDisk(it.first, it.second);
+            spilledRecords++;
+        }
+
+        _ht->clear();
+    } else {
+        // Evict only half of the groups and keep the rest resident. Groups that stay in memory
+        // keep absorbing updates without emitting additional spilled partial aggregates, so keys
+        // that occur frequently cause less merge work later, similar to hybrid hash aggregation.
+        // Iteration order is hash order, which makes the eviction an effectively random sample of
+        // the groups.
+        size_t numToSpill = (_ht->size() + 1) / 2;
+        auto it = _ht->begin();
+        while (numToSpill--) {
+            spilledBytes += spillRowToDisk(it->first, it->second);
+            spilledRecords++;
+            it = _ht->erase(it);
+        }
     }
 
-    _ht->clear();
+    // '_htIt' may refer to an evicted entry; callers position it again before the next use.
+    _htIt = _ht->end();
 
     static_cast<Derived*>(this)->getHashAggStats()->spills++;
     groupCounters.incrementGroupCountersPerSpilling(1 /* spills */, spilledBytes, spilledRecords);
@@ -224,7 +242,7 @@ void HashAggBaseStage<Derived>::checkMemoryUsageAndSpillIfNecessary(MemoryCheckD
     const long long estimatedTotalSize = _ht->size() * estimatedRowSize;
 
     if (estimatedTotalSize >= _approxMemoryUseInBytesBeforeSpill) {
-        spill(mcd);
+        spill(mcd, false /*spillEverything*/);
     } else {
         // Calculate the next memory checkpoint. We estimate it based on the prior growth of the
         // '_ht' and the remaining available memory. If 'estimatedGainPerChildAdvance' suggests that
@@ -136,9 +136,22 @@ protected:
      * from the record id, instead appending them to the end of the serialized 'val' buffer.
      */
     int64_t spillRowToDisk(const value::MaterializedRow& key, const value::MaterializedRow& val);
-    void spill(MemoryCheckData& mcd);
+
+    /**
+     * Spills contents of the hash table to the '_recordStore'. If 'spillEverything' is true the
+     * whole table is written out and cleared. Otherwise only half of the groups are evicted and
+     * the rest stay resident, so that frequently seen keys keep aggregating in memory instead of
+     * emitting additional spilled partial aggregates that have to be merged later. Tables smaller
+     * than 'kMinTableSizeForPartialSpill' are always spilled wholesale since partial eviction buys
+     * nothing at that size.
+     */
+    void spill(MemoryCheckData& mcd, bool spillEverything);
     void checkMemoryUsageAndSpillIfNecessary(MemoryCheckData& mcd);
 
+    // Minimum number of entries in the hash table for a mid-build spill to evict only part of the
+    // table instead of dumping it wholesale.
+    static constexpr size_t kMinTableSizeForPartialSpill = 64;
+
     // Memory tracking and spilling to disk.
     const long long _approxMemoryUseInBytesBeforeSpill =
         internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill.load();
@@ -45,6 +45,10 @@ void LookupHashTableIter::initSearchArray() {
     value::ArrayEnumerator enumerator(_outerKeyTag, _outerKeyVal);
     while (!enumerator.atEnd()) {
         auto [tagElemView, valElemView] = enumerator.getViewOfValue();
+        if (_hashTable.definitelyNotInTable(tagElemView, valElemView)) {
+            enumerator.advance();
+            continue;
+        }
         _iterProbeKey.reset(0, false, tagElemView, valElemView);
         hashTableMatchIter = _hashTable._memoryHt->find(_iterProbeKey);
         if (hashTableMatchIter != _hashTable._memoryHt->end()) {
@@ -71,6 +75,11 @@ void LookupHashTableIter::initSearchScalar() {
     invariant(!_outerKeyIsArray);
     HashTableType::const_iterator hashTableMatchIter;
 
+    if (_hashTable.definitelyNotInTable(_outerKeyTag, _outerKeyVal)) {
+        _hashTableSearched = true;
+        return;
+    }
+
     _iterProbeKey.reset(0, false, _outerKeyTag, _outerKeyVal);
     hashTableMatchIter = _hashTable._memoryHt->find(_iterProbeKey);
     if (hashTableMatchIter != _hashTable._memoryHt->end()) {
@@ -175,6 +184,13 @@ void LookupHashTable::addHashTableEntry(value::SlotAccessor* keyAccessor, size_t
     auto [tagKeyView, valKeyView] = keyAccessor->getViewOfValue();
     _htProbeKey.reset(0, false, tagKeyView, valKeyView);
 
+    // Record the key in the bloom filter whether it ends up in '_memoryHt' or '_recordStoreHt', so
+    // a negative probe answer is authoritative for both. The collator-aware hash matches the one
+    // used to probe with outer keys.
+    if (_bloomFilter) {
+        _bloomFilter->insert(value::hashValue(tagKeyView, valKeyView, _collator));
+    }
+
     // Check to see if key is already in memory. If not, we will emplace a new key or spill to disk.
     auto htIt = _memoryHt->find(_htProbeKey);
     if (htIt == _memoryHt->end()) {
@@ -377,6 +393,8 @@ boost::optional<std::pair<value::TypeTags, value::Value>> LookupHashTable::getVa
 void LookupHashTable::reset(bool fromClose) {
     _memoryUseInBytesBeforeSpill = internalQuerySBELookupApproxMemoryUseInBytesBeforeSpill.load();
     _memoryHt = boost::none;
+    // open() re-engages the filter if the knob is still set.
+    _bloomFilter = boost::none;
     if (_recordStoreHt) {
         _recordStoreHt.reset(nullptr);
     }
@@ -57,6 +57,49 @@ using RecordIndexCollection = std::variant<std::vector<size_t>*, std::set<size_t
 
 class LookupHashTable;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Class LookupBloomFilter
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A register-blocked bloom filter over the hashes of the inner collection's keys. Both bits for a
+ * key land in the same 64-bit word, so a probe touches a single cache line. When the outer side
+ * probes for keys that mostly have no match, a negative answer here lets the caller skip both the
+ * in-memory hash table search and, more importantly, the spilled record store lookup.
+ *
+ * The filter is sized statically since the number of inner keys is not known up front. It can only
+ * produce false positives (which cost a redundant table probe), never false negatives, so an
+ * overfull filter degrades to the unfiltered behavior.
+ */
+class LookupBloomFilter {
+public:
+    inline void insert(size_t hash) {
+        _words[wordIdx(hash)] |= bitMask(hash);
+    }
+
+    inline bool mayContain(size_t hash) const {
+        const uint64_t mask = bitMask(hash);
+        return (_words[wordIdx(hash)] & mask) == mask;
+    }
+
+private:
+    // 8192 words = 64 KiB, giving a ~0.2% false positive rate at 100k distinct inner keys. This is
+    // a fixed overhead that is negligible compared to the stage's spilling memory budget.
+    static constexpr size_t kNumWords = 8192;
+
+    // The word is selected by high hash bits and the two bit positions by low hash bits, so the
+    // three indices are computed from (mostly) independent parts of the hash.
+    static inline size_t wordIdx(size_t hash) {
+        return (hash >> 32) & (kNumWords - 1);
+    }
+
+    static inline uint64_t bitMask(size_t hash) {
+        return (uint64_t{1} << (hash & 63)) | (uint64_t{1} << ((hash >> 6) & 63));
+    }
+
+    std::vector<uint64_t> _words = std::vector<uint64_t>(kNumWords, 0);
+};  // class LookupBloomFilter
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Class LookupHashTableIter
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -220,6 +263,9 @@ public:
         } else {
             _memoryHt.emplace();
         }
+        if (internalQuerySlotBasedExecutionHashLookupUseBloomFilter.load()) {
+            _bloomFilter.emplace();
+        }
     }
 
     void reset(bool fromClose);
@@ -262,6 +308,20 @@ private:
 
     void makeTemporaryRecordStore();
 
+    /**
+     * Returns true iff the bloom filter is engaged and reports that the given key was never added
+     * to the hash table, neither to the memory portion nor the disk spill. Also maintains the probe
+     * counters used to report filter effectiveness in explain output.
+     */
+    inline bool definitelyNotInTable(value::TypeTags tagKey, value::Value valKey) {
+        _hashLookupStats.htProbes++;
+        if (_bloomFilter && !_bloomFilter->mayContain(value::hashValue(tagKey, valKey, _collator))) {
+            _hashLookupStats.bloomFilterSkips++;
+            return true;
+        }
+        return false;
+    }
+
     /**
      * Normalizes a string if '_collator' is populated and returns a third parameter to let the
      * caller know if it should own the tag and value.
@@ -326,6 +386,11 @@ private:
     // Outer key used to probe the hash table.
     value::MaterializedRow _htProbeKey{1 /* columns */};
 
+    // Optional filter over the hashes of all inner keys added via addHashTableEntry(), including
+    // those that were spilled to '_recordStoreHt'. Probes for keys the filter reports as definitely
+    // absent skip the table search entirely. Disengaged if the bloom filter knob is off.
+    boost::optional<LookupBloomFilter> _bloomFilter;
+
     HashLookupStats _hashLookupStats;
 
     // Used to hold a copy of a MaterializedRow from the disk store, so it does not go out of scope
@@ -151,7 +151,8 @@ void MakeObjStageBase<O>::projectField(value::Object* obj, size_t idx) {
 }
 
 template <typename O>
-void MakeObjStageBase<O>::projectField(UniqueBSONObjBuilder* bob, size_t idx) {
+template <typename BuilderType>
+void MakeObjStageBase<O>::projectField(BuilderType* bob, size_t idx) {
     const auto& p = _projects[idx];
 
     auto [tag, val] = p.second->getViewOfValue();
@@ -338,16 +339,9 @@ void MakeObjStageBase<MakeObjOutputType::Object>::produceObject() {
     }
 }
 
-template <>
-void MakeObjStageBase<MakeObjOutputType::BsonObject>::produceObject() {
-    UniqueBSONObjBuilder bob;
-
-    auto finish = [this, &bob]() {
-        bob.doneFast();
-        char* data = bob.bb().release().release();
-        _obj.reset(value::TypeTags::bsonObject, value::bitcastFrom<char*>(data));
-    };
-
+template <typename O>
+template <typename BuilderType, typename FinishFn, typename BailFn>
+void MakeObjStageBase<O>::produceBsonObject(BuilderType& bob, FinishFn finish, BailFn bail) {
     memset(_visited.data(), 0, _projectFields.size());
 
     const bool isInclusion = _fieldBehavior == FieldBehavior::keep;
@@ -474,10 +468,10 @@ void MakeObjStageBase<MakeObjOutputType::BsonObject>::produceObject() {
             }
             // Now we have to make a decision - return Nothing or the original _root.
             if (!_returnOldObject) {
-                _obj.reset(false, value::TypeTags::Nothing, 0);
+                bail(value::TypeTags::Nothing, 0);
             } else {
                 // _root is not an object return it unmodified.
-                _obj.reset(false, tag, val);
+                bail(tag, val);
             }
 
             return;
@@ -491,6 +485,41 @@ void MakeObjStageBase<MakeObjOutputType::BsonObject>::produceObject() {
     finish();
 }
 
+template <>
+void MakeObjStageBase<MakeObjOutputType::BsonObject>::produceObject() {
+    if (_outputBuffer) {
+        // Sink mode: serialize the object at the tail of the caller's buffer and publish an
+        // unowned view of it, so the consumer that owns the buffer gets the bytes in place
+        // without a per-row allocation or a copy of the finished object.
+        const auto priorLen = _outputBuffer->len();
+        BSONObjBuilder bob(*_outputBuffer);
+        produceBsonObject(
+            bob,
+            [&]() {
+                bob.doneFast();
+                _obj.reset(false,
+                           value::TypeTags::bsonObject,
+                           value::bitcastFrom<const char*>(_outputBuffer->buf() + priorLen));
+            },
+            [&](value::TypeTags tag, value::Value val) {
+                // No object is produced, so unwind the partially written bytes.
+                bob.abandon();
+                _outputBuffer->setlen(priorLen);
+                _obj.reset(false, tag, val);
+            });
+    } else {
+        UniqueBSONObjBuilder bob;
+        produceBsonObject(
+            bob,
+            [&]() {
+                bob.doneFast();
+                char* data = bob.bb().release().release();
+                _obj.reset(value::TypeTags::bsonObject, value::bitcastFrom<char*>(data));
+            },
+            [&](value::TypeTags tag, value::Value val) { _obj.reset(false, tag, val); });
+    }
+}
+
 template <typename O>
 PlanState MakeObjStageBase<O>::getNext() {
     auto optTimer(getOptTimer(_opCtx));
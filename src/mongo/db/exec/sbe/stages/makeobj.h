@@ -33,6 +33,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -146,6 +147,24 @@ public:
     std::vector<DebugPrinter::Block> debugPrint() const final;
     size_t estimateCompileTimeSize() const final;
 
+    /**
+     * Puts the stage into "sink" mode: each produced object is serialized directly at the tail of
+     * 'outputBuffer' instead of into a per-row owned allocation, and the output slot holds an
+     * unowned view of those bytes. This lets a consumer that assembles result rows into a larger
+     * buffer (e.g. a cursor response batch) receive each object without an extra copy of its
+     * bytes, at the cost of the consumer owning the buffer lifetime.
+     *
+     * The view in the output slot stays valid until the next getNext() call or until the consumer
+     * appends to 'outputBuffer' itself, whichever comes first. Passing nullptr restores the
+     * default per-row allocation behavior. Only supported for the BSON object output type. The
+     * sink buffer is an execution-time attachment and is deliberately not carried over by clone().
+     */
+    void setOutputBuffer(BufBuilder* outputBuffer) {
+        static_assert(std::is_same_v<O, MakeObjOutputType::BsonObject>,
+                      "sink mode requires BSON object output");
+        _outputBuffer = outputBuffer;
+    }
+
 protected:
     void doSaveState(bool relinquishCursor) final;
     bool shouldOptimizeSaveState(size_t) const final {
@@ -154,7 +173,9 @@ protected:
 
 private:
     void projectField(value::Object* obj, size_t idx);
-    void projectField(UniqueBSONObjBuilder* bob, size_t idx);
+
+    template <typename BuilderType>
+    void projectField(BuilderType* bob, size_t idx);
 
     std::pair<bool, size_t> lookupField(StringData sv) const {
         auto pos = _fieldNames.findPos(sv);
@@ -177,6 +198,16 @@ private:
 
     void produceObject();
 
+    /**
+     * Builds the output BSON object into 'bob', which may write either into a fresh per-row
+     * allocation or into the attached sink buffer. 'finish' is invoked once the object is
+     * complete; 'bail' is invoked with the value to publish instead when no object is produced
+     * (returning 'Nothing' or the unmodified root), letting the caller unwind any partially
+     * written bytes.
+     */
+    template <typename BuilderType, typename FinishFn, typename BailFn>
+    void produceBsonObject(BuilderType& bob, FinishFn finish, BailFn bail);
+
     const value::SlotId _objSlot;
     const boost::optional<value::SlotId> _rootSlot;
     const boost::optional<FieldBehavior> _fieldBehavior;
@@ -192,6 +223,10 @@ private:
 
     typename O::OutputAccessorType _obj;
 
+    // When non-null, produced BSON objects are serialized at the tail of this caller-provided
+    // buffer instead of per-row owned allocations. See setOutputBuffer().
+    BufBuilder* _outputBuffer{nullptr};
+
     value::SlotAccessor* _root{nullptr};
 
     bool _compiled{false};
@@ -376,6 +376,35 @@ struct BlockHashAggStats : public HashAggStats {
     long long elementWiseAccumulations{0};
 };
 
+struct HashJoinStats : public SpecificStats {
+    std::unique_ptr<SpecificStats> clone() const final {
+        return std::make_unique<HashJoinStats>(*this);
+    }
+
+    uint64_t estimateObjectSizeInBytes() const final {
+        return sizeof(*this);
+    }
+
+    void acceptVisitor(PlanStatsConstVisitor* visitor) const final {
+        visitor->visit(this);
+    }
+
+    void acceptVisitor(PlanStatsMutableVisitor* visitor) final {
+        visitor->visit(this);
+    }
+
+    bool usedDisk{false};
+    // The number of times that the entire build-side hash table was spilled.
+    long long spills{0};
+    // The number of individual build-side rows spilled to disk.
+    long long spilledRecords{0};
+    // The number of total bytes spilled to disk.
+    long long spilledBytes{0};
+    // An estimate, in bytes, of the size of the final spill table after all spill events have taken
+    // place.
+    long long spilledDataStorageSize{0};
+};
+
 struct HashLookupStats : public SpecificStats {
     std::unique_ptr<SpecificStats> clone() const final {
         return std::make_unique<HashLookupStats>(*this);
@@ -406,6 +435,12 @@ struct HashLookupStats : public SpecificStats {
     long long spilledHtBytesOverAllRecords{0};
     long long spilledBuffRecords{0};
     long long spilledBuffBytesOverAllRecords{0};
+
+    // Number of individual key probes against the hash table and how many of them the bloom filter
+    // answered as definitely absent, skipping the table search and any disk spill lookup. The ratio
+    // of the two indicates how effective the filter was for the join.
+    long long htProbes{0};
+    long long bloomFilterSkips{0};
 };
 
 struct WindowStats : public SpecificStats {
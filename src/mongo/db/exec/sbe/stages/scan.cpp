@@ -33,6 +33,7 @@
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <set>
@@ -839,6 +840,7 @@ ParallelScanStage::ParallelScanStage(UUID collUuid,
       _scanFieldSlots(scanFieldSlots),
       _scanCallbacks(callbacks) {
     invariant(_scanFieldNames.size() == _scanFieldSlots.size());
+    _state->participants.addAndFetch(1);
 }
 
 ParallelScanStage::ParallelScanStage(const std::shared_ptr<ParallelState>& state,
@@ -868,6 +870,7 @@ ParallelScanStage::ParallelScanStage(const std::shared_ptr<ParallelState>& state
       _scanFieldSlots(scanFieldSlots),
       _scanCallbacks(callbacks) {
     invariant(_scanFieldNames.size() == _scanFieldSlots.size());
+    _state->participants.addAndFetch(1);
 }
 
 std::unique_ptr<PlanStage> ParallelScanStage::clone() const {
@@ -1038,7 +1041,20 @@ void ParallelScanStage::open(bool reOpen) {
     {
         stdx::unique_lock lock(_state->mutex);
         if (_state->ranges.empty()) {
-            auto ranges = _coll.getPtr()->getRecordStore()->numRecords(_opCtx) / 10240;
+            // Ranges are claimed dynamically: a thread that finishes its range early takes the
+            // next unclaimed one, so skewed ranges only stall the scan when there are too few
+            // ranges to hand out. Aim for ranges of roughly 10k records, but never fewer than
+            // several ranges per participating thread, unless the collection is too small for
+            // splitting to be worthwhile.
+            constexpr long long kRecordsPerRange = 10240;
+            constexpr long long kMinRecordsPerRange = 256;
+            constexpr long long kRangesPerParticipant = 4;
+
+            auto numRecords = _coll.getPtr()->getRecordStore()->numRecords(_opCtx);
+            auto ranges = std::max<long long>(
+                numRecords / kRecordsPerRange,
+                _state->participants.load() * kRangesPerParticipant);
+            ranges = std::min<long long>(ranges, numRecords / kMinRecordsPerRange);
             if (ranges < 2) {
                 _state->ranges.emplace_back(Range{RecordId{}, RecordId{}});
             } else {
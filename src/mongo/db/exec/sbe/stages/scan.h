@@ -378,6 +378,10 @@ class ParallelScanStage final : public PlanStage {
         Mutex mutex = MONGO_MAKE_LATCH("ParallelScanStage::ParallelState::mutex");
         std::vector<Range> ranges;
         AtomicWord<size_t> currentRange{0};
+        // Number of stage instances sharing this state, i.e. the maximum number of threads that
+        // will claim ranges. Used to size the range list so that dynamic range claiming can
+        // balance skewed ranges across all participants.
+        AtomicWord<size_t> participants{0};
     };
 
 public:
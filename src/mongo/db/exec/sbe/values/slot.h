@@ -30,6 +30,8 @@
 #pragma once
 
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "mongo/bson/bsonobj.h"
 #include "mongo/config.h"
@@ -129,6 +131,48 @@ private:
     Value _val{0};
 };
 
+/**
+ * Collects owned values whose release has been deferred so that they can be freed wholesale
+ * instead of one at a time. Stages that churn through many short-lived owned values can attach a
+ * batch to their 'OwnedValueAccessor's, turning each ownership hand-off into a pointer copy, and
+ * call releaseAll() once per chunk of results. Deferred values remain valid until releaseAll() is
+ * called or the batch is destroyed.
+ */
+class ValueReleaseBatch {
+public:
+    ValueReleaseBatch() = default;
+    ValueReleaseBatch(const ValueReleaseBatch&) = delete;
+    ValueReleaseBatch& operator=(const ValueReleaseBatch&) = delete;
+
+    ~ValueReleaseBatch() {
+        releaseAll();
+    }
+
+    /**
+     * Takes ownership of the given value and defers its release until releaseAll().
+     */
+    void defer(TypeTags tag, Value val) {
+        _values.emplace_back(tag, val);
+    }
+
+    /**
+     * Releases all deferred values in one pass.
+     */
+    void releaseAll() noexcept {
+        for (auto& [tag, val] : _values) {
+            releaseValue(tag, val);
+        }
+        _values.clear();
+    }
+
+    size_t size() const {
+        return _values.size();
+    }
+
+private:
+    std::vector<std::pair<TypeTags, Value>> _values;
+};
+
 /**
  * Accessor for a slot which can own the value held by that slot.
  */
@@ -147,12 +191,14 @@ public:
             _val = other._val;
             _owned = false;
         }
+        _releaseBatch = other._releaseBatch;
     }
 
     OwnedValueAccessor(OwnedValueAccessor&& other) noexcept {
         _tag = other._tag;
         _val = other._val;
         _owned = other._owned;
+        _releaseBatch = other._releaseBatch;
 
         other._owned = false;
     }
@@ -166,6 +212,7 @@ public:
         std::swap(_tag, other._tag);
         std::swap(_val, other._val);
         std::swap(_owned, other._owned);
+        std::swap(_releaseBatch, other._releaseBatch);
         return *this;
     }
 
@@ -217,10 +264,23 @@ public:
         _owned = true;
     }
 
+    /**
+     * Attaches the given batch so that values owned by this accessor are handed off to it instead
+     * of being released individually when the slot is reset or destroyed. Pass nullptr to restore
+     * immediate release. The batch must outlive this accessor or be detached before it goes away.
+     */
+    void attachReleaseBatch(ValueReleaseBatch* batch) {
+        _releaseBatch = batch;
+    }
+
 private:
     void release() {
         if (_owned) {
-            releaseValue(_tag, _val);
+            if (_releaseBatch) {
+                _releaseBatch->defer(_tag, _val);
+            } else {
+                releaseValue(_tag, _val);
+            }
             _owned = false;
         }
     }
@@ -228,6 +288,7 @@ private:
     bool _owned{false};
     TypeTags _tag{TypeTags::Nothing};
     Value _val{0};
+    ValueReleaseBatch* _releaseBatch{nullptr};
 };  // class OwnedValueAccessor
 
 /**
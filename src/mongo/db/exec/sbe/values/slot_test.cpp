@@ -189,6 +189,39 @@ TEST_F(OwnedValueAccessorTest, Tests) {
     runTests();
 }
 
+TEST_F(OwnedValueAccessorTest, ReleaseBatch) {
+    auto expected = value::makeNewString(longString);
+    value::ValueGuard expectedGuard(expected);
+
+    value::ValueReleaseBatch batch;
+    value::OwnedValueAccessor slot;
+    slot.attachReleaseBatch(&batch);
+
+    for (int i = 0; i < 2; ++i) {
+        auto [tag, val] = value::makeNewString(longString);
+        slot.reset(true, tag, val);
+    }
+    auto deferredView = slot.getViewOfValue();
+
+    // Resetting hands the previous value to the batch instead of freeing it, so a view taken
+    // before the reset must remain valid until the batch is released.
+    {
+        auto [tag, val] = value::makeNewString("other_long_string"_sd);
+        slot.reset(true, tag, val);
+    }
+    ASSERT_EQ(batch.size(), 2);
+    ASSERT_THAT(deferredView, ValueEq(expected));
+
+    // Unowned values are never deferred.
+    slot.reset(false, value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(1));
+    ASSERT_EQ(batch.size(), 3);
+    slot.reset();
+    ASSERT_EQ(batch.size(), 3);
+
+    batch.releaseAll();
+    ASSERT_EQ(batch.size(), 0);
+}
+
 class BSONObjValueAccessorTest : public SlotTestBase<value::BSONObjValueAccessor>,
                                  public mongo::unittest::Test {
 public:
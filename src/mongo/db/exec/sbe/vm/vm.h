@@ -1070,6 +1070,15 @@ enum class AggAccumulatorNElems { kValues = 0, kN, kMemUsage, kMemLimit, kSizeOf
 using SmallArityType = uint8_t;
 using ArityType = uint32_t;
 
+/**
+ * A sequence of VM instructions produced by compiling an EExpression tree.
+ *
+ * Note that compiled code is not relocatable: instructions embed raw pointers resolved at compile
+ * time, such as the 'value::SlotAccessor*' of each referenced slot and views of constants owned by
+ * the originating expression tree. A CodeFragment is therefore only valid for the lifetime of the
+ * expressions and plan stage tree it was compiled against and cannot be shared across plans (or
+ * cached independently of them), even when the expressions print identically.
+ */
 class CodeFragment {
 public:
     const auto& frames() const {
@@ -688,6 +688,50 @@ size_t homogeneousTopBottomHelper(bool isAscending,
     return bestIdx;
 }
 
+/**
+ * Typed top-k selection over a dense homogeneous sort key block. Returns the indices of the (at
+ * most) 'k' best keys in ascending index order, considering only entries whose bitset value is
+ * true. Keys are compared as raw typed values; no sort key is materialized as an SBE value until
+ * the caller merges the winners into the accumulated heap.
+ */
+template <typename Less, typename T>
+std::vector<size_t> homogeneousTopBottomKHelper(bool isAscending,
+                                                const std::span<const value::Value>& bitsetVals,
+                                                const std::span<const value::Value>& keyVals,
+                                                size_t k) {
+    auto keyLess = HomogeneousSortPattern<Less, T>(isAscending);
+
+    // Holds the indices of the best keys seen so far as a heap with the worst of them at the
+    // front, so that each subsequent candidate is rejected with a single typed compare in the
+    // common case.
+    std::vector<size_t> heap;
+    heap.reserve(std::min(k, keyVals.size()));
+    auto worstAtFront = [&](size_t lhs, size_t rhs) {
+        return keyLess(keyVals[lhs], keyVals[rhs]);
+    };
+
+    for (size_t i = 0; i < keyVals.size(); ++i) {
+        if (!value::bitcastTo<bool>(bitsetVals[i])) {
+            continue;
+        }
+        if (heap.size() < k) {
+            heap.push_back(i);
+            std::push_heap(heap.begin(), heap.end(), worstAtFront);
+        } else if (keyLess(keyVals[i], keyVals[heap.front()])) {
+            // Strictly better than the worst kept key. Using a strict comparison keeps the
+            // earliest of equal keys, matching the generic element-at-a-time path.
+            std::pop_heap(heap.begin(), heap.end(), worstAtFront);
+            heap.back() = i;
+            std::push_heap(heap.begin(), heap.end(), worstAtFront);
+        }
+    }
+
+    // Hand the winners back in block order so they merge into the accumulated heap in the same
+    // order the generic path would insert them.
+    std::sort(heap.begin(), heap.end());
+    return heap;
+}
+
 int memAdded(std::pair<value::TypeTags, value::Value> key,
              std::pair<value::TypeTags, value::Value> output) {
     return value::getApproximateSize(key.first, key.second) +
@@ -960,7 +1004,7 @@ bool tryHomogeneousFastPath(TopBottomSense sense,
                             const Less& less) {
     auto [state, mergeArr, startIdx, maxSize, memUsage, memLimit, isGroupAccum] = stateTuple;
 
-    if (maxSize == 1 && sortKeys.isDense() && value::validHomogeneousType(sortKeys.tag()) &&
+    if (sortKeys.isDense() && value::validHomogeneousType(sortKeys.tag()) &&
         sortKeys.tag() != value::TypeTags::Boolean && sortKeys.count() > 0) {
 
         // We will use a std::vector of TopBottomSortKeyAndIdx structs instead of a nested SBE array
@@ -972,35 +1016,69 @@ bool tryHomogeneousFastPath(TopBottomSense sense,
 
         auto tag = sortKeys.tag();
         auto sortKeyVals = sortKeys.valsSpan();
-        size_t bestIdx = 0;
-        switch (tag) {
-            case value::TypeTags::NumberInt32:
-                bestIdx =
-                    homogeneousTopBottomHelper<Less, int32_t>(isAscending, bitsetVals, sortKeyVals);
-                break;
-            case value::TypeTags::NumberInt64:
-            case value::TypeTags::Date:
-                bestIdx =
-                    homogeneousTopBottomHelper<Less, int64_t>(isAscending, bitsetVals, sortKeyVals);
-                break;
-            case value::TypeTags::NumberDouble:
-                bestIdx =
-                    homogeneousTopBottomHelper<Less, double>(isAscending, bitsetVals, sortKeyVals);
-                break;
-            default:
-                MONGO_UNREACHABLE;
-        }
-
-        if (bestIdx == bitsetVals.size()) {
-            // All values in the bitset were false, so return the state unchanged.
-            return true;
-        }
-
-        // Now that we have the "best" index, update the state and return it.
-
-        // The sort key "array" for a NumberInt32, NumberInt64, Date, or NumberDouble when there is
-        // only one sort field will just be the value itself with no actual array.
-        newArr.push_back({std::pair{tag, sortKeyVals[bestIdx]} /* sortKey */, bestIdx});
+
+        if (maxSize == 1) {
+            size_t bestIdx = 0;
+            switch (tag) {
+                case value::TypeTags::NumberInt32:
+                    bestIdx = homogeneousTopBottomHelper<Less, int32_t>(
+                        isAscending, bitsetVals, sortKeyVals);
+                    break;
+                case value::TypeTags::NumberInt64:
+                case value::TypeTags::Date:
+                    bestIdx = homogeneousTopBottomHelper<Less, int64_t>(
+                        isAscending, bitsetVals, sortKeyVals);
+                    break;
+                case value::TypeTags::NumberDouble:
+                    bestIdx = homogeneousTopBottomHelper<Less, double>(
+                        isAscending, bitsetVals, sortKeyVals);
+                    break;
+                default:
+                    MONGO_UNREACHABLE;
+            }
+
+            if (bestIdx == bitsetVals.size()) {
+                // All values in the bitset were false, so return the state unchanged.
+                return true;
+            }
+
+            // Now that we have the "best" index, update the state and return it.
+
+            // The sort key "array" for a NumberInt32, NumberInt64, Date, or NumberDouble when
+            // there is only one sort field will just be the value itself with no actual array.
+            newArr.push_back({std::pair{tag, sortKeyVals[bestIdx]} /* sortKey */, bestIdx});
+        } else {
+            // General k: select the best 'maxSize' keys with a typed heap over the raw values, so
+            // block entries that can never make the result are rejected with one integer or
+            // double compare and are never materialized.
+            std::vector<size_t> bestIdxs;
+            switch (tag) {
+                case value::TypeTags::NumberInt32:
+                    bestIdxs = homogeneousTopBottomKHelper<Less, int32_t>(
+                        isAscending, bitsetVals, sortKeyVals, maxSize);
+                    break;
+                case value::TypeTags::NumberInt64:
+                case value::TypeTags::Date:
+                    bestIdxs = homogeneousTopBottomKHelper<Less, int64_t>(
+                        isAscending, bitsetVals, sortKeyVals, maxSize);
+                    break;
+                case value::TypeTags::NumberDouble:
+                    bestIdxs = homogeneousTopBottomKHelper<Less, double>(
+                        isAscending, bitsetVals, sortKeyVals, maxSize);
+                    break;
+                default:
+                    MONGO_UNREACHABLE;
+            }
+
+            if (bestIdxs.empty()) {
+                // All values in the bitset were false, so return the state unchanged.
+                return true;
+            }
+
+            for (size_t bestIdx : bestIdxs) {
+                newArr.push_back({std::pair{tag, sortKeyVals[bestIdx]} /* sortKey */, bestIdx});
+            }
+        }
 
         // Update mergeArr in-place.
         combineBlockNativeAggTopBottomN(stateTuple, newArr, valBlock, less);
@@ -1365,6 +1443,61 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinValueBlockAggBot
 
 enum class ArithmeticOp { Addition, Subtraction, Multiplication, Division };
 
+namespace {
+/**
+ * Returns true if the extracted block holds only NumberDouble values, with no Nothings, making it
+ * eligible for the typed arithmetic kernel below.
+ */
+bool isDenseDoubleBlock(const value::DeblockedTagVals& deblocked) {
+    return deblocked.isDense() && deblocked.tag() == value::TypeTags::NumberDouble &&
+        deblocked.count() > 0;
+}
+
+/**
+ * Typed arithmetic kernel for dense NumberDouble operands. Operand shapes and the presence of a
+ * bitset are template parameters so each instantiation is a plain loop over raw doubles that the
+ * compiler can auto-vectorize — the same way the other homogeneous block fast paths in this file
+ * get SIMD execution without hand-written intrinsics. Division is deliberately not handled here:
+ * dividing by zero produces Nothing, which would break the branch-free loop.
+ */
+template <int op, bool LeftIsScalar, bool RightIsScalar, bool HasBitset>
+void doubleArithKernel(double leftScalar,
+                       const value::Value* leftVals,
+                       double rightScalar,
+                       const value::Value* rightVals,
+                       const value::TypeTags* bitsetTags,
+                       const value::Value* bitsetVals,
+                       std::vector<value::TypeTags>& tagsOut,
+                       std::vector<value::Value>& valuesOut,
+                       size_t valsNum) {
+    static_assert(static_cast<int>(ArithmeticOp::Division) != op);
+
+    for (size_t i = 0; i < valsNum; ++i) {
+        if constexpr (HasBitset) {
+            if (bitsetTags[i] != value::TypeTags::Boolean ||
+                !value::bitcastTo<bool>(bitsetVals[i])) {
+                continue;
+            }
+        }
+
+        const double lhs = LeftIsScalar ? leftScalar : value::bitcastTo<double>(leftVals[i]);
+        const double rhs = RightIsScalar ? rightScalar : value::bitcastTo<double>(rightVals[i]);
+
+        double res;
+        if constexpr (static_cast<int>(ArithmeticOp::Addition) == op) {
+            res = lhs + rhs;
+        } else if constexpr (static_cast<int>(ArithmeticOp::Subtraction) == op) {
+            res = lhs - rhs;
+        } else {
+            res = lhs * rhs;
+        }
+
+        tagsOut[i] = value::TypeTags::NumberDouble;
+        valuesOut[i] = value::bitcastFrom<double>(res);
+    }
+}
+}  // namespace
+
 template <int op>
 FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinBlockBlockArithmeticOperation(
     const value::TypeTags* bitsetTags,
@@ -1378,6 +1511,24 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinBlockBlockArithm
     std::vector<value::TypeTags> tagsOut(valsNum, value::TypeTags::Nothing);
     std::vector<value::Value> valuesOut(valsNum, 0);
 
+    if constexpr (static_cast<int>(ArithmeticOp::Division) != op) {
+        if (isDenseDoubleBlock(leftBlock) && isDenseDoubleBlock(rightBlock)) {
+            doubleArithKernel<op, false, false, true>(0.0,
+                                                      leftBlock.vals(),
+                                                      0.0,
+                                                      rightBlock.vals(),
+                                                      bitsetTags,
+                                                      bitsetVals,
+                                                      tagsOut,
+                                                      valuesOut,
+                                                      valsNum);
+            auto resBlock = buildBlockFromStorage(std::move(tagsOut), std::move(valuesOut));
+            return {true,
+                    value::TypeTags::valueBlock,
+                    value::bitcastFrom<value::ValueBlock*>(resBlock.release())};
+        }
+    }
+
     for (size_t i = 0; i < valsNum; ++i) {
         if (bitsetTags[i] != value::TypeTags::Boolean || !value::bitcastTo<bool>(bitsetVals[i])) {
             continue;
@@ -1421,6 +1572,24 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinBlockBlockArithm
     std::vector<value::TypeTags> tagsOut(valsNum, value::TypeTags::Nothing);
     std::vector<value::Value> valuesOut(valsNum, 0);
 
+    if constexpr (static_cast<int>(ArithmeticOp::Division) != op) {
+        if (isDenseDoubleBlock(leftBlock) && isDenseDoubleBlock(rightBlock)) {
+            doubleArithKernel<op, false, false, false>(0.0,
+                                                       leftBlock.vals(),
+                                                       0.0,
+                                                       rightBlock.vals(),
+                                                       nullptr,
+                                                       nullptr,
+                                                       tagsOut,
+                                                       valuesOut,
+                                                       valsNum);
+            auto resBlock = buildBlockFromStorage(std::move(tagsOut), std::move(valuesOut));
+            return {true,
+                    value::TypeTags::valueBlock,
+                    value::bitcastFrom<value::ValueBlock*>(resBlock.release())};
+        }
+    }
+
     for (size_t i = 0; i < valsNum; ++i) {
         if constexpr (static_cast<int>(ArithmeticOp::Addition) == op) {
             auto [_, resTag, resVal] = genericAdd(
@@ -1464,6 +1633,24 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinScalarBlockArith
     std::vector<value::TypeTags> tagsOut(valsNum, value::TypeTags::Nothing);
     std::vector<value::Value> valuesOut(valsNum, 0);
 
+    if constexpr (static_cast<int>(ArithmeticOp::Division) != op) {
+        if (scalar.first == value::TypeTags::NumberDouble && isDenseDoubleBlock(extractedValues)) {
+            doubleArithKernel<op, true, false, true>(value::bitcastTo<double>(scalar.second),
+                                                     nullptr,
+                                                     0.0,
+                                                     extractedValues.vals(),
+                                                     bitsetTags,
+                                                     bitsetVals,
+                                                     tagsOut,
+                                                     valuesOut,
+                                                     valsNum);
+            auto resBlock = buildBlockFromStorage(std::move(tagsOut), std::move(valuesOut));
+            return {true,
+                    value::TypeTags::valueBlock,
+                    value::bitcastFrom<value::ValueBlock*>(resBlock.release())};
+        }
+    }
+
     for (size_t i = 0; i < valsNum; ++i) {
         if (bitsetTags[i] != value::TypeTags::Boolean || !value::bitcastTo<bool>(bitsetVals[i])) {
             continue;
@@ -1506,6 +1693,24 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinScalarBlockArith
     std::vector<value::TypeTags> tagsOut(valsNum, value::TypeTags::Nothing);
     std::vector<value::Value> valuesOut(valsNum, 0);
 
+    if constexpr (static_cast<int>(ArithmeticOp::Division) != op) {
+        if (scalar.first == value::TypeTags::NumberDouble && isDenseDoubleBlock(extractedValues)) {
+            doubleArithKernel<op, true, false, false>(value::bitcastTo<double>(scalar.second),
+                                                      nullptr,
+                                                      0.0,
+                                                      extractedValues.vals(),
+                                                      nullptr,
+                                                      nullptr,
+                                                      tagsOut,
+                                                      valuesOut,
+                                                      valsNum);
+            auto resBlock = buildBlockFromStorage(std::move(tagsOut), std::move(valuesOut));
+            return {true,
+                    value::TypeTags::valueBlock,
+                    value::bitcastFrom<value::ValueBlock*>(resBlock.release())};
+        }
+    }
+
     for (size_t i = 0; i < valsNum; ++i) {
         if constexpr (static_cast<int>(ArithmeticOp::Addition) == op) {
             auto [_, resTag, resVal] = genericAdd(
@@ -1549,6 +1754,24 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinBlockScalarArith
     std::vector<value::TypeTags> tagsOut(valsNum, value::TypeTags::Nothing);
     std::vector<value::Value> valuesOut(valsNum, 0);
 
+    if constexpr (static_cast<int>(ArithmeticOp::Division) != op) {
+        if (scalar.first == value::TypeTags::NumberDouble && isDenseDoubleBlock(extractedValues)) {
+            doubleArithKernel<op, false, true, true>(0.0,
+                                                     extractedValues.vals(),
+                                                     value::bitcastTo<double>(scalar.second),
+                                                     nullptr,
+                                                     bitsetTags,
+                                                     bitsetVals,
+                                                     tagsOut,
+                                                     valuesOut,
+                                                     valsNum);
+            auto resBlock = buildBlockFromStorage(std::move(tagsOut), std::move(valuesOut));
+            return {true,
+                    value::TypeTags::valueBlock,
+                    value::bitcastFrom<value::ValueBlock*>(resBlock.release())};
+        }
+    }
+
     for (size_t i = 0; i < valsNum; ++i) {
         if (bitsetTags[i] != value::TypeTags::Boolean || !value::bitcastTo<bool>(bitsetVals[i])) {
             continue;
@@ -1591,6 +1814,24 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinBlockScalarArith
     std::vector<value::TypeTags> tagsOut(valsNum, value::TypeTags::Nothing);
     std::vector<value::Value> valuesOut(valsNum, 0);
 
+    if constexpr (static_cast<int>(ArithmeticOp::Division) != op) {
+        if (scalar.first == value::TypeTags::NumberDouble && isDenseDoubleBlock(extractedValues)) {
+            doubleArithKernel<op, false, true, false>(0.0,
+                                                      extractedValues.vals(),
+                                                      value::bitcastTo<double>(scalar.second),
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      tagsOut,
+                                                      valuesOut,
+                                                      valsNum);
+            auto resBlock = buildBlockFromStorage(std::move(tagsOut), std::move(valuesOut));
+            return {true,
+                    value::TypeTags::valueBlock,
+                    value::bitcastFrom<value::ValueBlock*>(resBlock.release())};
+        }
+    }
+
     for (size_t i = 0; i < valsNum; ++i) {
         if constexpr (static_cast<int>(ArithmeticOp::Addition) == op) {
             auto [_, resTag, resVal] = genericAdd(
@@ -69,6 +69,7 @@
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/db/transaction_resources.h"
+#include "mongo/db/update/document_diff_applier.h"
 #include "mongo/db/update/path_support.h"
 #include "mongo/db/update/update_oplog_entry_serialization.h"
 #include "mongo/db/update/update_util.h"
@@ -347,17 +348,47 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj,
                 }
 
                 auto diff = update_oplog_entry::extractDiffFromOplogEntry(logObj);
+
+                // Delta updates replace the root of '_doc', so they never qualify for the in-place
+                // path above even when only a few bytes changed. When the diff is available, write
+                // just the changed byte ranges as damage events instead of rewriting the whole
+                // document. Capped and encrypted collections keep the full-document write to
+                // preserve the additional checks updateDocument() performs for them.
+                const bool useDamages = diff.has_value() &&
+                    driver->type() == UpdateDriver::UpdateType::kDelta &&
+                    collectionPtr()->updateWithDamagesSupported() &&
+                    !collectionPtr()->isCapped() &&
+                    !collectionPtr()->getCollectionOptions().encryptedFieldConfig;
+
                 WriteUnitOfWork wunit(opCtx());
-                collection_internal::updateDocument(
-                    opCtx(),
-                    collectionPtr(),
-                    recordId,
-                    oldObj,
-                    newObj,
-                    diff.has_value() ? &*diff : collection_internal::kUpdateAllIndexes,
-                    &indexesAffected,
-                    _params.opDebug,
-                    &args);
+                if (useDamages) {
+                    auto damagesOutput = doc_diff::computeDamages(
+                        oldObjValue,
+                        *diff,
+                        driver->getUpdateExecutor()->getCheckExistenceForDiffInsertOperations());
+                    newObj = uassertStatusOK(
+                        collection_internal::updateDocumentWithDamages(opCtx(),
+                                                                       collectionPtr(),
+                                                                       recordId,
+                                                                       oldObj,
+                                                                       damagesOutput.damageSource.get(),
+                                                                       damagesOutput.damages,
+                                                                       &*diff,
+                                                                       &indexesAffected,
+                                                                       _params.opDebug,
+                                                                       &args));
+                } else {
+                    collection_internal::updateDocument(
+                        opCtx(),
+                        collectionPtr(),
+                        recordId,
+                        oldObj,
+                        newObj,
+                        diff.has_value() ? &*diff : collection_internal::kUpdateAllIndexes,
+                        &indexesAffected,
+                        _params.opDebug,
+                        &args);
+                }
                 invariant(oldObj.snapshotId() ==
                           shard_role_details::getRecoveryUnit(opCtx())->getSnapshotId());
                 wunit.commit();
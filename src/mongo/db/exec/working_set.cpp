@@ -78,11 +78,23 @@ WorkingSetID WorkingSet::allocate() {
 }
 
 void WorkingSet::clear() {
-    _data.clear();
+    if (_data.size() > kMaxRecycledMembers) {
+        // The working set grew unusually large; release the memory rather than caching it for
+        // the next generation of results.
+        _data.clear();
+        _freeList = INVALID_ID;
+        return;
+    }
 
-    // Since working set is now empty, the free list pointer should
-    // point to nothing.
-    _freeList = INVALID_ID;
+    // Reset all members in place and thread the entire slab back onto the free list rather than
+    // destroying it. This retains the vector of MemberHolders as well as each member's preserved
+    // DocumentStorage buffer and keyData capacity, so the next generation of results (e.g. the
+    // next branch trialed by SubplanStage) is populated without going back to the allocator.
+    for (WorkingSetID i = 0; i < _data.size(); ++i) {
+        _data[i].member.clear();
+        _data[i].nextFreeOrSelf = (i + 1 == _data.size()) ? INVALID_ID : i + 1;
+    }
+    _freeList = _data.empty() ? INVALID_ID : 0;
 }
 
 void WorkingSet::transitionToRecordIdAndIdx(WorkingSetID id) {
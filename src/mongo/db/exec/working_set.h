@@ -377,7 +377,9 @@ public:
     }
 
     /**
-     * Removes and deallocates all members of this working set.
+     * Removes all members of this working set. The members themselves and the slab backing them
+     * are recycled rather than deallocated (up to an internal size limit), so the allocations made
+     * for one generation of query results are reused by the next.
      */
     void clear();
 
@@ -422,6 +424,11 @@ public:
     WorkingSetID emplace(WorkingSetMember&&);
 
 private:
+    // Largest working set that clear() will recycle in place. A working set that has grown beyond
+    // this many members is deallocated instead, so that a single oversized batch does not pin
+    // memory for the remainder of the query.
+    static constexpr size_t kMaxRecycledMembers = 4096;
+
     struct MemberHolder {
         // Free list link if freed. Points to self if in use.
         WorkingSetID nextFreeOrSelf;
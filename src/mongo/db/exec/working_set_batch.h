@@ -0,0 +1,113 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "mongo/db/exec/working_set.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+
+/**
+ * A bounded FIFO buffer of WorkingSetIDs passed through PlanStage::workBatch(). Producing stages
+ * append results with push() and may inspect them with at(); the consumer driving the plan drains
+ * them with pop(). Storage is recycled once the buffer has been fully drained, so a single batch
+ * allocates at most once.
+ */
+class WorkingSetBatch {
+public:
+    static constexpr size_t kDefaultMaxSize = 128;
+
+    explicit WorkingSetBatch(size_t maxSize = kDefaultMaxSize) : _maxSize(maxSize) {
+        invariant(_maxSize > 0);
+        _ids.reserve(_maxSize);
+    }
+
+    size_t size() const {
+        return _ids.size();
+    }
+
+    bool empty() const {
+        return _next == _ids.size();
+    }
+
+    bool full() const {
+        return _ids.size() >= _maxSize;
+    }
+
+    size_t remainingCapacity() const {
+        return _maxSize - _ids.size();
+    }
+
+    /**
+     * Returns the id at absolute position 'i', including positions already drained by pop().
+     */
+    WorkingSetID at(size_t i) const {
+        dassert(i < _ids.size());
+        return _ids[i];
+    }
+
+    void push(WorkingSetID id) {
+        dassert(!full());
+        _ids.push_back(id);
+    }
+
+    WorkingSetID pop() {
+        dassert(!empty());
+        const WorkingSetID id = _ids[_next++];
+        if (_next == _ids.size()) {
+            _ids.clear();
+            _next = 0;
+        }
+        return id;
+    }
+
+    /**
+     * Makes the objects of all members not yet drained safe to survive a yield. Must be called
+     * before the plan that produced the batch is saved while buffered results remain.
+     */
+    void makeObjsOwned(WorkingSet* ws) const {
+        for (size_t i = _next; i < _ids.size(); ++i) {
+            ws->get(_ids[i])->makeObjOwnedIfNeeded();
+        }
+    }
+
+private:
+    std::vector<WorkingSetID> _ids;
+
+    // Index of the next id to be returned by pop().
+    size_t _next = 0;
+
+    const size_t _maxSize;
+};
+
+}  // namespace mongo
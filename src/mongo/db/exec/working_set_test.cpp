@@ -330,4 +330,30 @@ TEST_F(WorkingSetFixture, WsmCanBeExtractedAndReinserted) {
     ASSERT_FALSE(emplacedWsm->metadata());
 }
 
+TEST_F(WorkingSetFixture, ClearRecyclesMembers) {
+    // Allocate a few more members so that clear() has a non-trivial slab to recycle.
+    std::vector<WorkingSetID> ids{id};
+    for (int i = 0; i < 3; ++i) {
+        auto nextId = ws->allocate();
+        ws->get(nextId)->doc.setValue(Document{{"x", Value{i}}});
+        ws->transitionToOwnedObj(nextId);
+        ids.push_back(nextId);
+    }
+
+    ws->clear();
+
+    // All previously allocated ids are back on the free list.
+    for (auto wsid : ids) {
+        ASSERT_TRUE(ws->isFree(wsid));
+    }
+
+    // Allocation after clear() reuses the recycled slots, and the recycled members come back
+    // empty.
+    for (size_t i = 0; i < ids.size(); ++i) {
+        auto recycled = ws->allocate();
+        ASSERT_LT(recycled, ids.size());
+        ASSERT_EQ(ws->get(recycled)->getState(), WorkingSetMember::INVALID);
+    }
+}
+
 }  // namespace mongo
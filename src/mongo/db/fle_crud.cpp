@@ -775,7 +775,7 @@ void processFieldsForInsertV2(FLEQueryInterface* queryImpl,
                 totalTokens++;
             }
 
-            tokensSets.emplace_back(tokens);
+            tokensSets.emplace_back(std::move(tokens));
         } else {
             FLEEdgePrfBlock block;
             block.esc = PrfBlockfromCDR(payload.payload.getEscDerivedToken());
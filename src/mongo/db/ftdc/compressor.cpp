@@ -27,6 +27,7 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
 #include <limits>
@@ -89,8 +90,11 @@ FTDCCompressor::addSample(const BSONObj& sample, Date_t date) {
 
     // Add another sample
     for (std::size_t i = 0; i < _metrics.size(); ++i) {
-        // NOTE: This touches a lot of cache lines so that compression code can be more effcient.
-        _deltas[getArrayOffset(_maxDeltas, _deltaCount, i)] = _metrics[i] - _prevmetrics[i];
+        // NOTE: Deltas are stored sample-major so this loop writes one contiguous range instead
+        // of touching a cold cache line per metric. getCompressedSamples() transposes the array
+        // to metric-major order once per chunk before encoding.
+        _deltas[static_cast<std::size_t>(_deltaCount) * _metricsCount + i] =
+            _metrics[i] - _prevmetrics[i];
     }
 
     ++_deltaCount;
@@ -150,9 +154,28 @@ StatusWith<std::tuple<ConstDataRange, Date_t>> FTDCCompressor::getCompressedSamp
         //
         // These byte arrays are added to a buffer which is then concatenated with other chunks and
         // compressed with ZLIB.
+
+        // The deltas are stored sample-major (see addSample()). Transpose them into metric-major
+        // order for encoding, in fixed-size tiles so that neither side of the copy strides
+        // through the whole array.
+        constexpr std::uint32_t kTransposeBlockDim = 64;
+        _transposedDeltas.resize(static_cast<std::size_t>(_metricsCount) * _deltaCount);
+        for (std::uint32_t jb = 0; jb < _deltaCount; jb += kTransposeBlockDim) {
+            const std::uint32_t jEnd = std::min(jb + kTransposeBlockDim, _deltaCount);
+            for (std::uint32_t ib = 0; ib < _metricsCount; ib += kTransposeBlockDim) {
+                const std::uint32_t iEnd = std::min(ib + kTransposeBlockDim, _metricsCount);
+                for (std::uint32_t j = jb; j < jEnd; ++j) {
+                    for (std::uint32_t i = ib; i < iEnd; ++i) {
+                        _transposedDeltas[getArrayOffset(_deltaCount, j, i)] =
+                            _deltas[static_cast<std::size_t>(j) * _metricsCount + i];
+                    }
+                }
+            }
+        }
+
         for (std::uint32_t i = 0; i < _metricsCount; i++) {
             for (std::uint32_t j = 0; j < _deltaCount; j++) {
-                std::uint64_t delta = _deltas[getArrayOffset(_maxDeltas, j, i)];
+                std::uint64_t delta = _transposedDeltas[getArrayOffset(_deltaCount, j, i)];
 
                 if (delta == 0) {
                     ++zeroesCount;
@@ -177,10 +177,13 @@ private:
     // Max deltas for the current chunk
     std::size_t _maxDeltas{0};
 
-    // Array of deltas - M x S
-    // _deltas[Metrics][Samples]
+    // Array of deltas - S x M
+    // _deltas[Samples][Metrics], so that adding a sample writes one contiguous range
     std::vector<std::uint64_t> _deltas;
 
+    // Scratch buffer used to transpose '_deltas' into metric-major order when encoding a chunk
+    std::vector<std::uint64_t> _transposedDeltas;
+
     // Buffer for metric chunk compressed = uncompressed length + compressed data
     BufBuilder _compressedChunkBuffer;
 
@@ -86,22 +86,48 @@ void String::setData(const StringData utf8_src) {
     // plus a null character if there isn't one.
     _data.resize(utf8_src.size() + 1);
 
+    const char* src = utf8_src.rawData();
+    const size_t srcSize = utf8_src.size();
+    size_t index = 0;
+
+#ifdef MONGO_HAVE_FAST_BYTE_VECTOR
+    // Widen the leading run of ASCII (the dominant case for text) a vector load at a time,
+    // leaving the scalar UTF-8 decoder only the remainder. The scalar decoder stops at a NUL
+    // byte, so the fast path must stop there too.
+    while (srcSize - index >= ByteVector::size) {
+        auto word = ByteVector::load(&src[index]);
+        uint32_t usableBytes = ByteVector::countInitialZeros(word.maskHigh());
+        if (ByteVector::Mask nulMask = word.compareEQ('\0').maskAny()) {
+            usableBytes = std::min(usableBytes, ByteVector::countInitialZeros(nulMask));
+        }
+        for (uint32_t i = 0; i < usableBytes; ++i) {
+            _data[index + i] = char32_t(uint8_t(src[index + i]));
+        }
+        index += usableBytes;
+        if (usableBytes < ByteVector::size) {
+            break;
+        }
+    }
+#endif
+
     int result = 0;
     size_t resultSize = 0;
 
-    // Although utf8_src.rawData() is not guaranteed to be null-terminated, copyString8to32 won't
-    // access bad memory because it is limited by the size of its output buffer, which is set to the
-    // size of utf8_src.
-    copyString8to32(&_data[0],
-                    reinterpret_cast<const unsigned char*>(&utf8_src.rawData()[0]),
-                    _data.size(),
-                    resultSize,
-                    result);
+    if (index < srcSize) {
+        // Although utf8_src.rawData() is not guaranteed to be null-terminated, copyString8to32
+        // won't access bad memory because it is limited by the size of its output buffer, which
+        // is set to the size of the remaining input.
+        copyString8to32(&_data[index],
+                        reinterpret_cast<const unsigned char*>(&src[index]),
+                        _data.size() - index,
+                        resultSize,
+                        result);
+    }
 
     uassert(28755, "text contains invalid UTF-8", result == 0);
 
     // Resize _data so it is only as big as what it contains.
-    _data.resize(resultSize);
+    _data.resize(index + resultSize);
     _needsOutputConversion = true;
 }
 
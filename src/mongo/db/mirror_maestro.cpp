@@ -29,6 +29,7 @@
 
 
 #include <absl/container/node_hash_map.h>
+#include <algorithm>
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
 #include <boost/smart_ptr.hpp>
@@ -78,9 +79,12 @@
 #include "mongo/util/assert_util.h"
 #include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/decorable.h"
+#include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/future.h"
+#include "mongo/util/namespace_string_util.h"
 #include "mongo/util/net/hostandport.h"
+#include "mongo/util/serialization_context.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/synchronized_value.h"
 
@@ -104,6 +108,8 @@ constexpr auto kMirroredReadsResolvedKey = "resolved"_sd;
 constexpr auto kMirroredReadsResolvedBreakdownKey = "resolvedBreakdown"_sd;
 constexpr auto kMirroredReadsSucceededKey = "succeeded"_sd;
 constexpr auto kMirroredReadsPendingKey = "pending"_sd;
+constexpr auto kMirroredReadsTargetedKey = "targeted"_sd;
+constexpr auto kMirroredReadsTotalResponseTimeMicrosKey = "totalResponseTimeMicros"_sd;
 
 MONGO_FAIL_POINT_DEFINE(mirrorMaestroExpectsResponse);
 MONGO_FAIL_POINT_DEFINE(mirrorMaestroTracksPending);
@@ -224,6 +230,16 @@ public:
         if (MONGO_unlikely(mirrorMaestroTracksPending.shouldFail())) {
             section.append(kMirroredReadsPendingKey, pending.loadRelaxed());
         }
+
+        {
+            // Targeted mirroring always awaits responses, so its metrics are always reported.
+            BSONObjBuilder targetedBob(section.subobjStart(kMirroredReadsTargetedKey));
+            targetedBob.append(kMirroredReadsSentKey, targetedSent.loadRelaxed());
+            targetedBob.append(kMirroredReadsResolvedKey, targetedResolved.loadRelaxed());
+            targetedBob.append(kMirroredReadsSucceededKey, targetedSucceeded.loadRelaxed());
+            targetedBob.append(kMirroredReadsTotalResponseTimeMicrosKey,
+                               targetedTotalResponseTimeMicros.loadRelaxed());
+        }
         return section.obj();
     };
 
@@ -277,6 +293,15 @@ public:
     // Counts the number of mirrored operations processed successfully by this node as a
     // secondary. Disabled by default, hidden behind the mirrorMaestroExpectsResponse fail point.
     AtomicWord<CounterT> processedAsSecondary;
+
+    // Counters for reads mirrored to an explicitly targeted host (mirrorReads.targetedHost).
+    // Targeted mirroring awaits every response so that per-host response times and outcomes
+    // accumulate as metrics rather than per-operation logs; the mean remote response time is
+    // targetedTotalResponseTimeMicros / targetedResolved.
+    AtomicWord<CounterT> targetedSent;
+    AtomicWord<CounterT> targetedResolved;
+    AtomicWord<CounterT> targetedSucceeded;
+    AtomicWord<CounterT> targetedTotalResponseTimeMicros;
 };
 auto& gMirroredReadsSection = *ServerStatusSectionBuilder<MirroredReadsSection>(
                                    MirrorMaestro::kServerStatusSectionName.toString())
@@ -371,6 +396,15 @@ void MirrorMaestroImpl::tryMirror(const std::shared_ptr<CommandInvocation>& invo
         return;
     }
 
+    if (const auto& namespaces = params.getNamespaces(); namespaces && !namespaces->empty()) {
+        const auto nss =
+            NamespaceStringUtil::serialize(invocation->ns(), SerializationContext::stateDefault());
+        if (std::find(namespaces->begin(), namespaces->end(), nss) == namespaces->end()) {
+            // Mirroring is restricted to namespaces this read does not touch.
+            return;
+        }
+    }
+
     auto imr = _topologyVersionObserver.getCached();
     auto samplingParams = MirroringSampler::SamplingParameters(params.getSamplingRate());
     if (!_sampler.shouldSample(imr, samplingParams)) {
@@ -444,6 +478,48 @@ void MirrorMaestroImpl::_mirror(const std::vector<HostAndPort>& hosts,
         return bob.obj();
     }();
 
+    // When a host is explicitly targeted, shadow traffic goes to it alone and every response is
+    // awaited, so the operator can warm a cold node and compare its response times and outcomes
+    // against the primary's own metrics before promoting it.
+    if (auto&& targetedHost = params.getTargetedHost()) {
+        const HostAndPort target(*targetedHost);
+        if (std::find(hosts.begin(), hosts.end(), target) == hosts.end()) {
+            LOGV2_DEBUG(8928501,
+                        2,
+                        "Targeted mirror host is not an eligible secondary",
+                        "host"_attr = target);
+            return;
+        }
+
+        auto targetedResponseCallback = [](auto& args) {
+            gMirroredReadsSection.targetedResolved.fetchAndAdd(1);
+            if (args.response.elapsed) {
+                gMirroredReadsSection.targetedTotalResponseTimeMicros.fetchAndAdd(
+                    durationCount<Microseconds>(*args.response.elapsed));
+            }
+            if (getStatusFromCommandResult(args.response.data).isOK()) {
+                gMirroredReadsSection.targetedSucceeded.fetchAndAdd(1);
+            }
+        };
+
+        auto newRequest = executor::RemoteCommandRequest(
+            target, invocation.getDBForReadMirroring(), payload, nullptr /* opCtx */);
+        newRequest.options.fireAndForget = false;
+
+        auto status =
+            _executor->scheduleRemoteCommand(newRequest, std::move(targetedResponseCallback))
+                .getStatus();
+        if (ErrorCodes::isShutdownError(status.code())) {
+            LOGV2_DEBUG(
+                8928502, 1, "Aborted targeted mirroring due to shutdown", "reason"_attr = status);
+            return;
+        }
+
+        tassert(status);
+        gMirroredReadsSection.targetedSent.fetchAndAdd(1);
+        return;
+    }
+
     // Mirror to a normalized subset of eligible hosts (i.e., secondaries).
     const auto startIndex = (*_random)->nextInt64(hosts.size());
     const auto mirroringFactor = std::ceil(params.getSamplingRate() * hosts.size());
@@ -82,6 +82,7 @@
 #include "mongo/db/catalog/health_log.h"
 #include "mongo/db/catalog/health_log_interface.h"
 #include "mongo/db/catalog_raii.h"
+#include "mongo/db/catalog/capped_collection_truncation.h"
 #include "mongo/db/change_collection_expired_documents_remover.h"
 #include "mongo/db/change_stream_change_collection_manager.h"
 #include "mongo/db/change_stream_options_manager.h"
@@ -1110,6 +1111,10 @@ ExitCode _initAndListen(ServiceContext* serviceContext, int listenPort) {
         }
     }
 
+    // Start the background task that truncates excess marker ranges from capped collections
+    // maintained with truncate markers (e.g. the profile collection).
+    startCappedCollectionTruncation(serviceContext);
+
     if (computeModeEnabled) {
         if (!isStandalone || !serverGlobalParams.clusterRole.has(ClusterRole::None)) {
             LOGV2_ERROR(6968200, "'enableComputeMode' can be used only in standalone server");
@@ -2047,6 +2052,8 @@ void shutdownTask(const ShutdownTaskArgs& shutdownArgs) {
         shutdownChangeStreamExpiredPreImagesRemover(serviceContext);
 
         shutdownChangeCollectionExpiredDocumentsRemover(serviceContext);
+
+        shutdownCappedCollectionTruncation(serviceContext);
     }
 
     // We should always be able to acquire the global lock at shutdown.
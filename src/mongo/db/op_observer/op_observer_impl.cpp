@@ -626,6 +626,16 @@ std::vector<repl::OpTime> _logInsertOps(OperationContext* opCtx,
 
     WriteUnitOfWork wuow(opCtx);
 
+    // When the caller has not preassigned any optimes, reserve the whole contiguous range of
+    // timestamps in one batch rather than taking the optime mutex and registering the oplog
+    // visibility update once per entry.
+    const bool allSlotsUnassigned = std::all_of(
+        begin, end, [](const InsertStatement& stmt) { return stmt.oplogSlot.isNull(); });
+    std::vector<OplogSlot> reservedSlots;
+    if (allSlotsUnassigned) {
+        reservedSlots = operationLogger->getNextOpTimes(opCtx, count);
+    }
+
     std::vector<repl::OpTime> opTimes(count);
     std::vector<Timestamp> timestamps(count);
     std::vector<BSONObj> bsonOplogEntries(count);
@@ -634,7 +644,8 @@ std::vector<repl::OpTime> _logInsertOps(OperationContext* opCtx,
         // Make a copy from the template for each insert oplog entry.
         MutableOplogEntry oplogEntry = *oplogEntryTemplate;
         // Make a mutable copy.
-        auto insertStatementOplogSlot = begin[i].oplogSlot;
+        auto insertStatementOplogSlot =
+            allSlotsUnassigned ? reservedSlots[i] : begin[i].oplogSlot;
         // Fetch optime now, if not already fetched.
         if (insertStatementOplogSlot.isNull()) {
             insertStatementOplogSlot = operationLogger->getNextOpTimes(opCtx, 1U)[0];
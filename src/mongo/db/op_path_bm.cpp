@@ -0,0 +1,307 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "mongo/base/init.h"
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/ops/write_ops_gen.h"
+#include "mongo/db/query/find_command_gen.h"
+#include "mongo/db/repl/member_state.h"
+#include "mongo/db/repl/oplog.h"
+#include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/repl/replication_coordinator_mock.h"
+#include "mongo/db/service_context_d_test_fixture.h"
+#include "mongo/logv2/log_domain_global.h"
+#include "mongo/logv2/log_manager.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/unittest/join_thread.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/future.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * End-to-end op-path benchmarks: each operation is serialized into an OpMsg and dispatched
+ * through DBDirectClient, so the measured cost covers command parse, planning, execution
+ * against a real (ephemeral) WiredTiger instance, and reply serialization. This is the
+ * in-process stand-in for "run a workload against mongod" that lets us bisect op-path
+ * regressions locally without standing up a cluster.
+ */
+
+// Dummy initializer to fill in the initializer graph
+MONGO_INITIALIZER_GENERAL(CoreOptions_Store, (), ())(InitializerContext*) {}
+
+MONGO_INITIALIZER_GENERAL(DisableLogging, (), ())
+(InitializerContext*) {
+    auto& lv2Manager = logv2::LogManager::global();
+    logv2::LogDomainGlobal::ConfigurationOptions lv2Config;
+    lv2Config.makeDisabled();
+    uassertStatusOK(lv2Manager.getGlobalDomainInternal().configure(lv2Config));
+}
+
+const NamespaceString kSeededNss =
+    NamespaceString::createNamespaceString_forTest("opPathBm.seeded");
+const NamespaceString kScratchNss =
+    NamespaceString::createNamespaceString_forTest("opPathBm.scratch");
+
+constexpr int kNumSeededDocs = 10'000;
+constexpr int kSeedBatchSize = 1'000;
+constexpr int kRangeScanWidth = 100;
+constexpr int kBulkInsertBatchSize = 100;
+constexpr int kNumGroupBuckets = 128;
+
+BSONObj makeSeedDoc(int i) {
+    return BSON("_id" << i << "bucket" << i % kNumGroupBuckets << "payload"
+                      << std::string(64, 'x'));
+}
+
+/**
+ * Stands up a single embedded mongod-like environment (real storage engine, mock replication
+ * coordinator in PRIMARY state) shared by all benchmark instances, following the pattern of
+ * collection_acquisition_bm.cpp: the test fixture lives on its own thread because whichever
+ * thread creates it owns a thread-local Client, while each benchmark thread gets its own
+ * ThreadClient and OperationContext.
+ */
+class OpPathBenchmark {
+public:
+    explicit OpPathBenchmark(benchmark::State& state) : _state{state} {}
+
+    template <typename F>
+    void operator()(F threadBody) {
+        _fixture = _ensureTestEnv();
+        threadBody(_state, *this);
+    }
+
+    OperationContext* getOperationContext() {
+        return _uniqueOpCtx.get();
+    }
+
+private:
+    class TestEnv {
+    public:
+        TestEnv() {
+            _thread = unittest::JoinThread([this] {
+                auto uniqueTest = std::make_unique<Test>();
+                _test = uniqueTest.get();
+                _test->setUp();
+                _running.promise.emplaceValue();
+                _stopRequest.future.get();
+                _test->tearDown();
+            });
+            _running.future.get();
+        }
+
+        ~TestEnv() {
+            _stopRequest.promise.emplaceValue();
+        }
+
+        Service* getService() const {
+            return _test->getService();
+        }
+
+        ServiceContext::UniqueOperationContext makeOperationContext() {
+            return _test->makeOperationContext();
+        }
+
+    private:
+        /** A `unittest::Test` fixture being overloaded as a benchmark harness. */
+        class Test : public ServiceContextMongoDTest {
+        public:
+            void _doTest() override {}
+
+            void setUp() override {
+                ServiceContextMongoDTest::setUp();
+
+                auto sc = getServiceContext();
+                auto replCoord = std::make_unique<repl::ReplicationCoordinatorMock>(sc);
+                // Transition to primary so that the server can accept writes.
+                invariant(replCoord->setFollowerMode(repl::MemberState::RS_PRIMARY));
+                repl::ReplicationCoordinator::set(sc, std::move(replCoord));
+
+                auto opCtx = makeOperationContext();
+                repl::createOplog(opCtx.get());
+                _seedCollection(opCtx.get());
+            }
+
+            using ServiceContextMongoDTest::tearDown;  // Widen visibility from protected to public
+
+        private:
+            void _seedCollection(OperationContext* opCtx) {
+                DBDirectClient client(opCtx);
+                for (int start = 0; start < kNumSeededDocs; start += kSeedBatchSize) {
+                    write_ops::InsertCommandRequest insertOp(kSeededNss);
+                    std::vector<BSONObj> docs;
+                    docs.reserve(kSeedBatchSize);
+                    for (int i = start; i < start + kSeedBatchSize; ++i) {
+                        docs.push_back(makeSeedDoc(i));
+                    }
+                    insertOp.setDocuments(std::move(docs));
+                    auto reply = client.insert(insertOp);
+                    invariant(!reply.getWriteErrors());
+                }
+            }
+        };
+
+        PromiseAndFuture<void> _running;
+        PromiseAndFuture<void> _stopRequest;
+        unittest::JoinThread _thread;
+        Test* _test;
+    };
+
+    std::shared_ptr<TestEnv> _ensureTestEnv() {
+        std::unique_lock lk{_mu};
+        auto sp = _fixtureWeak.lock();
+        if (!sp) {
+            _fixtureWeak = sp = std::make_shared<TestEnv>();
+        }
+
+        _threadClient.emplace(sp->getService());
+        _uniqueOpCtx = sp->makeOperationContext();
+        return sp;
+    }
+
+    static inline Mutex _mu;
+    static inline std::weak_ptr<TestEnv> _fixtureWeak;
+
+    benchmark::State& _state;
+    std::shared_ptr<TestEnv> _fixture;
+    boost::optional<ThreadClient> _threadClient;
+    ServiceContext::UniqueOperationContext _uniqueOpCtx;
+};
+
+/**
+ * Point reads on the _id index (IDHACK path). Threads read disjoint keys.
+ */
+void BM_opPathPointReadFunc(benchmark::State& state, OpPathBenchmark& fixture) {
+    DBDirectClient client(fixture.getOperationContext());
+
+    int64_t key = state.thread_index;
+    for (auto _ : state) {
+        auto doc = client.findOne(kSeededNss, BSON("_id" << static_cast<int>(key % kNumSeededDocs)));
+        key += state.threads;
+        invariant(!doc.isEmpty());
+        benchmark::DoNotOptimize(doc);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+void BM_opPathPointRead(benchmark::State& state) {
+    OpPathBenchmark{state}(BM_opPathPointReadFunc);
+}
+
+/**
+ * Bounded range scans on the _id index, draining the cursor.
+ */
+void BM_opPathRangeScanFunc(benchmark::State& state, OpPathBenchmark& fixture) {
+    DBDirectClient client(fixture.getOperationContext());
+
+    int64_t start = 0;
+    for (auto _ : state) {
+        const auto lo = static_cast<int>(start % (kNumSeededDocs - kRangeScanWidth));
+        FindCommandRequest findRequest{kSeededNss};
+        findRequest.setFilter(BSON("_id" << BSON("$gte" << lo << "$lt" << lo + kRangeScanWidth)));
+        auto cursor = client.find(std::move(findRequest));
+        int64_t docs = 0;
+        while (cursor->more()) {
+            benchmark::DoNotOptimize(cursor->next());
+            ++docs;
+        }
+        invariant(docs == kRangeScanWidth);
+        start += kRangeScanWidth;
+    }
+    state.SetItemsProcessed(state.iterations() * kRangeScanWidth);
+}
+void BM_opPathRangeScan(benchmark::State& state) {
+    OpPathBenchmark{state}(BM_opPathRangeScanFunc);
+}
+
+/**
+ * Batched inserts into a scratch collection; the server generates _id values, so batches
+ * never conflict and the collection simply grows over the run.
+ */
+void BM_opPathBulkInsertFunc(benchmark::State& state, OpPathBenchmark& fixture) {
+    DBDirectClient client(fixture.getOperationContext());
+
+    std::vector<BSONObj> docs;
+    docs.reserve(kBulkInsertBatchSize);
+    for (int i = 0; i < kBulkInsertBatchSize; ++i) {
+        docs.push_back(BSON("bucket" << i % kNumGroupBuckets << "payload" << std::string(64, 'x')));
+    }
+
+    for (auto _ : state) {
+        write_ops::InsertCommandRequest insertOp(kScratchNss);
+        insertOp.setDocuments(docs);
+        auto reply = client.insert(insertOp);
+        invariant(!reply.getWriteErrors());
+        benchmark::DoNotOptimize(reply);
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkInsertBatchSize);
+}
+void BM_opPathBulkInsert(benchmark::State& state) {
+    OpPathBenchmark{state}(BM_opPathBulkInsertFunc);
+}
+
+/**
+ * A collection-wide $group over a low-cardinality field, exercising the full aggregation
+ * path including cursor establishment and reply serialization.
+ */
+void BM_opPathGroupFunc(benchmark::State& state, OpPathBenchmark& fixture) {
+    DBDirectClient client(fixture.getOperationContext());
+
+    const auto cmd = BSON("aggregate" << kSeededNss.coll() << "pipeline"
+                                      << BSON_ARRAY(BSON("$group" << BSON("_id"
+                                                                          << "$bucket"
+                                                                          << "count"
+                                                                          << BSON("$sum" << 1))))
+                                      << "cursor" << BSONObj());
+    for (auto _ : state) {
+        BSONObj result;
+        invariant(client.runCommand(kSeededNss.dbName(), cmd, result));
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * kNumSeededDocs);
+}
+void BM_opPathGroup(benchmark::State& state) {
+    OpPathBenchmark{state}(BM_opPathGroupFunc);
+}
+
+BENCHMARK(BM_opPathPointRead)->ThreadRange(1, 8);
+BENCHMARK(BM_opPathRangeScan);
+BENCHMARK(BM_opPathBulkInsert);
+BENCHMARK(BM_opPathGroup);
+
+}  // namespace
+}  // namespace mongo
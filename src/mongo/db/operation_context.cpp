@@ -50,7 +50,7 @@
 #include "mongo/util/assert_util.h"
 #include "mongo/util/clock_source.h"
 #include "mongo/util/fail_point.h"
-#include "mongo/util/system_tick_source.h"
+#include "mongo/util/tsc_tick_source.h"
 #include "mongo/util/waitable.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kDefault
@@ -84,7 +84,7 @@ OperationContext::OperationContext(Client* client, OperationId opId)
     : _client(client),
       _opId(opId),
       _elapsedTime(client ? client->getServiceContext()->getTickSource()
-                          : globalSystemTickSource()) {}
+                          : globalDefaultTickSource()) {}
 
 OperationContext::~OperationContext() {
     releaseOperationKey();
@@ -60,19 +60,21 @@ namespace mongo {
 namespace {
 
 /**
- * Validates the nesting depth of 'obj', returning a non-OK status if it exceeds the limit.
+ * Validates the nesting depth of a top-level object or array element 'elem', returning a
+ * non-OK status if it exceeds the limit. 'elem' itself is at depth two, counting the
+ * document as depth one, so scalar-only documents skip this walk entirely.
  */
-Status validateDepth(const BSONObj& obj) {
+Status validateElementDepth(const BSONElement& elem) {
     std::vector<BSONObjIterator> frames;
     frames.reserve(16);
-    frames.emplace_back(obj);
+    frames.emplace_back(elem.embeddedObject());
 
     while (!frames.empty()) {
-        const auto elem = frames.back().next();
-        if (elem.type() == BSONType::Object || elem.type() == BSONType::Array) {
-            auto subObj = elem.embeddedObject();
+        const auto e = frames.back().next();
+        if (e.type() == BSONType::Object || e.type() == BSONType::Array) {
+            auto subObj = e.embeddedObject();
             // Empty subdocuments do not count toward the depth of a document.
-            if (MONGO_unlikely(frames.size() == BSONDepth::getMaxDepthForUserStorage() &&
+            if (MONGO_unlikely(frames.size() + 1 == BSONDepth::getMaxDepthForUserStorage() &&
                                !subObj.isEmpty())) {
                 // We're exactly at the limit, so descending to the next level would exceed
                 // the maximum depth.
@@ -113,11 +115,6 @@ StatusWith<BSONObj> fixDocumentForInsert(OperationContext* opCtx,
                                        str::stream() << "object to insert too large"
                                                      << ". size in bytes: " << doc.objsize()
                                                      << ", max size: " << BSONObjMaxUserSize);
-
-        auto depthStatus = validateDepth(doc);
-        if (!depthStatus.isOK()) {
-            return depthStatus;
-        }
     }
 
     bool firstElementIsId = false;
@@ -139,6 +136,15 @@ StatusWith<BSONObj> fixDocumentForInsert(OperationContext* opCtx,
             }
 
             if (!validationDisabled) {
+                // Depth validation is folded into this scan so that documents are walked once;
+                // only object and array fields require descending.
+                if (e.type() == BSONType::Object || e.type() == BSONType::Array) {
+                    auto depthStatus = validateElementDepth(e);
+                    if (!depthStatus.isOK()) {
+                        return depthStatus;
+                    }
+                }
+
                 if (!bypassEmptyTsReplacement && e.type() == bsonTimestamp &&
                     e.timestampValue() == 0) {
                     // we replace Timestamp(0,0) at the top level with a correct value
@@ -135,6 +135,7 @@
 #include "mongo/db/timeseries/bucket_catalog/write_batch.h"
 #include "mongo/db/timeseries/bucket_compression.h"
 #include "mongo/db/timeseries/bucket_compression_failure.h"
+#include "mongo/db/timeseries/bucket_compression_pipeline.h"
 #include "mongo/db/timeseries/timeseries_gen.h"
 #include "mongo/db/timeseries/timeseries_index_schema_conversion_functions.h"
 #include "mongo/db/timeseries/timeseries_options.h"
@@ -2363,22 +2364,28 @@ canCombineTimeseriesInsertWithOtherClients(OperationContext* opCtx,
         : timeseries::bucket_catalog::CombineWithInsertsFromOtherClients::kAllow;
 }
 
-TimeseriesSingleWriteResult getTimeseriesSingleWriteResult(
-    write_ops_exec::WriteResult&& reply, const write_ops::InsertCommandRequest& request) {
+TimeseriesSingleWriteResult getTimeseriesSingleWriteResult(write_ops_exec::WriteResult&& reply,
+                                                           const NamespaceString& sourceNs) {
     invariant(reply.results.size() == 1,
               str::stream() << "Unexpected number of results (" << reply.results.size()
                             << ") for insert on time-series collection "
-                            << ns(request).toStringForErrorMsg());
+                            << sourceNs.toStringForErrorMsg());
 
     return {std::move(reply.results[0]), reply.canContinue};
 }
 
+TimeseriesSingleWriteResult getTimeseriesSingleWriteResult(
+    write_ops_exec::WriteResult&& reply, const write_ops::InsertCommandRequest& request) {
+    return getTimeseriesSingleWriteResult(std::move(reply), ns(request));
+}
+
 write_ops::UpdateCommandRequest makeTimeseriesTransformationOp(
     OperationContext* opCtx,
     const OID& bucketId,
     write_ops::UpdateModification::TransformFunc transformationFunc,
-    const write_ops::InsertCommandRequest& request) {
-    write_ops::UpdateCommandRequest op(makeTimeseriesBucketsNamespace(ns(request)),
+    const NamespaceString& sourceNs,
+    const boost::optional<bool>& bypassEmptyTsReplacement) {
+    write_ops::UpdateCommandRequest op(makeTimeseriesBucketsNamespace(sourceNs),
                                        {timeseries::makeTimeseriesTransformationOpEntry(
                                            opCtx, bucketId, std::move(transformationFunc))});
 
@@ -2387,7 +2394,7 @@ write_ops::UpdateCommandRequest makeTimeseriesTransformationOp(
     // operations by end users and is not applicable here.
     base.setBypassDocumentValidation(true);
 
-    base.setBypassEmptyTsReplacement(request.getBypassEmptyTsReplacement());
+    base.setBypassEmptyTsReplacement(bypassEmptyTsReplacement);
 
     // Timeseries compression operation is not a user operation and should not use a
     // statement id from any user op. Set to Uninitialized to bypass.
@@ -2397,6 +2404,18 @@ write_ops::UpdateCommandRequest makeTimeseriesTransformationOp(
     return op;
 }
 
+write_ops::UpdateCommandRequest makeTimeseriesTransformationOp(
+    OperationContext* opCtx,
+    const OID& bucketId,
+    write_ops::UpdateModification::TransformFunc transformationFunc,
+    const write_ops::InsertCommandRequest& request) {
+    return makeTimeseriesTransformationOp(opCtx,
+                                          bucketId,
+                                          std::move(transformationFunc),
+                                          ns(request),
+                                          request.getBypassEmptyTsReplacement());
+}
+
 /**
  * Returns the status and whether the request can continue.
  */
@@ -2482,14 +2501,10 @@ void compressUncompressedBucketOnReopen(OperationContext* opCtx,
  * Attempts to perform bucket compression on time-series bucket. It will suppress any error caused
  * by the write and silently leave the bucket uncompressed when any type of error is encountered.
  */
-void tryPerformTimeseriesBucketCompression(OperationContext* opCtx,
-                                           const write_ops::InsertCommandRequest& request,
-                                           timeseries::bucket_catalog::ClosedBucket& closedBucket) {
-    // A bucket with just a single measurement is not worth compressing.
-    if (closedBucket.numMeasurements.has_value() && closedBucket.numMeasurements.value() <= 1) {
-        return;
-    }
-
+void performTimeseriesBucketCompression(OperationContext* opCtx,
+                                        const NamespaceString& sourceNs,
+                                        const boost::optional<bool>& bypassEmptyTsReplacement,
+                                        timeseries::bucket_catalog::ClosedBucket& closedBucket) {
     bool validateCompression = gValidateTimeseriesCompression.load();
 
     struct {
@@ -2510,7 +2525,7 @@ void tryPerformTimeseriesBucketCompression(OperationContext* opCtx,
         compressionStats.uncompressedSize = bucketDoc.objsize();
 
         auto compressed = timeseries::compressBucket(
-            bucketDoc, closedBucket.timeField, ns(request), validateCompression);
+            bucketDoc, closedBucket.timeField, sourceNs, validateCompression);
         if (compressed.compressedBucket) {
             // If compressed object size is larger than uncompressed, skip compression update.
             if (compressed.compressedBucket->objsize() >= compressionStats.uncompressedSize) {
@@ -2532,11 +2547,11 @@ void tryPerformTimeseriesBucketCompression(OperationContext* opCtx,
     };
 
     auto compressionOp = makeTimeseriesTransformationOp(
-        opCtx, closedBucket.bucketId.oid, bucketCompressionFunc, request);
+        opCtx, closedBucket.bucketId.oid, bucketCompressionFunc, sourceNs, bypassEmptyTsReplacement);
     auto result = getTimeseriesSingleWriteResult(
         write_ops_exec::performUpdates(
             opCtx, compressionOp, OperationSource::kTimeseriesBucketCompression),
-        request);
+        sourceNs);
 
     // TODO(SERVER-70605): Remove deprecated metrics.
     closedBucket.stats.incNumBytesUncompressed(compressionStats.uncompressedSize);
@@ -2554,6 +2569,39 @@ void tryPerformTimeseriesBucketCompression(OperationContext* opCtx,
     }
 }
 
+void tryPerformTimeseriesBucketCompression(OperationContext* opCtx,
+                                           const write_ops::InsertCommandRequest& request,
+                                           timeseries::bucket_catalog::ClosedBucket& closedBucket) {
+    // A bucket with just a single measurement is not worth compressing.
+    if (closedBucket.numMeasurements.has_value() && closedBucket.numMeasurements.value() <= 1) {
+        return;
+    }
+
+    // Hand the rewrite off to the background compression pipeline so this inserting thread does
+    // not stall on it. We don't know the bucket's size without reading it, so account the
+    // configured maximum bucket size against the backlog budget as a conservative estimate.
+    auto& pipeline = timeseries::BucketCompressionPipeline::get(opCtx->getServiceContext());
+    const long long approxBytes = gTimeseriesBucketMaxSize;
+    if (pipeline.wouldAccept(approxBytes)) {
+        // On the rare refusal after the admission check (shutdown race), the moved-from closed
+        // bucket is simply dropped and the bucket stays uncompressed, which is an
+        // already-tolerated outcome.
+        (void)pipeline.trySubmit(
+            [sourceNs = ns(request),
+             bypassEmptyTsReplacement = request.getBypassEmptyTsReplacement(),
+             closedBucket = std::move(closedBucket)](OperationContext* opCtx) mutable {
+                performTimeseriesBucketCompression(
+                    opCtx, sourceNs, bypassEmptyTsReplacement, closedBucket);
+            },
+            approxBytes);
+        return;
+    }
+
+    // Backlog over budget: back-pressure by compressing inline, as before the pipeline existed.
+    performTimeseriesBucketCompression(
+        opCtx, ns(request), request.getBypassEmptyTsReplacement(), closedBucket);
+}
+
 /**
  * Returns whether the request can continue.
  */
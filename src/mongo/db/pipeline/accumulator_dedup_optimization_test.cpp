@@ -0,0 +1,203 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <fmt/format.h>
+#include <memory>
+#include <vector>
+
+#include "mongo/bson/json.h"
+#include "mongo/db/pipeline/aggregation_context_fixture.h"
+#include "mongo/db/pipeline/pipeline.h"
+#include "mongo/db/query/util/make_data_structure.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/bson_test_util.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+class AccumulatorDedupOptimizationTest : public AggregationContextFixture {
+protected:
+    void verify(const BSONObj& groupSpec, const std::vector<BSONObj>& expectedOptimizedPipeline) {
+        using namespace fmt::literals;
+        auto pipeline = Pipeline::parse(makeVector(groupSpec), getExpCtx());
+
+        ASSERT_EQ(pipeline->getSources().size(), 1U);
+
+        pipeline->optimizePipeline();
+
+        auto actualOptimizedPipeline = pipeline->serializeToBson();
+        ASSERT_EQ(actualOptimizedPipeline.size(), expectedOptimizedPipeline.size())
+            << "Expected {} stages but got: "_format(expectedOptimizedPipeline.size())
+            << to_string(actualOptimizedPipeline);
+
+        for (size_t i = 0; i < actualOptimizedPipeline.size(); ++i) {
+            ASSERT_BSONOBJ_EQ_UNORDERED(actualOptimizedPipeline[i], expectedOptimizedPipeline[i]);
+        }
+    }
+};
+
+TEST_F(AccumulatorDedupOptimizationTest, IdenticalAccumulatorsAreComputedOnce) {
+    const auto groupWithDuplicateSums = fromjson(R"(
+{
+    $group: {
+        _id: "$k",
+        a: {$sum: "$x"},
+        b: {$sum: "$x"},
+        c: {$min: "$y"}
+    }
+}
+    )");
+    const auto expectedOptimizedGroup = fromjson(R"(
+{
+    $group: {
+        _id: "$k",
+        a: {$sum: "$x"},
+        c: {$min: "$y"}
+    }
+}
+    )");
+    const auto expectedOptimizedProject = fromjson(R"(
+{
+    $project: {
+        _id: true,
+        a: true,
+        b: "$a",
+        c: true
+    }
+}
+    )");
+
+    verify(groupWithDuplicateSums, makeVector(expectedOptimizedGroup, expectedOptimizedProject));
+}
+
+TEST_F(AccumulatorDedupOptimizationTest, IdenticalConstantArgumentAccumulatorsAreComputedOnce) {
+    const auto groupWithDuplicateCounts = fromjson(R"(
+{
+    $group: {
+        _id: "$k",
+        cnt1: {$sum: 1},
+        cnt2: {$sum: 1}
+    }
+}
+    )");
+    const auto expectedOptimizedGroup = fromjson(R"(
+{
+    $group: {
+        _id: "$k",
+        cnt1: {$sum: {$const: 1}}
+    }
+}
+    )");
+    const auto expectedOptimizedProject = fromjson(R"(
+{
+    $project: {
+        _id: true,
+        cnt1: true,
+        cnt2: "$cnt1"
+    }
+}
+    )");
+
+    verify(groupWithDuplicateCounts, makeVector(expectedOptimizedGroup, expectedOptimizedProject));
+}
+
+TEST_F(AccumulatorDedupOptimizationTest, AccumulatorsWithDifferentArgumentsAreNotDeduplicated) {
+    const auto groupWithDifferentSums = fromjson(R"(
+{
+    $group: {
+        _id: "$k",
+        a: {$sum: "$x"},
+        b: {$sum: "$y"}
+    }
+}
+    )");
+    const auto expectedNotOptimizedGroup = fromjson(R"(
+{
+    $group: {
+        _id: "$k",
+        a: {$sum: "$x"},
+        b: {$sum: "$y"}
+    }
+}
+    )");
+
+    verify(groupWithDifferentSums, makeVector(expectedNotOptimizedGroup));
+}
+
+TEST_F(AccumulatorDedupOptimizationTest, DifferentAccumulatorsWithSameArgumentAreNotDeduplicated) {
+    const auto groupWithDifferentAccumulators = fromjson(R"(
+{
+    $group: {
+        _id: "$k",
+        a: {$min: "$x"},
+        b: {$max: "$x"}
+    }
+}
+    )");
+    const auto expectedNotOptimizedGroup = fromjson(R"(
+{
+    $group: {
+        _id: "$k",
+        a: {$min: "$x"},
+        b: {$max: "$x"}
+    }
+}
+    )");
+
+    verify(groupWithDifferentAccumulators, makeVector(expectedNotOptimizedGroup));
+}
+
+TEST_F(AccumulatorDedupOptimizationTest, NondeterministicAccumulatorsAreNotDeduplicated) {
+    // Two syntactically equal $rand expressions may evaluate to different values, so the
+    // accumulators must stay separate.
+    const auto groupWithDuplicateRands = fromjson(R"(
+{
+    $group: {
+        _id: "$k",
+        a: {$first: {$rand: {}}},
+        b: {$first: {$rand: {}}}
+    }
+}
+    )");
+    const auto expectedNotOptimizedGroup = fromjson(R"(
+{
+    $group: {
+        _id: "$k",
+        a: {$first: {$rand: {}}},
+        b: {$first: {$rand: {}}}
+    }
+}
+    )");
+
+    verify(groupWithDuplicateRands, makeVector(expectedNotOptimizedGroup));
+}
+
+}  // namespace
+}  // namespace mongo
@@ -324,11 +324,12 @@ std::unique_ptr<MatchExpression> buildTransactionFilter(
             BSON(OR(applyOpsFilter, endOfTransactionFilter, commitTransactionFilter))),
         expCtx);
 
-    // All events in a transaction share the same clusterTime, lsid, and txNumber values. If the
-    // user wishes to filter out events based on these values, it is possible to rewrite these
-    // filters to filter out entire applyOps and commitTransaction entries before they are unwound.
+    // All events in a transaction share the same clusterTime, wallTime, lsid, and txNumber values.
+    // If the user wishes to filter out events based on these values, it is possible to rewrite
+    // these filters to filter out entire applyOps and commitTransaction entries before they are
+    // unwound.
     if (auto rewrittenMatch = change_stream_rewrite::rewriteFilterForFields(
-            expCtx, userMatch, backingBsonObjs, {"clusterTime", "lsid", "txnNumber"})) {
+            expCtx, userMatch, backingBsonObjs, {"clusterTime", "wallTime", "lsid", "txnNumber"})) {
         auto transactionFilterWithUserMatch = std::make_unique<AndMatchExpression>();
         transactionFilterWithUserMatch->add(std::move(transactionFilter));
         transactionFilterWithUserMatch->add(std::move(rewrittenMatch));
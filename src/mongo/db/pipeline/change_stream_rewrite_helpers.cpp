@@ -1272,8 +1272,10 @@ std::unique_ptr<MatchExpression> matchRewriteFullDocumentBeforeChange(
 }
 
 // Map of fields names for which a simple rename is sufficient when rewriting.
-StringMap<std::string> renameRegistry = {
-    {"clusterTime", "ts"}, {"lsid", "lsid"}, {"txnNumber", "txnNumber"}};
+StringMap<std::string> renameRegistry = {{"clusterTime", "ts"},
+                                         {"lsid", "lsid"},
+                                         {"txnNumber", "txnNumber"},
+                                         {"wallTime", "wall"}};
 
 // Map of field names to corresponding MatchExpression rewrite functions.
 StringMap<MatchExpressionRewrite> matchRewriteRegistry = {
@@ -113,6 +113,42 @@ TEST_F(ChangeStreamRewriteTest, RewriteOrPredicateOnRenameableFields) {
                       fromjson("{$or: [{ts: {$type: [17]}}, {lsid: {$type: [16]}}]}"));
 }
 
+TEST_F(ChangeStreamRewriteTest, CanRewritePredicateOnFieldWallTime) {
+    auto spec = fromjson("{wallTime: {$gte: {$date: '2023-01-01T00:00:00.000Z'}}}");
+    auto statusWithMatchExpression = MatchExpressionParser::parse(spec, getExpCtx());
+    ASSERT_OK(statusWithMatchExpression.getStatus());
+
+    auto bsonObjsArray = std::vector<BSONObj>{};
+    auto rewrittenMatchExpression =
+        change_stream_rewrite::rewriteFilterForFields(getExpCtx(),
+                                                      statusWithMatchExpression.getValue().get(),
+                                                      bsonObjsArray,
+                                                      {"wallTime"});
+    ASSERT(rewrittenMatchExpression);
+
+    auto rewrittenPredicate = rewrittenMatchExpression->serialize();
+    ASSERT_BSONOBJ_EQ(rewrittenPredicate,
+                      fromjson("{wall: {$gte: {$date: '2023-01-01T00:00:00.000Z'}}}"));
+}
+
+TEST_F(ChangeStreamRewriteTest, CanRewriteExprOnFieldWallTime) {
+    auto spec = fromjson("{$expr: {$eq: [{$dayOfWeek: '$wallTime'}, 1]}}");
+    auto statusWithMatchExpression = MatchExpressionParser::parse(spec, getExpCtx());
+    ASSERT_OK(statusWithMatchExpression.getStatus());
+
+    auto bsonObjsArray = std::vector<BSONObj>{};
+    auto rewrittenMatchExpression =
+        change_stream_rewrite::rewriteFilterForFields(getExpCtx(),
+                                                      statusWithMatchExpression.getValue().get(),
+                                                      bsonObjsArray,
+                                                      {"wallTime"});
+    ASSERT(rewrittenMatchExpression);
+
+    auto rewrittenPredicate = rewrittenMatchExpression->serialize();
+    ASSERT_BSONOBJ_EQ(rewrittenPredicate,
+                      fromjson("{$expr: {$eq: [{$dayOfWeek: ['$wall']}, {$const: 1}]}}"));
+}
+
 TEST_F(ChangeStreamRewriteTest, InexactRewriteOfAndWithUnrewritableChild) {
     // Note that rewrite of {operationType: {$gt: ...}} is currently not supported.
     auto spec = fromjson("{$and: [{lsid: {$type: [16]}}, {operationType: {$gt: 0}}]}");
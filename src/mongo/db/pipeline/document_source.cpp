@@ -148,7 +148,7 @@ list<intrusive_ptr<DocumentSource>> DocumentSource::parse(
     auto& entry = it->second;
     expCtx->throwIfFeatureFlagIsNotEnabledOnFCV(stageName, entry.featureFlag);
 
-    return it->second.parser(stageSpec, expCtx);
+    return entry.parser(stageSpec, expCtx);
 }
 
 intrusive_ptr<DocumentSource> DocumentSource::optimize() {
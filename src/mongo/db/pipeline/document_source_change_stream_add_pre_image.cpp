@@ -28,7 +28,10 @@
  */
 
 #include <boost/move/utility_core.hpp>
+#include <cstddef>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
@@ -43,6 +46,7 @@
 #include "mongo/db/pipeline/change_stream_preimage_gen.h"
 #include "mongo/db/pipeline/document_source_change_stream_add_pre_image.h"
 #include "mongo/db/pipeline/process_interface/mongo_process_interface.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/idl/idl_parser.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/intrusive_counter.h"
@@ -84,46 +88,101 @@ DocumentSourceChangeStreamAddPreImage::createFromBson(
 }
 
 DocumentSource::GetNextResult DocumentSourceChangeStreamAddPreImage::doGetNext() {
-    auto input = pSource->getNext();
-    if (!input.isAdvanced()) {
-        return input;
+    if (!_bufferedOutputs.empty()) {
+        auto next = std::move(_bufferedOutputs.front());
+        _bufferedOutputs.pop_front();
+        return next;
     }
 
-    // If this is not an update, replace or delete, then just pass along the result.
-    const auto kOpTypeField = DocumentSourceChangeStream::kOperationTypeField;
-    const auto opType = input.getDocument()[kOpTypeField];
-    DocumentSourceChangeStream::checkValueType(opType, kOpTypeField, BSONType::String);
-    if (opType.getStringData() != DocumentSourceChangeStream::kUpdateOpType &&
-        opType.getStringData() != DocumentSourceChangeStream::kReplaceOpType &&
-        opType.getStringData() != DocumentSourceChangeStream::kDeleteOpType) {
-        return input;
+    // Surface a pre-image lookup failure only after all events preceding it have been returned,
+    // matching the behaviour of per-event lookups.
+    if (_deferredError) {
+        uassertStatusOK(*_deferredError);
     }
 
-    auto preImageId = input.getDocument()[kPreImageIdFieldName];
-    tassert(6091900, "Pre-image id field is missing", !preImageId.missing());
-    tassert(5868900,
-            "Expected pre-image id field to be a document",
-            preImageId.getType() == BSONType::Object);
-
-    // Obtain the pre-image document, if available, given the specified preImageId.
-    auto preImageDoc = lookupPreImage(pExpCtx, preImageId.getDocument());
-    uassert(
-        ErrorCodes::NoMatchingDocument,
-        str::stream() << "Change stream was configured to require a pre-image for all update, "
-                         "delete and replace events, but the pre-image was not found for event: "
-                      << makePreImageNotFoundErrorMsg(input.getDocument()),
-        preImageDoc ||
-            _fullDocumentBeforeChangeMode != FullDocumentBeforeChangeModeEnum::kRequired);
-
-    // Even if no pre-image was found, we have to populate the 'fullDocumentBeforeChange' field.
-    MutableDocument outputDoc(input.releaseDocument());
-    outputDoc[kFullDocumentBeforeChangeFieldName] =
-        (preImageDoc ? Value(*preImageDoc) : Value(BSONNULL));
-
-    // Do not propagate preImageId field further through the pipeline.
-    outputDoc.remove(kPreImageIdFieldName);
-
-    return outputDoc.freeze();
+    // Pull a batch of events that are already available from the source stage. The first
+    // non-advanced result ends the batch, so batching never waits for additional events.
+    std::vector<Document> events;
+    boost::optional<GetNextResult> stateToPropagate;
+    const auto batchSize = static_cast<size_t>(internalChangeStreamPreImageLookupBatchSize.load());
+    while (events.size() < batchSize) {
+        auto input = pSource->getNext();
+        if (!input.isAdvanced()) {
+            stateToPropagate = std::move(input);
+            break;
+        }
+        events.push_back(input.releaseDocument());
+    }
+
+    if (events.empty()) {
+        return std::move(*stateToPropagate);
+    }
+
+    // Collect the pre-image ids of the update, replace and delete events; any other events are
+    // passed along unmodified.
+    std::vector<Document> preImageIds;
+    std::vector<bool> needsPreImage(events.size(), false);
+    for (size_t index = 0; index < events.size(); ++index) {
+        const auto kOpTypeField = DocumentSourceChangeStream::kOperationTypeField;
+        const auto opType = events[index][kOpTypeField];
+        DocumentSourceChangeStream::checkValueType(opType, kOpTypeField, BSONType::String);
+        if (opType.getStringData() != DocumentSourceChangeStream::kUpdateOpType &&
+            opType.getStringData() != DocumentSourceChangeStream::kReplaceOpType &&
+            opType.getStringData() != DocumentSourceChangeStream::kDeleteOpType) {
+            continue;
+        }
+
+        auto preImageId = events[index][kPreImageIdFieldName];
+        tassert(6091900, "Pre-image id field is missing", !preImageId.missing());
+        tassert(5868900,
+                "Expected pre-image id field to be a document",
+                preImageId.getType() == BSONType::Object);
+        needsPreImage[index] = true;
+        preImageIds.push_back(preImageId.getDocument());
+    }
+
+    // Obtain the pre-image documents, where available, in one batched lookup.
+    auto preImageDocs = lookupPreImages(pExpCtx, preImageIds);
+
+    size_t preImageIndex = 0;
+    for (size_t index = 0; index < events.size(); ++index) {
+        if (!needsPreImage[index]) {
+            _bufferedOutputs.push_back(std::move(events[index]));
+            continue;
+        }
+
+        auto preImageDoc = std::move(preImageDocs[preImageIndex++]);
+        if (!preImageDoc &&
+            _fullDocumentBeforeChangeMode == FullDocumentBeforeChangeModeEnum::kRequired) {
+            _deferredError = Status(
+                ErrorCodes::NoMatchingDocument,
+                str::stream()
+                    << "Change stream was configured to require a pre-image for all update, "
+                       "delete and replace events, but the pre-image was not found for event: "
+                    << makePreImageNotFoundErrorMsg(events[index]));
+            break;
+        }
+
+        // Even if no pre-image was found, we have to populate the 'fullDocumentBeforeChange'
+        // field.
+        MutableDocument outputDoc(std::move(events[index]));
+        outputDoc[kFullDocumentBeforeChangeFieldName] =
+            (preImageDoc ? Value(*preImageDoc) : Value(BSONNULL));
+
+        // Do not propagate preImageId field further through the pipeline.
+        outputDoc.remove(kPreImageIdFieldName);
+
+        _bufferedOutputs.push_back(outputDoc.freeze());
+    }
+
+    if (_bufferedOutputs.empty()) {
+        invariant(_deferredError);
+        uassertStatusOK(*_deferredError);
+    }
+
+    auto next = std::move(_bufferedOutputs.front());
+    _bufferedOutputs.pop_front();
+    return next;
 }
 
 boost::optional<Document> DocumentSourceChangeStreamAddPreImage::lookupPreImage(
@@ -147,6 +206,38 @@ boost::optional<Document> DocumentSourceChangeStreamAddPreImage::lookupPreImage(
     return preImageField.getDocument().getOwned();
 }
 
+std::vector<boost::optional<Document>> DocumentSourceChangeStreamAddPreImage::lookupPreImages(
+    boost::intrusive_ptr<ExpressionContext> pExpCtx, const std::vector<Document>& preImageIds) {
+    // Look up the pre-image documents on the local node by id in one batched pass over the
+    // pre-images collection.
+    const auto tenantId = change_stream_serverless_helpers::resolveTenantId(pExpCtx->ns.tenantId());
+    std::vector<Document> documentKeys;
+    documentKeys.reserve(preImageIds.size());
+    for (const auto& preImageId : preImageIds) {
+        documentKeys.push_back(Document{{ChangeStreamPreImage::kIdFieldName, preImageId}});
+    }
+
+    auto lookedUpDocs = pExpCtx->mongoProcessInterface->lookupDocumentsLocally(
+        pExpCtx, NamespaceString::makePreImageCollectionNSS(tenantId), documentKeys);
+
+    // Extract the "preImage" field values, leaving boost::none entries for the pre-images which
+    // were not found.
+    std::vector<boost::optional<Document>> preImages;
+    preImages.reserve(lookedUpDocs.size());
+    for (auto&& lookedUpDoc : lookedUpDocs) {
+        if (!lookedUpDoc) {
+            preImages.push_back(boost::none);
+            continue;
+        }
+        auto preImageField = lookedUpDoc->getField(ChangeStreamPreImage::kPreImageFieldName);
+        tassert(8777704,
+                "Pre-image document must contain the 'preImage' field",
+                !preImageField.nullish());
+        preImages.push_back(preImageField.getDocument().getOwned());
+    }
+    return preImages;
+}
+
 Value DocumentSourceChangeStreamAddPreImage::doSerialize(const SerializationOptions& opts) const {
     return opts.verbosity
         ? Value(Document{
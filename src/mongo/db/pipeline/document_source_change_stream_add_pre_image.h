@@ -29,13 +29,16 @@
 
 #pragma once
 
+#include <deque>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
+#include "mongo/base/status.h"
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonelement.h"
 #include "mongo/db/exec/document_value/document.h"
@@ -81,6 +84,12 @@ public:
     static boost::optional<Document> lookupPreImage(boost::intrusive_ptr<ExpressionContext> pExpCtx,
                                                     const Document& preImageId);
 
+    // Retrieves the pre-image documents for the given 'preImageIds' in one batched lookup. Returns
+    // one entry per id, in the same order, with boost::none for the pre-images which are not
+    // available.
+    static std::vector<boost::optional<Document>> lookupPreImages(
+        boost::intrusive_ptr<ExpressionContext> pExpCtx, const std::vector<Document>& preImageIds);
+
     // Removes the internal fields from the event and returns the string representation of it.
     static std::string makePreImageNotFoundErrorMsg(const Document& event);
 
@@ -144,6 +153,14 @@ private:
     // Determines whether pre-images are strictly required or may be included only when available.
     FullDocumentBeforeChangeModeEnum _fullDocumentBeforeChangeMode =
         FullDocumentBeforeChangeModeEnum::kOff;
+
+    // Fully-processed events awaiting return from 'doGetNext'. Populated one lookup batch at a
+    // time.
+    std::deque<Document> _bufferedOutputs;
+
+    // Set when an event in the current batch required a pre-image that could not be found. The
+    // error is surfaced once the buffered events preceding it have been returned.
+    boost::optional<Status> _deferredError;
 };
 
 }  // namespace mongo
@@ -108,7 +108,8 @@ std::unique_ptr<MatchExpression> buildUnwindTransactionFilter(
     // this separately because we need to exclude certain fields from the user's filters. Unwound
     // transaction events do not have these fields until we populate them from the commitTransaction
     // event. We already applied these predicates during the oplog scan, so we know that they match.
-    static const std::set<std::string> excludedFields = {"clusterTime", "lsid", "txnNumber"};
+    static const std::set<std::string> excludedFields = {
+        "clusterTime", "wallTime", "lsid", "txnNumber"};
     if (auto rewrittenMatch = change_stream_rewrite::rewriteFilterForFields(
             expCtx, userMatch, bsonObj, {}, excludedFields)) {
         unwindFilter->add(std::move(rewrittenMatch));
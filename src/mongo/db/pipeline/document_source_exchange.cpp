@@ -130,6 +130,7 @@ Exchange::Exchange(ExchangeSpec spec, std::unique_ptr<Pipeline, PipelineDeleter>
       _keyPattern(_spec.getKey().getOwned()),
       _ordering(extractOrdering(_keyPattern)),
       _keyPaths(extractKeyPaths(_keyPattern)),
+      _hashedFields(extractHashedFields(_keyPattern)),
       _boundaries(extractBoundaries(_spec.getBoundaries(), _ordering)),
       _consumerIds(extractConsumerIds(_spec.getConsumerIds(), _spec.getConsumers())),
       _policy(_spec.getPolicy()),
@@ -285,6 +286,14 @@ std::vector<FieldPath> Exchange::extractKeyPaths(const BSONObj& keyPattern) {
     return paths;
 }
 
+std::vector<bool> Exchange::extractHashedFields(const BSONObj& keyPattern) {
+    std::vector<bool> hashed;
+    for (auto& elem : keyPattern) {
+        hashed.push_back(elem.type() == BSONType::String && elem.valueStringData() == "hashed"_sd);
+    }
+    return hashed;
+}
+
 void Exchange::unblockLoading(size_t consumerId) {
     // See if the loading is blocked on this consumer and if so unblock it.
     if (_loadingThreadId == consumerId) {
@@ -419,30 +428,32 @@ size_t Exchange::loadNextBatch() {
 size_t Exchange::getTargetConsumer(const Document& input) {
     // Build the key.
     BSONObjBuilder kb;
-    size_t counter = 0;
-    for (const auto& elem : _keyPattern) {
-        auto value = input.getNestedField(_keyPaths[counter]);
+    for (size_t idx = 0; idx < _keyPaths.size(); ++idx) {
+        auto value = input.getNestedField(_keyPaths[idx]);
 
         // By definition we send documents with missing fields to the consumer 0.
         if (value.missing()) {
             return 0;
         }
 
-        if (elem.type() == BSONType::String && elem.str() == "hashed") {
+        if (_hashedFields[idx]) {
             kb << ""
                << BSONElementHasher::hash64(BSON("" << value).firstElement(),
                                             BSONElementHasher::DEFAULT_HASH_SEED);
         } else {
             kb << "" << value;
         }
-        ++counter;
     }
 
     key_string::Builder key{key_string::Version::V1, kb.obj(), _ordering};
-    std::string keyStr{key.getBuffer(), key.getSize()};
-
-    // Binary search for the consumer id.
-    auto it = std::upper_bound(_boundaries.begin(), _boundaries.end(), keyStr);
+    StringData keyStr{key.getBuffer(), key.getSize()};
+
+    // Binary search for the consumer id, comparing through a non-owning view of the key so that
+    // routing a document does not allocate a string.
+    auto it = std::upper_bound(_boundaries.begin(),
+                               _boundaries.end(),
+                               keyStr,
+                               [](StringData lhs, StringData rhs) { return lhs < rhs; });
     invariant(it != _boundaries.end());
 
     size_t distance = std::distance(_boundaries.begin(), it) - 1;
@@ -94,6 +94,12 @@ class Exchange : public RefCountable {
      */
     static std::vector<FieldPath> extractKeyPaths(const BSONObj& keyPattern);
 
+    /**
+     * Record which key fields are hashed so that the per-document routing code does not have to
+     * re-examine the key pattern.
+     */
+    static std::vector<bool> extractHashedFields(const BSONObj& keyPattern);
+
 public:
     /**
      * Create an exchange. 'pipeline' represents the input to the exchange operator and must not be
@@ -168,6 +174,9 @@ private:
 
     const std::vector<FieldPath> _keyPaths;
 
+    // For every entry in '_keyPaths', whether the corresponding key field is hashed.
+    const std::vector<bool> _hashedFields;
+
     // Range boundaries. The boundaries are ordered and must cover the whole domain, e.g.
     // [Min, -200, 0, 200, Max] partitions the domain into 4 ranges (i.e. 1 less than number of
     // boundaries). Every range has an assigned consumer that will process documents in that range.
@@ -208,10 +208,16 @@ DocumentSource::GetNextResult DocumentSourceFacet::doGetNext() {
                 results[facetId].emplace_back(next.releaseDocument());
             }
             allPipelinesEOF = allPipelinesEOF && next.isEOF();
-            accumulatePipelinePlanSummaryStats(*pipeline, _stats.planSummaryStats);
         }
     }
 
+    // Gather execution stats from each sub-pipeline once they are exhausted. Doing this inside the
+    // loop above would redo the whole aggregation for every batch, re-adding the counters that were
+    // already accumulated for earlier batches.
+    for (auto&& facet : _facets) {
+        accumulatePipelinePlanSummaryStats(*facet.pipeline, _stats.planSummaryStats);
+    }
+
     MutableDocument resultDoc;
     for (size_t facetId = 0; facetId < _facets.size(); ++facetId) {
         resultDoc[_facets[facetId].name] = Value(std::move(results[facetId]));
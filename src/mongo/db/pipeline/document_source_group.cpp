@@ -46,10 +46,14 @@
 #include "mongo/db/pipeline/document_source_match.h"
 #include "mongo/db/pipeline/document_source_project.h"
 #include "mongo/db/pipeline/document_source_single_document_transformation.h"
+#include "mongo/db/pipeline/document_source_streaming_group.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
+#include "mongo/db/pipeline/expression_function.h"
+#include "mongo/db/pipeline/expression_js_emit.h"
 #include "mongo/db/pipeline/lite_parsed_document_source.h"
 #include "mongo/db/query/allowed_contexts.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/platform/compiler.h"
 #include "mongo/util/assert_util.h"
 
@@ -98,10 +102,19 @@ Pipeline::SourceContainer::iterator DocumentSourceGroup::doOptimizeAt(
         return itr;
     }
 
+    if (tryToDeduplicateAccumulators(itr, container)) {
+        return itr;
+    }
+
     if (tryToGenerateCommonSortKey(itr, container)) {
         return itr;
     }
 
+    if (tryToEnableStreamingGroup(itr, container)) {
+        // '*itr' now points at the $_internalStreamingGroup stage that replaced this stage.
+        return itr;
+    }
+
     return std::next(itr);
 }
 
@@ -430,6 +443,25 @@ AccumulationStatement mergeAccStmtFor(boost::intrusive_ptr<ExpressionContext> pE
     return AccumulationStatement::parseAccumulationStatement(
         pExpCtx.get(), accStmtObj[mergeFieldName], pExpCtx->variablesParseState);
 }
+
+// Returns false if the expression tree rooted at 'expr' contains a nondeterministic expression,
+// i.e. one that may produce a different result when evaluated twice on the same input.
+bool isDeterministic(const boost::intrusive_ptr<Expression>& expr) {
+    if (!expr) {
+        return true;
+    }
+    if (dynamic_cast<ExpressionRandom*>(expr.get()) ||
+        dynamic_cast<ExpressionFunction*>(expr.get()) ||
+        dynamic_cast<ExpressionInternalJsEmit*>(expr.get())) {
+        return false;
+    }
+    for (auto&& child : expr->getChildren()) {
+        if (!isDeterministic(child)) {
+            return false;
+        }
+    }
+    return true;
+}
 }  // namespace
 
 bool DocumentSourceGroup::tryToGenerateCommonSortKey(Pipeline::SourceContainer::iterator itr,
@@ -526,6 +558,144 @@ bool DocumentSourceGroup::tryToGenerateCommonSortKey(Pipeline::SourceContainer::
     return true;
 }
 
+bool DocumentSourceGroup::tryToDeduplicateAccumulators(Pipeline::SourceContainer::iterator itr,
+                                                       Pipeline::SourceContainer* container) {
+    auto& accStmts = getMutableAccumulationStatements();
+    if (accStmts.size() < 2) {
+        return false;
+    }
+
+    // Duplicate output field names are allowed in a $group spec but cannot be expressed in the
+    // restoring $project, so bail out if any are present.
+    StringSet seenFieldNames;
+    for (const auto& accStmt : accStmts) {
+        if (!seenFieldNames.insert(accStmt.fieldName).second) {
+            return false;
+        }
+    }
+
+    // Maps the serialized form of an accumulator (name + initializer + argument) to the index of
+    // the first accumulation statement with that form.
+    auto firstAccIdxBySpec = pExpCtx->getValueComparator().makeFlatUnorderedValueMap<size_t>();
+    // Maps the index of each duplicate accumulation statement to the index of the statement whose
+    // result it can reuse.
+    absl::flat_hash_map<size_t, size_t> duplicateOf;
+    for (size_t accIdx = 0; accIdx < accStmts.size(); ++accIdx) {
+        const auto& expr = accStmts[accIdx].expr;
+        // $accumulator runs user JavaScript; two identical specs may not agree on a result.
+        if (expr.name == AccumulatorJs::kName || !isDeterministic(expr.initializer) ||
+            !isDeterministic(expr.argument)) {
+            continue;
+        }
+
+        Value key{std::vector<Value>{
+            Value(expr.name), expr.initializer->serialize(), expr.argument->serialize()}};
+        if (auto [it, inserted] = firstAccIdxBySpec.try_emplace(std::move(key), accIdx);
+            !inserted) {
+            duplicateOf.emplace(accIdx, it->second);
+        }
+    }
+
+    if (duplicateOf.empty()) {
+        return false;
+    }
+
+    // Prepares a $project stage that restores the dropped duplicate fields from the statements
+    // that are kept, e.g. {$project: {a: 1, b: "$a"}}. The spec is built before the kept
+    // statements are moved out of 'accStmts' so that the referenced field names are still valid.
+    using namespace fmt::literals;
+    BSONObjBuilder prjArgsBuilder;
+    for (size_t accIdx = 0; accIdx < accStmts.size(); ++accIdx) {
+        if (auto it = duplicateOf.find(accIdx); it != duplicateOf.end()) {
+            prjArgsBuilder.append(accStmts[accIdx].fieldName,
+                                  "${}"_format(accStmts[it->second].fieldName));
+        } else {
+            prjArgsBuilder.append(accStmts[accIdx].fieldName, 1);
+        }
+    }
+
+    std::vector<AccumulationStatement> newAccStmts;
+    newAccStmts.reserve(accStmts.size() - duplicateOf.size());
+    for (size_t accIdx = 0; accIdx < accStmts.size(); ++accIdx) {
+        if (!duplicateOf.contains(accIdx)) {
+            newAccStmts.push_back(std::move(accStmts[accIdx]));
+        }
+    }
+
+    accStmts = std::move(newAccStmts);
+    auto prjStageSpec = prjArgsBuilder.done();
+    auto prjStage = DocumentSourceProject::create(
+        std::move(prjStageSpec), pExpCtx, DocumentSourceProject::kStageName);
+    container->insert(std::next(itr), prjStage);
+
+    return true;
+}
+
+bool DocumentSourceGroup::tryToEnableStreamingGroup(Pipeline::SourceContainer::iterator itr,
+                                                    Pipeline::SourceContainer* container) {
+    if (!internalQueryEnableStreamingGroup.load()) {
+        return false;
+    }
+
+    // A merging $group consumes partial results from the shards, which do not arrive in the order
+    // that any preceding local $sort produced.
+    if (doingMerge()) {
+        return false;
+    }
+
+    // The order guarantee must come from the stage feeding this one directly.
+    if (itr == container->begin()) {
+        return false;
+    }
+    auto sortStage = dynamic_cast<DocumentSourceSort*>(std::prev(itr)->get());
+    if (!sortStage) {
+        return false;
+    }
+
+    // A sort key computed from an expression carries no field path to check monotonicity against.
+    const auto& leadingSortKey = sortStage->getSortKeyPattern().front();
+    if (leadingSortKey.expression || !leadingSortKey.fieldPath) {
+        return false;
+    }
+    const auto& sortedFieldPath = *leadingSortKey.fieldPath;
+
+    auto& idFields = getMutableIdFields();
+    std::vector<size_t> monotonicIdFields;
+    for (size_t i = 0; i < idFields.size(); ++i) {
+        // To group run-by-run, we need documents with the same value of an id field to form a
+        // single contiguous cluster. However this property is hard to check for, so we check for
+        // monotonicity with respect to the leading sort field instead, which is stronger.
+        idFields[i] = idFields[i]->optimize();  // We optimize here to make use of constant folding.
+        auto monotonicState = idFields[i]->getMonotonicState(sortedFieldPath);
+
+        // We don't add monotonic::State::Constant id fields, because they are useless when
+        // determining if a group batch is finished.
+        if (monotonicState == monotonic::State::Increasing ||
+            monotonicState == monotonic::State::Decreasing) {
+            monotonicIdFields.push_back(i);
+        }
+    }
+    if (monotonicIdFields.empty()) {
+        return false;
+    }
+
+    // Replacing '*itr' below releases the container's reference to this stage, so keep it alive
+    // until we return.
+    boost::intrusive_ptr<DocumentSource> self = this;
+
+    *itr = DocumentSourceStreamingGroup::create(pExpCtx,
+                                                getIdExpression(),
+                                                std::move(monotonicIdFields),
+                                                std::move(getMutableAccumulationStatements()),
+                                                getMaxMemoryUsageBytes());
+
+    // Streaming group isn't supported in SBE yet and we don't want to run the pipeline in hybrid
+    // mode due to potential perf impact.
+    pExpCtx->sbePipelineCompatibility = SbeCompatibility::notCompatible;
+
+    return true;
+}
+
 boost::intrusive_ptr<DocumentSource> DocumentSourceGroup::createFromBsonWithMaxMemoryUsage(
     BSONElement elem,
     const boost::intrusive_ptr<ExpressionContext>& expCtx,
@@ -145,6 +145,36 @@ protected:
     bool tryToGenerateCommonSortKey(Pipeline::SourceContainer::iterator itr,
                                     Pipeline::SourceContainer* container);
 
+    /**
+     * This optimization drops accumulators that are syntactic duplicates of an earlier accumulator
+     * in the same $group, so the shared result is computed and stored only once per group. The
+     * dropped output fields are restored by a $project inserted after this stage. For example,
+     *
+     * {$group: {_id: "$k", a: {$sum: "$x"}, b: {$sum: "$x"}}}
+     * ->
+     * {$group: {_id: "$k", a: {$sum: "$x"}}},
+     * {$project: {a: 1, b: "$a"}}
+     *
+     * Accumulators that run user JavaScript or contain nondeterministic expressions (e.g. $rand)
+     * are left alone, since their syntactic duplicates may legitimately differ in value.
+     */
+    bool tryToDeduplicateAccumulators(Pipeline::SourceContainer::iterator itr,
+                                      Pipeline::SourceContainer* container);
+
+    /**
+     * This optimization replaces the hash based $group with $_internalStreamingGroup when the
+     * stage immediately preceding it is a $sort and one or more of the _id field expressions are
+     * monotonic with respect to the leading sort key. Documents with equal values of a monotonic
+     * _id field then arrive as one contiguous run, so the group can aggregate run-by-run, bounding
+     * memory by the size of a single run and emitting results incrementally instead of blocking
+     * until the input is exhausted.
+     *
+     * Returns true if the stage was replaced, in which case '*itr' points at the new
+     * $_internalStreamingGroup stage.
+     */
+    bool tryToEnableStreamingGroup(Pipeline::SourceContainer::iterator itr,
+                                   Pipeline::SourceContainer* container);
+
 private:
     explicit DocumentSourceGroup(const boost::intrusive_ptr<ExpressionContext>& expCtx,
                                  boost::optional<int64_t> maxMemoryUsageBytes = boost::none);
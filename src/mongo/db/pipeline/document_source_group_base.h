@@ -75,8 +75,8 @@ namespace mongo {
  */
 class DocumentSourceGroupBase : public DocumentSource {
 public:
-    using Accumulators = std::vector<boost::intrusive_ptr<AccumulatorState>>;
-    using GroupsMap = ValueUnorderedMap<Accumulators>;
+    using Accumulators = GroupProcessorBase::Accumulators;
+    using GroupsMap = GroupProcessorBase::GroupsMap;
 
     Value serialize(const SerializationOptions& opts = SerializationOptions{}) const final;
     boost::intrusive_ptr<DocumentSource> optimize() final;
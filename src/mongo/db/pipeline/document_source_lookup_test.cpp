@@ -1715,7 +1715,7 @@ TEST_F(DocumentSourceLookUpTest, IncrementNestedAggregateOpCounterOnCreateButNot
     auto testOpCounter = [&](const NamespaceString& nss, const int expectedIncrease) {
         auto resolvedNss = StringMap<ExpressionContext::ResolvedNamespace>{
             {nss.coll().toString(), {nss, std::vector<BSONObj>()}}};
-        auto countBeforeCreate = globalOpCounters.getNestedAggregate()->load();
+        auto countBeforeCreate = globalOpCounters.getNestedAggregate();
 
         // Create a DocumentSourceLookUp and verify that the counter increases by the expected
         // amount.
@@ -1728,14 +1728,14 @@ TEST_F(DocumentSourceLookUpTest, IncrementNestedAggregateOpCounterOnCreateButNot
                 .firstElement(),
             originalExpCtx);
         auto originalLookup = static_cast<DocumentSourceLookUp*>(docSource.get());
-        auto countAfterCreate = globalOpCounters.getNestedAggregate()->load();
+        auto countAfterCreate = globalOpCounters.getNestedAggregate();
         ASSERT_EQ(countAfterCreate - countBeforeCreate, expectedIncrease);
 
         // Copy the DocumentSourceLookUp and verify that the counter doesn't increase.
         auto newExpCtx = make_intrusive<ExpressionContextForTest>(getOpCtx(), nss);
         newExpCtx->setResolvedNamespaces(resolvedNss);
         DocumentSourceLookUp newLookup{*originalLookup, newExpCtx};
-        auto countAfterCopy = globalOpCounters.getNestedAggregate()->load();
+        auto countAfterCopy = globalOpCounters.getNestedAggregate();
         ASSERT_EQ(countAfterCopy - countAfterCreate, 0);
     };
 
@@ -184,7 +184,7 @@ void GroupProcessor::readyGroups() {
             spill();
         }
 
-        _groups = _expCtx->getValueComparator().makeUnorderedValueMap<Accumulators>();
+        _groups = _expCtx->getValueComparator().makeFlatUnorderedValueMap<Accumulators>();
 
         _sorterIterator.reset(Sorter<Value, Value>::Iterator::merge(
             _sortedFiles, SortOptions(), SorterComparator(_expCtx->getValueComparator())));
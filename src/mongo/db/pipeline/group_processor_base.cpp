@@ -42,7 +42,7 @@ GroupProcessorBase::GroupProcessorBase(const boost::intrusive_ptr<ExpressionCont
                                        int64_t maxMemoryUsageBytes)
     : _expCtx(expCtx),
       _memoryTracker{expCtx->allowDiskUse && !expCtx->inMongos, maxMemoryUsageBytes},
-      _groups(expCtx->getValueComparator().makeUnorderedValueMap<Accumulators>()) {}
+      _groups(expCtx->getValueComparator().makeFlatUnorderedValueMap<Accumulators>()) {}
 
 void GroupProcessorBase::addAccumulationStatement(AccumulationStatement accumulationStatement) {
     tassert(7801002, "Can't mutate accumulated fields after initialization", !_executionStarted);
@@ -125,7 +125,7 @@ boost::intrusive_ptr<Expression> GroupProcessorBase::getIdExpression() const {
 
 void GroupProcessorBase::reset() {
     // Free our resources.
-    _groups = _expCtx->getValueComparator().makeUnorderedValueMap<Accumulators>();
+    _groups = _expCtx->getValueComparator().makeFlatUnorderedValueMap<Accumulators>();
     _memoryTracker.resetCurrent();
 }
 
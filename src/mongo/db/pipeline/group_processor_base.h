@@ -46,7 +46,11 @@ namespace mongo {
 class GroupProcessorBase {
 public:
     using Accumulators = std::vector<boost::intrusive_ptr<AccumulatorState>>;
-    using GroupsMap = ValueUnorderedMap<Accumulators>;
+    // A flat open-addressing table so that probing a group touches contiguous memory instead of
+    // chasing a heap node per group, which keeps large rollups from being memory-latency-bound.
+    // Iterators and entry pointers are invalidated by inserts; they are only ever held across
+    // mutation-free phases (spilling and result iteration).
+    using GroupsMap = ValueFlatUnorderedMap<Accumulators>;
 
     GroupProcessorBase(const boost::intrusive_ptr<ExpressionContext>& expCtx,
                        int64_t maxMemoryUsageBytes);
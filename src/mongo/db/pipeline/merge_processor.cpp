@@ -81,6 +81,7 @@ BatchedCommandGenerator makeUpdateCommandGenerator() {
 std::vector<write_ops::UpdateOpEntry> constructUpdateEntries(
     MongoProcessInterface::BatchedObjects&& batch, UpsertType upsert, bool multi) {
     std::vector<write_ops::UpdateOpEntry> updateEntries;
+    updateEntries.reserve(batch.size());
     for (auto&& obj : batch) {
         write_ops::UpdateOpEntry entry;
         auto&& [q, u, c] = obj;
@@ -184,7 +185,9 @@ BatchTransform makeUpdateTransform(const std::string& updateOp) {
  */
 BSONObj extractMergeOnFieldsFromDoc(const Document& doc, const std::set<FieldPath>& mergeOnFields) {
     using namespace fmt::literals;
-    MutableDocument result;
+    // Build the key object directly rather than going through an intermediate Document, as this
+    // runs once per input document.
+    BSONObjBuilder result;
     for (const auto& field : mergeOnFields) {
         auto value = doc.getNestedField(field);
         uassert(51185,
@@ -195,9 +198,9 @@ BSONObj extractMergeOnFieldsFromDoc(const Document& doc, const std::set<FieldPat
             "$merge write error: 'on' field '{}' cannot be missing, null, undefined or an array"_format(
                 field.fullPath()),
             !value.nullish());
-        result.addField(field.fullPath(), std::move(value));
+        value.addToBsonObj(&result, field.fullPath());
     }
-    return result.freeze().toBson();
+    return result.obj();
 }
 
 }  // namespace
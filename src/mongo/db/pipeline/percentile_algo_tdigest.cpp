@@ -34,6 +34,7 @@
 #include <memory>
 
 #include <boost/optional/optional.hpp>
+#include <boost/sort/spreadsort/float_sort.hpp>
 
 #include "mongo/db/pipeline/percentile_algo_tdigest.h"
 #include "mongo/db/query/query_knobs_gen.h"
@@ -122,10 +123,10 @@ void TDigest::flushBuffer() {
         return;
     }
 
-    // TODO SERVER-75565: 'boost::sort::spreadsort::spreadsort' shows an observable perf improvement
-    // over std::sort on large datasets. If switching to boost's spreadsort would need to re-tune
-    // the default delta setting and the size of the buffer.
-    std::sort(_buffer.begin(), _buffer.end());
+    // Radix-based 'float_sort' beats std::sort on large buffers and falls back to comparison
+    // sorting on its own for small ones. The buffer cannot contain NaNs or infinities (they are
+    // filtered out by incorporate()), so the bit-wise ordering it relies on agrees with operator<.
+    boost::sort::spreadsort::float_sort(_buffer.begin(), _buffer.end());
     merge(_buffer);
     _buffer.clear();
 }
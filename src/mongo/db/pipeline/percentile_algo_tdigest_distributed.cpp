@@ -30,6 +30,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <utility>
 #include <vector>
 
 
@@ -59,18 +60,17 @@ public:
     Value serialize() final {
         flushBuffer();
 
-        std::vector<double> flattened(kCentroidsOffset, 0);
-        flattened[kNegInfCountOffset] = _negInfCount;
-        flattened[kPosInfCountOffset] = _posInfCount;
-        flattened[kMinOffset] = _min;
-        flattened[kMaxOffset] = _max;
-
+        std::vector<Value> flattened;
         flattened.reserve(kCentroidsOffset + 2 * _centroids.size());
+        flattened.emplace_back(static_cast<double>(_negInfCount));
+        flattened.emplace_back(static_cast<double>(_posInfCount));
+        flattened.emplace_back(_min);
+        flattened.emplace_back(_max);
         for (const Centroid& c : _centroids) {
-            flattened.push_back(c.weight);
-            flattened.push_back(c.mean);
+            flattened.emplace_back(c.weight);
+            flattened.emplace_back(c.mean);
         }
-        return Value(std::vector<Value>(flattened.begin(), flattened.end()));
+        return Value(std::move(flattened));
     }
 
     /*
@@ -101,7 +101,7 @@ public:
             centroids.push_back({other[i].coerceToDouble(), other[i + 1].coerceToDouble()});
         }
 
-        merge(TDigest{negInfCount, posInfCount, min, max, centroids, _k_limit, _delta});
+        merge(TDigest{negInfCount, posInfCount, min, max, std::move(centroids), _k_limit, _delta});
     }
 };
 
@@ -214,13 +214,13 @@ std::unique_ptr<Pipeline, PipelineDeleter> Pipeline::clone(
     return create(std::move(clonedStages), expCtx);
 }
 
-template <class T>
+template <class T, class GetElemFunc>
 std::unique_ptr<Pipeline, PipelineDeleter> Pipeline::parseCommon(
     const std::vector<T>& rawPipeline,
     const boost::intrusive_ptr<ExpressionContext>& expCtx,
     PipelineValidatorCallback validator,
     bool isFacetPipeline,
-    std::function<BSONObj(T)> getElemFunc) {
+    GetElemFunc getElemFunc) {
 
     // Before parsing the pipeline, make sure it's not so long that it will make us run out of
     // memory.
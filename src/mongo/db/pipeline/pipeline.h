@@ -523,15 +523,17 @@ private:
     ~Pipeline();
 
     /**
-     * Helper for public methods that parse pipelines from vectors of different types.
+     * Helper for public methods that parse pipelines from vectors of different types. The element
+     * accessor is a template parameter rather than a std::function so that the per-stage call
+     * inlines; this helper runs once per command invocation on the ingress path.
      */
-    template <class T>
+    template <class T, class GetElemFunc>
     static std::unique_ptr<Pipeline, PipelineDeleter> parseCommon(
         const std::vector<T>& rawPipeline,
         const boost::intrusive_ptr<ExpressionContext>& expCtx,
         PipelineValidatorCallback validator,
         bool isFacetPipeline,
-        std::function<BSONObj(T)> getElemFunc);
+        GetElemFunc getElemFunc);
 
     /**
      * Stitch together the source pointers by calling setSource() for each source in '_sources'.
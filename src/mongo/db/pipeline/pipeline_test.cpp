@@ -86,6 +86,7 @@
 #include "mongo/db/s/shard_server_test_fixture.h"
 #include "mongo/db/tenant_id.h"
 #include "mongo/dbtests/dbtests.h"  // IWYU pragma: keep
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/s/sharding_state.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/bson_test_util.h"
@@ -3781,6 +3782,71 @@ TEST(PipelineOptimizationTest, LimDoesNotCoalesceWithSortInSortProjGroupLim) {
     assertPipelineOptimizesAndSerializesTo(inputPipe, outputPipe, serializedPipe);
 }
 
+TEST(PipelineOptimizationTest, GroupBecomesStreamingGroupAfterSortOnMonotonicId) {
+    RAIIServerParameterControllerForTest streamingGroupController(
+        "internalQueryEnableStreamingGroup", true);
+
+    std::string inputPipe =
+        "[{$sort: {a: 1}}"
+        ",{$group: {_id: {a: '$a'}, count: {$sum: {$const: 1}}}}"
+        "]";
+
+    std::string outputPipe =
+        "[{$sort: {sortKey: {a: 1}}}"
+        ",{$_internalStreamingGroup: {_id: {a: '$a'}, count: {$sum: {$const: 1}}, "
+        "'$monotonicIdFields': ['a']}}"
+        "]";
+
+    std::string serializedPipe =
+        "[{$sort: {a: 1}}"
+        ",{$_internalStreamingGroup: {_id: {a: '$a'}, count: {$sum: {$const: 1}}, "
+        "'$monotonicIdFields': ['a']}}"
+        "]";
+
+    assertPipelineOptimizesAndSerializesTo(inputPipe, outputPipe, serializedPipe);
+}
+
+TEST(PipelineOptimizationTest, GroupDoesNotBecomeStreamingGroupWhenIdIsNotMonotonic) {
+    RAIIServerParameterControllerForTest streamingGroupController(
+        "internalQueryEnableStreamingGroup", true);
+
+    std::string inputPipe =
+        "[{$sort: {a: 1}}"
+        ",{$group: {_id: {b: '$b'}, count: {$sum: {$const: 1}}}}"
+        "]";
+
+    std::string outputPipe =
+        "[{$sort: {sortKey: {a: 1}}}"
+        ",{$group: {_id: {b: '$b'}, count: {$sum: {$const: 1}}}}"
+        "]";
+
+    std::string serializedPipe =
+        "[{$sort: {a: 1}}"
+        ",{$group: {_id: {b: '$b'}, count: {$sum: {$const: 1}}}}"
+        "]";
+
+    assertPipelineOptimizesAndSerializesTo(inputPipe, outputPipe, serializedPipe);
+}
+
+TEST(PipelineOptimizationTest, GroupDoesNotBecomeStreamingGroupWhenKnobIsDisabled) {
+    std::string inputPipe =
+        "[{$sort: {a: 1}}"
+        ",{$group: {_id: {a: '$a'}, count: {$sum: {$const: 1}}}}"
+        "]";
+
+    std::string outputPipe =
+        "[{$sort: {sortKey: {a: 1}}}"
+        ",{$group: {_id: {a: '$a'}, count: {$sum: {$const: 1}}}}"
+        "]";
+
+    std::string serializedPipe =
+        "[{$sort: {a: 1}}"
+        ",{$group: {_id: {a: '$a'}, count: {$sum: {$const: 1}}}}"
+        "]";
+
+    assertPipelineOptimizesAndSerializesTo(inputPipe, outputPipe, serializedPipe);
+}
+
 TEST(PipelineOptimizationTest, SortProjSkipLimBecomesTopKSortSkipProj) {
     std::string inputPipe =
         "[{$sort: {a: 1}}"
@@ -36,6 +36,7 @@
 #include <boost/smart_ptr.hpp>
 #include <cstddef>
 #include <limits>
+#include <numeric>
 #include <vector>
 
 #include <boost/none.hpp>
@@ -47,6 +48,7 @@
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/db/auth/authorization_manager.h"
 #include "mongo/db/auth/authorization_session.h"
+#include "mongo/db/catalog/clustered_collection_util.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/collection_catalog.h"
 #include "mongo/db/catalog/collection_options.h"
@@ -81,6 +83,7 @@
 #include "mongo/db/query/multiple_collection_accessor.h"
 #include "mongo/db/query/plan_cache.h"
 #include "mongo/db/query/sbe_plan_cache.h"
+#include "mongo/db/record_id_helpers.h"
 #include "mongo/db/repl/primary_only_service.h"
 #include "mongo/db/s/query_analysis_writer.h"
 #include "mongo/db/s/transaction_coordinator_curop.h"
@@ -94,6 +97,7 @@
 #include "mongo/db/storage/backup_cursor_hooks.h"
 #include "mongo/db/storage/durable_catalog.h"
 #include "mongo/db/storage/record_data.h"
+#include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/db/timeseries/catalog_helper.h"
@@ -1006,4 +1010,51 @@ boost::optional<Document> CommonMongodProcessInterface::lookupSingleDocumentLoca
     return Document(document).getOwned();
 }
 
+std::vector<boost::optional<Document>> CommonMongodProcessInterface::lookupDocumentsLocally(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx,
+    const NamespaceString& nss,
+    const std::vector<Document>& documentKeys) {
+    std::vector<boost::optional<Document>> results(documentKeys.size());
+    AutoGetCollectionForReadMaybeLockFree autoColl(expCtx->opCtx, nss);
+    const auto& collection = autoColl.getCollection();
+    if (!collection) {
+        return results;
+    }
+
+    if (collection->isClustered() &&
+        clustered_util::isClusteredOnId(collection->getClusteredInfo())) {
+        // The documents are clustered by _id, so each key maps directly to a RecordId. Resolve the
+        // whole batch with one record store cursor, visiting the keys in RecordId order so the
+        // lookups walk the collection in a single forward pass instead of seeking back and forth.
+        const auto& indexSpec = collection->getClusteredInfo()->getIndexSpec();
+        std::vector<RecordId> recordIds(documentKeys.size());
+        for (size_t i = 0; i < documentKeys.size(); ++i) {
+            recordIds[i] = uassertStatusOK(record_id_helpers::keyForDoc(
+                documentKeys[i].toBson(), indexSpec, collection->getDefaultCollator()));
+        }
+
+        std::vector<size_t> order(documentKeys.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+            return recordIds[lhs] < recordIds[rhs];
+        });
+
+        auto cursor = collection->getRecordStore()->getCursor(expCtx->opCtx);
+        for (auto idx : order) {
+            if (auto record = cursor->seekExact(recordIds[idx])) {
+                results[idx] = Document(record->data.toBson()).getOwned();
+            }
+        }
+        return results;
+    }
+
+    for (size_t i = 0; i < documentKeys.size(); ++i) {
+        BSONObj document;
+        if (Helpers::findById(expCtx->opCtx, nss, documentKeys[i].toBson(), document)) {
+            results[i] = Document(document).getOwned();
+        }
+    }
+    return results;
+}
+
 }  // namespace mongo
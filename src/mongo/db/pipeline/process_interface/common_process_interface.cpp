@@ -95,7 +95,22 @@ std::vector<BSONObj> CommonProcessInterface::getCurrentOps(
 #endif
 
     auto reportCurrentOpForService = [&](Service* service) {
-        for (Service::LockedClientsCursor cursor(service); ClientLock lc = cursor.next();) {
+        ServiceContext::LockedClientsCursor cursor(service->getServiceContext());
+        while (Client* unlockedClient = cursor.next()) {
+            // When idle connections are excluded, skip clients with no attached operation before
+            // taking their lock; on nodes with tens of thousands of mostly idle connections this
+            // avoids a lock acquisition per idle client per poll. The unlocked flag may be stale,
+            // so the authoritative 'hasAnyActiveCurrentOp()' check below still runs under the
+            // client lock.
+            if (connMode == CurrentOpConnectionsMode::kExcludeIdle &&
+                !unlockedClient->mayHaveOperationContext()) {
+                continue;
+            }
+
+            ClientLock lc(unlockedClient);
+            if (lc->getService() != service) {
+                continue;
+            }
             Client* client = &*lc;
             if (ctxAuth->getAuthorizationManager().isAuthEnabled()) {
                 // If auth is disabled, ignore the allUsers parameter.
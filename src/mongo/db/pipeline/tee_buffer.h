@@ -68,6 +68,9 @@ public:
      * consumer will not consume all input.
      */
     void dispose(size_t consumerId) {
+        if (_consumers[consumerId].nLeftToReturn > 0) {
+            --_nConsumersStillProcessingThisBatch;
+        }
         _consumers[consumerId].stillInUse = false;
         _consumers[consumerId].nLeftToReturn = 0;
         if (std::none_of(_consumers.begin(), _consumers.end(), [](const ConsumerInfo& info) {
@@ -107,5 +110,10 @@ private:
         int nLeftToReturn = 0;
     };
     std::vector<ConsumerInfo> _consumers;
+
+    // The number of consumers with documents left to return from the current batch. Kept up to
+    // date so that getNext() can decide whether to load the next batch without scanning every
+    // consumer for each document returned.
+    size_t _nConsumersStillProcessingThisBatch = 0;
 };
 }  // namespace mongo
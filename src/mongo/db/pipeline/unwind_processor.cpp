@@ -44,12 +44,17 @@ UnwindProcessor::UnwindProcessor(const FieldPath& unwindPath,
     : _unwindPath(unwindPath),
       _preserveNullAndEmptyArrays(preserveNullAndEmptyArrays),
       _indexPath(indexPath),
+      _indexPathIsWithinUnwindPath(indexPath &&
+                                   indexPath->getPathLength() > unwindPath.getPathLength() &&
+                                   indexPath->getSubpath(unwindPath.getPathLength() - 1) ==
+                                       unwindPath.fullPath()),
       _strict(strict) {}
 
 void UnwindProcessor::process(const Document& document) {
     // Reset document specific attributes.
     _output.reset(document);
     _unwindPathFieldIndexes.clear();
+    _indexPathFieldIndexes.clear();
     _index = 0;
     _inputArray = document.getNestedField(_unwindPath, &_unwindPathFieldIndexes);
     _haveNext = true;
@@ -103,8 +108,20 @@ boost::optional<Document> UnwindProcessor::getNext() {
     }
 
     if (_indexPath) {
-        _output.getNestedField(*_indexPath) =
-            indexForOutput ? Value(*indexForOutput) : Value(BSONNULL);
+        Value indexValue = indexForOutput ? Value(*indexForOutput) : Value(BSONNULL);
+        if (!_indexPathFieldIndexes.empty()) {
+            _output.setNestedField(_indexPathFieldIndexes, std::move(indexValue));
+        } else {
+            _output.getNestedField(*_indexPath) = std::move(indexValue);
+            if (!_indexPathIsWithinUnwindPath) {
+                // The field (and any missing or non-document components along its path) now exists,
+                // so record its positions and set the index by position for the remaining array
+                // elements rather than re-walking the dotted path for each one. Positions stay
+                // valid across the copy-on-write clones the output document goes through between
+                // elements.
+                _output.peek().getNestedField(*_indexPath, &_indexPathFieldIndexes);
+            }
+        }
     }
 
     return _haveNext ? _output.peek() : _output.freeze();
@@ -77,6 +77,11 @@ private:
     // existing value, setting to null when the value was a non-array or empty array.
     const boost::optional<FieldPath> _indexPath;
 
+    // Whether '_indexPath' extends '_unwindPath' (e.g. unwinding 'a' with the index at 'a.idx').
+    // In that case the index field lives inside the value that gets replaced for every array
+    // element, so its positions cannot be cached across elements.
+    const bool _indexPathIsWithinUnwindPath{false};
+
     // Tracks whether or not we can possibly return any more documents. Note we may return
     // boost::none even if this is true.
     bool _haveNext{false};
@@ -91,6 +96,12 @@ private:
     // Document indexes of the field path components.
     std::vector<Position> _unwindPathFieldIndexes;
 
+    // Document indexes of the index path components. Resolved when the index field is first
+    // written for an input document so that subsequent array elements can set the index by
+    // position instead of re-walking the dotted path. Left empty when '_indexPath' is unset or
+    // '_indexPathIsWithinUnwindPath' is true.
+    std::vector<Position> _indexPathFieldIndexes;
+
     // Index into the _inputArray to return next.
     size_t _index{0};
 };
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <cstddef>
+#include <deque>
 #include <map>
 #include <memory>
 #include <utility>
@@ -90,33 +91,76 @@ protected:
     std::multiset<SimpleMemoryUsageTokenWith<Value>, MemoryTokenValueComparator> _values;
 };
 
+/**
+ * Implements $min and $max as a monotonic deque of candidates instead of materializing the whole
+ * window. A newly added value first discards every older value it supersedes, since those can never
+ * become the extreme again before they leave the window. Because executors remove values in FIFO
+ * order (see WindowFunctionState), the current extreme is always at the front, so add() and
+ * remove() are amortized O(1) and memory is bounded by the number of surviving candidates rather
+ * than the window size; over sorted input the state holds a single value.
+ */
 template <AccumulatorMinMax::Sense sense>
-class WindowFunctionMinMax : public WindowFunctionMinMaxCommon<sense> {
+class WindowFunctionMinMax : public WindowFunctionState {
 public:
-    using WindowFunctionMinMaxCommon<sense>::_values;
-    using WindowFunctionMinMaxCommon<sense>::_memUsageTracker;
-
     static inline const Value kDefault = Value{BSONNULL};
 
     static std::unique_ptr<WindowFunctionState> create(ExpressionContext* const expCtx) {
         return std::make_unique<WindowFunctionMinMax<sense>>(expCtx);
     }
 
-    explicit WindowFunctionMinMax(ExpressionContext* const expCtx)
-        : WindowFunctionMinMaxCommon<sense>(expCtx) {
+    explicit WindowFunctionMinMax(ExpressionContext* const expCtx) : WindowFunctionState(expCtx) {
+        _memUsageTracker.set(sizeof(*this));
+    }
+
+    void add(Value value) final {
+        // Ignore nullish values.
+        if (value.nullish()) {
+            return;
+        }
+        // Values that compare equal to the new value are retained, so that each of them still
+        // matches one future remove() call.
+        while (!_candidates.empty() && supersedes(value, _candidates.back().value())) {
+            _candidates.pop_back();
+        }
+        _candidates.emplace_back(
+            SimpleMemoryUsageToken{value.getApproximateSize(), &_memUsageTracker},
+            std::move(value));
+    }
+
+    void remove(Value value) final {
+        // Ignore nullish values.
+        if (value.nullish()) {
+            return;
+        }
+        // The removed value is the oldest one in the window. If it is still the front candidate,
+        // retire it; otherwise a later add() already discarded it and there is nothing to do.
+        if (!_candidates.empty() &&
+            _expCtx->getValueComparator().evaluate(_candidates.front().value() == value)) {
+            _candidates.pop_front();
+        }
+    }
+
+    void reset() final {
+        _candidates.clear();
         _memUsageTracker.set(sizeof(*this));
     }
 
     Value getValue() const final {
-        if (_values.empty())
-            return kDefault;
+        return _candidates.empty() ? kDefault : _candidates.front().value();
+    }
+
+private:
+    bool supersedes(const Value& newer, const Value& older) const {
         if constexpr (sense == AccumulatorMinMax::Sense::kMin) {
-            return _values.begin()->value();
+            return _expCtx->getValueComparator().evaluate(older > newer);
         } else {
-            return _values.rbegin()->value();
+            return _expCtx->getValueComparator().evaluate(older < newer);
         }
-        MONGO_UNREACHABLE_TASSERT(5371401);
     }
+
+    // Candidates for the extreme value, oldest first. For $min the values are non-decreasing and
+    // for $max non-increasing; the front is the window's current result.
+    std::deque<SimpleMemoryUsageTokenWith<Value>> _candidates;
 };
 
 template <AccumulatorMinMax::Sense sense>
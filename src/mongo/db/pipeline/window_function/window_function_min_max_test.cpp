@@ -168,6 +168,32 @@ TEST_F(WindowFunctionMinMaxTest, Ties) {
     ASSERT_VALUE_EQ(max.getValue(), y);
 }
 
+TEST_F(WindowFunctionMinMaxTest, DiscardsSupersededCandidates) {
+    // Values that can no longer become the extreme are discarded as soon as a better value
+    // arrives, instead of being retained for the lifetime of the window.
+    min.add(Value{5});
+    min.add(Value{10});
+    min.add(Value{2});  // Supersedes both 5 and 10.
+    ASSERT_VALUE_EQ(min.getValue(), Value{2});
+    ASSERT_EQ(min.getApproximateSize(),
+              sizeof(WindowFunctionMin) + Value{2}.getApproximateSize());
+
+    // Removing the superseded values is a no-op; they are already gone.
+    min.remove(Value{5});
+    min.remove(Value{10});
+    ASSERT_VALUE_EQ(min.getValue(), Value{2});
+
+    min.remove(Value{2});
+    ASSERT_VALUE_EQ(min.getValue(), Value{BSONNULL});
+
+    max.add(Value{1});
+    max.add(Value{0});
+    max.add(Value{7});  // Supersedes both 1 and 0.
+    ASSERT_VALUE_EQ(max.getValue(), Value{7});
+    ASSERT_EQ(max.getApproximateSize(),
+              sizeof(WindowFunctionMax) + Value{7}.getApproximateSize());
+}
+
 TEST_F(WindowFunctionMinMaxTest, TracksMemoryUsageOnAddAndRemove) {
     size_t trackingSize = sizeof(WindowFunctionMin);
     ASSERT_EQ(min.getApproximateSize(), trackingSize);
@@ -66,12 +66,27 @@ bool appendAndTerm(const std::vector<BitsetTreeNode>& children,
                    bool isNegated) {
     for (const auto& child : children) {
         auto dnfChild = convertToDNF(child, maximumNumberOfMinterms, isNegated);
-        if (!dnfChild ||
-            maxterm.minterms.size() * dnfChild->minterms.size() > maximumNumberOfMinterms) {
+        if (!dnfChild) {
             return false;
         }
 
+        if (maxterm.minterms.size() * dnfChild->minterms.size() > maximumNumberOfMinterms) {
+            // Before declining, try to shrink both operands using the Absorption law:
+            // intermediate products often carry many absorbable minterms which would otherwise be
+            // removed only after the full conversion.
+            maxterm.removeRedundancies();
+            dnfChild->removeRedundancies();
+            if (maxterm.minterms.size() * dnfChild->minterms.size() > maximumNumberOfMinterms) {
+                return false;
+            }
+        }
+
         maxterm &= *dnfChild;
+
+        if (maxterm.minterms.empty()) {
+            // The conjunction is unsatisfiable, no need to convert the remaining children.
+            break;
+        }
     }
 
     return true;
@@ -86,10 +101,19 @@ bool appendOrTerm(const std::vector<BitsetTreeNode>& children,
                   bool isNegated) {
     for (const auto& child : children) {
         auto dnfChild = convertToDNF(child, maximumNumberOfMinterms, isNegated);
-        if (!dnfChild ||
-            maxterm.minterms.size() + dnfChild->minterms.size() > maximumNumberOfMinterms) {
+        if (!dnfChild) {
             return false;
         }
+
+        if (maxterm.minterms.size() + dnfChild->minterms.size() > maximumNumberOfMinterms) {
+            // Before declining, try to shrink the accumulated disjunction using the Absorption
+            // law.
+            maxterm.removeRedundancies();
+            if (maxterm.minterms.size() + dnfChild->minterms.size() > maximumNumberOfMinterms) {
+                return false;
+            }
+        }
+
         maxterm |= *dnfChild;
     }
 
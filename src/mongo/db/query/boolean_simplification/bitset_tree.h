@@ -104,8 +104,9 @@ std::ostream& operator<<(std::ostream& os, const BitsetTreeNode& tree);
 
 /**
  * Converts the given bitset tree into DNF. 'maximumNumberOfMinterms' specifies the limit on the
- * number of minterms during boolean trnsformations. The boost::none will be returned if the linit
- * is exceeded.
+ * number of minterms during boolean trnsformations. Before giving up on an intermediate result
+ * that exceeds the limit, the conversion compacts it using the Absorption law; the boost::none
+ * will be returned only if the limit is still exceeded afterwards.
  */
 boost::optional<Maxterm> convertToDNF(const BitsetTreeNode& node, size_t maximumNumberOfMinterms);
 
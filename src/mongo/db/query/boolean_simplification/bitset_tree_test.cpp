@@ -177,4 +177,86 @@ TEST(BitsetTreeTests, ApplyDeMorgan) {
     root.applyDeMorgan();
     ASSERT_EQ(expectedRoot, root);
 }
+
+// (a | (a & b)) & (c | (c & d)): the raw product of the two disjunctions has 4 minterms, but
+// compacting the operands with the Absorption law keeps the conversion within a limit of 3.
+TEST(ConvertToDNFTests, AbsorptionRescuesMintermLimit) {
+    BitsetTreeNode root(BitsetTreeNode::And, false);
+    {
+        BitsetTreeNode orNode(BitsetTreeNode::Or, false);
+        orNode.leafChildren = makeBitsetTerm("0001", "0001");  // a
+        orNode.internalChildren.emplace_back(BitsetTreeNode::And, false);
+        orNode.internalChildren.back().leafChildren = makeBitsetTerm("0011", "0011");  // a & b
+        root.internalChildren.emplace_back(std::move(orNode));
+    }
+    {
+        BitsetTreeNode orNode(BitsetTreeNode::Or, false);
+        orNode.leafChildren = makeBitsetTerm("0100", "0100");  // c
+        orNode.internalChildren.emplace_back(BitsetTreeNode::And, false);
+        orNode.internalChildren.back().leafChildren = makeBitsetTerm("1100", "1100");  // c & d
+        root.internalChildren.emplace_back(std::move(orNode));
+    }
+    root.ensureBitsetSize(4);
+
+    auto dnf = convertToDNF(root, 3);
+    ASSERT_TRUE(dnf.has_value());
+
+    Maxterm expectedDnf{
+        {"0101", "0101"},  // a & c
+    };
+    ASSERT_EQ(expectedDnf, *dnf);
+}
+
+// a & ~a & (b | c): the conjunction is unsatisfiable, so the conversion produces an always-false
+// maxterm without visiting the remaining children.
+TEST(ConvertToDNFTests, UnsatisfiableConjunction) {
+    BitsetTreeNode root(BitsetTreeNode::And, false);
+    root.leafChildren = makeBitsetTerm("001", "001");  // a
+    {
+        BitsetTreeNode orNode(BitsetTreeNode::Or, false);
+        orNode.leafChildren = makeBitsetTerm("000", "001");  // ~a
+        root.internalChildren.emplace_back(std::move(orNode));
+    }
+    {
+        BitsetTreeNode orNode(BitsetTreeNode::Or, false);
+        orNode.leafChildren = makeBitsetTerm("110", "110");  // b | c
+        root.internalChildren.emplace_back(std::move(orNode));
+    }
+    root.ensureBitsetSize(3);
+
+    auto dnf = convertToDNF(root, 10);
+    ASSERT_TRUE(dnf.has_value());
+    ASSERT_TRUE(dnf->isAlwaysFalse());
+}
+
+// (a & b) | a | c: compacting the accumulated disjunction with the Absorption law keeps the
+// conversion within a limit of 2.
+TEST(ConvertToDNFTests, AbsorptionRescuesDisjunctionMintermLimit) {
+    BitsetTreeNode root(BitsetTreeNode::Or, false);
+    {
+        BitsetTreeNode andNode(BitsetTreeNode::And, false);
+        andNode.leafChildren = makeBitsetTerm("011", "011");  // a & b
+        root.internalChildren.emplace_back(std::move(andNode));
+    }
+    {
+        BitsetTreeNode andNode(BitsetTreeNode::And, false);
+        andNode.leafChildren = makeBitsetTerm("001", "001");  // a
+        root.internalChildren.emplace_back(std::move(andNode));
+    }
+    {
+        BitsetTreeNode andNode(BitsetTreeNode::And, false);
+        andNode.leafChildren = makeBitsetTerm("100", "100");  // c
+        root.internalChildren.emplace_back(std::move(andNode));
+    }
+    root.ensureBitsetSize(3);
+
+    auto dnf = convertToDNF(root, 2);
+    ASSERT_TRUE(dnf.has_value());
+
+    Maxterm expectedDnf{
+        {"001", "001"},  // a
+        {"100", "100"},  // c
+    };
+    ASSERT_EQ(expectedDnf, *dnf);
+}
 }  // namespace mongo::boolean_simplification
@@ -143,37 +143,57 @@ using AppendChar = decltype(std::declval<BuilderType>().appendChar(std::declval<
 template <typename BuilderType>
 inline constexpr auto hasAppendChar = stdx::is_detected_exact_v<void, AppendChar, BuilderType>;
 
+/**
+ * Returns true if 'c' is a cache key delimiter which must be escaped when it appears in a
+ * user-provided string.
+ */
+bool isEncodeEscapedChar(char c) {
+    switch (c) {
+        case kEncodeChildrenBegin:
+        case kEncodeChildrenEnd:
+        case kEncodeChildrenSeparator:
+        case kEncodeSectionDelimiter:
+        case kEncodeProjectionRequirementSeparator:
+        case kEncodeRegexFlagsSeparator:
+        case kEncodeParamMarker:
+        case kEncodeConstantLiteralMarker:
+        case '\\':
+            return true;
+        default:
+            return false;
+    }
+}
+
 /**
  * Encode user-provided string. Cache key delimiters seen in the user string are escaped with a
- * backslash.
+ * backslash. Typical inputs (field paths) contain no delimiters, so runs of characters that need
+ * no escaping are appended in bulk rather than one character at a time.
  */
 template <class BuilderType>
 void encodeUserString(StringData s, BuilderType* builder) {
-    for (size_t i = 0; i < s.size(); ++i) {
-        char c = s[i];
-        switch (c) {
-            case kEncodeChildrenBegin:
-            case kEncodeChildrenEnd:
-            case kEncodeChildrenSeparator:
-            case kEncodeSectionDelimiter:
-            case kEncodeProjectionRequirementSeparator:
-            case kEncodeRegexFlagsSeparator:
-            case kEncodeParamMarker:
-            case kEncodeConstantLiteralMarker:
-            case '\\':
-                if constexpr (hasAppendChar<BuilderType>) {
-                    builder->appendChar('\\');
-                } else {
-                    *builder << '\\';
-                }
-                [[fallthrough]];
-            default:
-                if constexpr (hasAppendChar<BuilderType>) {
-                    builder->appendChar(c);
-                } else {
-                    *builder << c;
-                }
+    size_t pos = 0;
+    while (pos < s.size()) {
+        size_t runEnd = pos;
+        while (runEnd < s.size() && !isEncodeEscapedChar(s[runEnd])) {
+            ++runEnd;
+        }
+        if (runEnd > pos) {
+            if constexpr (hasAppendChar<BuilderType>) {
+                builder->appendStr(s.substr(pos, runEnd - pos), false /* includeEndingNull */);
+            } else {
+                *builder << s.substr(pos, runEnd - pos);
+            }
+        }
+        if (runEnd < s.size()) {
+            if constexpr (hasAppendChar<BuilderType>) {
+                builder->appendChar('\\');
+                builder->appendChar(s[runEnd]);
+            } else {
+                *builder << '\\' << s[runEnd];
+            }
+            ++runEnd;
         }
+        pos = runEnd;
     }
 }
 
@@ -425,6 +425,24 @@ TEST_F(CanonicalQueryEncoderTest, ComputeKeyTimeseriesGeoWithin) {
                       canonical_query_encoder::encodeClassic(*cqSpherical));
 }
 
+// The classic cache key must not depend on the length or the contents of a $in list, so that
+// queries differing only in their $in constants collapse into a single cached plan. The constants
+// are bound when the plan stage tree is rebuilt from the live query, so sharing the entry is safe.
+// Regex members are the exception: their flags are part of the query shape.
+TEST_F(CanonicalQueryEncoderTest, ClassicComputeKeyIgnoresInListContents) {
+    unique_ptr<CanonicalQuery> cqShortList(canonicalize(opCtx(), "{sku: {$in: [1, 2]}}"));
+    unique_ptr<CanonicalQuery> cqLongList(
+        canonicalize(opCtx(), "{sku: {$in: [3, 4, 'abc', 5.5, null, 9]}}"));
+    ASSERT_EQUALS(canonical_query_encoder::encodeClassic(*cqShortList),
+                  canonical_query_encoder::encodeClassic(*cqLongList));
+
+    unique_ptr<CanonicalQuery> cqRegex(canonicalize(opCtx(), "{sku: {$in: [/foo/, /bar/]}}"));
+    unique_ptr<CanonicalQuery> cqRegexWithFlags(
+        canonicalize(opCtx(), "{sku: {$in: [/foo/, /bar/i]}}"));
+    ASSERT_NOT_EQUALS(canonical_query_encoder::encodeClassic(*cqRegex),
+                      canonical_query_encoder::encodeClassic(*cqRegexWithFlags));
+}
+
 TEST_F(CanonicalQueryEncoderTest, ComputeKeyRegexDependsOnFlags) {
     unittest::GoldenTestContext gctx(&goldenTestConfig);
     // The computed key depends on which execution engine is enabled. As such, we enable SBE for
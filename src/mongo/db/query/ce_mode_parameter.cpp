@@ -35,7 +35,7 @@
 
 namespace mongo::optimizer::ce {
 Status validateCEMode(const std::string& value, const boost::optional<TenantId>&) {
-    if (value == kHeuristic || value == kHistogram || value == kSampling) {
+    if (value == kHeuristic || value == kHistogram || value == kSampling || value == kAuto) {
         return Status::OK();
     }
     return Status(ErrorCodes::Error{6695700}, "Invalid cardinality estimation mode.");
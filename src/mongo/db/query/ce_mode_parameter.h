@@ -39,11 +39,14 @@
 namespace mongo::optimizer::ce {
 
 /**
- * Defines cardinality estimation modes.
+ * Defines cardinality estimation modes. In 'auto' mode the server picks the estimator per
+ * collection: sampling when the collection is large enough for a sample to be meaningful, and
+ * heuristics otherwise.
  */
 const std::string kHeuristic = "heuristic";
 const std::string kHistogram = "histogram";
 const std::string kSampling = "sampling";
+const std::string kAuto = "auto";
 
 Status validateCEMode(const std::string& value, const boost::optional<TenantId>&);
 
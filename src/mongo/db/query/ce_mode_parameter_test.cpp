@@ -41,6 +41,7 @@ TEST(CEModeParameterTest, ValidatesValidCEModes) {
     ASSERT_OK(validateCEMode("heuristic", boost::none));
     ASSERT_OK(validateCEMode("histogram", boost::none));
     ASSERT_OK(validateCEMode("sampling", boost::none));
+    ASSERT_OK(validateCEMode("auto", boost::none));
 }
 
 TEST(CEModeParameterTest, RejectsInvalidCEModes) {
@@ -31,7 +31,6 @@
 #include <memory>
 #include <string>
 #include <unicode/coll.h>
-#include <unicode/sortkey.h>
 #include <utility>
 
 #include <unicode/stringpiece.h>
@@ -84,20 +83,23 @@ CollatorInterface::ComparisonKey CollatorInterfaceICU::getComparisonKey(
     StringData stringData) const {
     // A StringPiece is ICU's StringData. They are logically the same abstraction.
     const icu::StringPiece stringPiece(stringData.rawData(), stringData.size());
-
-    UErrorCode status = U_ZERO_ERROR;
-    icu::CollationKey icuKey;
-    _collator->getCollationKey(icu::UnicodeString::fromUTF8(stringPiece), icuKey, status);
-
-    // Any sequence of bytes, even invalid UTF-8, has defined comparison behavior in ICU (invalid
-    // subsequences are weighted as the replacement character, U+FFFD). A non-ok error code is only
-    // expected when a memory allocation fails inside ICU, which we consider fatal to the process.
-    fassert(34439, U_SUCCESS(status));
-
-    int32_t keyLength;
-    const uint8_t* keyBuffer = icuKey.getByteArray(keyLength);
+    const auto unicodeString = icu::UnicodeString::fromUTF8(stringPiece);
+
+    // Write the sort key into a stack buffer, rather than through an icu::CollationKey, so that
+    // typical strings do not pay for a heap-allocated intermediate per key. If the buffer turns out
+    // to be too small, getSortKey() returns the required length (including the trailing null byte)
+    // without writing anything and we retry with a buffer of that size.
+    uint8_t stackBuffer[256];
+    uint8_t* keyBuffer = stackBuffer;
+    std::unique_ptr<uint8_t[]> heapBuffer;
+    int32_t keyLength = _collator->getSortKey(unicodeString, keyBuffer, sizeof(stackBuffer));
     invariant(keyLength > 0);
-    invariant(keyBuffer);
+    if (static_cast<size_t>(keyLength) > sizeof(stackBuffer)) {
+        heapBuffer = std::make_unique<uint8_t[]>(keyLength);
+        keyBuffer = heapBuffer.get();
+        const int32_t fullKeyLength = _collator->getSortKey(unicodeString, keyBuffer, keyLength);
+        invariant(fullKeyLength == keyLength);
+    }
 
     // The last byte of the sort key should always be null. When we construct the comparison key, we
     // omit the trailing null byte.
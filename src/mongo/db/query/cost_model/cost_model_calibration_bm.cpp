@@ -0,0 +1,341 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+/**
+ * Calibration harness for the cost model coefficients in 'cost_model_manager.cpp'. The shipped
+ * constants were measured on a particular reference machine; deployments whose hardware diverges
+ * from it can re-derive coefficients for their own build and storage stack by running this
+ * benchmark on the target hardware.
+ *
+ * The per-primitive benchmarks (BM_Scan, BM_Filter, BM_Eval) time a single SBE primitive over
+ * generated datasets of increasing size, so their per-document cost can be inspected directly in
+ * the benchmark output. BM_CalibrateCostModel runs the full calibration: it measures each
+ * primitive at a ladder of dataset sizes, fits 'total = startup + incremental * n' by ordinary
+ * least squares, and prints a coefficient override document suitable for the
+ * 'internalCostModelCoefficients' server parameter:
+ *
+ *   cost_model_calibration_bm --benchmark_filter=BM_CalibrateCostModel
+ *
+ * The primitives are exercised through the real SBE stages (unwind/project/limit/coscan streams
+ * the dataset the same way the SBE test virtual scans do), so the fitted values capture compiled
+ * expression evaluation and stage-to-stage overhead. Seek and fetch costs depend on a live
+ * storage engine and collection layout and cannot be reproduced in a standalone benchmark; the
+ * emitted document overrides only the coefficients measured here and leaves the rest at their
+ * defaults (partial overrides are merged by 'CostModelManager::updateCostModelCoefficients()').
+ */
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/exec/sbe/expressions/compile_ctx.h"
+#include "mongo/db/exec/sbe/expressions/expression.h"
+#include "mongo/db/exec/sbe/expressions/runtime_environment.h"
+#include "mongo/db/exec/sbe/stages/co_scan.h"
+#include "mongo/db/exec/sbe/stages/filter.h"
+#include "mongo/db/exec/sbe/stages/limit_skip.h"
+#include "mongo/db/exec/sbe/stages/project.h"
+#include "mongo/db/exec/sbe/stages/unwind.h"
+#include "mongo/db/exec/sbe/values/slot.h"
+#include "mongo/db/exec/sbe/values/value.h"
+#include "mongo/db/query/stage_types.h"
+#include "mongo/platform/random.h"
+#include "mongo/util/timer.h"
+
+namespace mongo::cost_model {
+namespace {
+
+constexpr int32_t kSeed = 5831;
+constexpr size_t kPayloadSize = 64;
+
+/**
+ * Generates 'count' documents of the shape {_id: <n>, a: <int>, b: <int>, payload: <string>}.
+ * The same seed is used for every dataset so that repeated runs measure identical data.
+ */
+std::vector<BSONObj> generateDocuments(size_t count) {
+    static const std::string kAlphabet = "abcdefghijklmnopqrstuvwxyz";
+
+    std::vector<BSONObj> docs;
+    docs.reserve(count);
+    PseudoRandom random(kSeed);
+    for (size_t i = 0; i < count; ++i) {
+        std::string payload;
+        payload.reserve(kPayloadSize);
+        for (size_t j = 0; j < kPayloadSize; ++j) {
+            payload.push_back(kAlphabet[random.nextInt32(kAlphabet.size())]);
+        }
+        docs.push_back(BSON("_id" << static_cast<long long>(i) << "a" << random.nextInt32(1000)
+                                  << "b" << random.nextInt32(1000) << "payload" << payload));
+    }
+    return docs;
+}
+
+std::pair<sbe::value::TypeTags, sbe::value::Value> makeDocumentArray(
+    const std::vector<BSONObj>& docs) {
+    auto [arrTag, arrVal] = sbe::value::makeNewArray();
+    sbe::value::ValueGuard guard{arrTag, arrVal};
+    auto* arr = sbe::value::getArrayView(arrVal);
+    arr->reserve(docs.size());
+    for (const auto& doc : docs) {
+        auto [tag, val] = sbe::value::copyValue(sbe::value::TypeTags::bsonObject,
+                                                sbe::value::bitcastFrom<const char*>(doc.objdata()));
+        arr->push_back(tag, val);
+    }
+    guard.reset();
+    return {arrTag, arrVal};
+}
+
+struct CalibrationPlan {
+    std::unique_ptr<sbe::PlanStage> root;
+    sbe::value::SlotId outSlot;
+};
+
+using PlanFactory = CalibrationPlan (*)(const std::vector<BSONObj>&,
+                                        sbe::value::SlotIdGenerator*);
+
+/**
+ * Builds an unwind/project/limit/coscan subtree that streams the documents out one at a time,
+ * mimicking the output of a collection scan.
+ */
+CalibrationPlan makeScanPlan(const std::vector<BSONObj>& docs,
+                             sbe::value::SlotIdGenerator* slotIdGen) {
+    auto [arrTag, arrVal] = makeDocumentArray(docs);
+    auto arraySlot = slotIdGen->generate();
+    auto scanSlot = slotIdGen->generate();
+    auto indexSlot = slotIdGen->generate();
+
+    auto limitCoScan = sbe::makeS<sbe::LimitSkipStage>(
+        sbe::makeS<sbe::CoScanStage>(kEmptyPlanNodeId),
+        sbe::makeE<sbe::EConstant>(sbe::value::TypeTags::NumberInt64,
+                                   sbe::value::bitcastFrom<int64_t>(1)),
+        nullptr,
+        kEmptyPlanNodeId);
+    auto project = sbe::makeProjectStage(std::move(limitCoScan),
+                                         kEmptyPlanNodeId,
+                                         arraySlot,
+                                         sbe::makeE<sbe::EConstant>(arrTag, arrVal));
+    auto unwind = sbe::makeS<sbe::UnwindStage>(std::move(project),
+                                               arraySlot,
+                                               scanSlot,
+                                               indexSlot,
+                                               false /*preserveNullAndEmptyArrays*/,
+                                               kEmptyPlanNodeId);
+    return {std::move(unwind), scanSlot};
+}
+
+/**
+ * Scan with a 50%-selective comparison predicate on top, matching the workload the filter
+ * coefficient models.
+ */
+CalibrationPlan makeFilterPlan(const std::vector<BSONObj>& docs,
+                               sbe::value::SlotIdGenerator* slotIdGen) {
+    auto plan = makeScanPlan(docs, slotIdGen);
+    auto predicate = sbe::makeE<sbe::EPrimBinary>(
+        sbe::EPrimBinary::less,
+        sbe::makeE<sbe::EFunction>("getField"_sd,
+                                   sbe::makeEs(sbe::makeE<sbe::EVariable>(plan.outSlot),
+                                               sbe::makeE<sbe::EConstant>("a"_sd))),
+        sbe::makeE<sbe::EConstant>(sbe::value::TypeTags::NumberInt32,
+                                   sbe::value::bitcastFrom<int32_t>(500)));
+    plan.root = sbe::makeS<sbe::FilterStage<false>>(
+        std::move(plan.root), std::move(predicate), kEmptyPlanNodeId);
+    return plan;
+}
+
+/**
+ * Scan with a projection computing a new value per document, matching the workload the eval
+ * coefficient models.
+ */
+CalibrationPlan makeEvalPlan(const std::vector<BSONObj>& docs,
+                             sbe::value::SlotIdGenerator* slotIdGen) {
+    auto plan = makeScanPlan(docs, slotIdGen);
+    auto evalSlot = slotIdGen->generate();
+    auto sum = sbe::makeE<sbe::EPrimBinary>(
+        sbe::EPrimBinary::add,
+        sbe::makeE<sbe::EFunction>("getField"_sd,
+                                   sbe::makeEs(sbe::makeE<sbe::EVariable>(plan.outSlot),
+                                               sbe::makeE<sbe::EConstant>("a"_sd))),
+        sbe::makeE<sbe::EFunction>("getField"_sd,
+                                   sbe::makeEs(sbe::makeE<sbe::EVariable>(plan.outSlot),
+                                               sbe::makeE<sbe::EConstant>("b"_sd))));
+    plan.root = sbe::makeProjectStage(
+        std::move(plan.root), kEmptyPlanNodeId, evalSlot, std::move(sum));
+    return {std::move(plan.root), evalSlot};
+}
+
+size_t drain(sbe::PlanStage* root, sbe::value::SlotAccessor* accessor) {
+    size_t count = 0;
+    while (root->getNext() == sbe::PlanState::ADVANCED) {
+        benchmark::DoNotOptimize(accessor->getViewOfValue());
+        ++count;
+    }
+    return count;
+}
+
+/**
+ * Times a full open/drain/close execution of the plan built by 'makePlan' and returns the best of
+ * several trials in microseconds. Construction and compilation happen outside the timed region;
+ * open() is included since it is what the startup coefficients model.
+ */
+double measurePlanUs(PlanFactory makePlan, const std::vector<BSONObj>& docs) {
+    constexpr int kTrials = 5;
+
+    sbe::value::SlotIdGenerator slotIdGen;
+    auto plan = makePlan(docs, &slotIdGen);
+    sbe::CompileCtx ctx{std::make_unique<sbe::RuntimeEnvironment>()};
+    plan.root->prepare(ctx);
+    auto* accessor = plan.root->getAccessor(ctx, plan.outSlot);
+
+    double best = std::numeric_limits<double>::max();
+    for (int trial = 0; trial < kTrials; ++trial) {
+        Timer timer;
+        plan.root->open(false);
+        benchmark::DoNotOptimize(drain(plan.root.get(), accessor));
+        plan.root->close();
+        best = std::min(best, static_cast<double>(timer.micros()));
+    }
+    return best;
+}
+
+struct FittedCost {
+    double startupUs;
+    double incrementalUs;
+};
+
+/**
+ * Ordinary least squares fit of 'total = startup + incremental * n' over (n, totalUs) points.
+ * Noise can push the intercept slightly negative; clamp both coefficients at zero since negative
+ * costs are meaningless to the estimator.
+ */
+FittedCost fitLinear(const std::vector<std::pair<double, double>>& points) {
+    const double n = static_cast<double>(points.size());
+    double sumX = 0, sumY = 0, sumXY = 0, sumXX = 0;
+    for (auto&& [x, y] : points) {
+        sumX += x;
+        sumY += y;
+        sumXY += x * y;
+        sumXX += x * x;
+    }
+    const double incremental = (n * sumXY - sumX * sumY) / (n * sumXX - sumX * sumX);
+    const double startup = (sumY - incremental * sumX) / n;
+    return {std::max(startup, 0.0), std::max(incremental, 0.0)};
+}
+
+FittedCost fitPrimitive(PlanFactory makePlan) {
+    const std::vector<size_t> kSizes = {1'000, 4'000, 16'000, 64'000};
+
+    std::vector<std::pair<double, double>> points;
+    points.reserve(kSizes.size());
+    for (auto size : kSizes) {
+        points.emplace_back(static_cast<double>(size),
+                            measurePlanUs(makePlan, generateDocuments(size)));
+    }
+    return fitLinear(points);
+}
+
+BSONObj calibrateCoefficients() {
+    // Coefficients are expressed in milliseconds, matching 'initializeCoefficients()'.
+    constexpr double usToMs = 1.0e-3;
+
+    const auto scan = fitPrimitive(makeScanPlan);
+    const auto filter = fitPrimitive(makeFilterPlan);
+    const auto eval = fitPrimitive(makeEvalPlan);
+
+    // The filter and eval plans run on top of the scan, and the cost model composes per-stage
+    // costs, so their coefficients are the measured cost net of the child scan.
+    BSONObjBuilder bob;
+    bob.append("scanIncrementalCost", scan.incrementalUs * usToMs);
+    bob.append("scanStartupCost", scan.startupUs * usToMs);
+    bob.append("filterIncrementalCost",
+               std::max(filter.incrementalUs - scan.incrementalUs, 0.0) * usToMs);
+    bob.append("filterStartupCost", std::max(filter.startupUs - scan.startupUs, 0.0) * usToMs);
+    bob.append("evalIncrementalCost",
+               std::max(eval.incrementalUs - scan.incrementalUs, 0.0) * usToMs);
+    bob.append("evalStartupCost", std::max(eval.startupUs - scan.startupUs, 0.0) * usToMs);
+    return bob.obj();
+}
+
+void runPlanBenchmark(benchmark::State& state, PlanFactory makePlan) {
+    const auto docs = generateDocuments(state.range(0));
+    sbe::value::SlotIdGenerator slotIdGen;
+    auto plan = makePlan(docs, &slotIdGen);
+    sbe::CompileCtx ctx{std::make_unique<sbe::RuntimeEnvironment>()};
+    plan.root->prepare(ctx);
+    auto* accessor = plan.root->getAccessor(ctx, plan.outSlot);
+
+    for (auto keepRunning : state) {
+        plan.root->open(false);
+        benchmark::DoNotOptimize(drain(plan.root.get(), accessor));
+        plan.root->close();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Scan(benchmark::State& state) {
+    runPlanBenchmark(state, makeScanPlan);
+}
+
+void BM_Filter(benchmark::State& state) {
+    runPlanBenchmark(state, makeFilterPlan);
+}
+
+void BM_Eval(benchmark::State& state) {
+    runPlanBenchmark(state, makeEvalPlan);
+}
+
+void BM_CalibrateCostModel(benchmark::State& state) {
+    BSONObj overrides;
+    for (auto keepRunning : state) {
+        overrides = calibrateCoefficients();
+        benchmark::DoNotOptimize(overrides.objdata());
+    }
+    std::cout << "Calibrated cost model coefficient overrides; apply with "
+                 "{setParameter: 1, internalCostModelCoefficients: '<json>'}:\n"
+              << overrides.jsonString() << std::endl;
+}
+
+BENCHMARK(BM_Scan)->RangeMultiplier(4)->Range(1'000, 64'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Filter)->RangeMultiplier(4)->Range(1'000, 64'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Eval)->RangeMultiplier(4)->Range(1'000, 64'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CalibrateCostModel)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+}  // namespace
+}  // namespace mongo::cost_model
@@ -35,9 +35,13 @@
 #include "mongo/db/exec/sbe/stages/filter.h"
 #include "mongo/db/exec/sbe/stages/makeobj.h"
 #include "mongo/db/exec/sbe/stages/scan.h"
+#include "mongo/db/exec/sbe/stages/sort.h"
 #include "mongo/db/exec/sbe/values/slot.h"
 #include "mongo/db/exec/sbe/values/value.h"
+#include "mongo/db/exec/sbe/sort_spec.h"
+#include "mongo/db/pipeline/document_source_limit.h"
 #include "mongo/db/pipeline/document_source_single_document_transformation.h"
+#include "mongo/db/pipeline/document_source_sort.h"
 #include "mongo/db/query/cqf_command_utils.h"
 #include "mongo/db/query/cqf_fast_paths_utils.h"
 #include "mongo/db/query/plan_yield_policy_sbe.h"
@@ -149,22 +153,49 @@ bool canUseFastPath(const bool hasIndexHint,
             return dynamic_cast<const DocumentSourceMatch*>(stage) ||
                 dynamic_cast<const DocumentSourceSingleDocumentTransformation*>(stage);
         };
-        // The current fast path implementations only support pipelines with max two stages.
+        // A single-field, non-meta sort whose limit is known (either absorbed into the $sort
+        // during pipeline optimization or given by a trailing $limit stage) can be answered with
+        // a canned bounded top-k plan.
+        auto boundedSortStage = [](const DocumentSource* stage, bool hasTrailingLimit) {
+            const auto* sortStage = dynamic_cast<const DocumentSourceSort*>(stage);
+            if (!sortStage) {
+                return false;
+            }
+            const auto& sortPattern = sortStage->getSortKeyPattern();
+            if (sortPattern.size() != 1 || !sortPattern[0].fieldPath || sortPattern[0].expression) {
+                return false;
+            }
+            return hasTrailingLimit || sortStage->getLimit().has_value();
+        };
+        // The current fast path implementations only support pipelines with max three stages.
         //
         // Currently supported pipeline patterns:
         //  1) Pipeline: []
         //  2) Pipeline: [{$match: <Simple predicate>}]
         //  3) Pipeline: [{$project: <Simple projection>}]
         //  4) Pipeline: [{$match: <Simple predicate>}, {$project: <Simple projection>}]
-        if (sources.size() > 2)
+        //  5) Pipeline: [{$match: <Simple predicate>}, {$sort: <Single field>}, {$limit: <n>}]
+        //     (also with the $limit absorbed into the $sort)
+        if (sources.size() > 3)
             return false;
         if (sources.size() == 1 && !matchOrTransformationStage(sources.front().get()))
             return false;
-        if (sources.size() == 2 &&
-            (!dynamic_cast<const DocumentSourceMatch*>(sources.front().get()) ||
-             !dynamic_cast<const DocumentSourceSingleDocumentTransformation*>(
-                 sources.back().get())))
-            return false;
+        if (sources.size() == 2) {
+            auto it = sources.begin();
+            if (!dynamic_cast<const DocumentSourceMatch*>(it->get()))
+                return false;
+            const auto* secondStage = std::next(it)->get();
+            if (!dynamic_cast<const DocumentSourceSingleDocumentTransformation*>(secondStage) &&
+                !boundedSortStage(secondStage, false /*hasTrailingLimit*/))
+                return false;
+        }
+        if (sources.size() == 3) {
+            auto it = sources.begin();
+            if (!dynamic_cast<const DocumentSourceMatch*>(it->get()) ||
+                !boundedSortStage(std::next(it)->get(), true /*hasTrailingLimit*/) ||
+                !dynamic_cast<const DocumentSourceLimit*>(std::next(it, 2)->get()))
+                return false;
+        }
     }
     const bool isSharded = collections.isAcquisition()
         ? collections.getMainAcquisition().getShardingDescription().isSharded()
@@ -186,6 +217,39 @@ BSONObj extractQueryFilter(const CanonicalQuery* canonicalQuery, const Pipeline*
     tasserted(8217100, "Expected canonicalQuery or pipeline.");
 }
 
+struct PipelineSortAndLimit {
+    BSONObj sortPattern;
+    int64_t limit;
+};
+
+/**
+ * Extracts the sort pattern and limit from a '{$sort}, {$limit}' pipeline suffix (or a $sort with
+ * an absorbed limit). Assumes 'canUseFastPath()' has already verified the pipeline's shape.
+ */
+boost::optional<PipelineSortAndLimit> extractPipelineSortAndLimit(const Pipeline* pipeline) {
+    if (!pipeline) {
+        return boost::none;
+    }
+    for (auto it = pipeline->getSources().begin(); it != pipeline->getSources().end(); ++it) {
+        const auto* sortStage = dynamic_cast<const DocumentSourceSort*>(it->get());
+        if (!sortStage) {
+            continue;
+        }
+        const auto& part = sortStage->getSortKeyPattern()[0];
+        auto sortPattern = BSON(part.fieldPath->fullPath() << (part.isAscending ? 1 : -1));
+
+        auto limit = sortStage->getLimit();
+        if (auto next = std::next(it); !limit && next != pipeline->getSources().end()) {
+            const auto* limitStage = dynamic_cast<const DocumentSourceLimit*>(next->get());
+            tassert(8321507, "Expected a $limit stage after an unbounded $sort", limitStage);
+            limit = limitStage->getLimit();
+        }
+        tassert(8321508, "Expected a limit for a fast path sort", limit.has_value());
+        return PipelineSortAndLimit{std::move(sortPattern), static_cast<int64_t>(*limit)};
+    }
+    return boost::none;
+}
+
 inline void extractFromStage(DocumentSource* stage,
                              const bool emptyFilter,
                              bool& projExists,
@@ -256,15 +320,11 @@ std::vector<FieldRef> extractProjectedFields(const CanonicalQuery* canonicalQuer
     if (pipeline) {
         const auto& stages = pipeline->getSources();
         tassert(
-            805803, "The size of a Pipeline in CQF fast path cannot exceed 2", stages.size() <= 2);
-        if (stages.size() == 1) {
-            extractFromStage(
-                stages.front().get(), emptyFilter, projExists, projSupported, projectedFields);
-        } else if (stages.size() == 2) {
-            extractFromStage(
-                stages.front().get(), emptyFilter, projExists, projSupported, projectedFields);
-            extractFromStage(
-                stages.back().get(), emptyFilter, projExists, projSupported, projectedFields);
+            805803, "The size of a Pipeline in CQF fast path cannot exceed 3", stages.size() <= 3);
+        // 'extractFromStage' is a no-op for non-transformation stages such as $match, $sort and
+        // $limit.
+        for (const auto& stage : stages) {
+            extractFromStage(stage.get(), emptyFilter, projExists, projSupported, projectedFields);
         }
     }
 
@@ -594,9 +654,38 @@ public:
             std::move(lambdaExpr),
             EExprBuilder::makeBoolConstant(shouldCompareArray(props.constant)));
 
-        auto sbePlan = sbe::makeS<sbe::FilterStage<false>>(
+        std::unique_ptr<sbe::PlanStage> sbePlan = sbe::makeS<sbe::FilterStage<false>>(
             std::move(scanStage), std::move(traverseExpr), planNodeId);
 
+        if (!params.sortPattern.isEmpty()) {
+            // Compute a mem-comparable KeyString for each document so that the sort respects MQL
+            // ordering semantics (arrays, missing fields). Since the KeyString encodes the sort
+            // direction, the sort stage always orders ascending on it.
+            auto sortSpec = std::make_unique<sbe::SortSpec>(params.sortPattern);
+            auto sortKeyExpr = EExprBuilder::makeFunction(
+                "generateSortKey",
+                EExprBuilder::makeConstant(
+                    sbe::value::TypeTags::sortSpec,
+                    sbe::value::bitcastFrom<sbe::SortSpec*>(sortSpec.release())),
+                EExprBuilder::makeVariable(*staticData->resultSlot));
+            const auto sortKeySlot = ids.generate();
+            sbePlan = sbe::makeProjectStage(
+                std::move(sbePlan), planNodeId, sortKeySlot, std::move(sortKeyExpr));
+
+            tassert(8321509, "Expected a limit for a fast path sort", params.limit.has_value());
+            sbePlan = sbe::makeS<sbe::SortStage>(
+                std::move(sbePlan),
+                sbe::makeSV(sortKeySlot),
+                std::vector<sbe::value::SortDirection>{sbe::value::SortDirection::Ascending},
+                sbe::makeSV(*staticData->resultSlot),
+                EExprBuilder::makeConstant(sbe::value::TypeTags::NumberInt64,
+                                           sbe::value::bitcastFrom<int64_t>(*params.limit)),
+                internalQueryMaxBlockingSortMemoryUsageBytes.load(),
+                params.allowDiskUse,
+                params.yieldPolicy,
+                planNodeId);
+        }
+
         stage_builder::PlanStageData data{
             stage_builder::Environment{std::make_unique<sbe::RuntimeEnvironment>()},
             std::move(staticData)};
@@ -726,6 +815,10 @@ const ExecTreeGenerator* getFastPathExecTreeGenerator(const ExecTreeGeneratorPar
     const auto& fields = params.projectFields;
     // Check if 'projectedFields' is eligible for EmptyQueryExecTreeGenerator.
     if (dynamic_cast<EmptyQueryExecTreeGenerator*>(generatorIt->second.get())) {
+        if (!params.sortPattern.isEmpty()) {
+            // Only the single-predicate generator can honor a pushed-down sort and limit.
+            return nullptr;
+        }
         // Bail out if there is a projection but not yet supported.
         if (!params.projSupported || fields.size() > 2)
             return nullptr;
@@ -773,12 +866,19 @@ boost::optional<ExecParams> tryGetSBEExecutorViaFastPath(
     std::unique_ptr<PlanYieldPolicySBE> sbeYieldPolicy =
         PlanYieldPolicySBE::make(opCtx, PlanYieldPolicy::YieldPolicy::YIELD_AUTO, collections, nss);
 
+    const auto sortAndLimit = extractPipelineSortAndLimit(pipeline);
+
     ExecTreeGeneratorParams params{collections.getMainCollection()->uuid(),
                                    sbeYieldPolicy.get(),
                                    filter,
                                    projection,
                                    projExists,
-                                   projSupported};
+                                   projSupported,
+                                   sortAndLimit ? sortAndLimit->sortPattern : BSONObj{},
+                                   sortAndLimit
+                                       ? boost::optional<int64_t>{sortAndLimit->limit}
+                                       : boost::none,
+                                   expCtx->allowDiskUse};
 
     auto generator = getFastPathExecTreeGenerator(params);
     if (!generator) {
@@ -64,6 +64,11 @@ struct ExecTreeGeneratorParams {
     const bool projExists;
     // If 'false' there exists a non-simple projection. Shortcut for 'EmptyQueryExecTreeGenerator'.
     const bool projSupported;
+    // Sort pattern and limit extracted from a trailing '{$sort}, {$limit}' pipeline suffix, if
+    // present. Only fast paths that can honor them may be selected.
+    const BSONObj sortPattern;
+    const boost::optional<int64_t> limit;
+    const bool allowDiskUse = false;
 };
 
 using ExecTreeResult = std::pair<std::unique_ptr<sbe::PlanStage>, stage_builder::PlanStageData>;
@@ -613,8 +613,12 @@ std::unique_ptr<CardinalityEstimator> createCardinalityEstimator(
     bool collectionExists,
     const QueryParameterMap& queryParameters) {
 
-    // TODO: SERVER-70241: Handle "auto" estimation mode.
-    if (internalQueryCardinalityEstimatorMode == ce::kSampling) {
+    // In "auto" mode we choose the estimator per collection: sampling reads the live collection at
+    // plan time, so it is preferred whenever the collection is large enough for a sample to be
+    // meaningful; for smaller collections plans differ little and heuristics are free. Histograms
+    // are never chosen automatically since they require a manual analyze to exist.
+    if (internalQueryCardinalityEstimatorMode == ce::kSampling ||
+        internalQueryCardinalityEstimatorMode == ce::kAuto) {
         if (collectionExists && collectionSize > internalCascadesOptimizerSampleSizeMin.load()) {
             return std::make_unique<SamplingEstimator>(
                 createSamplingPhaseManager(
@@ -52,7 +52,10 @@
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/lru_cache.h"
+#include "mongo/util/static_immortal.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kQuery
 
@@ -148,6 +151,85 @@ void ExpressionMapping::cover2dsphere(const S2Region& region,
     S2CellIdsToIntervalsWithParents(cover, indexingParams, oilOut);
 }
 
+namespace {
+
+// Geometries larger than this are not cached; the key would cost more memory than the
+// covering computation is worth.
+constexpr int kMaxCachedGeometrySize = 8 * 1024;
+
+/**
+ * A bounded LRU cache of S2 coverings keyed by the raw geometry bytes and the covering
+ * knobs. Coverings for the same region computed under different knob values are distinct
+ * entries; a stale entry is never incorrect, merely a differently-granular covering of the
+ * same region.
+ */
+class S2CoveringCache {
+public:
+    using Covering = std::shared_ptr<const std::vector<S2CellId>>;
+
+    Covering find(const std::string& key) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        auto it = _cache.find(key);
+        if (it == _cache.end()) {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    void add(std::string key, Covering covering) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _cache.add(std::move(key), std::move(covering));
+    }
+
+private:
+    Mutex _mutex = MONGO_MAKE_LATCH("S2CoveringCache::_mutex");
+    LRUCache<std::string, Covering> _cache{
+        static_cast<size_t>(gInternalQueryS2CoveringCacheSize)};
+};
+
+std::string makeCoveringCacheKey(const BSONElement& geoElement,
+                                 int minLevel,
+                                 int maxLevel,
+                                 int maxCells) {
+    std::string key;
+    key.reserve(geoElement.valuesize() + 3 * sizeof(int));
+    key.append(geoElement.value(), geoElement.valuesize());
+    key.append(reinterpret_cast<const char*>(&minLevel), sizeof(minLevel));
+    key.append(reinterpret_cast<const char*>(&maxLevel), sizeof(maxLevel));
+    key.append(reinterpret_cast<const char*>(&maxCells), sizeof(maxCells));
+    return key;
+}
+
+}  // namespace
+
+void ExpressionMapping::cover2dsphere(const S2Region& region,
+                                      const BSONElement& geoElement,
+                                      const S2IndexingParams& indexingParams,
+                                      OrderedIntervalList* oilOut) {
+    if (gInternalQueryS2CoveringCacheSize == 0 || geoElement.eoo() ||
+        geoElement.valuesize() > kMaxCachedGeometrySize) {
+        cover2dsphere(region, indexingParams, oilOut);
+        return;
+    }
+
+    static StaticImmortal<S2CoveringCache> cache;
+
+    auto key = makeCoveringCacheKey(geoElement,
+                                    gInternalQueryS2GeoCoarsestLevel.load(),
+                                    gInternalQueryS2GeoFinestLevel.load(),
+                                    gInternalQueryS2GeoMaxCells.load());
+
+    auto covering = cache->find(key);
+    if (!covering) {
+        covering = std::make_shared<const std::vector<S2CellId>>(get2dsphereCovering(region));
+        cache->add(std::move(key), covering);
+    }
+
+    // Interval generation depends on the index parameters, which are not part of the cache
+    // key, so it is redone per query from the cached covering.
+    S2CellIdsToIntervalsWithParents(*covering, indexingParams, oilOut);
+}
+
 namespace {
 bool compareIntervals(const Interval& a, const Interval& b) {
     return a.precedes(b);
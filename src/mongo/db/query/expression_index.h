@@ -83,6 +83,19 @@ public:
     static void cover2dsphere(const S2Region& region,
                               const S2IndexingParams& indexParams,
                               OrderedIntervalList* oilOut);
+
+    /**
+     * As above, but consults a process-wide cache of coverings keyed by the raw bytes of
+     * 'geoElement' (the query geometry 'region' was parsed from) and the covering knobs. A
+     * covering is a pure function of those inputs, so workloads that issue repeated queries
+     * over a fixed set of geometries (e.g. geofences) skip the S2 covering computation.
+     * Falls back to an uncached covering when the cache is disabled or the geometry is too
+     * large to be worth keying on.
+     */
+    static void cover2dsphere(const S2Region& region,
+                              const BSONElement& geoElement,
+                              const S2IndexingParams& indexParams,
+                              OrderedIntervalList* oilOut);
 };
 
 }  // namespace mongo
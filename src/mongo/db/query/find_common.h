@@ -129,13 +129,15 @@ public:
                               CursorResponseBuilder* builder,
                               ResourceConsumption::DocumentUnitCounter* docUnitsReturned,
                               BSONObj& pbrt,
-                              bool& failedToAppend)
+                              bool& failedToAppend,
+                              const size_t byteBudget = kMaxBytesToReturnToClientAtOnce)
             : _alwaysAcceptFirstDoc{alwaysAcceptFirstDoc},
               _exec{exec},
               _builder{builder},
               _docUnitsReturned{docUnitsReturned},
               _pbrt{pbrt},
-              _failedToAppend{failedToAppend} {}
+              _failedToAppend{failedToAppend},
+              _byteBudget{byteBudget} {}
 
         BSONObjCursorAppender(const BSONObjCursorAppender&) = default;
         ~BSONObjCursorAppender() = default;
@@ -146,8 +148,9 @@ public:
                                                      const size_t numAppended) {
             objSize = obj.objsize();
 
-            if (MONGO_unlikely(!(_alwaysAcceptFirstDoc && numAppended == 0) &&
-                               !FindCommon::fitsInBatch(_builder->bytesUsed(), objSize))) {
+            if (MONGO_unlikely(
+                    !(_alwaysAcceptFirstDoc && numAppended == 0) &&
+                    !FindCommon::fitsInBatch(_builder->bytesUsed(), objSize, _byteBudget))) {
                 // We failed to append to batch; we should stash & early out. We don't want to
                 // update the resume token here.
                 _failedToAppend = true;
@@ -171,13 +174,24 @@ public:
         ResourceConsumption::DocumentUnitCounter* _docUnitsReturned;
         BSONObj& _pbrt;
         bool& _failedToAppend;
+        const size_t _byteBudget;
 
         // State within append() calls.
         size_t objSize;
     };
 
     MONGO_COMPILER_ALWAYS_INLINE static bool fitsInBatch(size_t bytesBuffered, size_t objSize) {
-        return (bytesBuffered + objSize) <= kMaxBytesToReturnToClientAtOnce;
+        return fitsInBatch(bytesBuffered, objSize, kMaxBytesToReturnToClientAtOnce);
+    }
+
+    /**
+     * As above, but with an explicit byte budget, which may be smaller than the default when
+     * adaptive getMore reply sizing has shrunk the budget of a slowly consumed cursor.
+     */
+    MONGO_COMPILER_ALWAYS_INLINE static bool fitsInBatch(size_t bytesBuffered,
+                                                         size_t objSize,
+                                                         size_t byteBudget) {
+        return (bytesBuffered + objSize) <= byteBudget;
     }
 
     /**
@@ -1161,7 +1161,8 @@ void IndexBoundsBuilder::_translatePredicate(const MatchExpression* expr,
             const S2Region& region = gme->getGeoExpression().getGeometry().getS2Region();
             S2IndexingParams indexParams;
             ExpressionParams::initialize2dsphereParams(index.infoObj, index.collator, &indexParams);
-            ExpressionMapping::cover2dsphere(region, indexParams, oilOut);
+            ExpressionMapping::cover2dsphere(
+                region, gme->getGeoExpression().getGeometry().getGeoElement(), indexParams, oilOut);
             *tightnessOut = IndexBoundsBuilder::INEXACT_FETCH;
         } else if ("2d" == elt.valueStringDataSafe()) {
             MONGO_verify(gme->getGeoExpression().getGeometry().hasR2Region());
@@ -1187,7 +1188,8 @@ void IndexBoundsBuilder::_translatePredicate(const MatchExpression* expr,
             const S2Region& region = ibgwme->getGeoContainer().getS2Region();
             S2IndexingParams indexParams;
             ExpressionParams::initialize2dsphereParams(index.infoObj, index.collator, &indexParams);
-            ExpressionMapping::cover2dsphere(region, indexParams, oilOut);
+            ExpressionMapping::cover2dsphere(
+                region, ibgwme->getGeoContainer().getGeoElement(), indexParams, oilOut);
             *tightnessOut = IndexBoundsBuilder::INEXACT_FETCH;
         } else {
             LOGV2_WARNING(5837102,
@@ -1283,43 +1285,44 @@ void IndexBoundsBuilder::unionize(OrderedIntervalList* oilOut) {
     // Step 1: sort.
     std::sort(iv.begin(), iv.end(), IntervalComparison);
 
-    // Step 2: Walk through and merge.
-    size_t i = 0;
-    while (i < iv.size() - 1) {
-        // Compare i with i + 1.
-        Interval::IntervalComparison cmp = iv[i].compare(iv[i + 1]);
+    // Step 2: Merge in a single pass, compacting into the prefix of 'iv'. 'out' is the index of
+    // the last merged interval; each candidate either extends it, is swallowed by it, replaces it,
+    // or starts a new merged interval. Erasing from the middle of the vector instead, as a naive
+    // implementation would, costs quadratic element moves on the large interval lists produced by
+    // geo covers and $in.
+    size_t out = 0;
+    for (size_t i = 1; i < iv.size(); ++i) {
+        Interval::IntervalComparison cmp = iv[out].compare(iv[i]);
 
         // This means our sort didn't work.
         MONGO_verify(Interval::INTERVAL_SUCCEEDS != cmp);
 
-        // Intervals are correctly ordered.
         if (Interval::INTERVAL_PRECEDES == cmp) {
-            // We can move to the next pair.
-            ++i;
+            // Intervals are correctly ordered and disjoint; iv[i] starts a new merged interval.
+            if (++out != i) {
+                iv[out] = std::move(iv[i]);
+            }
         } else if (Interval::INTERVAL_EQUALS == cmp || Interval::INTERVAL_WITHIN == cmp) {
-            // Interval 'i' is equal to i+1, or is contained within i+1.
-            // Remove interval i and don't move to the next value of 'i'.
-            iv.erase(iv.begin() + i);
+            // The merged interval is equal to, or contained within, iv[i]; iv[i] replaces it.
+            iv[out] = std::move(iv[i]);
         } else if (Interval::INTERVAL_CONTAINS == cmp) {
-            // Interval 'i' contains i+1, remove i+1 and don't move to the next value of 'i'.
-            iv.erase(iv.begin() + i + 1);
+            // The merged interval contains iv[i]; drop iv[i].
         } else if (Interval::INTERVAL_OVERLAPS_BEFORE == cmp ||
                    Interval::INTERVAL_PRECEDES_COULD_UNION == cmp) {
-            // We want to merge intervals i and i+1.
-            // Interval 'i' starts before interval 'i+1'.
+            // The merged interval starts before iv[i] and they overlap or abut; extend the merged
+            // interval to iv[i]'s end.
             BSONObjBuilder bob;
-            bob.appendAs(iv[i].start, "");
-            bob.appendAs(iv[i + 1].end, "");
+            bob.appendAs(iv[out].start, "");
+            bob.appendAs(iv[i].end, "");
             BSONObj data = bob.obj();
-            bool startInclusive = iv[i].startInclusive;
-            bool endInclusive = iv[i + 1].endInclusive;
-            iv.erase(iv.begin() + i);
-            // iv[i] is now the former iv[i + 1]
-            iv[i] = makeRangeInterval(
-                data, IndexBounds::makeBoundInclusionFromBoundBools(startInclusive, endInclusive));
-            // Don't increment 'i'.
+            iv[out] = makeRangeInterval(data,
+                                        IndexBounds::makeBoundInclusionFromBoundBools(
+                                            iv[out].startInclusive, iv[i].endInclusive));
+        } else {
+            MONGO_UNREACHABLE;
         }
     }
+    iv.resize(out + 1);
 }
 
 // static
@@ -200,10 +200,15 @@ public:
     size_t add(const K& key, V entry) {
         KVMapConstIt i = _kvMap.find(&key);
         if (i != _kvMap.end()) {
+            // Replace the value in place and splice the existing list node to the front. The node
+            // is not reallocated, so the key pointer stored in '_kvMap' remains valid.
             KVListIt found = i->second;
-            _budgetTracker.onRemove(key, found->second);
-            _kvMap.erase(i);
-            _kvList.erase(found);
+            _budgetTracker.onRemove(found->first, found->second);
+            found->second = std::move(entry);
+            _budgetTracker.onAdd(found->first, found->second);
+            _kvList.splice(_kvList.begin(), _kvList, found);
+
+            return evict();
         }
 
         _budgetTracker.onAdd(key, entry);
@@ -226,10 +231,10 @@ public:
         KVListIt found = i->second;
 
         // Promote the kv-store entry to the front of the list. It is now the most recently used.
-        const auto& newEntry = _kvList.emplace_front(key, std::move(found->second));
-        _kvMap.erase(i);
-        _kvList.erase(found);
-        _kvMap[&newEntry.first] = _kvList.begin();
+        // Splicing moves the existing list node without copying the key, allocating, or touching
+        // '_kvMap': the node's address is unchanged and 'found' continues to refer to it, which
+        // keeps the time spent under the partition lock of a concurrent caller to a minimum.
+        _kvList.splice(_kvList.begin(), _kvList, found);
 
         return _kvList.begin();
     }
@@ -63,6 +63,7 @@
 #include "mongo/db/query/plan_explainer_impl.h"
 #include "mongo/db/query/plan_insert_listener.h"
 #include "mongo/db/query/plan_yield_policy_impl.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/stage_types.h"
 #include "mongo/db/query/yield_policy_callbacks_impl.h"
 #include "mongo/db/repl/optime.h"
@@ -161,6 +162,10 @@ PlanExecutorImpl::PlanExecutorImpl(OperationContext* opCtx,
     if (auto collectionScan = getStageByType(_root.get(), STAGE_COLLSCAN)) {
         _collScanStage = static_cast<CollectionScan*>(collectionScan);
     }
+
+    if (const auto batchSize = internalQueryExecWorkBatchSize.load(); batchSize > 0) {
+        _workBatch.emplace(static_cast<size_t>(batchSize));
+    }
 }
 
 PlanExecutorImpl::~PlanExecutorImpl() {
@@ -198,6 +203,11 @@ void PlanExecutorImpl::saveState() {
         _root->saveState();
     }
 
+    // Buffered batch results may reference storage-engine memory that does not survive a yield.
+    if (_workBatch) {
+        _workBatch->makeObjsOwned(_workingSet.get());
+    }
+
     if (!_yieldPolicy->usesCollectionAcquisitions()) {
         _yieldPolicy->setYieldable(nullptr);
     }
@@ -356,7 +366,19 @@ PlanExecutor::ExecState PlanExecutorImpl::_getNextImpl(Snapshotted<Document>* ob
         }
 
         WorkingSetID id = WorkingSet::INVALID_ID;
-        PlanStage::StageState code = _root->work(&id);
+        PlanStage::StageState code;
+        if (_workBatch && objOut && !dlOut) {
+            // Batched execution: move documents through the plan a whole batch per dispatch and
+            // hand them out one at a time. Yield and interrupt checks run between batches rather
+            // than between documents.
+            code = _workBatch->empty() ? _root->workBatch(_workBatch.get_ptr())
+                                       : PlanStage::ADVANCED;
+            if (PlanStage::ADVANCED == code) {
+                id = _workBatch->pop();
+            }
+        } else {
+            code = _root->work(&id);
+        }
 
         if (code != PlanStage::NEED_YIELD) {
             writeConflictsInARow = 0;
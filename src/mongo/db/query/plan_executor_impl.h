@@ -47,6 +47,7 @@
 #include "mongo/db/exec/plan_stage.h"
 #include "mongo/db/exec/plan_stats.h"
 #include "mongo/db/exec/working_set.h"
+#include "mongo/db/exec/working_set_batch.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/ops/update_result.h"
@@ -282,6 +283,11 @@ private:
     // stages.
     std::deque<Document> _stash;
 
+    // When batched execution is enabled via 'internalQueryExecWorkBatchSize', holds results the
+    // plan produced ahead of what getNext() has handed out. Buffered members are made owned
+    // before a yield in saveState().
+    boost::optional<WorkingSetBatch> _workBatch;
+
     // The output document that is used by getNext BSON API. This allows us to avoid constantly
     // allocating and freeing DocumentStorage.
     Document _docOutput;
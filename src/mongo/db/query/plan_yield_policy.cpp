@@ -239,6 +239,8 @@ void PlanYieldPolicy::performYield(OperationContext* opCtx,
         whileYieldingFn();
     }
 
+    runBatonWhileYielded(opCtx);
+
     locker->restoreLockState(opCtx, snapshot);
 
     // A yield has occurred, but there still may not be a 'yieldable' if the PlanExecutor
@@ -247,6 +249,21 @@ void PlanYieldPolicy::performYield(OperationContext* opCtx,
     yieldable.restore();
 }
 
+void PlanYieldPolicy::runBatonWhileYielded(OperationContext* opCtx) const {
+    if (MONGO_likely(!internalQueryExecYieldDrainsBaton.load())) {
+        return;
+    }
+
+    // The yield has already released the query's locks and storage snapshot, so the thread would
+    // otherwise sit idle until the yield round trip completes. Use that window to run any
+    // callbacks that are already ready on the operation's baton (e.g. scheduled networking work),
+    // instead of leaving them for the next blocking wait. Running with a deadline of "now" drains
+    // only the ready work and never blocks waiting for more.
+    if (const auto& baton = opCtx->getBaton()) {
+        baton->run_until(_fastClock, _fastClock->now());
+    }
+}
+
 void PlanYieldPolicy::performYieldWithAcquisitions(OperationContext* opCtx,
                                                    std::function<void()> whileYieldingFn) {
     // Things have to happen here in a specific order:
@@ -279,6 +296,8 @@ void PlanYieldPolicy::performYieldWithAcquisitions(OperationContext* opCtx,
         whileYieldingFn();
     }
 
+    runBatonWhileYielded(opCtx);
+
     yieldFailedScopeGuard.dismiss();
     restoreTransactionResourcesToOperationContext(opCtx, std::move(yieldedTransactionResources));
 }
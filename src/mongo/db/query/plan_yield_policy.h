@@ -341,6 +341,13 @@ private:
     void performYieldWithAcquisitions(OperationContext* opCtx,
                                       std::function<void()> whileYieldingFn);
 
+    /**
+     * Runs the ready callbacks scheduled on the operation's baton, if any, while the query's locks
+     * and storage snapshot are released. Only has an effect when the
+     * 'internalQueryExecYieldDrainsBaton' knob is enabled.
+     */
+    void runBatonWhileYielded(OperationContext* opCtx) const;
+
     const YieldPolicy _policy;
     std::variant<const Yieldable*, YieldThroughAcquisitions> _yieldable;
     std::unique_ptr<const YieldPolicyCallbacks> _callbacks;
@@ -78,6 +78,7 @@
 #include "mongo/db/pipeline/field_path.h"
 #include "mongo/db/pipeline/search/search_helper.h"
 #include "mongo/db/query/canonical_query.h"
+#include "mongo/db/query/canonical_query_encoder.h"
 #include "mongo/db/query/classic_plan_cache.h"
 #include "mongo/db/query/collation/collation_index_key.h"
 #include "mongo/db/query/collation/collator_interface.h"
@@ -2065,6 +2066,14 @@ StatusWith<std::unique_ptr<QuerySolution>> QueryPlanner::choosePlanForSubqueries
     QueryPlanner::SubqueriesPlanningResult planningResult,
     std::function<StatusWith<std::unique_ptr<QuerySolution>>(
         CanonicalQuery* cq, std::vector<unique_ptr<QuerySolution>>)> multiplanCallback) {
+    // Branches of a rooted $or often share a shape within a single query: the same access-path
+    // predicates composed with different constants. The plan cache lets later queries reuse a
+    // branch's winning plan, but does nothing for repeated shapes within this call, so remember
+    // the winning index assignments per branch shape and apply them to later branches directly.
+    // Reusing a plan for an equal shape is the same policy the plan cache itself follows.
+    absl::node_hash_map<CanonicalQuery::QueryShapeString, std::unique_ptr<SolutionCacheData>>
+        plannedBranchShapes;
+
     for (size_t i = 0; i < planningResult.orExpression->numChildren(); ++i) {
         auto orChild = planningResult.orExpression->getChild(i);
         auto branchResult = planningResult.branches[i].get();
@@ -2097,6 +2106,19 @@ StatusWith<std::unique_ptr<QuerySolution>> QueryPlanner::choosePlanForSubqueries
 
             invariant(!branchResult->solutions.empty());
 
+            // If an earlier branch with the same shape was already multi-planned in this call,
+            // reuse its winning index assignments instead of ranking this branch from scratch.
+            const auto branchShape =
+                canonical_query_encoder::encodeClassic(*branchResult->canonicalQuery);
+            if (auto it = plannedBranchShapes.find(branchShape); it != plannedBranchShapes.end()) {
+                Status tagStatus = tagOrChildAccordingToCache(
+                    it->second.get(), orChild, planningResult.indexMap);
+                if (!tagStatus.isOK()) {
+                    return tagStatus;
+                }
+                continue;
+            }
+
             auto multiPlanStatus = multiplanCallback(branchResult->canonicalQuery.get(),
                                                      std::move(branchResult->solutions));
             if (!multiPlanStatus.isOK()) {
@@ -2139,6 +2161,8 @@ StatusWith<std::unique_ptr<QuerySolution>> QueryPlanner::choosePlanForSubqueries
                     ss << "Failed to extract indices from subchild " << orChild->debugString();
                     return tagStatus.withContext(ss);
                 }
+
+                plannedBranchShapes.emplace(branchShape, bestSoln->cacheData->clone());
             }
         }
     }
@@ -29,6 +29,8 @@
 
 #include "mongo/db/query/query_stats/aggregated_metric.h"
 
+#include <algorithm>
+
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobjbuilder.h"
 
@@ -38,6 +40,25 @@ template void AggregatedMetric<uint64_t>::appendTo(BSONObjBuilder& builder,
                                                    StringData fieldName) const;
 }  // namespace agg_metric_detail
 
+void LatencyDistribution::appendTo(BSONObjBuilder& builder, StringData fieldName) const {
+    const bool empty =
+        std::all_of(_buckets.begin(), _buckets.end(), [](uint64_t count) { return count == 0; });
+    if (empty) {
+        return;
+    }
+
+    BSONArrayBuilder arrayBuilder{builder.subarrayStart(fieldName)};
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+        if (_buckets[i] == 0) {
+            continue;
+        }
+        BSONObjBuilder{arrayBuilder.subobjStart()}
+            .append("lowerBoundMicros",
+                    static_cast<long long>(i == 0 ? 0 : (1ULL << i)))
+            .append("count", static_cast<long long>(_buckets[i]));
+    }
+}
+
 void AggregatedBool::appendTo(BSONObjBuilder& builder, StringData fieldName) const {
     BSONObjBuilder{builder.subobjStart(fieldName)}
         .append("true"_sd, static_cast<long long>(trueCount))
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <concepts>
 #include <cstdint>
 #include <limits>
@@ -37,6 +38,7 @@
 
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/platform/bits.h"
 #include "mongo/platform/decimal128.h"
 #include "mongo/util/summation.h"
 
@@ -161,6 +163,43 @@ public:
     using agg_metric_detail::AggregatedMetric<T>::AggregatedMetric;
 };
 
+/**
+ * A compact base-2 latency distribution. Bucket i counts observations in [2^i, 2^(i+1))
+ * microseconds, with bucket 0 also covering zero and the last bucket absorbing everything
+ * slower (~35 minutes and up). One bit-scan and one increment per observation and a fixed 256
+ * bytes per entry keeps it cheap enough to be always on, while giving enough resolution to read
+ * per-shape tail percentiles instead of inferring them from the mean and variance.
+ */
+class LatencyDistribution {
+public:
+    static constexpr size_t kNumBuckets = 32;
+
+    /**
+     * Aggregate an observed value into the distribution.
+     */
+    void aggregate(uint64_t micros) {
+        ++_buckets[bucketFor(micros)];
+    }
+
+    /**
+     * Appends the distribution as an array of {lowerBoundMicros, count} documents, skipping
+     * empty buckets. Appends nothing when no observations have been aggregated, so entries
+     * predating the distribution serialize unchanged.
+     */
+    void appendTo(BSONObjBuilder& builder, StringData fieldName) const;
+
+    static size_t bucketFor(uint64_t micros) {
+        if (micros == 0) {
+            return 0;
+        }
+        const size_t log2 = 63 - countLeadingZeros64(micros);
+        return std::min(log2, kNumBuckets - 1);
+    }
+
+private:
+    std::array<uint64_t, kNumBuckets> _buckets{};
+};
+
 /**
  * An aggregated metric that counts frequency of different boolean values.
  */
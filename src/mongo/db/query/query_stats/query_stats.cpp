@@ -241,6 +241,7 @@ void updateStatistics(const QueryStatsStore::Partition& proofOfLock,
     toUpdate.lastExecutionMicros = snapshot.queryExecMicros;
     toUpdate.execCount++;
     toUpdate.totalExecMicros.aggregate(snapshot.queryExecMicros);
+    toUpdate.totalExecMicrosDistribution.aggregate(snapshot.queryExecMicros);
     toUpdate.firstResponseExecMicros.aggregate(snapshot.firstResponseExecMicros);
     toUpdate.docsReturned.aggregate(snapshot.docsReturned);
 
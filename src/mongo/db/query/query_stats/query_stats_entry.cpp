@@ -41,6 +41,7 @@ BSONObj QueryStatsEntry::toBSON(bool includeDiskUsageMetrics) const {
     builder.append("lastExecutionMicros", (long long)lastExecutionMicros);
     builder.append("execCount", (long long)execCount);
     totalExecMicros.appendTo(builder, "totalExecMicros");
+    totalExecMicrosDistribution.appendTo(builder, "totalExecMicrosDistribution");
     firstResponseExecMicros.appendTo(builder, "firstResponseExecMicros");
     docsReturned.appendTo(builder, "docsReturned");
 
@@ -82,6 +82,12 @@ struct QueryStatsEntry {
      */
     AggregatedMetric<uint64_t> totalExecMicros;
 
+    /**
+     * Base-2 distribution of the total execution time, so per-shape tail percentiles can be
+     * read directly rather than inferred from the mean and variance above.
+     */
+    LatencyDistribution totalExecMicrosDistribution;
+
     /**
      * Aggregates the time for execution for first batch only.
      */
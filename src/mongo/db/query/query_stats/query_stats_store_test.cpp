@@ -1472,6 +1472,43 @@ BSONObj toBSON(AggregatedMetric<T>& am) {
     return builder.obj();
 }
 
+TEST(LatencyDistributionTest, Basic) {
+    LatencyDistribution dist;
+
+    // Empty distributions append nothing.
+    {
+        BSONObjBuilder builder;
+        dist.appendTo(builder, "d");
+        ASSERT_BSONOBJ_EQ(builder.obj(), BSONObj());
+    }
+
+    // Zero and one land in bucket 0; values share a bucket with their power-of-two lower bound;
+    // values beyond the largest bucket saturate into it.
+    ASSERT_EQ(LatencyDistribution::bucketFor(0), 0u);
+    ASSERT_EQ(LatencyDistribution::bucketFor(1), 0u);
+    ASSERT_EQ(LatencyDistribution::bucketFor(2), 1u);
+    ASSERT_EQ(LatencyDistribution::bucketFor(3), 1u);
+    ASSERT_EQ(LatencyDistribution::bucketFor(1024), 10u);
+    ASSERT_EQ(LatencyDistribution::bucketFor(std::numeric_limits<uint64_t>::max()),
+              LatencyDistribution::kNumBuckets - 1);
+
+    dist.aggregate(0);
+    dist.aggregate(1);
+    dist.aggregate(1000);
+    dist.aggregate(1024);
+
+    {
+        BSONObjBuilder builder;
+        dist.appendTo(builder, "d");
+        ASSERT_BSONOBJ_EQ(builder.obj(),
+                          BSON("d" << BSON_ARRAY(BSON("lowerBoundMicros" << 0LL << "count" << 2LL)
+                                                 << BSON("lowerBoundMicros" << 512LL << "count"
+                                                                            << 1LL)
+                                                 << BSON("lowerBoundMicros" << 1024LL << "count"
+                                                                            << 1LL))));
+    }
+}
+
 TEST(AggBool, Basic) {
 
     AggregatedBool ab;
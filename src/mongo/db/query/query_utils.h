@@ -69,7 +69,9 @@ inline bool isIdHackEligibleQuery(const CollectionPtr& collection,
 /**
  * Returns 'true' if 'query' on the given 'collection' can be answered using a special IXSCAN +
  * FETCH plan. Among other restrictions, the query must be a single-field equality generating exact
- * bounds.
+ * bounds. A simple projection does not disqualify the query; the express executor applies simple
+ * projections to the fetched document itself. Callers are expected to have already rejected
+ * non-simple projections.
  */
 inline bool isEqualityExpressEligibleQuery(const CollectionPtr& collection,
                                            const CanonicalQuery& cq) {
@@ -84,7 +86,7 @@ inline bool isEqualityExpressEligibleQuery(const CollectionPtr& collection,
         // Properties of the find command.
         !findCommand.getShowRecordId() && findCommand.getHint().isEmpty() &&
         findCommand.getMin().isEmpty() && findCommand.getMax().isEmpty() &&
-        findCommand.getProjection().isEmpty() && findCommand.getSort().isEmpty() &&
+        findCommand.getSort().isEmpty() &&
         !findCommand.getSkip() && !findCommand.getTailable() &&
         // Properties of the query's match expression.
         me->matchType() == MatchExpression::EQ &&
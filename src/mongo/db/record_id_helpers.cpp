@@ -121,7 +121,10 @@ StatusWith<RecordId> keyForDoc(const BSONObj& doc,
                 str::stream() << "Document " << redact(doc) << " is missing the '"
                               << clusterKeyField << "' field"};
     }
-    if (collator) {
+    // Only pay for the collation-aware rewrite when the collator can actually change the key. The
+    // common clustered key types (ObjectId, date, numerics) are unaffected by collation, so this
+    // keeps the collator off the hot encoding path for them.
+    if (collator && CollationIndexKey::isCollatableType(keyElement.type())) {
         BSONObjBuilder out;
         CollationIndexKey::collationAwareIndexKeyAppend(keyElement, collator, &out);
         return keyForElem(out.done().firstElement());
@@ -134,9 +137,19 @@ RecordId keyForElem(const BSONElement& elem) {
     // Intentionally discard the TypeBits since the type information will be stored in the cluster
     // key of the original document. The consequence of this behavior is that cluster key values
     // that compare similarly, but are of different types may not be used concurrently.
-    key_string::Builder keyBuilder(key_string::Version::kLatestVersion);
-    keyBuilder.appendBSONElement(elem);
-    return RecordId(keyBuilder.getBuffer(), keyBuilder.getSize());
+    switch (elem.type()) {
+        // Dispatch the common clustered key types to their dedicated encoders up front, skipping
+        // the generic BSONElement value dispatch inside the builder.
+        case jstOID:
+            return keyForOID(elem.OID());
+        case Date:
+            return keyForDate(elem.date());
+        default: {
+            key_string::Builder keyBuilder(key_string::Version::kLatestVersion);
+            keyBuilder.appendBSONElement(elem);
+            return RecordId(keyBuilder.getBuffer(), keyBuilder.getSize());
+        }
+    }
 }
 
 RecordId keyForObj(const BSONObj& obj) {
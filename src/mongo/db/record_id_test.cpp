@@ -36,10 +36,12 @@
 #include "mongo/bson/oid.h"
 #include "mongo/db/record_id_helpers.h"
 #include "mongo/db/storage/key_format.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/death_test.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/util/debug_util.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 namespace {
@@ -163,6 +165,22 @@ TEST(RecordId, OidTestCompare) {
     ASSERT_GT(oidMax, rid0);
 }
 
+TEST(RecordId, KeyForElemMatchesGenericEncoding) {
+    // The fast paths in keyForElem must produce keys identical to the generic element encoding;
+    // persisted clustered RecordIds depend on the encoding staying stable.
+    auto genericKey = [](const BSONObj& obj) {
+        key_string::Builder keyBuilder(key_string::Version::kLatestVersion);
+        keyBuilder.appendBSONElement(obj.firstElement());
+        return RecordId(keyBuilder.getBuffer(), keyBuilder.getSize());
+    };
+
+    const auto oidObj = BSON("" << OID::gen());
+    ASSERT_EQ(record_id_helpers::keyForElem(oidObj.firstElement()), genericKey(oidObj));
+
+    const auto dateObj = BSON("" << Date_t::now());
+    ASSERT_EQ(record_id_helpers::keyForElem(dateObj.firstElement()), genericKey(dateObj));
+}
+
 TEST(RecordId, ReservationsLong) {
     // It's important that reserved IDs like this never change.
     RecordId ridReserved(RecordId::kMaxRepr - (1024 * 1024));
@@ -31,6 +31,7 @@
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
 // IWYU pragma: no_include "ext/alloc_traits.h"
+#include <algorithm>
 #include <list>
 #include <mutex>
 
@@ -38,16 +39,21 @@
 #include "mongo/base/status.h"
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonelement.h"
+#include "mongo/db/client.h"
 #include "mongo/db/commands/list_collections_filter.h"
 #include "mongo/db/repl/database_cloner.h"
 #include "mongo/db/repl/database_cloner_gen.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
+#include "mongo/db/repl/replication_auth.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/storage_engine.h"
 #include "mongo/idl/idl_parser.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/stdx/unordered_set.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/clock_source.h"
@@ -71,7 +77,15 @@ DatabaseCloner::DatabaseCloner(const DatabaseName& dbName,
     : InitialSyncBaseCloner(
           "DatabaseCloner"_sd, sharedData, source, client, storageInterface, dbPool),
       _dbName(dbName),
-      _listCollectionsStage("listCollections", this, &DatabaseCloner::listCollectionsStage) {
+      _listCollectionsStage("listCollections", this, &DatabaseCloner::listCollectionsStage),
+      _makeWorkerClientFn([this] {
+          auto workerClient = std::make_unique<DBClientConnection>(true /* autoReconnect */);
+          workerClient->connect(getSource(), StringData(), boost::none);
+          uassertStatusOK(replAuthenticate(workerClient.get())
+                              .withContext(str::stream()
+                                           << "Failed to authenticate to " << getSource()));
+          return workerClient;
+      }) {
     invariant(!dbName.isEmpty());
     _stats.dbname = dbName;
 }
@@ -153,6 +167,19 @@ void DatabaseCloner::postStage() {
             _stats.collectionStats.back().nss = coll.first;
         }
     }
+    const size_t numWorkers =
+        std::min(static_cast<size_t>(initialSyncCollectionClonerConcurrency.load()),
+                 _collections.size());
+    const bool allClonesSucceeded =
+        numWorkers > 1 ? _cloneCollectionsConcurrently(numWorkers) : _cloneCollectionsSerially();
+    // Abort the database cloner if a collection clone failed.
+    if (!allClonesSucceeded)
+        return;
+    stdx::lock_guard<Latch> lk(_mutex);
+    _stats.end = getSharedData()->getClock()->now();
+}
+
+bool DatabaseCloner::_cloneCollectionsSerially() {
     for (const auto& coll : _collections) {
         auto& sourceNss = coll.first;
         auto& collectionOptions = coll.second;
@@ -185,14 +212,89 @@ void DatabaseCloner::postStage() {
             stdx::lock_guard<Latch> lk(_mutex);
             _stats.collectionStats[_stats.clonedCollections] = _currentCollectionCloner->getStats();
             _currentCollectionCloner = nullptr;
-            // Abort the database cloner if the collection clone failed.
             if (!collStatus.isOK())
-                return;
+                return false;
             _stats.clonedCollections++;
         }
     }
-    stdx::lock_guard<Latch> lk(_mutex);
-    _stats.end = getSharedData()->getClock()->now();
+    return true;
+}
+
+bool DatabaseCloner::_cloneCollectionsConcurrently(size_t numWorkers) {
+    LOGV2(9958800,
+          "Cloning collections concurrently",
+          logAttrs(_dbName),
+          "numWorkers"_attr = numWorkers,
+          "collections"_attr = _collections.size());
+    AtomicWord<size_t> nextCollection{0};
+    AtomicWord<bool> failed{false};
+    std::vector<stdx::thread> workers;
+    workers.reserve(numWorkers);
+    for (size_t workerId = 0; workerId < numWorkers; ++workerId) {
+        workers.emplace_back([&, workerId] {
+            Client::initThread(std::string(str::stream() << "CollectionClonerWorker-" << workerId),
+                               getGlobalServiceContext()->getService());
+            std::unique_ptr<DBClientConnection> workerClient;
+            try {
+                workerClient = _makeWorkerClientFn();
+            } catch (const DBException& e) {
+                LOGV2_ERROR(9958801,
+                            "Failed to open cloning connection to sync source",
+                            logAttrs(_dbName),
+                            "error"_attr = e.toString());
+                setSyncFailedStatus(e.toStatus().withContext(
+                    str::stream() << "Error opening cloning connection to sync source '"
+                                  << getSource() << "'"));
+                failed.store(true);
+                return;
+            }
+            while (!failed.load()) {
+                const auto idx = nextCollection.fetchAndAdd(1);
+                if (idx >= _collections.size())
+                    break;
+                auto& sourceNss = _collections[idx].first;
+                auto& collectionOptions = _collections[idx].second;
+                auto collectionCloner = std::make_unique<CollectionCloner>(sourceNss,
+                                                                           collectionOptions,
+                                                                           getSharedData(),
+                                                                           getSource(),
+                                                                           workerClient.get(),
+                                                                           getStorageInterface(),
+                                                                           getDBPool());
+                {
+                    stdx::lock_guard<Latch> lk(_mutex);
+                    _activeCollectionCloners[idx] = collectionCloner.get();
+                }
+                auto collStatus = collectionCloner->run();
+                {
+                    stdx::lock_guard<Latch> lk(_mutex);
+                    _stats.collectionStats[idx] = collectionCloner->getStats();
+                    _activeCollectionCloners.erase(idx);
+                    if (collStatus.isOK())
+                        _stats.clonedCollections++;
+                }
+                if (collStatus.isOK()) {
+                    LOGV2_DEBUG(9958802, 1, "Collection clone finished", logAttrs(sourceNss));
+                } else {
+                    LOGV2_ERROR(9958803,
+                                "Collection clone failed",
+                                logAttrs(sourceNss),
+                                "error"_attr = collStatus.toString());
+                    setSyncFailedStatus(
+                        {ErrorCodes::InitialSyncFailure,
+                         collStatus
+                             .withContext(str::stream() << "Error cloning collection '"
+                                                        << sourceNss.toStringForErrorMsg() << "'")
+                             .toString()});
+                    failed.store(true);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return !failed.load();
 }
 
 DatabaseCloner::Stats DatabaseCloner::getStats() const {
@@ -201,6 +303,9 @@ DatabaseCloner::Stats DatabaseCloner::getStats() const {
     if (_currentCollectionCloner) {
         stats.collectionStats[_stats.clonedCollections] = _currentCollectionCloner->getStats();
     }
+    for (const auto& [idx, activeCloner] : _activeCollectionCloners) {
+        stats.collectionStats[idx] = activeCloner->getStats();
+    }
     return stats;
 }
 
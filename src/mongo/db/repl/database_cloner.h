@@ -30,6 +30,7 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -46,6 +47,7 @@
 #include "mongo/db/repl/initial_sync_base_cloner.h"
 #include "mongo/db/repl/initial_sync_shared_data.h"
 #include "mongo/db/repl/storage_interface.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/database_name_util.h"
 #include "mongo/util/net/hostandport.h"
@@ -102,10 +104,25 @@ private:
 
     /**
      * The postStage creates and runs the individual CollectionCloners on each database found on
-     * the sync source, and sets the end time in _stats when done.
+     * the sync source, and sets the end time in _stats when done. When
+     * 'initialSyncCollectionClonerConcurrency' is greater than 1, collections are cloned
+     * concurrently by worker threads which each open their own connection to the sync source;
+     * otherwise they are cloned serially over the shared connection.
      */
     void postStage() final;
 
+    /**
+     * Clones the collections in '_collections' one at a time using the shared client.
+     * Returns false if a collection clone failed and the database clone should be aborted.
+     */
+    bool _cloneCollectionsSerially();
+
+    /**
+     * Clones the collections in '_collections' using 'numWorkers' threads, each with its own
+     * connection to the sync source. Returns false if any collection clone failed.
+     */
+    bool _cloneCollectionsConcurrently(size_t numWorkers);
+
     std::string describeForFuzzer(BaseClonerStage* stage) const final {
         return toStringForLogging(_dbName) + " db: { " + stage->getName() + ": 1 } ";
     }
@@ -123,7 +140,15 @@ private:
     ClonerStage<DatabaseCloner> _listCollectionsStage;                        // (R)
     std::vector<std::pair<NamespaceString, CollectionOptions>> _collections;  // (X)
     std::unique_ptr<CollectionCloner> _currentCollectionCloner;               // (MX)
-    Stats _stats;                                                             // (MX)
+
+    // Cloners currently running on worker threads, keyed by the index of their collection in
+    // '_collections'. Only populated while cloning concurrently.
+    stdx::unordered_map<size_t, CollectionCloner*> _activeCollectionCloners;  // (M)
+
+    // Factory for per-worker connections; overridable for testing.
+    std::function<std::unique_ptr<DBClientConnection>()> _makeWorkerClientFn;  // (R)
+
+    Stats _stats;  // (MX)
 };
 
 }  // namespace repl
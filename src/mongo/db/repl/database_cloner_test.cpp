@@ -45,8 +45,10 @@
 #include "mongo/db/repl/initial_sync_cloner_test_fixture.h"
 #include "mongo/db/repl/storage_interface_mock.h"
 #include "mongo/db/tenant_id.h"
+#include "mongo/dbtests/mock/mock_dbclient_connection.h"
 #include "mongo/dbtests/mock/mock_remote_db_server.h"
 #include "mongo/idl/server_parameter_test_util.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/bson_test_util.h"
@@ -126,6 +128,11 @@ protected:
         return cloner->_collections;
     }
 
+    void setWorkerClientFactory(DatabaseCloner* cloner,
+                                std::function<std::unique_ptr<DBClientConnection>()> factoryFn) {
+        cloner->_makeWorkerClientFn = std::move(factoryFn);
+    }
+
     std::map<NamespaceString, CollectionCloneInfo> _collections;
 
     DatabaseName _dbName;
@@ -416,6 +423,79 @@ TEST_F(DatabaseClonerTest, CreateCollections) {
     ASSERT(stats.commitCalled);
 }
 
+TEST_F(DatabaseClonerTest, ConcurrentCollectionCloning) {
+    RAIIServerParameterControllerForTest concurrencyController(
+        "initialSyncCollectionClonerConcurrency", 2);
+    auto uuid1 = UUID::gen();
+    auto uuid2 = UUID::gen();
+    const BSONObj idIndexSpec = BSON("v" << 1 << "key" << BSON("_id" << 1) << "name"
+                                         << "_id_");
+    const std::vector<BSONObj> sourceInfos = {BSON("name"
+                                                   << "a"
+                                                   << "type"
+                                                   << "collection"
+                                                   << "options" << BSONObj() << "info"
+                                                   << BSON("readOnly" << false << "uuid" << uuid1)),
+                                              BSON(
+                                                  "name"
+                                                  << "b"
+                                                  << "type"
+                                                  << "collection"
+                                                  << "options" << BSONObj() << "info"
+                                                  << BSON("readOnly" << false << "uuid" << uuid2))};
+    _mockServer->setCommandReply("listCollections",
+                                 createListCollectionsResponse({sourceInfos[0], sourceInfos[1]}));
+    // The collection cloner pre-stage makes a remote call to collStats to store in-progress
+    // metrics.
+    _mockServer->setCommandReply("collStats", BSON("size" << 0));
+    _mockServer->setCommandReply("count", {createCountResponse(0), createCountResponse(0)});
+    _mockServer->setCommandReply(
+        "listIndexes",
+        {createCursorResponse(_dbName.toString_forTest() + ".a", BSON_ARRAY(idIndexSpec)),
+         createCursorResponse(_dbName.toString_forTest() + ".b", BSON_ARRAY(idIndexSpec))});
+
+    // The worker threads create their collections concurrently; guard the shared test map.
+    Mutex collectionsMutex = MONGO_MAKE_LATCH("ConcurrentCollectionCloning::collectionsMutex");
+    _storageInterface.createCollectionForBulkFn =
+        [&](const NamespaceString& nss,
+            const CollectionOptions& options,
+            const BSONObj& idIndexSpec,
+            const std::vector<BSONObj>& secondaryIndexSpecs)
+        -> StatusWith<std::unique_ptr<CollectionBulkLoaderMock>> {
+        stdx::lock_guard<Latch> lk(collectionsMutex);
+        const auto collInfo = &_collections[nss];
+
+        auto localLoader = std::make_unique<CollectionBulkLoaderMock>(collInfo->stats);
+        auto status = localLoader->init(secondaryIndexSpecs);
+        if (!status.isOK())
+            return status;
+        collInfo->loader = localLoader.get();
+
+        return std::move(localLoader);
+    };
+
+    auto cloner = makeDatabaseCloner();
+    // Each worker gets its own connection to the mock sync source.
+    setWorkerClientFactory(cloner.get(), [this] {
+        return std::make_unique<MockDBClientConnection>(_mockServer.get(),
+                                                        true /* autoReconnect */);
+    });
+    auto status = cloner->run();
+    ASSERT_OK(status);
+
+    ASSERT_EQUALS(2U, _collections.size());
+
+    auto collInfo = _collections[NamespaceString::createNamespaceString_forTest(_dbName, "a")];
+    ASSERT(collInfo.stats->commitCalled);
+    collInfo = _collections[NamespaceString::createNamespaceString_forTest(_dbName, "b")];
+    ASSERT(collInfo.stats->commitCalled);
+
+    auto stats = cloner->getStats();
+    ASSERT_EQUALS(2U, stats.collections);
+    ASSERT_EQUALS(2U, stats.clonedCollections);
+    ASSERT_EQUALS(2U, stats.collectionStats.size());
+}
+
 TEST_F(DatabaseClonerTest, DatabaseAndCollectionStats) {
     auto uuid1 = UUID::gen();
     auto uuid2 = UUID::gen();
@@ -798,7 +798,8 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
     std::vector<OplogEntry>* ops,
     std::vector<std::vector<ApplierOperation>>* writerVectors,
     std::vector<std::vector<OplogEntry>>* derivedOps,
-    SessionUpdateTracker* sessionUpdateTracker) noexcept {
+    SessionUpdateTracker* sessionUpdateTracker,
+    CachedCollectionProperties* collPropertiesCache) noexcept {
 
     // Caches partial transaction operations. Each map entry contains a cumulative list
     // of operations seen in this batch so far.
@@ -824,8 +825,6 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
         return &emptyPartialTxnOps;  // cleared in _addOplogChainOpsToWriterVectors().
     };
 
-    CachedCollectionProperties collPropertiesCache;
-
     RetryImageRectifier retryImageRectifier;
 
     for (auto&& op : *ops) {
@@ -843,7 +842,7 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
                 OplogApplierUtils::addDerivedOps(opCtx,
                                                  &derivedOps->back(),
                                                  writerVectors,
-                                                 &collPropertiesCache,
+                                                 collPropertiesCache,
                                                  false /*serial*/);
             }
 
@@ -900,7 +899,7 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
                                                  partialTxnList,
                                                  derivedOps,
                                                  writerVectors,
-                                                 &collPropertiesCache,
+                                                 collPropertiesCache,
                                                  &retryImageRectifier);
                 invariant(partialTxnList->empty(), op.toStringForLogging());
             } else {
@@ -910,7 +909,7 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
 
                 // Nested entries cannot have different session updates.
                 OplogApplierUtils::addDerivedOps(
-                    opCtx, &extractedOps, writerVectors, &collPropertiesCache, false /*serial*/);
+                    opCtx, &extractedOps, writerVectors, collPropertiesCache, false /*serial*/);
             }
             continue;
         }
@@ -924,7 +923,7 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
                                              partialTxnList,
                                              derivedOps,
                                              writerVectors,
-                                             &collPropertiesCache,
+                                             collPropertiesCache,
                                              &retryImageRectifier);
             continue;
         }
@@ -934,7 +933,7 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
         if (op.isPreparedCommitOrAbort() &&
             (getOptions().mode == OplogApplication::Mode::kSecondary)) {
             OplogApplierUtils::addDerivedCommitsOrAborts(
-                opCtx, &op, writerVectors, &collPropertiesCache);
+                opCtx, &op, writerVectors, collPropertiesCache);
             continue;
         }
 
@@ -948,16 +947,16 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
                                              partialTxnList,
                                              derivedOps,
                                              writerVectors,
-                                             &collPropertiesCache,
+                                             collPropertiesCache,
                                              &retryImageRectifier);
             invariant(partialTxnList->empty(), op.toStringForLogging());
             continue;
         }
 
-        OplogApplierUtils::addToWriterVector(opCtx, &op, writerVectors, &collPropertiesCache);
+        OplogApplierUtils::addToWriterVector(opCtx, &op, writerVectors, collPropertiesCache);
     }
     retryImageRectifier.handleLatestDeletes([&](OplogEntry* op) {
-        OplogApplierUtils::addToWriterVector(opCtx, op, writerVectors, &collPropertiesCache);
+        OplogApplierUtils::addToWriterVector(opCtx, op, writerVectors, collPropertiesCache);
     });
 }
 
@@ -967,13 +966,19 @@ void OplogApplierImpl::_fillWriterVectors(
     std::vector<std::vector<ApplierOperation>>* writerVectors,
     std::vector<std::vector<OplogEntry>>* derivedOps) noexcept {
     SessionUpdateTracker sessionUpdateTracker;
-    _deriveOpsAndFillWriterVectors(opCtx, ops, writerVectors, derivedOps, &sessionUpdateTracker);
+
+    // The cache must span both passes below so that ops for the same document end up in the same
+    // writer vector even when some of them are derived from the session update tracker flush.
+    CachedCollectionProperties collPropertiesCache;
+
+    _deriveOpsAndFillWriterVectors(
+        opCtx, ops, writerVectors, derivedOps, &sessionUpdateTracker, &collPropertiesCache);
 
     auto newOplogWrites = sessionUpdateTracker.flushAll();
     if (!newOplogWrites.empty()) {
         derivedOps->emplace_back(std::move(newOplogWrites));
         _deriveOpsAndFillWriterVectors(
-            opCtx, &derivedOps->back(), writerVectors, derivedOps, nullptr);
+            opCtx, &derivedOps->back(), writerVectors, derivedOps, nullptr, &collPropertiesCache);
     }
 }
 
@@ -57,6 +57,8 @@
 namespace mongo {
 namespace repl {
 
+class CachedCollectionProperties;
+
 /**
  * Applies oplog entries.
  * Primarily used to apply batches of operations fetched from a sync source during steady state
@@ -120,7 +122,8 @@ private:
                                         std::vector<OplogEntry>* ops,
                                         std::vector<std::vector<ApplierOperation>>* writerVectors,
                                         std::vector<std::vector<OplogEntry>>* derivedOps,
-                                        SessionUpdateTracker* sessionUpdateTracker) noexcept;
+                                        SessionUpdateTracker* sessionUpdateTracker,
+                                        CachedCollectionProperties* collPropertiesCache) noexcept;
 
     void _fillWriterVectors(OperationContext* opCtx,
                             std::vector<OplogEntry>* ops,
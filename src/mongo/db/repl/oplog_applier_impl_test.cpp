@@ -192,9 +192,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
         NamespaceString::createNamespaceString_forTest(boost::none, "test.t");
     NamespaceString otherNss = NamespaceString::createNamespaceString_forTest("test.othername");
     auto op = makeOplogEntry(OpTypeEnum::kDelete, otherNss, {});
-    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     ASSERT_EQ(1, postDeleteFromMissing - prevDeleteFromMissing);
 
     ASSERT_EQ(postDeleteFromMissing,
@@ -232,9 +232,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     NamespaceString otherNss =
         NamespaceString::createNamespaceString_forTest(nss.getSisterNS("othername"));
     auto op = makeOplogEntry(OpTypeEnum::kDelete, otherNss, kUuid);
-    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     ASSERT_EQ(1, postDeleteFromMissing - prevDeleteFromMissing);
 
     ASSERT_EQ(postDeleteFromMissing,
@@ -277,10 +277,10 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     // which in the case of this test just ignores such errors. This tests mostly that we don't
     // implicitly create the collection.
     auto op = makeOplogEntry(OpTypeEnum::kDelete, nss, {});
-    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
     ASSERT_FALSE(collectionExists(_opCtx.get(), nss));
-    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     ASSERT_EQ(1, postDeleteFromMissing - prevDeleteFromMissing);
 
     ASSERT_EQ(postDeleteFromMissing,
@@ -314,9 +314,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     const NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.t");
     repl::createCollection(_opCtx.get(), nss, {});
     auto op = makeOplogEntry(OpTypeEnum::kDelete, nss, {});
-    int prevDeleteWasEmpty = replOpCounters.getDeleteWasEmpty()->load();
+    int prevDeleteWasEmpty = replOpCounters.getDeleteWasEmpty();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postDeleteWasEmpty = replOpCounters.getDeleteWasEmpty()->load();
+    auto postDeleteWasEmpty = replOpCounters.getDeleteWasEmpty();
     ASSERT_EQ(1, postDeleteWasEmpty - prevDeleteWasEmpty);
 
     ASSERT_EQ(postDeleteWasEmpty,
@@ -354,9 +354,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     auto uuid = createCollectionWithUuid(_opCtx.get(), nss);
     ASSERT_OK(getStorageInterface()->insertDocument(_opCtx.get(), nss, {BSON("_id" << 0)}, 0));
     auto op = makeOplogEntry(OpTypeEnum::kInsert, nss, uuid);
-    int prevInsertOnExistingDoc = replOpCounters.getInsertOnExistingDoc()->load();
+    int prevInsertOnExistingDoc = replOpCounters.getInsertOnExistingDoc();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postInsertOnExistingDoc = replOpCounters.getInsertOnExistingDoc()->load();
+    auto postInsertOnExistingDoc = replOpCounters.getInsertOnExistingDoc();
     ASSERT_EQ(1, postInsertOnExistingDoc - prevInsertOnExistingDoc);
 
     ASSERT_EQ(postInsertOnExistingDoc,
@@ -385,9 +385,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
                              update_oplog_entry::makeDeltaOplogEntry(
                                  BSON(doc_diff::kUpdateSectionFieldName << fromjson("{a: 1}"))),
                              BSON("_id" << 0));
-    int prevUpdateOnMissingDoc = replOpCounters.getUpdateOnMissingDoc()->load();
+    int prevUpdateOnMissingDoc = replOpCounters.getUpdateOnMissingDoc();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, true);
-    auto postUpdateOnMissingDoc = replOpCounters.getUpdateOnMissingDoc()->load();
+    auto postUpdateOnMissingDoc = replOpCounters.getUpdateOnMissingDoc();
     ASSERT_EQ(1, postUpdateOnMissingDoc - prevUpdateOnMissingDoc);
 
     ASSERT_EQ(postUpdateOnMissingDoc,
@@ -432,9 +432,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     NamespaceString otherNss =
         NamespaceString::createNamespaceString_forTest(nss.getSisterNS("othername"));
     auto op = makeOplogEntry(OpTypeEnum::kDelete, otherNss, options.uuid);
-    int prevDeleteWasEmpty = replOpCounters.getDeleteWasEmpty()->load();
+    int prevDeleteWasEmpty = replOpCounters.getDeleteWasEmpty();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postDeleteWasEmpty = replOpCounters.getDeleteWasEmpty()->load();
+    auto postDeleteWasEmpty = replOpCounters.getDeleteWasEmpty();
     ASSERT_EQ(1, postDeleteWasEmpty - prevDeleteWasEmpty);
 
     ASSERT_EQ(postDeleteWasEmpty,
@@ -1265,6 +1265,56 @@ TEST_F(OplogApplierImplTest,
                   secondDerivedOp.getObject()["lastWriteOpTime"]["ts"].timestamp());
 }
 
+TEST_F(OplogApplierImplTest, FillWriterVectorsBalancesSingleCollectionAcrossAllWriters) {
+    NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.balanced");
+
+    auto workerPool = makeReplWorkerPool();
+    NoopOplogApplierObserver observer;
+    OplogApplierImpl oplogApplier(
+        nullptr,  // executor
+        nullptr,  // oplogBuffer
+        &observer,
+        ReplicationCoordinator::get(_opCtx.get()),
+        getConsistencyMarkers(),
+        getStorageInterface(),
+        repl::OplogApplier::Options(repl::OplogApplication::Mode::kSecondary, false),
+        workerPool.get());
+
+    // Two ops per document, all to the same collection. The two ops for each document must be
+    // applied in order and so must land in the same writer vector, but distinct documents are
+    // free to spread over the entire writer pool regardless of how their hashes collide.
+    const size_t numWriters = workerPool->getStats().options.maxThreads;
+    std::vector<OplogEntry> ops;
+    for (size_t i = 0; i < numWriters; ++i) {
+        const auto id = static_cast<int>(i);
+        ops.push_back(makeInsertDocumentOplogEntry(
+            {Timestamp(Seconds(1), static_cast<unsigned>(2 * i + 1)), 1LL},
+            nss,
+            BSON("_id" << id)));
+        ops.push_back(makeUpdateDocumentOplogEntry(
+            {Timestamp(Seconds(1), static_cast<unsigned>(2 * i + 2)), 1LL},
+            nss,
+            BSON("_id" << id),
+            BSON("_id" << id << "a" << 1)));
+    }
+
+    std::vector<std::vector<ApplierOperation>> writerVectors(numWriters);
+    std::vector<std::vector<OplogEntry>> derivedOps;
+    oplogApplier.fillWriterVectors_forTest(_opCtx.get(), &ops, &writerVectors, &derivedOps);
+
+    for (auto& writer : writerVectors) {
+        // Balanced writer assignment gives every writer its own document, even if the document
+        // hashes collide modulo the number of writers.
+        ASSERT_EQ(2U, writer.size());
+        // Both ops for a document stay on the writer the document was first assigned to.
+        for (size_t i = 0; i < writer.size(); i += 2) {
+            ASSERT_EQ(OpTypeEnum::kInsert, writer[i]->getOpType());
+            ASSERT_EQ(OpTypeEnum::kUpdate, writer[i + 1]->getOpType());
+            ASSERT_EQ(0, writer[i]->getIdElement().woCompare(writer[i + 1]->getIdElement()));
+        }
+    }
+}
+
 TEST_F(OplogApplierImplTest, applyOplogEntryOrGroupedInsertsInsertDocumentIncludesTenantId) {
     setServerParameter("multitenancySupport", true);
     setServerParameter("featureFlagRequireTenantID", true);
@@ -2307,14 +2357,14 @@ TEST_F(MultiOplogEntryOplogApplierImplTest, MultiApplyTwoTransactionsOneBatch) {
     // Note the insert counter so we can check it later.  It is necessary to use opCounters as
     // inserts are idempotent so we will not detect duplicate inserts just by checking inserts in
     // the opObserver.
-    int insertsBefore = replOpCounters.getInsert()->load();
+    int insertsBefore = replOpCounters.getInsert();
     // Insert all the oplog entries in one batch.  All inserts should be executed, in order, exactly
     // once.
     ASSERT_OK(oplogApplier.applyOplogBatch(
         _opCtx.get(),
         {insertOps1[0], insertOps1[1], commitOp1, insertOps2[0], insertOps2[1], commitOp2}));
     ASSERT_EQ(6U, oplogDocs().size());
-    ASSERT_EQ(4, replOpCounters.getInsert()->load() - insertsBefore);
+    ASSERT_EQ(4, replOpCounters.getInsert() - insertsBefore);
     ASSERT_EQ(4U, _insertedDocs[_nss1].size());
     checkTxnTable(_lsid,
                   txnNum2,
@@ -5211,10 +5261,10 @@ TEST_F(IdempotencyTestDisableSteadyStateConstraints, AcceptableErrorsRecordedInS
     auto emptyCappedOp = makeCommandOplogEntry(nextOpTime(), _nss, emptyCappedCmd);
 
     // Ensure that NamespaceNotFound is "acceptable" but counted.
-    int prevAcceptableError = replOpCounters.getAcceptableErrorInCommand()->load();
+    int prevAcceptableError = replOpCounters.getAcceptableErrorInCommand();
     ASSERT_OK(runOpSteadyState(emptyCappedOp));
 
-    auto postAcceptableError = replOpCounters.getAcceptableErrorInCommand()->load();
+    auto postAcceptableError = replOpCounters.getAcceptableErrorInCommand();
     ASSERT_EQ(1, postAcceptableError - prevAcceptableError);
 
     ASSERT_EQ(postAcceptableError,
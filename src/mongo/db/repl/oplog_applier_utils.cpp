@@ -84,6 +84,7 @@
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/logv2/redaction.h"
+#include "mongo/platform/compiler.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/decorable.h"
 #include "mongo/util/fail_point.h"
@@ -115,6 +116,28 @@ CachedCollectionProperties::getCollectionProperties(OperationContext* opCtx,
     return collProperties;
 }
 
+uint32_t CachedCollectionProperties::assignWriterId(
+    uint32_t hash, const std::vector<std::vector<ApplierOperation>>& writerVectors) {
+    if (auto it = _writerAssignments.find(hash); it != _writerAssignments.end()) {
+        return it->second;
+    }
+
+    // This is the first op with this document hash in the batch, so we are free to pick any
+    // writer for it. Start at the bucket the hash maps to and pick the least loaded writer,
+    // bailing out early if we find an empty one.
+    uint32_t writerId = hash % writerVectors.size();
+    auto minLoad = writerVectors[writerId].size();
+    for (uint32_t id = 0; id < writerVectors.size() && minLoad > 0; ++id) {
+        if (writerVectors[id].size() < minLoad) {
+            writerId = id;
+            minLoad = writerVectors[id].size();
+        }
+    }
+
+    _writerAssignments.emplace(hash, writerId);
+    return writerId;
+}
+
 namespace {
 /**
  * Populates a CRUD op's idHash and updates the isForCappedCollection field if necessary.
@@ -152,15 +175,26 @@ void processCrudOp(OperationContext* opCtx,
 
 /**
  * Returns the ID of the writer thread that this op will be assigned to, determined by the
- * namespace string (and document key if exists) of the op.
+ * namespace string (and document key if exists) of the op. With balanced assignment enabled,
+ * the first op for a given document in the batch instead picks the least loaded writer and
+ * subsequent ops for the same document follow it; see
+ * CachedCollectionProperties::assignWriterId().
  */
 uint32_t getWriterId(OperationContext* opCtx,
                      OplogEntry* op,
                      CachedCollectionProperties* collPropertiesCache,
-                     uint32_t numWriters,
+                     const std::vector<std::vector<ApplierOperation>>& writerVectors,
                      boost::optional<uint32_t> forceWriterId = boost::none) {
+    // Always compute the hash: getOplogEntryHash() also populates op fields such as
+    // isForCappedCollection as a side effect.
     auto hash = OplogApplierUtils::getOplogEntryHash(opCtx, op, collPropertiesCache);
-    return (forceWriterId ? *forceWriterId : hash) % numWriters;
+    if (forceWriterId) {
+        return *forceWriterId % writerVectors.size();
+    }
+    if (MONGO_likely(replWriterBalancedWriterAssignment.load())) {
+        return collPropertiesCache->assignWriterId(hash, writerVectors);
+    }
+    return hash % writerVectors.size();
 }
 
 /**
@@ -247,7 +281,7 @@ uint32_t OplogApplierUtils::addToWriterVector(
     CachedCollectionProperties* collPropertiesCache,
     boost::optional<uint32_t> forceWriterId) {
     auto writerId =
-        getWriterId(opCtx, op, collPropertiesCache, writerVectors->size(), forceWriterId);
+        getWriterId(opCtx, op, collPropertiesCache, *writerVectors, forceWriterId);
     return addToWriterVectorImpl(writerId, writerVectors, op);
 }
 
@@ -319,7 +353,7 @@ void OplogApplierUtils::addDerivedPrepares(
         // prepare op (as the prepares in initial sync or recovery mode) is so that we can keep a
         // logical invariant that all prepares in secondary mode are split, and thus we can apply
         // empty and non-empty prepares in the same way.
-        auto writerId = getWriterId(opCtx, prepareOp, collPropertiesCache, writerVectors->size());
+        auto writerId = getWriterId(opCtx, prepareOp, collPropertiesCache, *writerVectors);
         const auto& sessionInfos = splitSessFunc({writerId});
         addToWriterVectorImpl(writerId,
                               writerVectors,
@@ -337,7 +371,7 @@ void OplogApplierUtils::addDerivedPrepares(
         std::vector<std::vector<const OplogEntry*>> bufWriterVectors(writerVectors->size());
         boost::optional<uint32_t> serialWriterId;
         for (auto&& op : *derivedOps) {
-            auto writerId = getWriterId(opCtx, &op, collPropertiesCache, writerVectors->size());
+            auto writerId = getWriterId(opCtx, &op, collPropertiesCache, *writerVectors);
             if (serial && !serialWriterId) {
                 serialWriterId.emplace(writerId);
                 writerIds.emplace(*serialWriterId);
@@ -52,8 +52,9 @@ class OpCounters;
 namespace repl {
 
 /**
- * Caches per-collection properties which are relevant for oplog application, so that they don't
- * have to be retrieved repeatedly for each op.
+ * Caches per-batch state which is relevant for oplog application: per-collection properties, so
+ * that they don't have to be retrieved repeatedly for each op, and the writer thread assignments
+ * made so far for the batch. One instance must not be shared between batches.
  */
 class CachedCollectionProperties {
 public:
@@ -66,8 +67,21 @@ public:
     CollectionProperties getCollectionProperties(OperationContext* opCtx,
                                                  const NamespaceString& nss);
 
+    /**
+     * Returns the ID of the writer thread that ops with the given document hash should be
+     * assigned to. The first op seen for a given hash in the batch is assigned to the least
+     * loaded writer; subsequent ops with the same hash follow it, which preserves the apply
+     * order of each document while letting a single hot collection spread over the entire
+     * writer pool instead of the few buckets its document hashes happen to collide into.
+     */
+    uint32_t assignWriterId(uint32_t hash,
+                            const std::vector<std::vector<ApplierOperation>>& writerVectors);
+
 private:
     stdx::unordered_map<NamespaceString, CollectionProperties> _cache;
+
+    // Maps the document hash of ops seen so far in this batch to their assigned writer ID.
+    stdx::unordered_map<uint32_t, uint32_t> _writerAssignments;
 };
 
 /**
@@ -140,6 +140,11 @@ auto& readersCreatedStats = *MetricBuilder<Counter64>{"repl.network.readersCreat
 
 const Milliseconds maximumAwaitDataTimeoutMS = Seconds{30};
 
+// A reply at least this large is considered "full", i.e. limited by the sync source's response
+// size cutoff rather than by oplog availability, which implies that the next exhaust reply is
+// already in flight with more data.
+constexpr long long kOplogFetcherFullReplyThresholdBytes = BSONObjMaxUserSize / 2;
+
 /**
  * Calculates await data timeout based on the current replica set configuration.
  */
@@ -786,8 +791,32 @@ StatusWith<OplogFetcher::Documents> OplogFetcher::_getNextBatch() {
             }
             _cursor->more();
         }
-        while (_cursor->moreInCurrentBatch()) {
-            batch.emplace_back(_cursor->nextSafe());
+        auto readCurrentReply = [&]() {
+            long long replyBytes = 0;
+            while (_cursor->moreInCurrentBatch()) {
+                batch.emplace_back(_cursor->nextSafe());
+                replyBytes += batch.back().objsize();
+            }
+            return replyBytes;
+        };
+
+        auto lastReplyBytes = readCurrentReply();
+
+        // Speculative read-ahead: a full reply means the sync source has more oplog entries
+        // immediately available and, on the exhaust path, the next reply is already in flight.
+        // Draining such replies into the current batch keeps a high-latency link saturated
+        // instead of letting the socket back up while each reply is handed off individually,
+        // and amortizes the per-batch processing overhead. A reply below the threshold means
+        // the source is about to be caught up, in which case we must not block waiting for the
+        // next reply as that would delay the entries we already have.
+        const auto readAheadBudget = oplogFetcherReadAheadBudgetBytes.load();
+        auto totalReplyBytes = lastReplyBytes;
+        while (!_firstBatch && _cursor->isExhaust() && _cursor->connectionHasPendingReplies() &&
+               lastReplyBytes >= kOplogFetcherFullReplyThresholdBytes &&
+               totalReplyBytes < readAheadBudget) {
+            _cursor->more();
+            lastReplyBytes = readCurrentReply();
+            totalReplyBytes += lastReplyBytes;
         }
 
         // This value is only used on a successful batch for metrics.repl.network.getmores. This
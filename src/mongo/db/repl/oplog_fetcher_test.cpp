@@ -149,6 +149,30 @@ BSONObj makeNoopOplogEntry(Seconds seconds,
     return makeNoopOplogEntry({{seconds, 0}, 1LL}, version);
 }
 
+BSONObj makeLargeNoopOplogEntry(OpTime opTime, std::size_t paddingSize) {
+    auto oplogEntry = repl::DurableOplogEntry(
+        opTime,                                                    // optime
+        OpTypeEnum ::kNoop,                                        // opType
+        NamespaceString::createNamespaceString_forTest("test.t"),  // namespace
+        boost::none,                                               // uuid
+        boost::none,                                               // fromMigrate
+        boost::none,                                               // checkExistenceForDiffInsert
+        repl::OplogEntry::kOplogVersion,                           // version
+        BSON("padding" << std::string(paddingSize, 'a')),          // o
+        boost::none,                                               // o2
+        {},                                                        // sessionInfo
+        boost::none,                                               // upsert
+        Date_t(),                                                  // wall clock time
+        {},                                                        // statement ids
+        boost::none,   // optime of previous write within same transaction
+        boost::none,   // pre-image optime
+        boost::none,   // post-image optime
+        boost::none,   // ShardId of resharding recipient
+        boost::none,   // _id
+        boost::none);  // needsRetryImage
+    return oplogEntry.toBSON();
+}
+
 BSONObj makeOplogBatchMetadata(boost::optional<const rpc::ReplSetMetadata&> replMetadata,
                                boost::optional<const rpc::OplogQueryMetadata&> oqMetadata) {
     BSONObjBuilder bob;
@@ -2603,6 +2627,52 @@ TEST_F(OplogFetcherTest, GetMoreEmptyBatch) {
     ASSERT_OK(shutdownState.getStatus());
 }
 
+TEST_F(OplogFetcherTest, ReadAheadCoalescesFullExhaustRepliesIntoOneBatch) {
+    ShutdownState shutdownState;
+
+    auto oplogFetcher = getOplogFetcherAfterConnectionCreated(std::ref(shutdownState));
+
+    CursorId cursorId = 22LL;
+    auto firstEntry = makeNoopOplogEntry(lastFetched);
+    // Pad the second entry so that the reply carrying it crosses the "full reply" threshold
+    // (half the maximum user BSON size) and triggers read-ahead into the next in-flight reply.
+    auto secondEntry = makeLargeNoopOplogEntry({{Seconds(124), 0}, lastFetched.getTerm()},
+                                               9 * 1024 * 1024 /* paddingSize */);
+    auto thirdEntry = makeNoopOplogEntry({{Seconds(125), 0}, lastFetched.getTerm()});
+    auto metadataObj = makeOplogBatchMetadata(replSetMetadata, oqMetadata);
+
+    auto conn = oplogFetcher->getDBClientConnection_forTest();
+
+    // First batch for the initial find command.
+    processSingleRequestResponse(conn, makeFirstBatch(cursorId, {firstEntry}, metadataObj), true);
+
+    // The reply to the first getMore is full and has moreToCome set, so instead of enqueueing it
+    // on its own the fetcher reads ahead into the next reply of the exhaust stream.
+    processSingleRequestResponse(
+        conn,
+        makeSubsequentBatch(cursorId, {secondEntry}, metadataObj, true /* moreToCome */),
+        true);
+
+    // The next exhaust reply is below the threshold, which ends the read-ahead.
+    processSingleExhaustResponse(
+        conn,
+        makeSubsequentBatch(cursorId, {thirdEntry}, metadataObj, true /* moreToCome */),
+        true);
+
+    // Both getMore replies must have been handed to the oplog buffer as a single batch.
+    ASSERT_EQUALS(2U, lastEnqueuedDocuments.size());
+    ASSERT_BSONOBJ_EQ(secondEntry, lastEnqueuedDocuments[0]);
+    ASSERT_BSONOBJ_EQ(thirdEntry, lastEnqueuedDocuments[1]);
+
+    // Terminating empty batch from the exhaust stream with cursorId 0.
+    processSingleExhaustResponse(
+        conn, makeSubsequentBatch(0LL, {}, metadataObj, false /* moreToCome */), false);
+
+    oplogFetcher->join();
+
+    ASSERT_OK(shutdownState.getStatus());
+}
+
 TEST_F(OplogFetcherTest, HandleLogicalTimeMetaDataAndAdvanceClusterTime) {
     auto firstEntry = makeNoopOplogEntry(lastFetched);
 
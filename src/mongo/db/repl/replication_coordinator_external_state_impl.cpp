@@ -165,17 +165,10 @@ namespace {
 MONGO_FAIL_POINT_DEFINE(dropPendingCollectionReaperHang);
 MONGO_FAIL_POINT_DEFINE(skipDurableTimestampUpdates);
 
-// The maximum size of the oplog write buffer is set to 256MB.
-constexpr std::size_t kOplogWriteBufferSize = 256 * 1024 * 1024;
-
-// The maximum size of the oplog apply buffer is set to 100MB,
+// The default maximum size of the oplog apply buffer is set to 100MB,
 // equal to the maximum value of 'replBatchLimitBytes'.
 constexpr std::size_t kOplogApplyBufferSize = 100 * 1024 * 1024;
 
-// The maximum count of the oplog apply buffer is set to 10000,
-// equal to 2 * default value of 'replBatchLimitOperations'.
-constexpr std::size_t kOplogApplyBufferCount = 10 * 1000;
-
 // The maximum size of the oplog apply buffer is set to 256MB,
 // for the old architecture with no oplog write buffer.
 constexpr std::size_t kOplogApplyBufferSizeLegacy = 256 * 1024 * 1024;
@@ -271,12 +264,18 @@ void ReplicationCoordinatorExternalStateImpl::startSteadyStateReplication(
 
     const auto useOplogWriter = feature_flags::gReduceMajorityWriteLatency.isEnabled(
         serverGlobalParams.featureCompatibility.acquireFCVSnapshot());
-    const auto applyBufferSize =
-        useOplogWriter ? kOplogApplyBufferSize : kOplogApplyBufferSizeLegacy;
+
+    // The buffer limits default to the architecture-appropriate constants above but may be
+    // raised at startup to allow more fetch-ahead before a slow applier stalls the fetcher.
+    const auto applyBufferSizeMB = oplogApplyBufferSizeMB.load();
+    const std::size_t applyBufferSize = applyBufferSizeMB > 0
+        ? static_cast<std::size_t>(applyBufferSizeMB) * 1024 * 1024
+        : (useOplogWriter ? kOplogApplyBufferSize : kOplogApplyBufferSizeLegacy);
 
     if (useOplogWriter) {
         _oplogWriteBuffer = std::make_unique<OplogBufferBatchedQueue>(
-            kOplogWriteBufferSize, oplogBufferMetrics.getWriteBufferCounter());
+            static_cast<std::size_t>(oplogWriteBufferSizeMB.load()) * 1024 * 1024,
+            oplogBufferMetrics.getWriteBufferCounter());
     }
 
     // When featureFlagReduceMajorityWriteLatency is enabled, we must drain the apply buffer on
@@ -285,8 +284,9 @@ void ReplicationCoordinatorExternalStateImpl::startSteadyStateReplication(
     // for downgrades to work.
     OplogBufferBlockingQueue::Options bufferOptions;
     bufferOptions.clearOnShutdown = !useOplogWriter;
-    std::size_t maxCount =
-        useOplogWriter ? kOplogApplyBufferCount : std::numeric_limits<std::size_t>::max();
+    std::size_t maxCount = useOplogWriter
+        ? static_cast<std::size_t>(oplogApplyBufferCountLimit.load())
+        : std::numeric_limits<std::size_t>::max();
     _oplogApplyBuffer = std::make_unique<OplogBufferBlockingQueue>(
         applyBufferSize, maxCount, oplogBufferMetrics.getApplyBufferCounter(), bufferOptions);
 
@@ -30,6 +30,8 @@
 
 #include "mongo/db/repl/reporter.h"
 
+#include <algorithm>
+
 #include <boost/move/utility_core.hpp>
 // IWYU pragma: no_include "cxxabi.h"
 #include <mutex>
@@ -148,6 +150,10 @@ Status Reporter::trigger(bool allowOneMore) {
         return _status;
     }
 
+    // Each trigger indicates that there is newer progress to report than what any command
+    // currently being prepared or sent was built from.
+    ++_triggerGeneration;
+
     bool useBackupChannel = false;
     if (_keepAliveTimeoutWhen != Date_t()) {
         // Reset keep alive expiration to signal handler that it was canceled internally.
@@ -250,8 +256,25 @@ void Reporter::_sendCommand_inlock(BSONObj commandRequest,
     }
 }
 
+bool Reporter::_scheduleKeepAlive_inlock() {
+    auto when = _executor->now() + _keepAliveInterval;
+    auto scheduleResult = _executor->scheduleWorkAt(
+        when, [=, this](const executor::TaskExecutor::CallbackArgs& args) {
+            _prepareAndSendCommandCallback(args, false /*fromTrigger*/, false /*useBackupChannel*/);
+        });
+    _status = scheduleResult.getStatus();
+    if (!_status.isOK()) {
+        return false;
+    }
+
+    _prepareAndSendCommandCallbackHandle = scheduleResult.getValue();
+    _keepAliveTimeoutWhen = when;
+    return true;
+}
+
 void Reporter::_processResponseCallback(
     const executor::TaskExecutor::RemoteCommandCallbackArgs& rcbd, bool useBackupChannel) {
+    uint64_t waitingGeneration = 0;
     {
         stdx::lock_guard<Latch> lk(_mutex);
 
@@ -287,39 +310,48 @@ void Reporter::_processResponseCallback(
         if (_requestWaitingStatus == RequestWaitingStatus::kNoWaiting) {
             // Since we are also on a timer, schedule a report for that interval, or until
             // triggered.
-            auto when = _executor->now() + _keepAliveInterval;
-            bool fromTrigger = false;
-            auto scheduleResult = _executor->scheduleWorkAt(
-                when, [=, this](const executor::TaskExecutor::CallbackArgs& args) {
-                    _prepareAndSendCommandCallback(args, fromTrigger, false
-                                                   /*useBackupChannel*/);
-                });
-            _status = scheduleResult.getStatus();
-            if (!_status.isOK()) {
+            if (!_scheduleKeepAlive_inlock()) {
                 _onShutdown_inlock(useBackupChannel);
                 return;
             }
 
-            _prepareAndSendCommandCallbackHandle = scheduleResult.getValue();
-            _keepAliveTimeoutWhen = when;
-
             _remoteCommandCallbackHandle = executor::TaskExecutor::CallbackHandle();
             return;
         }
+
+        waitingGeneration = _triggerGeneration;
     }
 
     // Must call without holding the lock.
     auto prepareResult = _prepareCommand();
 
     // Since we unlock above, there is a chance that the main channel and backup channel reach this
-    // point at about the same time and the updatePosition request would be almost the same. We may
-    // save one request in that case but for now we leave it for future optimization.
+    // point at about the same time and the updatePosition request would be almost the same. The
+    // generation check below detects that case and drops the duplicate.
     stdx::lock_guard<Latch> lk(_mutex);
     if (!_status.isOK()) {
         _onShutdown_inlock(useBackupChannel);
         return;
     }
 
+    if (_lastSentGeneration >= _triggerGeneration) {
+        // While this channel was preparing its command, the other channel sent a command that was
+        // prepared after every trigger received so far, so this command would be a near duplicate
+        // of it. Drop it and fall back to the regular keep alive schedule.
+        _requestWaitingStatus = RequestWaitingStatus::kNoWaiting;
+        if (useBackupChannel) {
+            _backupRemoteCommandCallbackHandle = executor::TaskExecutor::CallbackHandle();
+        } else {
+            if (!_scheduleKeepAlive_inlock()) {
+                _onShutdown_inlock(useBackupChannel);
+                return;
+            }
+            _remoteCommandCallbackHandle = executor::TaskExecutor::CallbackHandle();
+        }
+        return;
+    }
+
+    _lastSentGeneration = std::max(_lastSentGeneration, waitingGeneration);
     _sendCommand_inlock(prepareResult.getValue(), _updatePositionTimeout, useBackupChannel);
     if (!_status.isOK()) {
         _onShutdown_inlock(useBackupChannel);
@@ -335,6 +367,7 @@ void Reporter::_processResponseCallback(
 void Reporter::_prepareAndSendCommandCallback(const executor::TaskExecutor::CallbackArgs& args,
                                               bool fromTrigger,
                                               bool useBackupChannel) {
+    uint64_t generation = 0;
     {
         stdx::lock_guard<Latch> lk(_mutex);
         if (!_status.isOK()) {
@@ -354,6 +387,8 @@ void Reporter::_prepareAndSendCommandCallback(const executor::TaskExecutor::Call
             _onShutdown_inlock(useBackupChannel);
             return;
         }
+
+        generation = _triggerGeneration;
     }
 
     // Must call without holding the lock.
@@ -365,6 +400,7 @@ void Reporter::_prepareAndSendCommandCallback(const executor::TaskExecutor::Call
         return;
     }
 
+    _lastSentGeneration = std::max(_lastSentGeneration, generation);
     _sendCommand_inlock(prepareResult.getValue(), _updatePositionTimeout, useBackupChannel);
     if (!_status.isOK()) {
         _onShutdown_inlock(useBackupChannel);
@@ -188,6 +188,12 @@ private:
                                         bool fromTrigger,
                                         bool useBackupChannel);
 
+    /**
+     * Schedules the next report on the keep alive interval and updates the associated bookkeeping.
+     * Returns false and sets "_status" if the work cannot be scheduled.
+     */
+    bool _scheduleKeepAlive_inlock();
+
     /**
      * Signals end of Reporter work and notifies waiters.
      */
@@ -221,6 +227,15 @@ private:
     // subsequent updates have come in.
     RequestWaitingStatus _requestWaitingStatus = RequestWaitingStatus::kNoWaiting;
 
+    // Incremented by each trigger() call to record that there is newer progress to report than
+    // what any in-flight command was prepared with.
+    uint64_t _triggerGeneration = 0;
+
+    // The value of "_triggerGeneration" observed when the most recently sent command began
+    // preparation. When this is at least "_triggerGeneration", every progress update signaled so
+    // far is covered by a command that has already been sent.
+    uint64_t _lastSentGeneration = 0;
+
     // Callback handle to the scheduled remote command.
     executor::TaskExecutor::CallbackHandle _remoteCommandCallbackHandle;
 
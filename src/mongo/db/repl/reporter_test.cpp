@@ -746,7 +746,9 @@ TEST_F(ReporterTest, AllowUsingBackupChannel) {
     ASSERT_TRUE(reporter->isBackupActive());
 
     processNetworkResponse(BSON("ok" << 1), true);
-    processNetworkResponse(BSON("ok" << 1), true);
+    // The trigger that was waiting on the main channel is already covered by the command the
+    // backup channel sent, so the main channel drops the near duplicate instead of sending a
+    // third command.
     processNetworkResponse(BSON("ok" << 1), false);
     ASSERT_FALSE(reporter->isBackupActive());
     ASSERT_TRUE(reporter->isActive());
@@ -1293,25 +1293,22 @@ Status RollbackImpl::_checkAgainstTimeLimit(
     return Status::OK();
 }
 
-boost::optional<BSONObj> RollbackImpl::_findDocumentById(OperationContext* opCtx,
-                                                         UUID uuid,
-                                                         NamespaceString nss,
-                                                         BSONElement id) {
-    auto document = _storageInterface->findById(opCtx, {nss.dbName(), uuid}, id);
-    if (document.isOK()) {
-        return document.getValue();
-    } else if (document.getStatus().code() == ErrorCodes::NoSuchKey) {
-        return boost::none;
-    } else {
-        LOGV2_FATAL_CONTINUE(21645,
-                             "Rollback failed to read document",
-                             "id"_attr = redact(id),
-                             logAttrs(nss),
-                             "uuid"_attr = uuid.toString(),
-                             "error"_attr = causedBy(document.getStatus()));
-        fassert(50751, document.getStatus());
+std::vector<BSONObj> RollbackImpl::_findDocumentsByIds(OperationContext* opCtx,
+                                                       UUID uuid,
+                                                       NamespaceString nss,
+                                                       const std::vector<BSONElement>& ids) {
+    auto documents = _storageInterface->findByIds(opCtx, {nss.dbName(), uuid}, ids);
+    if (documents.isOK()) {
+        return documents.getValue();
     }
 
+    LOGV2_FATAL_CONTINUE(21645,
+                         "Rollback failed to read documents",
+                         logAttrs(nss),
+                         "uuid"_attr = uuid.toString(),
+                         "error"_attr = causedBy(documents.getStatus()));
+    fassert(50751, documents.getStatus());
+
     MONGO_UNREACHABLE;
 }
 
@@ -1376,14 +1373,16 @@ void RollbackImpl::_writeRollbackFileForNamespace(OperationContext* opCtx,
         _rollbackStats.rollbackDataFileDirectory = std::string(newDirectoryPath.begin(), prefixEnd);
     }
 
+    std::vector<BSONElement> ids;
+    ids.reserve(idSet.size());
     for (auto&& id : idSet) {
-        // StorageInterface::findById() does not respect the collation, but because we are using
-        // exact _id fields recorded in the oplog, we can get away with binary string
-        // comparisons.
-        auto document = _findDocumentById(opCtx, uuid, nss, id.firstElement());
-        if (document) {
-            fassert(50750, removeSaver.goingToDelete(*document));
-        }
+        ids.push_back(id.firstElement());
+    }
+
+    // StorageInterface::findByIds() does not respect the collation, but because we are using
+    // exact _id fields recorded in the oplog, we can get away with binary string comparisons.
+    for (auto&& document : _findDocumentsByIds(opCtx, uuid, nss, ids)) {
+        fassert(50750, removeSaver.goingToDelete(document));
     }
     _listener->onRollbackFileWrittenForNamespace(std::move(uuid), std::move(nss));
 }
@@ -311,17 +311,19 @@ public:
 
 protected:
     /**
-     * Returns the document with _id 'id' in the namespace 'nss', or boost::none if that document
-     * no longer exists in 'nss'. This function is used to write documents to rollback data files,
-     * and this function will terminate the server if an unexpected error is returned by the storage
-     * interface.
+     * Returns the documents in the namespace 'nss' whose _ids are listed in 'ids'. _ids whose
+     * documents no longer exist in 'nss' are omitted from the result. All of the lookups share one
+     * collection acquisition and storage snapshot, so this is substantially cheaper than looking
+     * the documents up one at a time. This function is used to write documents to rollback data
+     * files, and this function will terminate the server if an unexpected error is returned by the
+     * storage interface.
      *
      * This function is protected so that subclasses can access this method for test purposes.
      */
-    boost::optional<BSONObj> _findDocumentById(OperationContext* opCtx,
-                                               UUID uuid,
-                                               NamespaceString nss,
-                                               BSONElement id);
+    std::vector<BSONObj> _findDocumentsByIds(OperationContext* opCtx,
+                                             UUID uuid,
+                                             NamespaceString nss,
+                                             const std::vector<BSONElement>& ids);
 
     /**
      * Writes a rollback file for the namespace 'nss' containing all of the documents whose _ids are
@@ -161,15 +161,17 @@ protected:
               "Simulating writing a rollback file for namespace {nss_ns} with uuid {uuid}",
               logAttrs(nss),
               "uuid"_attr = uuid);
+        std::vector<BSONElement> ids;
+        ids.reserve(idSet.size());
         for (auto&& id : idSet) {
             LOGV2(21648,
                   "Looking up {id_jsonString_JsonStringFormat_LegacyStrict}",
                   "id_jsonString_JsonStringFormat_LegacyStrict"_attr =
                       id.jsonString(JsonStringFormat::LegacyStrict));
-            auto document = _findDocumentById(opCtx, uuid, nss, id.firstElement());
-            if (document) {
-                _uuidToObjsMap[uuid].push_back(*document);
-            }
+            ids.push_back(id.firstElement());
+        }
+        for (auto&& document : _findDocumentsByIds(opCtx, uuid, nss, ids)) {
+            _uuidToObjsMap[uuid].push_back(document);
         }
         _listener->onRollbackFileWrittenForNamespace(std::move(uuid), std::move(nss));
     }
@@ -347,6 +347,19 @@ public:
                                          const NamespaceStringOrUUID& nsOrUUID,
                                          const BSONElement& idKey) = 0;
 
+    /**
+     * Finds the documents in the collection referenced by the specified _ids. The _id lookups are
+     * all performed within a single collection acquisition and storage snapshot, which makes this
+     * substantially cheaper than calling findById() once per document. _ids that do not match a
+     * document are omitted from the result.
+     *
+     * Not supported on collections with a default collation.
+     */
+    virtual StatusWith<std::vector<BSONObj>> findByIds(
+        OperationContext* opCtx,
+        const NamespaceStringOrUUID& nsOrUUID,
+        const std::vector<BSONElement>& idKeys) = 0;
+
     /**
      * Deletes a single document in the collection referenced by the specified _id.
      * Returns deleted document on success.
@@ -95,6 +95,7 @@
 #include "mongo/db/storage/oplog_cap_maintainer_thread.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/recovery_unit.h"
+#include "mongo/db/storage/snapshot.h"
 #include "mongo/db/storage/storage_engine.h"
 #include "mongo/db/storage/storage_util.h"
 #include "mongo/db/storage/write_unit_of_work.h"
@@ -978,6 +979,51 @@ StatusWith<BSONObj> StorageInterfaceImpl::findById(OperationContext* opCtx,
     return _findOrDeleteById(opCtx, nsOrUUID, idKey, FindDeleteMode::kFind);
 }
 
+StatusWith<std::vector<BSONObj>> StorageInterfaceImpl::findByIds(
+    OperationContext* opCtx,
+    const NamespaceStringOrUUID& nsOrUUID,
+    const std::vector<BSONElement>& idKeys) {
+    return writeConflictRetry(
+        opCtx,
+        "StorageInterfaceImpl::findByIds",
+        nsOrUUID,
+        [&]() -> StatusWith<std::vector<BSONObj>> {
+            const auto collection = acquireCollection(
+                opCtx,
+                CollectionAcquisitionRequest::fromOpCtx(
+                    opCtx, nsOrUUID, AcquisitionPrerequisites::kRead),
+                MODE_IS);
+            if (!collection.exists()) {
+                return Status{ErrorCodes::NamespaceNotFound,
+                              str::stream() << "Collection [" << nsOrUUID.toStringForErrorMsg()
+                                            << "] not found. Unable to proceed with "
+                                            << "StorageInterfaceImpl::findByIds."};
+            }
+
+            std::vector<BSONObj> docs;
+            docs.reserve(idKeys.size());
+            try {
+                for (const auto& idKey : idKeys) {
+                    auto recordId =
+                        Helpers::findById(opCtx, collection.getCollectionPtr(), idKey.wrap("_id"));
+                    if (recordId.isNull()) {
+                        continue;
+                    }
+                    Snapshotted<BSONObj> doc;
+                    if (collection.getCollectionPtr()->findDoc(opCtx, recordId, &doc)) {
+                        docs.push_back(doc.value().getOwned());
+                    }
+                }
+            } catch (const StorageUnavailableException&) {
+                throw;
+            } catch (const DBException&) {
+                return exceptionToStatus();
+            }
+
+            return docs;
+        });
+}
+
 StatusWith<BSONObj> StorageInterfaceImpl::deleteById(OperationContext* opCtx,
                                                      const NamespaceStringOrUUID& nsOrUUID,
                                                      const BSONElement& idKey) {
@@ -170,6 +170,10 @@ public:
                                  const NamespaceStringOrUUID& nsOrUUID,
                                  const BSONElement& idKey) override;
 
+    StatusWith<std::vector<BSONObj>> findByIds(OperationContext* opCtx,
+                                               const NamespaceStringOrUUID& nsOrUUID,
+                                               const std::vector<BSONElement>& idKeys) override;
+
     StatusWith<BSONObj> deleteById(OperationContext* opCtx,
                                    const NamespaceStringOrUUID& nsOrUUID,
                                    const BSONElement& idKey) override;
@@ -298,6 +298,12 @@ public:
         return Status{ErrorCodes::IllegalOperation, "findById not implemented."};
     }
 
+    StatusWith<std::vector<BSONObj>> findByIds(OperationContext* opCtx,
+                                               const NamespaceStringOrUUID&,
+                                               const std::vector<BSONElement>& idKeys) override {
+        return Status{ErrorCodes::IllegalOperation, "findByIds not implemented."};
+    }
+
     StatusWith<BSONObj> deleteById(OperationContext* opCtx,
                                    const NamespaceStringOrUUID&,
                                    const BSONElement& idKey) override {
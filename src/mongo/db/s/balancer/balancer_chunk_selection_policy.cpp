@@ -386,6 +386,26 @@ StatusWith<MigrateInfoVector> BalancerChunkSelectionPolicy::selectChunksToMove(
 
     const uint32_t kMaxCachedCollectionsSize = 0.75 * kStatsForBalancingBatchSize;
 
+    // Lambda function returning whether the migrations budget for this round has been exhausted.
+    // Each shard participates in at most one migration at a time, so the budget bounds the
+    // concurrent migrations (and thereby the aggregate I/O) a round may generate.
+    const auto reachedMaxConcurrentMigrations = [&candidateChunks] {
+        const auto maxConcurrentMigrations = balancerMaxConcurrentMigrationsPerRound.load();
+        return maxConcurrentMigrations > 0 &&
+            candidateChunks.size() >= static_cast<size_t>(maxConcurrentMigrations);
+    };
+
+    // Lambda function discarding any candidates selected beyond the migrations budget. A single
+    // collection may contribute several migrations at once, so selection can overshoot the budget
+    // by the last collection processed.
+    const auto trimToMigrationsBudget = [&candidateChunks] {
+        const auto maxConcurrentMigrations = balancerMaxConcurrentMigrationsPerRound.load();
+        if (maxConcurrentMigrations > 0 &&
+            candidateChunks.size() > static_cast<size_t>(maxConcurrentMigrations)) {
+            candidateChunks.resize(maxConcurrentMigrations);
+        }
+    };
+
     // Lambda function used to get a CollectionType leveraging the `collections` vector
     // The `collections` vector must be sorted by nss when it is called
     auto getCollectionTypeByNss = [&collections](const NamespaceString& nss)
@@ -413,7 +433,7 @@ StatusWith<MigrateInfoVector> BalancerChunkSelectionPolicy::selectChunksToMove(
         std::shuffle(collBatch.begin(), collBatch.end(), client->getPrng().urbg());
         for (const auto& coll : collBatch) {
 
-            if (availableShards->size() < 2) {
+            if (availableShards->size() < 2 || reachedMaxConcurrentMigrations()) {
                 break;
             }
 
@@ -483,7 +503,8 @@ StatusWith<MigrateInfoVector> BalancerChunkSelectionPolicy::selectChunksToMove(
 
         if (collBatch.size() == kStatsForBalancingBatchSize) {
             processBatch(collBatch);
-            if (availableShards->size() < 2) {
+            trimToMigrationsBudget();
+            if (availableShards->size() < 2 || reachedMaxConcurrentMigrations()) {
                 return candidateChunks;
             }
             collBatch.clear();
@@ -505,6 +526,7 @@ StatusWith<MigrateInfoVector> BalancerChunkSelectionPolicy::selectChunksToMove(
 
     if (collBatch.size() > 0) {
         processBatch(collBatch);
+        trimToMigrationsBudget();
     }
 
     return candidateChunks;
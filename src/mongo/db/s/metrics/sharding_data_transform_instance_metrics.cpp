@@ -229,6 +229,10 @@ int64_t ShardingDataTransformInstanceMetrics::getBytesWrittenCount() const {
     return _bytesWritten.load();
 }
 
+int64_t ShardingDataTransformInstanceMetrics::getApproxDocumentsToProcessCount() const {
+    return _approxDocumentsToProcess.load();
+}
+
 int64_t ShardingDataTransformInstanceMetrics::getApproxBytesToScanCount() const {
     return _approxBytesToScan.load();
 }
@@ -94,6 +94,7 @@ public:
                               Milliseconds elapsed);
     int64_t getDocumentsProcessedCount() const;
     int64_t getBytesWrittenCount() const;
+    int64_t getApproxDocumentsToProcessCount() const;
     int64_t getApproxBytesToScanCount() const;
     int64_t getWritesDuringCriticalSection() const;
 
@@ -1844,21 +1844,23 @@ bool MigrationDestinationManager::_applyMigrateOp(OperationContext* opCtx, const
 
     // Deleted documents
     if (xfer["deleted"].isABSONObj()) {
+        // Acquire the collection once for the whole batch instead of re-acquiring it for every
+        // document; catch up batches can contain thousands of modifications.
+        const auto collection = acquireCollection(
+            opCtx,
+            CollectionAcquisitionRequest(_nss,
+                                         AcquisitionPrerequisites::kPretendUnsharded,
+                                         repl::ReadConcernArgs::get(opCtx),
+                                         AcquisitionPrerequisites::kWrite),
+            MODE_IX);
+        uassert(ErrorCodes::ConflictingOperationInProgress,
+                str::stream() << "Collection " << _nss.toStringForErrorMsg()
+                              << " was dropped in the middle of the migration",
+                collection.exists());
+
         BSONObjIterator i(xfer["deleted"].Obj());
         while (i.more()) {
             totalDocs++;
-            const auto collection = acquireCollection(
-                opCtx,
-                CollectionAcquisitionRequest(_nss,
-                                             AcquisitionPrerequisites::kPretendUnsharded,
-                                             repl::ReadConcernArgs::get(opCtx),
-                                             AcquisitionPrerequisites::kWrite),
-                MODE_IX);
-            uassert(ErrorCodes::ConflictingOperationInProgress,
-                    str::stream() << "Collection " << _nss.toStringForErrorMsg()
-                                  << " was dropped in the middle of the migration",
-                    collection.exists());
-
             BSONObj id = i.next().Obj();
 
             // Do not apply delete if doc does not belong to the chunk being migrated
@@ -1888,21 +1890,22 @@ bool MigrationDestinationManager::_applyMigrateOp(OperationContext* opCtx, const
 
     // Inserted or updated documents
     if (xfer["reload"].isABSONObj()) {
+        // As above, a single acquisition covers the application of the whole batch.
+        auto collection = acquireCollection(
+            opCtx,
+            CollectionAcquisitionRequest(_nss,
+                                         AcquisitionPrerequisites::kPretendUnsharded,
+                                         repl::ReadConcernArgs::get(opCtx),
+                                         AcquisitionPrerequisites::kWrite),
+            MODE_IX);
+        uassert(ErrorCodes::ConflictingOperationInProgress,
+                str::stream() << "Collection " << _nss.toStringForErrorMsg()
+                              << " was dropped in the middle of the migration",
+                collection.exists());
+
         BSONObjIterator i(xfer["reload"].Obj());
         while (i.more()) {
             totalDocs++;
-            auto collection = acquireCollection(
-                opCtx,
-                CollectionAcquisitionRequest(_nss,
-                                             AcquisitionPrerequisites::kPretendUnsharded,
-                                             repl::ReadConcernArgs::get(opCtx),
-                                             AcquisitionPrerequisites::kWrite),
-                MODE_IX);
-            uassert(ErrorCodes::ConflictingOperationInProgress,
-                    str::stream() << "Collection " << _nss.toStringForErrorMsg()
-                                  << " was dropped in the middle of the migration",
-                    collection.exists());
-
             BSONObj updatedDoc = i.next().Obj();
 
             // do not apply insert/update if doc does not belong to the chunk being migrated
@@ -29,10 +29,12 @@
 
 
 #include <absl/container/node_hash_map.h>
+#include <algorithm>
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
 #include <boost/smart_ptr.hpp>
+#include <cstdint>
 #include <mutex>
 #include <string>
 #include <tuple>
@@ -116,6 +118,24 @@ bool collectionHasSimpleCollation(OperationContext* opCtx, const NamespaceString
     return !sourceChunkMgr.getDefaultCollator();
 }
 
+/**
+ * Computes the number of documents to request per getMore from each donor shard. The natural-order
+ * cloner applies every donor batch in a single storage transaction, so the batches are sized to
+ * keep each transaction near the 'reshardingCollectionClonerBatchSizeInBytes' limit. Returns
+ * boost::none if there is no collection size estimate yet, in which case the donor fills each
+ * batch up to the response size limit.
+ */
+boost::optional<std::int64_t> computeNaturalOrderGetMoreBatchSize(int64_t batchSizeLimitBytes,
+                                                                  int64_t approxDocumentsToCopy,
+                                                                  int64_t approxBytesToCopy) {
+    if (approxDocumentsToCopy <= 0 || approxBytesToCopy <= 0) {
+        return boost::none;
+    }
+    auto averageDocumentSizeBytes =
+        std::max<int64_t>(1, approxBytesToCopy / approxDocumentsToCopy);
+    return std::max<int64_t>(1, batchSizeLimitBytes / averageDocumentSizeBytes);
+}
+
 }  // namespace
 
 ReshardingCollectionCloner::ReshardingCollectionCloner(ReshardingMetrics* metrics,
@@ -303,13 +323,14 @@ public:
                            std::shared_ptr<executor::TaskExecutor> cleanupExecutor,
                            CancellationToken cancelToken,
                            sharded_agg_helpers::DispatchShardPipelineResults dispatchResults,
-                           int batchSizeLimitBytes,
+                           boost::optional<std::int64_t> getMoreBatchSize,
                            int numWriteThreads)
         : _executor(std::move(executor)),
           _cleanupExecutor(std::move(cleanupExecutor)),
           _cancelSource(cancelToken),
           _factory(_cancelSource.token(), _executor),
           _dispatchResults(std::move(dispatchResults)),
+          _getMoreBatchSize(getMoreBatchSize),
           _numWriteThreads(numWriteThreads),
           _queues(_numWriteThreads),
           _activeCursors(0),
@@ -442,6 +463,9 @@ public:
             GetMoreCommandRequest getMoreRequest(
                 cursor->getCursorResponse().getCursorId(),
                 cursor->getCursorResponse().getNSS().coll().toString());
+            // Each response is applied in a single storage transaction by a writer thread, so
+            // bound the batches to keep those transactions reasonably sized.
+            getMoreRequest.setBatchSize(_getMoreBatchSize);
             BSONObj cmdObj;
             if (opCtx->getLogicalSessionId()) {
                 getMoreRequest.setLsid(generic_argument_util::toLogicalSessionFromClient(
@@ -534,6 +558,11 @@ private:
     CancellationSource _cancelSource;
     CancelableOperationContextFactory _factory;
     sharded_agg_helpers::DispatchShardPipelineResults _dispatchResults;
+
+    // If set, the number of documents to request per getMore from each donor. Left unset when
+    // there is no estimate of the average document size, in which case the donors fill each batch
+    // up to the response size limit.
+    boost::optional<std::int64_t> _getMoreBatchSize;
     int _numWriteThreads;
     std::vector<ExecutorFuture<executor::TaskExecutor::ResponseStatus>> _cmdFutures;
     std::vector<ExecutorFuture<void>> _writerFutures;
@@ -695,7 +724,10 @@ void ReshardingCollectionCloner::_writeOnceWithNaturalOrder(
         std::move(cleanupExecutor),
         cancelToken,
         std::move(dispatchResults),
-        resharding::gReshardingCollectionClonerBatchSizeInBytes.load(),
+        computeNaturalOrderGetMoreBatchSize(
+            resharding::gReshardingCollectionClonerBatchSizeInBytes.load(),
+            _metrics->getApproxDocumentsToProcessCount(),
+            _metrics->getApproxBytesToScanCount()),
         resharding::gReshardingCollectionClonerWriteThreadCount);
     reshardingCloneFetcher
         .run(opCtx,
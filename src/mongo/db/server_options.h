@@ -167,6 +167,7 @@ struct ServerGlobalParams {
 #ifdef MONGO_CONFIG_GRPC
     int grpcPort = DefaultGRPCServerPort;
     int grpcServerMaxThreads = 1000;
+    int grpcServerMaxConcurrentStreams = -1;
 #endif
 
     /**
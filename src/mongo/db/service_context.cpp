@@ -59,6 +59,7 @@
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/system_clock_source.h"
 #include "mongo/util/system_tick_source.h"
+#include "mongo/util/tsc_tick_source.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kDefault
 
@@ -140,7 +141,13 @@ Service::~Service() = default;
 Service::Service(ServiceContext* sc, ClusterRole role) : _sc{sc}, _role{role} {}
 
 ServiceContext::ServiceContext()
-    : _tickSource(makeSystemTickSource()),
+    : _tickSource([] {
+          // Prefer the calibrated invariant-TSC source for operation timing; reading it avoids
+          // the clock_gettime call the steady_clock-based source makes on every tick.
+          if (auto tsc = makeTscTickSourceIfStable())
+              return tsc;
+          return makeSystemTickSource();
+      }()),
       _fastClockSource(std::make_unique<SystemClockSource>()),
       _preciseClockSource(std::make_unique<SystemClockSource>()),
       _serviceSet(std::make_unique<ServiceSet>(this)) {}
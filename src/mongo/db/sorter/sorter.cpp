@@ -67,6 +67,11 @@
 #include <utility>
 #include <vector>
 
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 // IWYU pragma: no_include "boost/container/detail/std_fwd.hpp"
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
@@ -133,6 +138,11 @@ EncryptionHooks* getEncryptionHooksIfEnabled() {
 
 constexpr std::size_t kSortedFileBufferSize = 64 * 1024;
 
+// Amount of newly spilled data after which the spill file hints the OS to write the data back and
+// release it from the page cache; see File::_adviseSpilledDataWillNotBeNeeded(). Large enough to
+// keep writeback requests sequential and cheap, small enough to bound page-cache pollution.
+constexpr std::streamoff kSpillCacheHintIntervalBytes = 16 * 1024 * 1024;
+
 }  // namespace
 
 namespace sorter {
@@ -290,6 +300,7 @@ public:
           _fileCurrentOffset(fileStartOffset),
           _fileEndOffset(fileEndOffset),
           _dbName(dbName),
+          _readAheadFileOffset(fileStartOffset),
           _afterReadChecksumCalculator(checksumVersion),
           _originalChecksum(checksum) {}
 
@@ -443,6 +454,11 @@ private:
 
     /**
      * Attempts to read data from disk. Sets _done to true when file offset reaches _fileEndOffset.
+     *
+     * Reads are served from a read-ahead buffer that is refilled with large sequential reads, so
+     * that the many small reads the iterator issues (a 4-byte block size followed by the block)
+     * do not each pay the cost of a syscall, and sequential file access stays large enough for
+     * the OS to overlap readahead with block decompression.
      */
     void _read(void* out, size_t size) {
         if (_fileCurrentOffset == _fileEndOffset) {
@@ -454,8 +470,29 @@ private:
                   str::stream() << "Current file offset (" << _fileCurrentOffset
                                 << ") greater than end offset (" << _fileEndOffset << ")");
 
-        _file->read(_fileCurrentOffset, size, out);
-        _fileCurrentOffset += size;
+        char* dest = static_cast<char*>(out);
+        while (size > 0) {
+            if (_readAheadPos == _readAheadValid) {
+                invariant(_readAheadFileOffset < _fileEndOffset);
+                const size_t toRead =
+                    std::min(static_cast<size_t>(_fileEndOffset - _readAheadFileOffset),
+                             kReadAheadSize);
+                if (!_readAheadBuffer) {
+                    _readAheadBuffer.reset(new char[kReadAheadSize]);
+                }
+                _file->read(_readAheadFileOffset, toRead, _readAheadBuffer.get());
+                _readAheadFileOffset += toRead;
+                _readAheadValid = toRead;
+                _readAheadPos = 0;
+            }
+
+            const size_t available = std::min(size, _readAheadValid - _readAheadPos);
+            memcpy(dest, _readAheadBuffer.get() + _readAheadPos, available);
+            _readAheadPos += available;
+            dest += available;
+            size -= available;
+            _fileCurrentOffset += available;
+        }
     }
 
     const Settings _settings;
@@ -470,6 +507,15 @@ private:
     std::streamoff _fileEndOffset;      // File offset at which the sorted data range ends.
     boost::optional<DatabaseName> _dbName;
 
+    // Sized to hold the block being consumed plus the next one, so a buffer refill typically
+    // fetches two spill blocks in a single sequential read. Allocated lazily on the first read.
+    static constexpr size_t kReadAheadSize = 2 * kSortedFileBufferSize;
+    std::unique_ptr<char[]> _readAheadBuffer;
+    size_t _readAheadValid = 0;  // Number of valid bytes in _readAheadBuffer.
+    size_t _readAheadPos = 0;    // Consumption position within _readAheadBuffer.
+    // File offset of the first byte past the data currently held in _readAheadBuffer.
+    std::streamoff _readAheadFileOffset;
+
     // Points to the beginning of a serialized key in the key-value pair currently being read, and
     // used for computing the checksum value. This is set to nullptr after reading each key-value
     // pair.
@@ -490,6 +536,11 @@ private:
  * ranges within the same file. The input iterators must implement nextWithDeferredValue() and
  * getDeferredValue(). This class is given the data source file name upon construction and is
  * responsible for deleting the data source file upon destruction.
+ *
+ * The k-way merge is implemented with a tournament tree of losers rather than a binary heap.
+ * Selecting the next element replays only the matches on the path from the previous winner's leaf
+ * to the root, which performs exactly ceil(log2(k)) comparisons and no sift-down swaps, roughly
+ * halving the comparison count of a heap-based merge for large k.
  */
 template <typename Key, typename Value, typename Comparator>
 class MergeIterator : public SortIteratorInterface<Key, Value> {
@@ -507,7 +558,7 @@ public:
         for (size_t i = 0; i < iters.size(); i++) {
             iters[i]->openSource();
             if (iters[i]->more()) {
-                _heap.push_back(
+                _streams.push_back(
                     std::make_shared<Stream>(i, iters[i]->nextWithDeferredValue(), iters[i]));
                 if (i > _maxFile) {
                     _maxFile = i;
@@ -517,22 +568,21 @@ public:
             }
         }
 
-        if (_heap.empty()) {
+        _liveStreams = _streams.size();
+        if (_streams.empty()) {
             _remaining = 0;
             return;
         }
 
-        std::make_heap(_heap.begin(), _heap.end(), _greater);
-        std::pop_heap(_heap.begin(), _heap.end(), _greater);
-        _current = _heap.back();
-        _heap.pop_back();
+        _rebuildTree();
+        _current = _streams[_winner];
 
         _positioned = true;
     }
 
     ~MergeIterator() override {
         _current.reset();
-        _heap.clear();
+        _streams.clear();
     }
 
     void openSource() override {}
@@ -541,22 +591,21 @@ public:
     void addSource(std::shared_ptr<Input> iter) {
         iter->openSource();
         if (iter->more()) {
-            _heap.push_back(
+            _streams.push_back(
                 std::make_shared<Stream>(++_maxFile, iter->nextWithDeferredValue(), iter));
-            std::push_heap(_heap.begin(), _heap.end(), _greater);
+            _liveStreams++;
 
-            if (_greater(_current, _heap.front())) {
-                std::pop_heap(_heap.begin(), _heap.end(), _greater);
-                std::swap(_current, _heap.back());
-                std::push_heap(_heap.begin(), _heap.end(), _greater);
-            }
+            // Rebuilding the tree replays every match, so the new stream competes against the
+            // current winner just as it would have in the incremental case.
+            _rebuildTree();
+            _current = _streams[_winner];
         } else {
             iter->closeSource();
         }
     }
 
     bool more() override {
-        if (_remaining > 0 && (_positioned || !_heap.empty() || _current->more()))
+        if (_remaining > 0 && (_positioned || _liveStreams > 1 || _current->more()))
             return true;
 
         _remaining = 0;
@@ -599,15 +648,12 @@ public:
 
     void advance() {
         if (!_current->advance()) {
-            invariant(!_heap.empty());
-            std::pop_heap(_heap.begin(), _heap.end(), _greater);
-            _current = _heap.back();
-            _heap.pop_back();
-        } else if (!_heap.empty() && _greater(_current, _heap.front())) {
-            std::pop_heap(_heap.begin(), _heap.end(), _greater);
-            std::swap(_current, _heap.back());
-            std::push_heap(_heap.begin(), _heap.end(), _greater);
+            _streams[_winner].reset();  // Destroys the stream, closing its source.
+            _liveStreams--;
+            invariant(_liveStreams > 0);
         }
+        _winner = _replayMatches(_winner);
+        _current = _streams[_winner];
     }
 
 private:
@@ -651,7 +697,7 @@ private:
         std::shared_ptr<Input> _rest;
     };
 
-    class STLComparator {  // uses greater rather than less-than to maintain a MinHeap
+    class STLComparator {  // uses greater rather than less-than to order the tournament
     public:
         explicit STLComparator(const Comparator& comp) : _comp(comp) {}
 
@@ -671,13 +717,85 @@ private:
         const Comparator _comp;
     };
 
+    // Marks a tournament tree slot with no stream behind it: either padding up to the tree
+    // capacity, or a stream that has been exhausted. Such slots lose every match.
+    static constexpr size_t kNoStream = std::numeric_limits<size_t>::max();
+
+    /**
+     * Returns true if the stream in slot 'lhs' should be returned before the stream in slot 'rhs',
+     * i.e. it wins their match.
+     */
+    bool _beats(size_t lhs, size_t rhs) const {
+        if (lhs == kNoStream)
+            return false;
+        if (rhs == kNoStream)
+            return true;
+        return !_greater(_streams[lhs], _streams[rhs]);
+    }
+
+    /**
+     * Rebuilds the tournament tree over all streams. The tree is a complete binary tree with
+     * _treeCapacity (the stream count rounded up to a power of two) leaves; internal node i covers
+     * leaves [i * 2, i * 2 + 1] of the level below and stores the slot index of the stream that
+     * lost the match played there, while the winner advances towards the root. _winner holds the
+     * slot that won every match.
+     */
+    void _rebuildTree() {
+        _treeCapacity = 1;
+        while (_treeCapacity < _streams.size()) {
+            _treeCapacity *= 2;
+        }
+        _tree.assign(_treeCapacity, kNoStream);
+        _winner = _buildSubtree(1);
+    }
+
+    size_t _buildSubtree(size_t node) {
+        if (node >= _treeCapacity) {
+            const size_t slot = node - _treeCapacity;
+            return (slot < _streams.size() && _streams[slot]) ? slot : kNoStream;
+        }
+        const size_t left = _buildSubtree(node * 2);
+        const size_t right = _buildSubtree(node * 2 + 1);
+        if (_beats(left, right)) {
+            _tree[node] = right;
+            return left;
+        }
+        _tree[node] = left;
+        return right;
+    }
+
+    /**
+     * Replays the matches on the path from 'slot''s leaf to the root after the stream in 'slot'
+     * advanced or was exhausted, and returns the new overall winner. All other matches in the tree
+     * are unaffected by the change, so this performs exactly log2(_treeCapacity) comparisons.
+     */
+    size_t _replayMatches(size_t slot) {
+        size_t candidate = _streams[slot] ? slot : kNoStream;
+        for (size_t node = (_treeCapacity + slot) / 2; node >= 1; node /= 2) {
+            if (_beats(_tree[node], candidate)) {
+                std::swap(_tree[node], candidate);
+            }
+        }
+        return candidate;
+    }
+
     SortOptions _opts;
     unsigned long long _remaining;
     bool _positioned;
     std::shared_ptr<Stream> _current;
-    std::vector<std::shared_ptr<Stream>> _heap;  // MinHeap
-    STLComparator _greater;                      // named so calls make sense
-    size_t _maxFile = 0;                         // The maximum file identifier used thus far
+
+    // One slot per stream ever added; exhausted slots are reset but keep their position so that
+    // tournament tree nodes, which store slot indexes, remain valid.
+    std::vector<std::shared_ptr<Stream>> _streams;
+    size_t _liveStreams = 0;  // Number of non-exhausted entries in _streams.
+
+    // Tournament tree of losers over _streams; see _rebuildTree(). Node 0 is unused.
+    std::vector<size_t> _tree;
+    size_t _treeCapacity = 0;
+    size_t _winner = kNoStream;
+
+    STLComparator _greater;  // named so calls make sense
+    size_t _maxFile = 0;     // The maximum file identifier used thus far
 };
 
 template <typename Key, typename Value, typename Comparator>
@@ -765,6 +883,7 @@ protected:
                             "beginIdx"_attr = i,
                             "endIdx"_attr = endIndex - 1);
 
+                this->_stats.updateMaxMergeWidth(spillsToMerge.size());
                 auto mergeIterator =
                     std::unique_ptr<Iterator>(Iterator::merge(spillsToMerge, this->_opts, _comp));
                 mergeIterator->openSource();
@@ -919,6 +1038,7 @@ public:
         spill();
         this->_mergeSpills(this->_spillsNumToRespectMemoryLimits);
 
+        this->_stats.updateMaxMergeWidth(this->_iters.size());
         return Iterator::merge(this->_iters, this->_opts, this->_comp);
     }
 
@@ -1200,6 +1320,7 @@ public:
         spill();
         this->_mergeSpills(this->_spillsNumToRespectMemoryLimits);
 
+        this->_stats.updateMaxMergeWidth(this->_iters.size());
         Iterator* iterator = Iterator::merge(this->_iters, this->_opts, this->_comp);
         _done = true;
         return iterator;
@@ -1445,6 +1566,12 @@ Sorter<Key, Value>::File::File(std::string path, SorterFileStats* stats)
 
 template <typename Key, typename Value>
 Sorter<Key, Value>::File::~File() {
+#ifdef __linux__
+    if (_adviseFd >= 0) {
+        ::close(_adviseFd);
+    }
+#endif
+
     if (_stats && _file.is_open()) {
         _stats->closed.addAndFetch(1);
     }
@@ -1518,6 +1645,9 @@ void Sorter<Key, Value>::File::write(const char* data, std::streamsize size) {
         if (_stats) {
             this->_stats->addSpilledDataSize(size);
         };
+        if (_offset - _cacheWritebackEnd >= kSpillCacheHintIntervalBytes) {
+            _adviseSpilledDataWillNotBeNeeded();
+        }
     } catch (const std::system_error& ex) {
         if (ex.code() == std::errc::no_space_on_device) {
             uasserted(ErrorCodes::OutOfDiskSpace,
@@ -1561,6 +1691,38 @@ void Sorter<Key, Value>::File::_open() {
     }
 }
 
+template <typename Key, typename Value>
+void Sorter<Key, Value>::File::_adviseSpilledDataWillNotBeNeeded() {
+#ifdef __linux__
+    // Spilled data is written once and read back at most once, so there is no reason for it to
+    // displace hotter pages (notably the storage engine's own I/O) from the page cache. Flush the
+    // stream so the data reaches the page cache, queue asynchronous writeback for the newly
+    // written range, and drop the range whose writeback was queued on the previous round and has
+    // had time to reach disk. Dropping only behind the writeback window avoids blocking on dirty
+    // pages, which posix_fadvise would silently skip. A failing flush throws and is reported
+    // through the caller's write error handling.
+    _file.flush();
+
+    if (_adviseFd < 0) {
+        _adviseFd = ::open(_path.string().c_str(), O_RDONLY | O_CLOEXEC);
+        if (_adviseFd < 0) {
+            return;
+        }
+    }
+
+    ::sync_file_range(
+        _adviseFd, _cacheWritebackEnd, _offset - _cacheWritebackEnd, SYNC_FILE_RANGE_WRITE);
+    if (_cacheWritebackEnd > _cacheDroppedEnd) {
+        ::posix_fadvise(_adviseFd,
+                        _cacheDroppedEnd,
+                        _cacheWritebackEnd - _cacheDroppedEnd,
+                        POSIX_FADV_DONTNEED);
+        _cacheDroppedEnd = _cacheWritebackEnd;
+    }
+    _cacheWritebackEnd = _offset;
+#endif
+}
+
 template <typename Key, typename Value>
 void Sorter<Key, Value>::File::_ensureOpenForWriting() {
     if (!_file.is_open()) {
@@ -371,6 +371,15 @@ public:
          */
         void _ensureOpenForWriting();
 
+        /**
+         * Hints to the OS that spilled data written so far should be written back to disk and
+         * dropped from the page cache, as it will be read back at most once. On Linux this queues
+         * asynchronous writeback for the most recently written range and evicts the previously
+         * written-back range; elsewhere it is a no-op. Failures are ignored since the hints are
+         * purely advisory.
+         */
+        void _adviseSpilledDataWillNotBeNeeded();
+
         boost::filesystem::path _path;
         std::fstream _file;
 
@@ -378,6 +387,13 @@ public:
         // file either has not yet been opened or has been flushed.
         std::streamoff _offset = -1;
 
+        // State for the rolling page-cache hints issued by _adviseSpilledDataWillNotBeNeeded().
+        // [0, _cacheDroppedEnd) has been dropped from the page cache and
+        // [_cacheDroppedEnd, _cacheWritebackEnd) has been queued for asynchronous writeback.
+        std::streamoff _cacheWritebackEnd = 0;
+        std::streamoff _cacheDroppedEnd = 0;
+        int _adviseFd = -1;  // Lazily opened file descriptor used to issue the hints.
+
         // Whether to keep the on-disk file even after this in-memory object has been destructed.
         bool _keep = false;
 
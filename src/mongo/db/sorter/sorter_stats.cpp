@@ -29,6 +29,7 @@
 
 #include "mongo/db/sorter/sorter_stats.h"
 
+#include <algorithm>
 
 #include "mongo/util/assert_util_core.h"
 
@@ -100,6 +101,21 @@ uint64_t SorterStats::bytesSorted() const {
     return _bytesSorted;
 }
 
+void SorterStats::updateMaxMergeWidth(uint64_t mergeWidth) {
+    _maxMergeWidth = std::max(_maxMergeWidth, mergeWidth);
+    if (_sorterTracker) {
+        long long current = _sorterTracker->maxMergeWidth.load();
+        while (current < static_cast<long long>(mergeWidth) &&
+               !_sorterTracker->maxMergeWidth.compareAndSwap(&current,
+                                                             static_cast<long long>(mergeWidth))) {
+        }
+    }
+}
+
+uint64_t SorterStats::maxMergeWidth() const {
+    return _maxMergeWidth;
+}
+
 void SorterStats::incrementMemUsage(uint64_t memUsage) {
     _memUsage += memUsage;
     if (_sorterTracker) {
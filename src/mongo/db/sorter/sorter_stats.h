@@ -45,6 +45,7 @@ struct SorterTracker {
     AtomicWord<long long> numSorted{0};
     AtomicWord<long long> bytesSorted{0};
     AtomicWord<long long> memUsage{0};
+    AtomicWord<long long> maxMergeWidth{0};
 };
 
 /**
@@ -95,6 +96,14 @@ public:
     void incrementBytesSorted(uint64_t bytes);
     uint64_t bytesSorted() const;
 
+    /**
+     * Records the number of spilled ranges combined in one merge pass, keeping the maximum
+     * observed. This reports the width of the k-way merge: how many runs the sorter consumed
+     * simultaneously.
+     */
+    void updateMaxMergeWidth(uint64_t mergeWidth);
+    uint64_t maxMergeWidth() const;
+
     void incrementMemUsage(uint64_t memUsage);
     void decrementMemUsage(uint64_t memUsage);
     void resetMemUsage();
@@ -106,6 +115,7 @@ private:
     uint64_t _numSorted = 0;      // Number of keys sorted.
     uint64_t _bytesSorted = 0;    // Total bytes of data sorted.
     uint64_t _memUsage = 0;       // Current memory being used.
+    uint64_t _maxMergeWidth = 0;  // Widest merge pass performed.
 
     // All SorterStats update the SorterTracker to report sorter statistics for the
     // server.
@@ -111,6 +111,27 @@ TEST(SorterStatsTest, SingleSorterSpilledRanges) {
     ASSERT_EQ(sorterTracker.spilledRanges.load(), 2);
 }
 
+TEST(SorterStatsTest, MultipleSortersMaxMergeWidth) {
+    SorterTracker sorterTracker;
+    SorterStats sorterStats1(&sorterTracker);
+    SorterStats sorterStats2(&sorterTracker);
+
+    sorterStats1.updateMaxMergeWidth(4);
+    ASSERT_EQ(sorterStats1.maxMergeWidth(), 4);
+    ASSERT_EQ(sorterTracker.maxMergeWidth.load(), 4);
+
+    // A narrower merge does not lower the maximum.
+    sorterStats1.updateMaxMergeWidth(2);
+    ASSERT_EQ(sorterStats1.maxMergeWidth(), 4);
+    ASSERT_EQ(sorterTracker.maxMergeWidth.load(), 4);
+
+    // The tracker reports the widest merge across all sorters.
+    sorterStats2.updateMaxMergeWidth(8);
+    ASSERT_EQ(sorterStats1.maxMergeWidth(), 4);
+    ASSERT_EQ(sorterStats2.maxMergeWidth(), 8);
+    ASSERT_EQ(sorterTracker.maxMergeWidth.load(), 8);
+}
+
 TEST(SorterStatsTest, MultipleSortersSpilledRanges) {
     SorterTracker sorterTracker;
     SorterStats sorterStats1(&sorterTracker);
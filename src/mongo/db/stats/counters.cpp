@@ -46,52 +46,55 @@ namespace mongo {
 using namespace fmt::literals;
 
 void OpCounters::_reset() {
-    _insert->store(0);
-    _query->store(0);
-    _update->store(0);
-    _delete->store(0);
-    _getmore->store(0);
-    _command->store(0);
-    _nestedAggregate->store(0);
-
-    _queryDeprecated->store(0);
-
-    _insertOnExistingDoc->store(0);
-    _updateOnMissingDoc->store(0);
-    _deleteWasEmpty->store(0);
-    _deleteFromMissingNamespace->store(0);
-    _acceptableErrorInCommand->store(0);
+    _insert.reset();
+    _query.reset();
+    _update.reset();
+    _delete.reset();
+    _getmore.reset();
+    _command.reset();
+    _nestedAggregate.reset();
+
+    _queryDeprecated.reset();
+
+    _insertOnExistingDoc.reset();
+    _updateOnMissingDoc.reset();
+    _deleteWasEmpty.reset();
+    _deleteFromMissingNamespace.reset();
+    _acceptableErrorInCommand.reset();
 }
 
-void OpCounters::_checkWrap(CacheExclusive<AtomicWord<long long>> OpCounters::*counter, int n) {
-    static constexpr auto maxCount = 1LL << 60;
-    auto oldValue = (this->*counter)->fetchAndAddRelaxed(n);
-    if (oldValue > maxCount) {
+void OpCounters::_checkWrap(ShardedCounter64 OpCounters::*counter, int n) {
+    // The increment only reveals the local stripe's old value, so guard each stripe against its
+    // share of the historical 2^60 budget rather than summing on every bump.
+    static const auto maxCountPerStripe =
+        (1LL << 60) / static_cast<long long>(ShardedCounter64::numStripes());
+    auto oldValue = (this->*counter).increment(n);
+    if (oldValue > maxCountPerStripe) {
         _reset();
     }
 }
 
 BSONObj OpCounters::getObj() const {
     BSONObjBuilder b;
-    b.append("insert", _insert->loadRelaxed());
-    b.append("query", _query->loadRelaxed());
-    b.append("update", _update->loadRelaxed());
-    b.append("delete", _delete->loadRelaxed());
-    b.append("getmore", _getmore->loadRelaxed());
-    b.append("command", _command->loadRelaxed());
-
-    auto queryDep = _queryDeprecated->loadRelaxed();
+    b.append("insert", _insert.sum());
+    b.append("query", _query.sum());
+    b.append("update", _update.sum());
+    b.append("delete", _delete.sum());
+    b.append("getmore", _getmore.sum());
+    b.append("command", _command.sum());
+
+    auto queryDep = _queryDeprecated.sum();
     if (queryDep > 0) {
         BSONObjBuilder d(b.subobjStart("deprecated"));
         d.append("query", queryDep);
     }
 
     // Append counters for constraint relaxations, only if they exist.
-    auto insertOnExistingDoc = _insertOnExistingDoc->loadRelaxed();
-    auto updateOnMissingDoc = _updateOnMissingDoc->loadRelaxed();
-    auto deleteWasEmpty = _deleteWasEmpty->loadRelaxed();
-    auto deleteFromMissingNamespace = _deleteFromMissingNamespace->loadRelaxed();
-    auto acceptableErrorInCommand = _acceptableErrorInCommand->loadRelaxed();
+    auto insertOnExistingDoc = _insertOnExistingDoc.sum();
+    auto updateOnMissingDoc = _updateOnMissingDoc.sum();
+    auto deleteWasEmpty = _deleteWasEmpty.sum();
+    auto deleteFromMissingNamespace = _deleteFromMissingNamespace.sum();
+    auto acceptableErrorInCommand = _acceptableErrorInCommand.sum();
     auto totalRelaxed = insertOnExistingDoc + updateOnMissingDoc + deleteWasEmpty +
         deleteFromMissingNamespace + acceptableErrorInCommand;
 
@@ -107,60 +110,48 @@ BSONObj OpCounters::getObj() const {
     return b.obj();
 }
 
-void NetworkCounter::hitPhysicalIn(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
+namespace {
+// Per-stripe share of the historical 2^60 overflow budget; stripes only reveal their own old
+// value on increment.
+int64_t networkCounterMax() {
+    static const int64_t max =
+        (1LL << 60) / static_cast<int64_t>(ShardedCounter64::numStripes());
+    return max;
+}
+}  // namespace
 
+void NetworkCounter::hitPhysicalIn(long long bytes) {
     // don't care about the race as its just a counter
-    const bool overflow = _physicalBytesIn->loadRelaxed() > MAX;
-
-    if (overflow) {
-        _physicalBytesIn->store(bytes);
-    } else {
-        _physicalBytesIn->fetchAndAdd(bytes);
+    if (_physicalBytesIn.increment(bytes) > networkCounterMax()) {
+        _physicalBytesIn.reset();
     }
 }
 
 void NetworkCounter::hitPhysicalOut(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
     // don't care about the race as its just a counter
-    const bool overflow = _physicalBytesOut->loadRelaxed() > MAX;
-
-    if (overflow) {
-        _physicalBytesOut->store(bytes);
-    } else {
-        _physicalBytesOut->fetchAndAdd(bytes);
+    if (_physicalBytesOut.increment(bytes) > networkCounterMax()) {
+        _physicalBytesOut.reset();
     }
 }
 
 void NetworkCounter::hitLogicalIn(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
     // don't care about the race as its just a counter
-    const bool overflow = _together->logicalBytesIn.loadRelaxed() > MAX;
+    const bool overflow = _logicalBytesIn.increment(bytes) > networkCounterMax();
+    // The requests field only gets incremented here (and not in hitPhysical) because the
+    // hitLogical and hitPhysical are each called for each operation. Incrementing it in both
+    // functions would double-count the number of operations.
+    _requests.increment(1);
 
     if (overflow) {
-        _together->logicalBytesIn.store(bytes);
-        // The requests field only gets incremented here (and not in hitPhysical) because the
-        // hitLogical and hitPhysical are each called for each operation. Incrementing it in both
-        // functions would double-count the number of operations.
-        _together->requests.store(1);
-    } else {
-        _together->logicalBytesIn.fetchAndAdd(bytes);
-        _together->requests.fetchAndAdd(1);
+        _logicalBytesIn.reset();
+        _requests.reset();
     }
 }
 
 void NetworkCounter::hitLogicalOut(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
     // don't care about the race as its just a counter
-    const bool overflow = _logicalBytesOut->loadRelaxed() > MAX;
-
-    if (overflow) {
-        _logicalBytesOut->store(bytes);
-    } else {
-        _logicalBytesOut->fetchAndAdd(bytes);
+    if (_logicalBytesOut.increment(bytes) > networkCounterMax()) {
+        _logicalBytesOut.reset();
     }
 }
 
@@ -177,13 +168,13 @@ void NetworkCounter::acceptedTFOIngress() {
 }
 
 void NetworkCounter::append(BSONObjBuilder& b) {
-    b.append("bytesIn", static_cast<long long>(_together->logicalBytesIn.loadRelaxed()));
-    b.append("bytesOut", static_cast<long long>(_logicalBytesOut->loadRelaxed()));
-    b.append("physicalBytesIn", static_cast<long long>(_physicalBytesIn->loadRelaxed()));
-    b.append("physicalBytesOut", static_cast<long long>(_physicalBytesOut->loadRelaxed()));
+    b.append("bytesIn", _logicalBytesIn.sum());
+    b.append("bytesOut", _logicalBytesOut.sum());
+    b.append("physicalBytesIn", _physicalBytesIn.sum());
+    b.append("physicalBytesOut", _physicalBytesOut.sum());
     b.append("numSlowDNSOperations", static_cast<long long>(_numSlowDNSOperations->loadRelaxed()));
     b.append("numSlowSSLOperations", static_cast<long long>(_numSlowSSLOperations->loadRelaxed()));
-    b.append("numRequests", static_cast<long long>(_together->requests.loadRelaxed()));
+    b.append("numRequests", _requests.sum());
 
     BSONObjBuilder tfo;
 #ifdef __linux__
@@ -51,6 +51,7 @@
 #include "mongo/util/aligned.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/processinfo.h"
+#include "mongo/util/sharded_counter.h"
 #include "mongo/util/str.h"
 #include "mongo/util/string_map.h"
 
@@ -115,41 +116,41 @@ public:
     }
 
     // thse are used by metrics things, do not remove
-    const AtomicWord<long long>* getInsert() const {
-        return &*_insert;
+    long long getInsert() const {
+        return _insert.sum();
     }
-    const AtomicWord<long long>* getQuery() const {
-        return &*_query;
+    long long getQuery() const {
+        return _query.sum();
     }
-    const AtomicWord<long long>* getUpdate() const {
-        return &*_update;
+    long long getUpdate() const {
+        return _update.sum();
     }
-    const AtomicWord<long long>* getDelete() const {
-        return &*_delete;
+    long long getDelete() const {
+        return _delete.sum();
     }
-    const AtomicWord<long long>* getGetMore() const {
-        return &*_getmore;
+    long long getGetMore() const {
+        return _getmore.sum();
     }
-    const AtomicWord<long long>* getCommand() const {
-        return &*_command;
+    long long getCommand() const {
+        return _command.sum();
     }
-    const AtomicWord<long long>* getNestedAggregate() const {
-        return &*_nestedAggregate;
+    long long getNestedAggregate() const {
+        return _nestedAggregate.sum();
     }
-    const AtomicWord<long long>* getInsertOnExistingDoc() const {
-        return &*_insertOnExistingDoc;
+    long long getInsertOnExistingDoc() const {
+        return _insertOnExistingDoc.sum();
     }
-    const AtomicWord<long long>* getUpdateOnMissingDoc() const {
-        return &*_updateOnMissingDoc;
+    long long getUpdateOnMissingDoc() const {
+        return _updateOnMissingDoc.sum();
     }
-    const AtomicWord<long long>* getDeleteWasEmpty() const {
-        return &*_deleteWasEmpty;
+    long long getDeleteWasEmpty() const {
+        return _deleteWasEmpty.sum();
     }
-    const AtomicWord<long long>* getDeleteFromMissingNamespace() const {
-        return &*_deleteFromMissingNamespace;
+    long long getDeleteFromMissingNamespace() const {
+        return _deleteFromMissingNamespace.sum();
     }
-    const AtomicWord<long long>* getAcceptableErrorInCommand() const {
-        return &*_acceptableErrorInCommand;
+    long long getAcceptableErrorInCommand() const {
+        return _acceptableErrorInCommand.sum();
     }
 
     // Reset all counters. To used for testing purposes only.
@@ -161,25 +162,26 @@ private:
     // Reset all counters.
     void _reset();
 
-    // Increment member `counter` by `n`, resetting all counters if it was > 2^60.
-    void _checkWrap(CacheExclusive<AtomicWord<long long>> OpCounters::*counter, int n);
+    // Increment member `counter` by `n`, resetting all counters if its local stripe grew past
+    // its share of 2^60.
+    void _checkWrap(ShardedCounter64 OpCounters::*counter, int n);
 
-    CacheExclusive<AtomicWord<long long>> _insert;
-    CacheExclusive<AtomicWord<long long>> _query;
-    CacheExclusive<AtomicWord<long long>> _update;
-    CacheExclusive<AtomicWord<long long>> _delete;
-    CacheExclusive<AtomicWord<long long>> _getmore;
-    CacheExclusive<AtomicWord<long long>> _command;
-    CacheExclusive<AtomicWord<long long>> _nestedAggregate;
+    ShardedCounter64 _insert;
+    ShardedCounter64 _query;
+    ShardedCounter64 _update;
+    ShardedCounter64 _delete;
+    ShardedCounter64 _getmore;
+    ShardedCounter64 _command;
+    ShardedCounter64 _nestedAggregate;
 
-    CacheExclusive<AtomicWord<long long>> _insertOnExistingDoc;
-    CacheExclusive<AtomicWord<long long>> _updateOnMissingDoc;
-    CacheExclusive<AtomicWord<long long>> _deleteWasEmpty;
-    CacheExclusive<AtomicWord<long long>> _deleteFromMissingNamespace;
-    CacheExclusive<AtomicWord<long long>> _acceptableErrorInCommand;
+    ShardedCounter64 _insertOnExistingDoc;
+    ShardedCounter64 _updateOnMissingDoc;
+    ShardedCounter64 _deleteWasEmpty;
+    ShardedCounter64 _deleteFromMissingNamespace;
+    ShardedCounter64 _acceptableErrorInCommand;
 
     // Counter for the deprecated OP_QUERY opcode.
-    CacheExclusive<AtomicWord<long long>> _queryDeprecated;
+    ShardedCounter64 _queryDeprecated;
 };
 
 extern OpCounters globalOpCounters;
@@ -220,22 +222,16 @@ public:
     void append(BSONObjBuilder& b);
 
 private:
-    CacheExclusive<AtomicWord<long long>> _physicalBytesIn{0};
-    CacheExclusive<AtomicWord<long long>> _physicalBytesOut{0};
-
-    // These two counters are always incremented at the same time, so
-    // we place them on the same cache line. We use
-    // CacheCombinedExclusive to ensure that they are combined within
-    // the scope of a constructive interference region, and protected
-    // from false sharing by padding out to destructive interference
-    // size.
-    struct Together {
-        AtomicWord<long long> logicalBytesIn{0};
-        AtomicWord<long long> requests{0};
-    };
-    CacheCombinedExclusive<Together> _together{};
+    ShardedCounter64 _physicalBytesIn;
+    ShardedCounter64 _physicalBytesOut;
+
+    // These two counters are always incremented at the same time (hitLogical and hitPhysical
+    // are each called once per operation), so both increments land on the caller's local
+    // stripes back to back.
+    ShardedCounter64 _logicalBytesIn;
+    ShardedCounter64 _requests;
 
-    CacheExclusive<AtomicWord<long long>> _logicalBytesOut{0};
+    ShardedCounter64 _logicalBytesOut;
 
     CacheExclusive<AtomicWord<long long>> _numSlowDNSOperations{0};
     CacheExclusive<AtomicWord<long long>> _numSlowSSLOperations{0};
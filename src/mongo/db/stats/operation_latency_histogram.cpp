@@ -35,6 +35,7 @@
 #include "mongo/db/server_options.h"
 #include "mongo/db/stats/operation_latency_histogram.h"
 #include "mongo/platform/bits.h"
+#include "mongo/util/sharded_counter.h"
 
 namespace mongo {
 namespace {
@@ -271,16 +272,41 @@ void OperationLatencyHistogram::append(bool includeHistograms,
     appendHistograms(_histograms, includeHistograms, slowMSBucketsOnly, *builder);
 }
 
+AtomicOperationLatencyHistogram::AtomicOperationLatencyHistogram()
+    : _stripes(std::make_unique<Stripe[]>(ShardedCounter64::numStripes())) {}
+
 void AtomicOperationLatencyHistogram::increment(uint64_t latency,
                                                 Command::ReadWriteType type,
                                                 bool isQueryableEncryptionOperation) {
-    ::mongo::increment(_histograms, latency, type, isQueryableEncryptionOperation);
+    ::mongo::increment(_stripes[ShardedCounter64::currentStripe()].histograms,
+                       latency,
+                       type,
+                       isQueryableEncryptionOperation);
 }
 
 void AtomicOperationLatencyHistogram::append(bool includeHistograms,
                                              bool slowMSBucketsOnly,
                                              BSONObjBuilder* builder) const {
-    appendHistograms(_histograms, includeHistograms, slowMSBucketsOnly, *builder);
+    // Merge the per-CPU stripes into one plain histogram per operation type, then report it the
+    // same way as the unsharded flavor. Reads are relaxed, matching the partial-update tolerance
+    // documented on this class.
+    std::array<OperationLatencyHistogram::HistogramType,
+               operation_latency_histogram_details::kHistogramsCount>
+        merged{};
+    for (size_t s = 0, n = ShardedCounter64::numStripes(); s != n; ++s) {
+        for (size_t i = 0; i < operation_latency_histogram_details::kHistogramsCount; ++i) {
+            const auto& stripe = _stripes[s].histograms[i];
+            auto& out = merged[i];
+            for (size_t b = 0; b < operation_latency_histogram_details::kMaxBuckets; ++b) {
+                out.buckets[b] += stripe.buckets[b].loadRelaxed();
+            }
+            out.entryCount += stripe.entryCount.loadRelaxed();
+            out.sum += stripe.sum.loadRelaxed();
+            out.sumQueryableEncryption += stripe.sumQueryableEncryption.loadRelaxed();
+        }
+    }
+
+    appendHistograms(merged, includeHistograms, slowMSBucketsOnly, *builder);
 }
 
 }  // namespace mongo
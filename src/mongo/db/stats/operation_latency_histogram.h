@@ -30,6 +30,7 @@
 
 #include <array>
 #include <cstdint>
+#include <memory>
 
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/commands.h"
@@ -86,10 +87,21 @@ class AtomicOperationLatencyHistogram {
 public:
     using HistogramType = operation_latency_histogram_details::HistogramData<Atomic<uint64_t>>;
 
+    AtomicOperationLatencyHistogram();
+
     void increment(uint64_t latency, Command::ReadWriteType type, bool isQueryableEncryptionOp);
     void append(bool includeHistograms, bool slowMSBucketsOnly, BSONObjBuilder* builder) const;
 
 private:
-    std::array<HistogramType, operation_latency_histogram_details::kHistogramsCount> _histograms;
+    // The histograms are sharded by CPU like ShardedCounter64: every user operation bumps
+    // several counters here, so one shared set of atomics makes its cache lines ping-pong
+    // between all cores. Each CPU instead updates its own copy with relaxed increments, and
+    // append() merges the stripes into a single histogram, leaving the reported output
+    // unchanged.
+    struct Stripe {
+        std::array<HistogramType, operation_latency_histogram_details::kHistogramsCount>
+            histograms;
+    };
+    std::unique_ptr<Stripe[]> _stripes;
 };
 }  // namespace mongo
@@ -29,19 +29,23 @@
 
 
 // IWYU pragma: no_include "cxxabi.h"
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <mutex>
 #include <utility>
 
+#include "mongo/base/counter.h"
 #include "mongo/base/string_data.h"
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/client.h"
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/checkpointer.h"
 #include "mongo/db/storage/storage_engine.h"
 #include "mongo/db/storage/storage_options.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
@@ -64,6 +68,18 @@ const auto getCheckpointer = ServiceContext::declareDecoration<std::unique_ptr<C
 
 MONGO_FAIL_POINT_DEFINE(pauseCheckpointThread);
 
+// How often the checkpoint thread re-examines the dirty-data threshold while waiting out the
+// syncdelay window. The period is arbitrary, but short enough to catch dirty spikes well before
+// the next scheduled checkpoint.
+const Milliseconds kDirtyDataCheckPeriod = Seconds(1);
+
+auto& checkpointsTriggeredByDirtyData =
+    *MetricBuilder<Counter64>("storage.checkpoint.triggeredByDirtyDataThreshold");
+auto& predictedCheckpointDurationMillis =
+    *MetricBuilder<Atomic64Metric>("storage.checkpoint.predictedDurationMillis");
+auto& lastCheckpointDurationMillis =
+    *MetricBuilder<Atomic64Metric>("storage.checkpoint.lastDurationMillis");
+
 }  // namespace
 
 Checkpointer* Checkpointer::get(ServiceContext* serviceCtx) {
@@ -92,29 +108,59 @@ void Checkpointer::run() {
         tc.get()->setSystemOperationUnkillableByStepdown(lk);
     }
 
+    // Exponentially weighted estimate of checkpoint throughput, in dirty bytes flushed per
+    // millisecond, used to predict the duration of the next checkpoint. Zero until the first
+    // checkpoint with a measurable amount of dirty data has completed.
+    double checkpointBytesPerMillis = 0;
+
     while (true) {
         auto opCtx = tc->makeOperationContext();
+        StorageEngine* storageEngine = opCtx->getServiceContext()->getStorageEngine();
+        bool dirtyDataTriggered = false;
 
         {
             stdx::unique_lock<Latch> lock(_mutex);
             MONGO_IDLE_THREAD_BLOCK;
 
-            // Wait for 'storageGlobalParams.syncdelay' seconds; or until either shutdown is
-            // signaled or a checkpoint is triggered.
+            // Wait for 'storageGlobalParams.syncdelay' seconds; or until shutdown is signaled, a
+            // checkpoint is triggered, or the amount of dirty data in the storage engine cache
+            // exceeds 'checkpointDirtyDataThresholdMB' (when that parameter is enabled).
             LOGV2_DEBUG(7702900,
                         1,
                         "Checkpoint thread sleeping",
                         "duration"_attr = static_cast<std::int64_t>(storageGlobalParams.syncdelay));
-            _sleepCV.wait_for(
-                lock,
-                stdx::chrono::seconds(static_cast<std::int64_t>(storageGlobalParams.syncdelay)),
-                [&] { return _shuttingDown || _triggerCheckpoint; });
-
-            // If the syncdelay is set to 0, that means we should skip checkpointing. However,
-            // syncdelay is adjustable by a runtime server parameter, so we need to wake up to check
-            // periodically. The wakeup to check period is arbitrary.
-            while (storageGlobalParams.syncdelay == 0 && !_shuttingDown && !_triggerCheckpoint) {
-                _sleepCV.wait_for(lock, stdx::chrono::seconds(static_cast<std::int64_t>(3)), [&] {
+            const Date_t windowStart = Date_t::now();
+            while (!_shuttingDown && !_triggerCheckpoint) {
+                // The syncdelay is adjustable by a runtime server parameter, so re-read it on each
+                // wakeup. A syncdelay of 0 means we should skip checkpointing, but we still need to
+                // wake up to check the parameter periodically. That wakeup period is arbitrary.
+                const auto syncdelay = static_cast<std::int64_t>(storageGlobalParams.syncdelay);
+                if (syncdelay == 0) {
+                    _sleepCV.wait_for(lock, stdx::chrono::seconds(static_cast<std::int64_t>(3)), [&] {
+                        return _shuttingDown || _triggerCheckpoint;
+                    });
+                    continue;
+                }
+
+                const Milliseconds remaining = windowStart + Seconds(syncdelay) - Date_t::now();
+                if (remaining <= Milliseconds::zero()) {
+                    break;
+                }
+
+                // When dirty-data pacing is enabled, checkpoint early if the cache has accumulated
+                // more dirty data than the configured threshold, rather than letting it keep
+                // growing until the syncdelay expires and then paying for one large flush.
+                const int64_t thresholdBytes =
+                    static_cast<int64_t>(gCheckpointDirtyDataThresholdMB.load()) * 1024 * 1024;
+                if (thresholdBytes > 0 &&
+                    storageEngine->getCacheDirtyBytes() >= thresholdBytes) {
+                    dirtyDataTriggered = true;
+                    break;
+                }
+
+                const Milliseconds waitPeriod =
+                    thresholdBytes > 0 ? std::min(remaining, kDirtyDataCheckPeriod) : remaining;
+                _sleepCV.wait_for(lock, waitPeriod.toSystemDuration(), [&] {
                     return _shuttingDown || _triggerCheckpoint;
                 });
             }
@@ -135,10 +181,32 @@ void Checkpointer::run() {
 
         pauseCheckpointThread.pauseWhileSet();
 
+        if (dirtyDataTriggered) {
+            checkpointsTriggeredByDirtyData.increment();
+        }
+
+        const int64_t dirtyBytesAtStart = storageEngine->getCacheDirtyBytes();
+        if (checkpointBytesPerMillis > 0) {
+            predictedCheckpointDurationMillis.set(
+                static_cast<int64_t>(dirtyBytesAtStart / checkpointBytesPerMillis));
+        }
+
         const Date_t startTime = Date_t::now();
-        opCtx->getServiceContext()->getStorageEngine()->checkpoint();
+        storageEngine->checkpoint();
+
+        const auto millisElapsed = durationCount<Milliseconds>(Date_t::now() - startTime);
+        lastCheckpointDurationMillis.set(millisElapsed);
+
+        // Fold the observed throughput into the estimate, weighting recent checkpoints more
+        // heavily than old history so the prediction tracks changes in checkpoint behaviour.
+        if (millisElapsed > 0 && dirtyBytesAtStart > 0) {
+            const double observed = static_cast<double>(dirtyBytesAtStart) / millisElapsed;
+            checkpointBytesPerMillis = checkpointBytesPerMillis > 0
+                ? 0.8 * checkpointBytesPerMillis + 0.2 * observed
+                : observed;
+        }
 
-        const auto secondsElapsed = durationCount<Seconds>(Date_t::now() - startTime);
+        const auto secondsElapsed = millisElapsed / 1000;
         if (secondsElapsed >= 30) {
             LOGV2_DEBUG(22308,
                         1,
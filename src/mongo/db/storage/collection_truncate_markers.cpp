@@ -349,17 +349,38 @@ CollectionTruncateMarkers::InitialSetOfMarkers CollectionTruncateMarkers::create
         }
     }
 
-    std::sort(collectionEstimates.begin(),
-              collectionEstimates.end(),
-              [](const auto& a, const auto& b) { return a.id < b.id; });
     LOGV2(7393205, "Collection sampling complete", "namespace"_attr = ns);
 
+    return createMarkersFromSampleEstimates(
+        std::move(collectionEstimates),
+        ns,
+        collectionIterator.numRecords(opCtx),
+        collectionIterator.dataSize(opCtx),
+        estimatedRecordsPerMarker,
+        estimatedBytesPerMarker,
+        Microseconds{static_cast<int64_t>(curTimeMicros64() - startTime)});
+}
+
+CollectionTruncateMarkers::InitialSetOfMarkers
+CollectionTruncateMarkers::createMarkersFromSampleEstimates(
+    std::vector<RecordIdAndWallTime> estimates,
+    const NamespaceString& ns,
+    int64_t numRecords,
+    int64_t dataSize,
+    int64_t estimatedRecordsPerMarker,
+    int64_t estimatedBytesPerMarker,
+    Microseconds timeTaken) {
+    std::sort(estimates.begin(), estimates.end(), [](const auto& a, const auto& b) {
+        return a.id < b.id;
+    });
+
+    int64_t wholeMarkers = numRecords / estimatedRecordsPerMarker;
     std::deque<Marker> markers;
     for (int i = 1; i <= wholeMarkers; ++i) {
         // Use every (kRandomSamplesPerMarker)th sample, starting with the
         // (kRandomSamplesPerMarker - 1)th, as the last record for each marker.
         // If parsing "wall" fails, we crash to allow user to fix their collection.
-        const auto& [id, wallTime] = collectionEstimates[kRandomSamplesPerMarker * i - 1];
+        const auto& [id, wallTime] = estimates[kRandomSamplesPerMarker * i - 1];
 
         LOGV2_DEBUG(7393204,
                     1,
@@ -372,15 +393,13 @@ CollectionTruncateMarkers::InitialSetOfMarkers CollectionTruncateMarkers::create
     }
 
     // Account for the partially filled chunk.
-    auto currentRecords =
-        collectionIterator.numRecords(opCtx) - estimatedRecordsPerMarker * wholeMarkers;
-    auto currentBytes = collectionIterator.dataSize(opCtx) - estimatedBytesPerMarker * wholeMarkers;
-    return CollectionTruncateMarkers::InitialSetOfMarkers{
-        std::move(markers),
-        currentRecords,
-        currentBytes,
-        Microseconds{static_cast<int64_t>(curTimeMicros64() - startTime)},
-        MarkersCreationMethod::Sampling};
+    auto currentRecords = numRecords - estimatedRecordsPerMarker * wholeMarkers;
+    auto currentBytes = dataSize - estimatedBytesPerMarker * wholeMarkers;
+    return CollectionTruncateMarkers::InitialSetOfMarkers{std::move(markers),
+                                                          currentRecords,
+                                                          currentBytes,
+                                                          timeTaken,
+                                                          MarkersCreationMethod::Sampling};
 }
 
 CollectionTruncateMarkers::MarkersCreationMethod
@@ -255,6 +255,18 @@ public:
         int64_t estimatedBytesPerMarker,
         std::function<RecordIdAndWallTime(const Record&)> getRecordIdAndWallTime);
 
+    // Builds the initial set of markers from pre-collected random sample estimates. 'estimates'
+    // need not be sorted. This is the merge step of the sampling path above, exposed so that
+    // storage engines may collect the samples on several threads and combine them.
+    static InitialSetOfMarkers createMarkersFromSampleEstimates(
+        std::vector<RecordIdAndWallTime> estimates,
+        const NamespaceString& ns,
+        int64_t numRecords,
+        int64_t dataSize,
+        int64_t estimatedRecordsPerMarker,
+        int64_t estimatedBytesPerMarker,
+        Microseconds timeTaken);
+
     void setMinBytesPerMarker(int64_t size);
 
     static constexpr uint64_t kRandomSamplesPerMarker = 10;
@@ -466,6 +466,47 @@ TEST_F(CollectionMarkersTest, SamplingMarkerCreation) {
     }
 }
 
+// Test that marker creation from pre-collected sample estimates tolerates unsorted input, as
+// produced when several sampling threads merge their estimates.
+TEST_F(CollectionMarkersTest, MarkerCreationFromUnsortedSampleEstimates) {
+    static constexpr int64_t kNumRecords = 100;
+    static constexpr int64_t kRecordSize = 50;
+    static constexpr int64_t kRecordsPerMarker = 10;
+
+    auto collNs = NamespaceString::createNamespaceString_forTest("test", "coll");
+
+    // Simulate the concatenation of three workers' estimates: each holds an interleaved third of
+    // the collection, so the combined vector is far from sorted.
+    std::vector<CollectionTruncateMarkers::RecordIdAndWallTime> estimates;
+    for (int64_t offset = 0; offset < 3; offset++) {
+        for (int64_t id = 1 + offset; id <= kNumRecords; id += 3) {
+            estimates.emplace_back(RecordId(id), Date_t::fromMillisSinceEpoch(id));
+        }
+    }
+    ASSERT_EQ(estimates.size(), kNumRecords);
+
+    auto result = CollectionTruncateMarkers::createMarkersFromSampleEstimates(
+        std::move(estimates),
+        collNs,
+        kNumRecords,
+        kNumRecords * kRecordSize,
+        kRecordsPerMarker,
+        kRecordsPerMarker * kRecordSize,
+        Microseconds{0});
+
+    ASSERT_EQ(result.methodUsed, CollectionTruncateMarkers::MarkersCreationMethod::Sampling);
+    ASSERT_EQ(result.markers.size(), kNumRecords / kRecordsPerMarker);
+    int64_t expectedId = kRecordsPerMarker;
+    for (const auto& marker : result.markers) {
+        ASSERT_EQ(marker.lastRecord, RecordId(expectedId));
+        ASSERT_EQ(marker.records, kRecordsPerMarker);
+        ASSERT_EQ(marker.bytes, kRecordsPerMarker * kRecordSize);
+        expectedId += kRecordsPerMarker;
+    }
+    ASSERT_EQ(result.leftoverRecordsCount, 0);
+    ASSERT_EQ(result.leftoverRecordsBytes, 0);
+}
+
 // Tests that auto yielding with query plan iterators works
 TEST_F(CollectionMarkersTest, ScanningAutoYieldingWorks) {
     // Manually set the yielding parameters to make the yield count computation simpler.
@@ -34,14 +34,17 @@
 #include <mutex>
 #include <utility>
 
+#include "mongo/base/counter.h"
 #include "mongo/base/error_codes.h"
 #include "mongo/base/string_data.h"
 #include "mongo/db/admission/execution_admission_context.h"
 #include "mongo/db/client.h"
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/storage/control/journal_flusher.h"
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/storage_options.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/db/transaction_resources.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
@@ -69,6 +72,13 @@ const auto getJournalFlusher = ServiceContext::declareDecoration<std::unique_ptr
 MONGO_FAIL_POINT_DEFINE(pauseJournalFlusherBeforeFlush);
 MONGO_FAIL_POINT_DEFINE(pauseJournalFlusherThread);
 
+auto& journalFlusherBatchedWaiters =
+    *MetricBuilder<Counter64>("storage.journalFlusher.batchedWaiters");
+auto& journalFlusherLastBatchSize =
+    *MetricBuilder<Atomic64Metric>("storage.journalFlusher.lastBatchSize");
+auto& journalFlusherMaxBatchSize =
+    *MetricBuilder<Atomic64Metric>("storage.journalFlusher.maxBatchSize");
+
 }  // namespace
 
 JournalFlusher* JournalFlusher::get(ServiceContext* serviceCtx) {
@@ -189,6 +199,21 @@ void JournalFlusher::run() {
             });
         }
 
+        // Hold the next round open briefly once a waiter has requested a flush, so that
+        // concurrent durability waiters join the same flush instead of each forcing their own
+        // round. The window closes early once enough waiters have been batched. Periodic
+        // (timeout-driven) rounds have no waiters and are not delayed.
+        const auto groupCommitWindow =
+            Microseconds(gJournalFlusherGroupCommitWindowMicros.load());
+        if (_flushJournalNow && groupCommitWindow > Microseconds(0) && !_needToPause &&
+            !_shuttingDown) {
+            const auto windowDeadline = Date_t::now() + groupCommitWindow;
+            _flushJournalNowCV.wait_until(lk, windowDeadline.toSystemTimePoint(), [&] {
+                return _nextRoundWaiters >= gJournalFlusherGroupCommitMaxWaiters.load() ||
+                    _needToPause || _shuttingDown;
+            });
+        }
+
         if (_needToPause) {
             _state = States::Paused;
             _stateChangeCV.notify_all();
@@ -214,6 +239,13 @@ void JournalFlusher::run() {
             return;
         }
 
+        if (_nextRoundWaiters > 0) {
+            journalFlusherBatchedWaiters.increment(_nextRoundWaiters);
+            journalFlusherLastBatchSize.set(_nextRoundWaiters);
+            journalFlusherMaxBatchSize.setToMax(_nextRoundWaiters);
+            _nextRoundWaiters = 0;
+        }
+
         // Take the next promise as current and reset the next promise.
         _currentSharedPromise =
             std::exchange(_nextSharedPromise, std::make_unique<SharedPromise<void>>());
@@ -257,6 +289,12 @@ void JournalFlusher::waitForJournalFlush(Interruptible* interruptible) {
     auto myFuture = [&]() {
         stdx::lock_guard<Latch> lk(_stateMutex);
         _triggerJournalFlush(lk);
+        // _triggerJournalFlush only notifies the flusher for the first waiter of a round. Once
+        // enough waiters have been batched, wake it again so it can close its group commit
+        // window early.
+        if (++_nextRoundWaiters >= gJournalFlusherGroupCommitMaxWaiters.load()) {
+            _flushJournalNowCV.notify_one();
+        }
         return _nextSharedPromise->getFuture();
     }();
 
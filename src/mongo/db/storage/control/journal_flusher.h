@@ -166,6 +166,10 @@ private:
     bool _shuttingDown = false;
     Status _shutdownReason = Status::OK();
 
+    // Number of durability waiters registered on _nextSharedPromise. Used to close the group
+    // commit window early and to report achieved batch sizes via serverStatus.
+    int64_t _nextRoundWaiters = 0;
+
     // New callers get a future from nextSharedPromise. The JournalFlusher thread will swap that to
     // currentSharedPromise at the start of every round of flushing, and reset nextSharedPromise
     // with a new shared promise.
@@ -245,6 +245,22 @@ std::vector<DurableCatalog::EntryIdentifier> DurableCatalog::getAllCatalogEntrie
     return ret;
 }
 
+std::vector<DurableCatalogEntry> DurableCatalog::getAllParsedCatalogEntries(
+    OperationContext* opCtx) const {
+    std::vector<DurableCatalogEntry> ret;
+
+    auto cursor = _rs->getCursor(opCtx);
+    while (auto record = cursor->next()) {
+        BSONObj obj = record->data.releaseToBson();
+        // Skips over the feature document, which cannot be parsed into a DurableCatalogEntry.
+        if (auto entry = parseCatalogEntry(record->id, obj)) {
+            ret.push_back(std::move(*entry));
+        }
+    }
+
+    return ret;
+}
+
 boost::optional<DurableCatalogEntry> DurableCatalog::scanForCatalogEntryByNss(
     OperationContext* opCtx, const NamespaceString& nss) const {
     auto cursor = _rs->getCursor(opCtx);
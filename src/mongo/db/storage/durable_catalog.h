@@ -140,6 +140,14 @@ public:
 
     std::vector<EntryIdentifier> getAllCatalogEntries(OperationContext* opCtx) const;
 
+    /**
+     * Like getAllCatalogEntries(), but parses the metadata of each entry as it is read off the
+     * scan. Startup paths that need the metadata for every entry should prefer this over calling
+     * getParsedCatalogEntry() per entry, which re-reads and re-decodes each document from the
+     * record store.
+     */
+    std::vector<DurableCatalogEntry> getAllParsedCatalogEntries(OperationContext* opCtx) const;
+
     /**
      * Scans the persisted catalog until an entry is found matching 'nss'.
      */
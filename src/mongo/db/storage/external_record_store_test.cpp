@@ -585,4 +585,63 @@ TEST_F(ExternalRecordStoreTest, NamedPipeMultiplePipes4) {
     ASSERT_EQ(objsRead, objsWritten)
         << "Expected objsRead == {} but got {}"_format(objsWritten, objsRead);
 }
+
+// Tests that a MultiBsonStreamCursor over multiple pipes drains to completion: every stream's
+// normal EOF must propagate to the consumer so next() reaches boost::none instead of blocking on
+// an exhausted stream. One pipe is left empty to cover EOF with no objects written, and next() is
+// called again after exhaustion to verify the cursor stays at end-of-stream.
+TEST_F(ExternalRecordStoreTest, NamedPipeMultiplePipesDrainToCompletion) {
+    constexpr int kNumPipes = 3;  // shadows the global
+    const int objsPerPipe[kNumPipes] = {10, 0, 25};
+    auto srcBsonObj = BSON("drain" << 1);
+
+    stdx::thread pipeThreads[kNumPipes];
+    PipeWaiter pw[kNumPipes];
+    std::string pipePaths[kNumPipes];
+    long numWritten = 0;
+    for (int pipeIdx = 0; pipeIdx < kNumPipes; ++pipeIdx) {
+        pipePaths[pipeIdx] = "ERSTest_DrainToCompletionPipe{}"_format(pipeIdx);
+        pipeThreads[pipeIdx] = stdx::thread(createNamedPipe,
+                                            &pw[pipeIdx],
+                                            pipePaths[pipeIdx],
+                                            objsPerPipe[pipeIdx],
+                                            std::vector<BSONObj>{srcBsonObj});
+        numWritten += objsPerPipe[pipeIdx];
+    }
+    ON_BLOCK_EXIT([&] {
+        for (int pipeIdx = 0; pipeIdx < kNumPipes; ++pipeIdx) {
+            pipeThreads[pipeIdx].join();
+        }
+    });
+
+    // Gives some time to the producers so they can initialize the named pipes.
+    for (int pipeIdx = 0; pipeIdx < kNumPipes; ++pipeIdx) {
+        pw[pipeIdx].wait();
+    }
+
+    // Create metadata describing the pipes and a MultiBsonStreamCursor to read them.
+    VirtualCollectionOptions vopts;
+    for (int pipeIdx = 0; pipeIdx < kNumPipes; ++pipeIdx) {
+        ExternalDataSourceMetadata meta(
+            (ExternalDataSourceMetadata::kUrlProtocolFile + pipePaths[pipeIdx]),
+            StorageTypeEnum::pipe,
+            FileTypeEnum::bson);
+        vopts.dataSources.emplace_back(meta);
+    }
+    MultiBsonStreamCursor msbc(vopts);
+
+    long objsRead = 0;
+    while (auto record = msbc.next()) {
+        ASSERT_EQ(record->id.getLong(), objsRead)
+            << "Expected record->id {} but got {}"_format(objsRead, record->id.getLong());
+        ASSERT_EQ(record->data.size(), srcBsonObj.objsize());
+        ++objsRead;
+    }
+    ASSERT_EQ(objsRead, numWritten)
+        << "Expected objsRead == {} but got {}"_format(numWritten, objsRead);
+
+    // The cursor must remain exhausted on subsequent calls.
+    ASSERT_FALSE(msbc.next());
+    ASSERT_FALSE(msbc.next());
+}
 }  // namespace mongo
@@ -40,6 +40,7 @@
 #include <utility>
 
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/admission/ticketholder_manager.h"
 #include "mongo/db/client.h"
 #include "mongo/db/concurrency/flow_control_ticketholder.h"
 #include "mongo/db/concurrency/lock_manager_defs.h"
@@ -165,7 +166,7 @@ FlowControl::FlowControl(repl::ReplicationCoordinator* replCoord)
     : _replCoord(replCoord), _lastTimeSustainerAdvanced(Date_t::now()) {}
 
 FlowControl::FlowControl(ServiceContext* service, repl::ReplicationCoordinator* replCoord)
-    : _replCoord(replCoord), _lastTimeSustainerAdvanced(Date_t::now()) {
+    : _service(service), _replCoord(replCoord), _lastTimeSustainerAdvanced(Date_t::now()) {
     // Initialize _lastTargetTicketsPermitted to maximum tickets to make sure flow control doesn't
     // cause a slow start on start up.
     FlowControlTicketholder::set(service, std::make_unique<FlowControlTicketholder>(kMaxTickets));
@@ -249,6 +250,8 @@ BSONObj FlowControl::generateSection(OperationContext* opCtx,
     bob.append("isLagged", _isLagged.loadRelaxed());
     bob.append("isLaggedCount", _isLaggedCount.loadRelaxed());
     bob.append("isLaggedTimeMicros", _isLaggedTimeMicros.loadRelaxed());
+    bob.append("isSecondaryReadPressured", _isSecondaryReadPressured.loadRelaxed());
+    bob.append("secondaryReadPressureCount", _secondaryReadPressureCount.loadRelaxed());
 
     return bob.obj();
 }
@@ -354,10 +357,49 @@ int FlowControl::_calculateNewTicketsForLag(const std::vector<repl::MemberData>&
     return multiplyWithOverflowCheck(locksPerOp, sustainerAppliedPenalty, kMaxTickets);
 }
 
+/**
+ * Secondaries invert the primary's lag question: how far does this node's applied optime trail the
+ * majority commit point? Crossing the threshold means the oplog applier is losing ground to local
+ * load (typically a read storm evicting its working set), so eligible low-priority reads are asked
+ * to back off before apply stalls develop and the primary is throttled cluster-wide.
+ */
+void FlowControl::_updateSecondaryReadPressure(bool canAcceptWrites,
+                                               const repl::OpTimeAndWallTime& myLastApplied,
+                                               const repl::OpTimeAndWallTime& lastCommitted) {
+    bool pressured = false;
+    if (gFlowControlEnabled.load() && !canAcceptWrites &&
+        gFlowControlSecondaryReadsBackoffMillis.load() > 0 &&
+        lastCommitted.wallTime > myLastApplied.wallTime) {
+        pressured = getLagMillis(lastCommitted.wallTime, myLastApplied.wallTime) >=
+            getThresholdLagMillis();
+    }
+    _setSecondaryReadPressure(pressured);
+}
+
+void FlowControl::_setSecondaryReadPressure(bool pressured) {
+    if (pressured && !_isSecondaryReadPressured.load()) {
+        _secondaryReadPressureCount.fetchAndAddRelaxed(1);
+        LOGV2_DEBUG(8928500,
+                    DEBUG_LOG_LEVEL,
+                    "Flow control engaging the secondary read pressure backoff");
+    }
+    _isSecondaryReadPressured.store(pressured);
+
+    if (!_service) {
+        return;
+    }
+    if (auto ticketHolderManager = admission::TicketHolderManager::get(_service)) {
+        ticketHolderManager->setLowPriorityReadsBackoff(
+            pressured ? Milliseconds(gFlowControlSecondaryReadsBackoffMillis.load())
+                      : Milliseconds(0));
+    }
+}
+
 int FlowControl::getNumTickets(Date_t now) {
     // Flow control can be disabled until a certain deadline is passed.
     const Date_t disabledUntil = _disableUntil.load();
     if (now < disabledUntil) {
+        _setSecondaryReadPressure(false);
         return kMaxTickets;
     }
 
@@ -378,6 +420,8 @@ int FlowControl::getNumTickets(Date_t now) {
     const double locksPerOp = _getLocksPerOp();
     const std::int64_t locksUsedLastPeriod = _getLocksUsedLastPeriod();
 
+    _updateSecondaryReadPressure(canAcceptWrites, myLastApplied, lastCommitted);
+
     if (gFlowControlEnabled.load() == false || canAcceptWrites == false || locksPerOp < 0.0) {
         _trimSamples(std::min(lastCommitted.opTime.getTimestamp(),
                               getMedianAppliedTimestamp(_prevMemberData)));
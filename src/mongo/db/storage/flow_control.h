@@ -102,6 +102,25 @@ public:
      */
     int getNumTickets(Date_t now);
 
+    /**
+     * Returns whether the last flow control computation observed majority commit point lag beyond
+     * the configured threshold. Background maintenance work may use this to back off while
+     * replication is catching up.
+     */
+    bool isLagged() const {
+        return _isLagged.load();
+    }
+
+    /**
+     * Returns whether this node is a secondary whose applied optime was observed to trail the
+     * majority commit point by more than the threshold lag. While true, eligible low-priority
+     * reads back off before admission so the oplog applier can catch up; the primary is never
+     * throttled on this signal.
+     */
+    bool isSecondaryReadPressured() const {
+        return _isSecondaryReadPressured.load();
+    }
+
     BSONObj generateSection(OperationContext* opCtx, const BSONElement& configElement) const;
 
     /**
@@ -124,6 +143,9 @@ public:
     std::int64_t _approximateOpsBetween(Timestamp prevTs, Timestamp currTs);
 
     void _updateTopologyData();
+    void _updateSecondaryReadPressure(bool canAcceptWrites,
+                                      const repl::OpTimeAndWallTime& myLastApplied,
+                                      const repl::OpTimeAndWallTime& lastCommitted);
     int _calculateNewTicketsForLag(const std::vector<repl::MemberData>& prevMemberData,
                                    const std::vector<repl::MemberData>& currMemberData,
                                    std::int64_t locksUsedLastPeriod,
@@ -140,6 +162,13 @@ public:
     }
 
 private:
+    /**
+     * Publishes or clears the low-priority read backoff on the TicketHolderManager to match
+     * `pressured`, and maintains the related server status counters.
+     */
+    void _setSecondaryReadPressure(bool pressured);
+
+    ServiceContext* _service = nullptr;
     repl::ReplicationCoordinator* _replCoord;
 
     // These values are updated with each flow control computation and are also surfaced in server
@@ -149,6 +178,8 @@ private:
     AtomicWord<int> _lastSustainerAppliedCount{0};
     AtomicWord<bool> _isLagged{false};
     AtomicWord<int> _isLaggedCount{0};
+    AtomicWord<bool> _isSecondaryReadPressured{false};
+    AtomicWord<int> _secondaryReadPressureCount{0};
     // Use an int64_t as this is serialized to bson which does not support unsigned 64-bit numbers.
     AtomicWord<std::int64_t> _isLaggedTimeMicros{0};
     AtomicWord<Date_t> _disableUntil;
@@ -262,6 +262,27 @@ TEST_F(FlowControlTest, CalculatingTickets) {
                                                       thresholdLag));
 }
 
+TEST_F(FlowControlTest, SecondaryReadPressure) {
+    auto optimeAt = [](Date_t wall) -> repl::OpTimeAndWallTime {
+        return {{Timestamp(1000, 1), 1}, wall};
+    };
+    gFlowControlTargetLagSeconds.store(10);
+    gFlowControlThresholdLagPercentage.store(0.5);  // Threshold lag of five seconds.
+
+    const Date_t base = Date_t::fromMillisSinceEpoch(100000);
+    // Applied optime within the threshold of the commit point: healthy.
+    flowControl->_updateSecondaryReadPressure(false, optimeAt(base), optimeAt(base + Seconds(1)));
+    ASSERT_FALSE(flowControl->isSecondaryReadPressured());
+
+    // Applied optime trailing the commit point beyond the threshold: pressured.
+    flowControl->_updateSecondaryReadPressure(false, optimeAt(base), optimeAt(base + Seconds(6)));
+    ASSERT_TRUE(flowControl->isSecondaryReadPressured());
+
+    // The signal never engages on a node that can accept writes, whatever the lag says.
+    flowControl->_updateSecondaryReadPressure(true, optimeAt(base), optimeAt(base + Seconds(6)));
+    ASSERT_FALSE(flowControl->isSecondaryReadPressured());
+}
+
 TEST_F(FlowControlTest, DisableUntil) {
     const int ticketOverride = 52319;
 
@@ -2811,6 +2811,50 @@ BSONObj toBson(StringData data, Ordering ord, StringData typeBitsRawBuffer, Vers
     return builder.obj();
 }
 
+namespace {
+template <typename T, typename AppendFn>
+std::vector<Value> encodeColumn(
+    Version version, Ordering ord, const T* nums, size_t n, AppendFn&& append) {
+    std::vector<Value> out;
+    out.reserve(n);
+    // One builder, and therefore one growing buffer and TypeBits, is reused for the whole
+    // column. This hoists the per-element type dispatch and builder setup that
+    // appendBSONElement() pays out of the loop.
+    HeapBuilder builder(version, ord);
+    for (size_t i = 0; i < n; ++i) {
+        builder.resetToEmpty(ord);
+        append(builder, nums[i]);
+        out.push_back(builder.getValueCopy());
+    }
+    return out;
+}
+}  // namespace
+
+std::vector<Value> encodeNumberLongColumn(Version version,
+                                          Ordering ord,
+                                          const long long* nums,
+                                          size_t n) {
+    return encodeColumn(
+        version, ord, nums, n, [](HeapBuilder& b, long long num) { b.appendNumberLong(num); });
+}
+
+std::vector<Value> encodeNumberDoubleColumn(Version version,
+                                            Ordering ord,
+                                            const double* nums,
+                                            size_t n) {
+    return encodeColumn(
+        version, ord, nums, n, [](HeapBuilder& b, double num) { b.appendNumberDouble(num); });
+}
+
+std::vector<BSONObj> toBsonColumnSafe(const std::vector<Value>& keys, Ordering ord) {
+    std::vector<BSONObj> out;
+    out.reserve(keys.size());
+    for (const auto& key : keys) {
+        out.push_back(toBsonSafe(key.getBuffer(), key.getSize(), ord, key.getTypeBits()));
+    }
+    return out;
+}
+
 RecordId decodeRecordIdLongAtEnd(const void* bufferRaw, size_t bufSize) {
     RecordId recordId;
     sizeWithoutRecordIdLongAtEnd(bufferRaw, bufSize, &recordId);
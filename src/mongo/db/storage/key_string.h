@@ -1166,6 +1166,27 @@ BSONObj toBson(const T& keyString, Ordering ord) noexcept {
     return toBson(keyString.getBuffer(), keyString.getSize(), ord, keyString.getTypeBits());
 }
 
+/**
+ * Batch encoders for homogeneous columns of values, the common case for secondary indexes whose
+ * keys all share one numeric type. Each value becomes an independent single-field KeyString. One
+ * builder and its buffer are reused across the whole column, hoisting the per-element type
+ * dispatch and builder setup that appendBSONElement() would pay out of the loop.
+ */
+std::vector<Value> encodeNumberLongColumn(Version version,
+                                          Ordering ord,
+                                          const long long* nums,
+                                          size_t n);
+std::vector<Value> encodeNumberDoubleColumn(Version version,
+                                            Ordering ord,
+                                            const double* nums,
+                                            size_t n);
+
+/**
+ * Counterpart of the column encoders: decodes each KeyString in 'keys' to its BSONObj
+ * representation with the same validation as toBsonSafe().
+ */
+std::vector<BSONObj> toBsonColumnSafe(const std::vector<Value>& keys, Ordering ord);
+
 /**
  * Decodes a RecordId long from the end of a buffer.
  */
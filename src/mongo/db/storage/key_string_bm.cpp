@@ -217,6 +217,35 @@ void BM_KeyStringStackBuilderCopy(benchmark::State& state, BsonValueType bsonTyp
     state.SetItemsProcessed(state.iterations() * kSampleSize);
 }
 
+void BM_KeyStringEncodeLongColumn(benchmark::State& state, const key_string::Version version) {
+    std::mt19937_64 gen(seedGen());
+    long long nums[kSampleSize];
+    for (auto& num : nums) {
+        num = static_cast<long long>(gen());
+    }
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(
+            key_string::encodeNumberLongColumn(version, ALL_ASCENDING, nums, kSampleSize));
+    }
+    state.SetItemsProcessed(state.iterations() * kSampleSize);
+}
+
+void BM_KeyStringEncodeDoubleColumn(benchmark::State& state, const key_string::Version version) {
+    std::mt19937 gen(seedGen());
+    std::exponential_distribution<double> expReal(1e-3);
+    double nums[kSampleSize];
+    for (auto& num : nums) {
+        num = expReal(gen);
+    }
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(
+            key_string::encodeNumberDoubleColumn(version, ALL_ASCENDING, nums, kSampleSize));
+    }
+    state.SetItemsProcessed(state.iterations() * kSampleSize);
+}
+
 void BM_KeyStringRecordIdStrAppend(benchmark::State& state, const size_t size) {
     const auto buf = std::string(size, 'a');
     auto rid = RecordId(buf.c_str(), size);
@@ -275,6 +304,11 @@ BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_String, key_string::Version::V1, STRING
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V0_Array, key_string::Version::V0, ARRAY);
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_Array, key_string::Version::V1, ARRAY);
 
+BENCHMARK_CAPTURE(BM_KeyStringEncodeLongColumn, V0, key_string::Version::V0);
+BENCHMARK_CAPTURE(BM_KeyStringEncodeLongColumn, V1, key_string::Version::V1);
+BENCHMARK_CAPTURE(BM_KeyStringEncodeDoubleColumn, V0, key_string::Version::V0);
+BENCHMARK_CAPTURE(BM_KeyStringEncodeDoubleColumn, V1, key_string::Version::V1);
+
 BENCHMARK_CAPTURE(BM_KeyStringRecordIdStrAppend, 16B, 16);
 BENCHMARK_CAPTURE(BM_KeyStringRecordIdStrAppend, 512B, 512);
 BENCHMARK_CAPTURE(BM_KeyStringRecordIdStrAppend, 1kB, 1024);
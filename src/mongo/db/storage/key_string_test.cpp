@@ -348,6 +348,46 @@ TEST_F(KeyStringBuilderTest, Simple1) {
                      key_string::Builder(version, b, ALL_ASCENDING, RecordId(1)));
 }
 
+TEST_F(KeyStringBuilderTest, EncodeNumberLongColumn) {
+    const long long nums[] = {0, 1, -1, 255, 1LL << 40, std::numeric_limits<long long>::min()};
+    const size_t n = sizeof(nums) / sizeof(nums[0]);
+
+    for (auto ord : {ALL_ASCENDING, ONE_DESCENDING}) {
+        auto keys = key_string::encodeNumberLongColumn(version, ord, nums, n);
+        ASSERT_EQUALS(n, keys.size());
+        for (size_t i = 0; i < n; ++i) {
+            key_string::Builder expected(version, BSON("" << nums[i]), ord);
+            ASSERT_EQUALS(expected.getValueCopy(), keys[i]);
+        }
+
+        auto objs = key_string::toBsonColumnSafe(keys, ord);
+        ASSERT_EQUALS(n, objs.size());
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_BSONOBJ_EQ(BSON("" << nums[i]), objs[i]);
+        }
+    }
+}
+
+TEST_F(KeyStringBuilderTest, EncodeNumberDoubleColumn) {
+    const double nums[] = {0.0, -0.0, 1.0, -1.5, 1e300, std::numeric_limits<double>::quiet_NaN()};
+    const size_t n = sizeof(nums) / sizeof(nums[0]);
+
+    for (auto ord : {ALL_ASCENDING, ONE_DESCENDING}) {
+        auto keys = key_string::encodeNumberDoubleColumn(version, ord, nums, n);
+        ASSERT_EQUALS(n, keys.size());
+        for (size_t i = 0; i < n; ++i) {
+            key_string::Builder expected(version, BSON("" << nums[i]), ord);
+            ASSERT_EQUALS(expected.getValueCopy(), keys[i]);
+        }
+
+        auto objs = key_string::toBsonColumnSafe(keys, ord);
+        ASSERT_EQUALS(n, objs.size());
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT(objs[i].binaryEqual(BSON("" << nums[i])));
+        }
+    }
+}
+
 #define ROUNDTRIP_ORDER(version, x, order)                            \
     do {                                                              \
         const BSONObj _orig = x;                                      \
@@ -83,13 +83,7 @@ void KVDropPendingIdentReaper::addDropPendingIdent(
                                                      return Timestamp::min();
                                                  }},
                                dropTime);
-    const auto equalRange = _dropPendingIdents.equal_range(dropTimestamp);
-    const auto& lowerBound = equalRange.first;
-    const auto& upperBound = equalRange.second;
-    auto matcher = [ident](const auto& pair) {
-        return pair.second->identName == ident->getIdent();
-    };
-    if (std::find_if(lowerBound, upperBound, matcher) == upperBound) {
+    if (_identToInfo.find(ident->getIdent()) == _identToInfo.end()) {
         auto info = std::make_shared<IdentInfo>();
         info->identName = ident->getIdent();
         info->identState = IdentInfo::State::kNotDropped;
@@ -97,10 +91,10 @@ void KVDropPendingIdentReaper::addDropPendingIdent(
         info->dropTime = dropTime;
         info->onDrop = std::move(onDrop);
         _dropPendingIdents.insert(std::make_pair(dropTimestamp, info));
-        _identToTimestamp.insert(std::make_pair(ident->getIdent(), dropTimestamp));
+        _identToInfo.insert(std::make_pair(ident->getIdent(), std::move(info)));
     } else {
         LOGV2_WARNING(8097403,
-                      "Ignoring duplicate ident drop with same drop time",
+                      "Ignoring duplicate ident drop",
                       "ident"_attr = ident->getIdent(),
                       "dropTimestamp"_attr = dropTimestamp);
     }
@@ -108,39 +102,28 @@ void KVDropPendingIdentReaper::addDropPendingIdent(
 
 std::shared_ptr<Ident> KVDropPendingIdentReaper::markIdentInUse(StringData ident) {
     stdx::lock_guard<Latch> lock(_mutex);
-    auto identToTimestampIt = _identToTimestamp.find(ident);
-    if (identToTimestampIt == _identToTimestamp.end()) {
+    auto identToInfoIt = _identToInfo.find(ident);
+    if (identToInfoIt == _identToInfo.end()) {
         // Ident is not known to the reaper.
         return nullptr;
     }
 
-    auto beginEndPair = _dropPendingIdents.equal_range(identToTimestampIt->second);
-    for (auto dropPendingIdentsIt = beginEndPair.first; dropPendingIdentsIt != beginEndPair.second;
-         dropPendingIdentsIt++) {
-        auto info = dropPendingIdentsIt->second;
-        if (info->identName != ident) {
-            continue;
-        }
-
-        if (info->identState == IdentInfo::State::kBeingDropped ||
-            info->identState == IdentInfo::State::kDropped) {
-            // The ident is being dropped or was already dropped. Cannot mark the ident as in use.
-            return nullptr;
-        }
-
-        if (auto existingIdent = info->dropToken.lock()) {
-            // This function can be called concurrently and we need to share the same ident at any
-            // given time to prevent the reaper from removing idents prematurely.
-            return existingIdent;
-        }
+    const auto& info = identToInfoIt->second;
+    if (info->identState == IdentInfo::State::kBeingDropped ||
+        info->identState == IdentInfo::State::kDropped) {
+        // The ident is being dropped or was already dropped. Cannot mark the ident as in use.
+        return nullptr;
+    }
 
-        std::shared_ptr<Ident> newIdent = std::make_shared<Ident>(info->identName);
-        info->dropToken = newIdent;
-        return newIdent;
+    if (auto existingIdent = info->dropToken.lock()) {
+        // This function can be called concurrently and we need to share the same ident at any
+        // given time to prevent the reaper from removing idents prematurely.
+        return existingIdent;
     }
 
-    // The ident was found in _identToTimestamp earlier, so it must exist in _dropPendingIdents.
-    MONGO_UNREACHABLE;
+    std::shared_ptr<Ident> newIdent = std::make_shared<Ident>(info->identName);
+    info->dropToken = newIdent;
+    return newIdent;
 }
 
 bool KVDropPendingIdentReaper::hasExpiredIdents(const Timestamp& ts) const {
@@ -279,7 +262,7 @@ void KVDropPendingIdentReaper::dropIdentsOlderThan(OperationContext* opCtx, cons
             auto beginEndPair = _dropPendingIdents.equal_range(timestampAndIdentInfo.first);
             for (auto it = beginEndPair.first; it != beginEndPair.second;) {
                 if (it->second == timestampAndIdentInfo.second) {
-                    invariant(_identToTimestamp.erase(it->second->identName) == 1);
+                    invariant(_identToInfo.erase(it->second->identName) == 1);
                     it = _dropPendingIdents.erase(it);
                     break;
                 } else {
@@ -300,8 +283,12 @@ void KVDropPendingIdentReaper::clearDropPendingState(OperationContext* opCtx) {
                                       _dropPendingIdents.end(),
                                       [](const auto& kv) { return kv.first == Timestamp::min(); });
     _dropPendingIdents.erase(firstElem, _dropPendingIdents.end());
-    absl::erase_if(_identToTimestamp,
-                   [&](const auto& kv) { return kv.second != Timestamp::min(); });
+    absl::erase_if(_identToInfo, [](const auto& kv) {
+        return visit(
+            OverloadedVisitor{[](const Timestamp& ts) { return ts != Timestamp::min(); },
+                              [](const StorageEngine::CheckpointIteration&) { return false; }},
+            kv.second->dropTime);
+    });
 }
 
 }  // namespace mongo
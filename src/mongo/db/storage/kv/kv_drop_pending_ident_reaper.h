@@ -179,8 +179,10 @@ private:
     // Drop-pending idents. Ordered by drop timestamp.
     DropPendingIdents _dropPendingIdents;
 
-    // Ident to drop timestamp map. Used for efficient lookups into _dropPendingIdents.
-    StringMap<Timestamp> _identToTimestamp;
+    // Ident name to IdentInfo map. Provides constant-time lookups by ident name; all untimestamped
+    // drops share the Timestamp::min() key in '_dropPendingIdents', so scanning that range per
+    // lookup would be linear in the number of pending untimestamped drops.
+    StringMap<std::shared_ptr<IdentInfo>> _identToInfo;
 };
 
 }  // namespace mongo
@@ -272,6 +272,15 @@ public:
 
     virtual void checkpoint() {}
 
+    /**
+     * Returns the number of dirty bytes currently held in the storage engine's cache, or 0 if the
+     * engine does not track this statistic. The checkpoint thread uses this to decide whether to
+     * take a checkpoint ahead of the regular syncdelay cadence.
+     */
+    virtual int64_t getCacheDirtyBytes() {
+        return 0;
+    }
+
     virtual StorageEngine::CheckpointIteration getCheckpointIteration() const {
         return StorageEngine::CheckpointIteration{0};
     }
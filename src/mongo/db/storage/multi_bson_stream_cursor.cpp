@@ -41,11 +41,13 @@
 #include "mongo/base/data_view.h"
 #include "mongo/base/error_codes.h"
 #include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/catalog/virtual_collection_options.h"
 #include "mongo/db/storage/record_data.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/platform/compiler.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 using namespace fmt::literals;
@@ -176,11 +178,139 @@ std::unique_ptr<InputStream<NamedPipeInput>> MultiBsonStreamCursor::getInputStre
     return std::make_unique<InputStream<NamedPipeInput>>(filePathStr);
 }
 
+/**
+ * Spawns one reader thread per stream. Each thread drains its own pipe into its own bounded queue
+ * of framed batches, so all pipes are read concurrently while next() returns records in stream
+ * order: while the cursor consumes stream 0, the remaining streams' pipes are already being
+ * drained up to each queue's byte bound.
+ */
+void MultiBsonStreamCursor::startPrefetchers() {
+    _prefetchers.reserve(_numStreams);
+    for (int streamIdx = 0; streamIdx < _numStreams; ++streamIdx) {
+        _prefetchers.push_back(std::make_unique<StreamPrefetcher>());
+    }
+    for (int streamIdx = 0; streamIdx < _numStreams; ++streamIdx) {
+        auto prefetcher = _prefetchers[streamIdx].get();
+        prefetcher->thread =
+            stdx::thread([prefetcher, url = _vopts.dataSources[streamIdx].url] {
+                prefetchStream(prefetcher, url);
+            });
+    }
+}
+
+/**
+ * Reader thread body: block-reads the pipe at 'url' and pushes batches of whole BSON objects onto
+ * 'prefetcher->queue' until EOF. Each block read is framed by scanning length prefixes; a partial
+ * trailing object is carried over to the front of the next buffer, so a batch always ends on an
+ * object boundary. Any error is published in 'prefetcher->error' before the producer end closes.
+ */
+void MultiBsonStreamCursor::prefetchStream(StreamPrefetcher* prefetcher, const std::string& url) {
+    // The producer end must be closed on every exit, including the normal EOF returns; otherwise
+    // the consumer's pop() would block forever waiting for this stream's next batch.
+    ScopeGuard closeProducer([&] { prefetcher->queue.closeProducerEnd(); });
+    try {
+        auto streamReader = getInputStream(url);
+        int bufSize = kBatchReadSize;
+        std::unique_ptr<char[]> buffer{new char[bufSize]};
+        int bufEnd = 0;  // number of valid bytes in 'buffer'
+        while (true) {
+            const int wantBytes = bufSize - bufEnd;
+            const int readBytes = streamReader->readBytes(wantBytes, (buffer.get() + bufEnd));
+            uassert(8928503, "Error reading file: {}"_format(url), readBytes >= 0);
+            bufEnd += readBytes;
+            const bool eof = (readBytes < wantBytes);
+            if (bufEnd == 0) {  // EOF: okay here as the pipe ended at an object boundary
+                return;
+            }
+
+            // Scan length prefixes to find the last complete object boundary in the buffer.
+            int framedEnd = 0;
+            while (bufEnd - framedEnd >= kSizeSize) {
+                const int32_t bsonSize =
+                    ConstDataView(buffer.get() + framedEnd).read<LittleEndian<int32_t>>();
+                uassert(8928504,
+                        "Invalid BSON size {} in file: {}"_format(bsonSize, url),
+                        (bsonSize >= BSONObj::kMinBSONLength && bsonSize <= BSONObjMaxUserSize));
+                if (bsonSize > bufEnd - framedEnd) {
+                    break;
+                }
+                framedEnd += bsonSize;
+            }
+            uassert(8928505, "Truncated file: {}"_format(url), !(eof && framedEnd < bufEnd));
+
+            if (framedEnd == 0) {
+                // A single object is larger than the whole buffer; double it until it fits. The
+                // scan above validated the object's size, so this caps below BSONObjMaxUserSize.
+                const int32_t bsonSize = ConstDataView(buffer.get()).read<LittleEndian<int32_t>>();
+                int newBufSize = bufSize;
+                do {
+                    newBufSize *= 2;
+                } while (newBufSize < bsonSize);
+                std::unique_ptr<char[]> newBuffer{new char[newBufSize]};
+                std::memcpy(newBuffer.get(), buffer.get(), bufEnd);
+                buffer = std::move(newBuffer);
+                bufSize = newBufSize;
+                continue;
+            }
+
+            // Hand off the framed prefix; carry any partial trailing object into the next buffer.
+            // The push blocks while the queue is at its byte bound, which is what keeps prefetch
+            // memory bounded per stream.
+            const int carryBytes = bufEnd - framedEnd;
+            std::unique_ptr<char[]> nextBuffer{new char[bufSize]};
+            std::memcpy(nextBuffer.get(), (buffer.get() + framedEnd), carryBytes);
+            prefetcher->queue.push(Batch{std::move(buffer), framedEnd});
+            buffer = std::move(nextBuffer);
+            bufEnd = carryBytes;
+            if (eof) {
+                return;
+            }
+        }
+    } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueEndClosed>&) {
+        // The cursor was destroyed and closed the consumer end; nothing more to do.
+    } catch (...) {
+        prefetcher->error = exceptionToStatus();
+    }
+}
+
+/**
+ * Returns the next record in stream order from the prefetched batches, or boost::none when all
+ * streams are exhausted. Rethrows the first error a reader thread hit on the stream being
+ * consumed. As on the serial path, the returned RecordData points into the cursor's current
+ * buffer and is invalidated when the cursor advances past it.
+ */
+boost::optional<Record> MultiBsonStreamCursor::nextFromBatches() {
+    while (_streamIdx < _numStreams) {
+        if (_batchPos < _batch.size) {
+            const int32_t bsonSize =
+                ConstDataView(_batch.data.get() + _batchPos).read<LittleEndian<int32_t>>();
+            RecordData recordData{(_batch.data.get() + _batchPos), bsonSize};
+            _batchPos += bsonSize;
+            return {{RecordId{_nextRecordId++}, std::move(recordData)}};
+        }
+        auto& prefetcher = *_prefetchers[_streamIdx];
+        try {
+            _batch = prefetcher.queue.pop();
+            _batchPos = 0;
+        } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueConsumed>&) {
+            uassertStatusOK(prefetcher.error);
+            _batch = {};
+            _batchPos = 0;
+            ++_streamIdx;
+        }
+    }
+    return boost::none;
+}
+
 /**
  * Returns the next record from the vector of streams or boost::none if exhausted or error.
- * '_streamReader' is initialized to the first stream, if there is one, in the constructor.
+ * With multiple streams the records come from the per-stream prefetch queues; with a single
+ * stream '_streamReader' is initialized to it in the constructor and read directly.
  */
 boost::optional<Record> MultiBsonStreamCursor::next() {
+    if (!_prefetchers.empty()) {
+        return nextFromBatches();
+    }
     while (_streamIdx < _numStreams) {
         auto record = nextFromCurrentStream();
         if (MONGO_likely(record)) {
@@ -39,13 +39,17 @@
 #include <boost/optional/optional.hpp>
 #include <fmt/format.h>
 
+#include "mongo/base/status.h"
+#include "mongo/bson/util/builder.h"
 #include "mongo/db/catalog/virtual_collection_options.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/storage/input_stream.h"
 #include "mongo/db/storage/named_pipe.h"
 #include "mongo/db/storage/record_store.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/producer_consumer_queue.h"
 
 namespace mongo {
 class MultiBsonStreamCursor : public SeekableRecordCursor {
@@ -54,7 +58,25 @@ public:
         : _numStreams(vopts.dataSources.size()), _vopts(vopts) {
         using namespace fmt::literals;
         tassert(6968310, "_numStreams {} <= 0"_format(_numStreams), _numStreams > 0);
-        _streamReader = getInputStream(_vopts.dataSources[_streamIdx].url);
+        if (_numStreams > 1) {
+            startPrefetchers();
+        } else {
+            _streamReader = getInputStream(_vopts.dataSources[_streamIdx].url);
+        }
+    }
+
+    ~MultiBsonStreamCursor() override {
+        // Unblock any reader threads waiting to push, then wait for them to exit. A thread that
+        // is blocked reading its pipe exits once the pipe delivers more data or EOF; this is the
+        // same wait the serial path incurs reading that pipe directly.
+        for (auto& prefetcher : _prefetchers) {
+            prefetcher->queue.closeConsumerEnd();
+        }
+        for (auto& prefetcher : _prefetchers) {
+            if (prefetcher->thread.joinable()) {
+                prefetcher->thread.join();
+            }
+        }
     }
 
     boost::optional<Record> next() override;
@@ -83,13 +105,58 @@ public:
     }
 
 private:
+    /**
+     * A contiguous run of whole BSON objects framed off one stream by its reader thread. 'size'
+     * is the number of valid bytes in 'data' and always falls exactly on an object boundary.
+     */
+    struct Batch {
+        std::unique_ptr<char[]> data;
+        int size = 0;
+    };
+
+    // Costs batches by their byte size so a prefetch queue's bound is measured in buffered bytes.
+    // Reader threads never push empty batches, so the cost can never be zero.
+    struct BatchCost {
+        size_t operator()(const Batch& batch) const {
+            return static_cast<size_t>(batch.size);
+        }
+    };
+
+    using BatchQueue = SingleProducerSingleConsumerQueue<Batch, BatchCost>;
+
+    /**
+     * Per-stream prefetch state: a reader thread that drains one named pipe into a bounded queue
+     * of framed batches, plus the first error it hit, if any. 'error' is written before the thread
+     * closes the producer end of 'queue', so the consumer may safely read it once pop() throws
+     * ProducerConsumerQueueConsumed.
+     */
+    struct StreamPrefetcher {
+        BatchQueue queue{BatchQueue::Options{kStreamQueueMaxBytes}};
+        stdx::thread thread;
+        Status error = Status::OK();
+    };
+
     void expandBuffer(int32_t bsonSize);
     boost::optional<Record> nextFromCurrentStream();
     static std::unique_ptr<InputStream<NamedPipeInput>> getInputStream(const std::string& url);
 
+    void startPrefetchers();
+    static void prefetchStream(StreamPrefetcher* prefetcher, const std::string& url);
+    boost::optional<Record> nextFromBatches();
+
     // The size in bytes of a BSON object's "size" prefix.
     static constexpr int kSizeSize = static_cast<int>(sizeof(int32_t));
 
+    // Starting size of a reader thread's batch buffer. Large relative to the serial path's 8K
+    // starting buffer because each batch is handed across threads, so framing overhead should be
+    // amortized over many objects. Doubles as needed to hold one oversized object.
+    static constexpr int kBatchReadSize = 64 * 1024;
+
+    // Bound in bytes on each stream's prefetch queue. Large enough that a batch containing one
+    // maximum-size object (whose buffer doubles from 'kBatchReadSize' to less than twice the
+    // object's size) always fits, so a push can never throw ProducerConsumerQueueBatchTooLarge.
+    static constexpr size_t kStreamQueueMaxBytes = 2 * BSONObjMaxUserSize;
+
     // The buffer starts small and doubles as needed to have room to read the rest of an object that
     // spans across the half-way point. Block reads are done at offset 0 and get only half the
     // buffer size, so worst case is the last byte of this read is the first byte of the size of the
@@ -114,9 +181,16 @@ private:
     int _numStreams;            // number of streams in '_vopts'
     int _streamIdx = 0;         // index in' _vopts' of stream being consumed in '_streamReader'
 
-    // Reader for the current stream.
+    // Reader for the current stream. Only used in the serial (single-stream) case.
     std::unique_ptr<InputStream<NamedPipeInput>> _streamReader = nullptr;
 
+    // One prefetcher per stream when reading more than one pipe, so all pipes are drained
+    // concurrently while next() still returns records in stream order. Empty in the serial case.
+    std::vector<std::unique_ptr<StreamPrefetcher>> _prefetchers;
+
+    Batch _batch;       // prefetched batch currently being consumed
+    int _batchPos = 0;  // index of first unconsumed byte in '_batch'
+
     const VirtualCollectionOptions& _vopts;  // metadata containing the pipe URLs
 };
 }  // namespace mongo
@@ -0,0 +1,127 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/storage/record_id_heat_sketch.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace mongo {
+
+namespace {
+
+// Per-row seeds for the bucket hash. Arbitrary odd 64-bit constants.
+constexpr std::array<uint64_t, RecordIdHeatSketch::kDepth> kRowSeeds = {
+    0x9e3779b97f4a7c15ull,
+    0xc2b2ae3d27d4eb4full,
+    0x165667b19e3779f9ull,
+    0x27d4eb2f165667c5ull,
+};
+
+/**
+ * Finalizer-style mix (from splitmix64) applied to the bucket number with a per-row seed,
+ * producing the counter slot for that row.
+ */
+size_t rowSlot(uint64_t bucket, size_t row) {
+    uint64_t x = bucket * kRowSeeds[row];
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return static_cast<size_t>(x & (RecordIdHeatSketch::kWidth - 1));
+}
+
+}  // namespace
+
+void RecordIdHeatSketch::recordAccess(const RecordId& id) {
+    if (!id.isLong()) {
+        return;
+    }
+
+    const uint64_t bucket = static_cast<uint64_t>(id.getLong()) >> kBucketShift;
+    for (size_t row = 0; row < kDepth; ++row) {
+        _counters[row][rowSlot(bucket, row)].fetchAndAddRelaxed(1);
+    }
+
+    if (_accesses.fetchAndAddRelaxed(1) + 1 >= kDecayThreshold) {
+        _decay();
+    }
+}
+
+uint64_t RecordIdHeatSketch::estimateAccessCount(const RecordId& id) const {
+    if (!id.isLong()) {
+        return 0;
+    }
+
+    const uint64_t bucket = static_cast<uint64_t>(id.getLong()) >> kBucketShift;
+    uint64_t estimate = std::numeric_limits<uint64_t>::max();
+    for (size_t row = 0; row < kDepth; ++row) {
+        estimate = std::min(estimate, _counters[row][rowSlot(bucket, row)].loadRelaxed());
+    }
+    return estimate;
+}
+
+RecordIdHeatSketch::Stats RecordIdHeatSketch::getStats() const {
+    // Each access touches one counter per row, so the row with the fewest non-zero counters gives
+    // the tightest estimate of how many distinct buckets have been accessed. Hash collisions can
+    // only inflate it.
+    size_t distinct = kWidth;
+    for (size_t row = 0; row < kDepth; ++row) {
+        size_t nonZero = 0;
+        for (size_t slot = 0; slot < kWidth; ++slot) {
+            if (_counters[row][slot].loadRelaxed() > 0) {
+                nonZero++;
+            }
+        }
+        distinct = std::min(distinct, nonZero);
+    }
+
+    return {static_cast<int64_t>(_accesses.loadRelaxed()), static_cast<int64_t>(distinct)};
+}
+
+void RecordIdHeatSketch::_decay() {
+    // Only one thread runs the decay pass; the rest keep counting.
+    bool expected = false;
+    if (!_decaying.compareAndSwap(&expected, true)) {
+        return;
+    }
+
+    for (size_t row = 0; row < kDepth; ++row) {
+        for (size_t slot = 0; slot < kWidth; ++slot) {
+            auto& counter = _counters[row][slot];
+            counter.storeRelaxed(counter.loadRelaxed() / 2);
+        }
+    }
+    _accesses.storeRelaxed(_accesses.loadRelaxed() / 2);
+
+    _decaying.storeRelaxed(false);
+}
+
+}  // namespace mongo
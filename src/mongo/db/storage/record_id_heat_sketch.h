@@ -0,0 +1,96 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "mongo/db/record_id.h"
+#include "mongo/platform/atomic_word.h"
+
+namespace mongo {
+
+/**
+ * A fixed-memory count-min sketch that tracks how often contiguous ranges of RecordIds are read.
+ * Each bucket covers 2^kBucketShift consecutive RecordIds; an access increments one counter per
+ * row, and the estimate for a bucket is the minimum across rows, which can only over-count.
+ *
+ * The sketch is the measurement half of tiered record placement: it identifies the small fraction
+ * of a large collection that serves most reads, so that cold ranges can eventually be relocated to
+ * more aggressively compressed storage. Counters are periodically halved so that estimates track
+ * recent heat rather than lifetime totals.
+ *
+ * All methods are thread safe and the hot path is a handful of relaxed atomic increments; only
+ * RecordIds in the long format are tracked and others are ignored.
+ */
+class RecordIdHeatSketch {
+public:
+    static constexpr size_t kDepth = 4;
+    static constexpr size_t kWidth = 2048;  // Counters per row. Must be a power of two.
+    static constexpr int kBucketShift = 14;
+
+    // Once this many accesses have been recorded, all counters are halved to age out old heat.
+    static constexpr uint64_t kDecayThreshold = uint64_t{1} << 26;
+
+    struct Stats {
+        int64_t accesses;  // Accesses recorded since the last decay.
+
+        // Approximate number of distinct buckets that have been accessed since the last time
+        // their counters decayed to zero.
+        int64_t distinctBucketsEstimate;
+    };
+
+    /**
+     * Records one read of 'id'. May trigger a decay pass when the access count since the last
+     * decay reaches kDecayThreshold.
+     */
+    void recordAccess(const RecordId& id);
+
+    /**
+     * Returns an estimate of the number of recorded accesses to the bucket containing 'id', or 0
+     * for RecordIds the sketch does not track. Never under-counts relative to what was recorded.
+     */
+    uint64_t estimateAccessCount(const RecordId& id) const;
+
+    Stats getStats() const;
+
+private:
+    /**
+     * Halves every counter. Concurrent increments may be lost during the pass; the sketch is
+     * approximate and the error is bounded by the number of racing accesses.
+     */
+    void _decay();
+
+    std::array<std::array<AtomicWord<uint64_t>, kWidth>, kDepth> _counters{};
+    AtomicWord<uint64_t> _accesses{0};
+    AtomicWord<bool> _decaying{false};
+};
+
+}  // namespace mongo
@@ -0,0 +1,88 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/record_id.h"
+#include "mongo/db/storage/record_id_heat_sketch.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+// RecordIds this many apart are guaranteed to land in different buckets.
+constexpr int64_t kBucketSpan = int64_t{1} << RecordIdHeatSketch::kBucketShift;
+
+TEST(RecordIdHeatSketchTest, EstimateNeverUnderCounts) {
+    RecordIdHeatSketch sketch;
+    const RecordId hot(1 * kBucketSpan);
+    const RecordId cold(2 * kBucketSpan);
+
+    for (int i = 0; i < 100; i++) {
+        sketch.recordAccess(hot);
+    }
+    sketch.recordAccess(cold);
+
+    ASSERT_GTE(sketch.estimateAccessCount(hot), 100u);
+    ASSERT_GTE(sketch.estimateAccessCount(cold), 1u);
+}
+
+TEST(RecordIdHeatSketchTest, RecordIdsInSameBucketShareCounters) {
+    RecordIdHeatSketch sketch;
+    sketch.recordAccess(RecordId(kBucketSpan));
+    sketch.recordAccess(RecordId(kBucketSpan + 1));
+    sketch.recordAccess(RecordId(2 * kBucketSpan - 1));
+
+    ASSERT_GTE(sketch.estimateAccessCount(RecordId(kBucketSpan + 2)), 3u);
+}
+
+TEST(RecordIdHeatSketchTest, StringRecordIdsAreIgnored) {
+    RecordIdHeatSketch sketch;
+    const char key[] = "abc";
+    sketch.recordAccess(RecordId(key, sizeof(key)));
+
+    ASSERT_EQ(sketch.estimateAccessCount(RecordId(key, sizeof(key))), 0u);
+    ASSERT_EQ(sketch.getStats().accesses, 0);
+}
+
+TEST(RecordIdHeatSketchTest, StatsTrackAccessesAndDistinctBuckets) {
+    RecordIdHeatSketch sketch;
+    for (int64_t bucket = 1; bucket <= 10; bucket++) {
+        sketch.recordAccess(RecordId(bucket * kBucketSpan));
+        sketch.recordAccess(RecordId(bucket * kBucketSpan));
+    }
+
+    const auto stats = sketch.getStats();
+    ASSERT_EQ(stats.accesses, 20);
+    // Hash collisions can only lower the non-zero counter count, never raise it.
+    ASSERT_GTE(stats.distinctBucketsEstimate, 1);
+    ASSERT_LTE(stats.distinctBucketsEstimate, 10);
+}
+
+}  // namespace
+}  // namespace mongo
@@ -46,6 +46,18 @@ void validateWriteAllowed(OperationContext* opCtx) {
 
 }  // namespace
 
+size_t RecordCursor::nextBatch(RecordBatch* batch, size_t n) {
+    batch->clear();
+    while (batch->size() < n) {
+        auto record = next();
+        if (!record) {
+            break;
+        }
+        batch->append(std::move(record->id), record->data.data(), record->data.size());
+    }
+    return batch->size();
+}
+
 RecordStore::RecordStore(boost::optional<UUID> uuid, StringData identName, bool isCapped)
     : _ident(std::make_shared<Ident>(identName.toString())),
       _uuid(uuid),
@@ -82,6 +82,51 @@ struct Record {
     RecordData data;
 };
 
+/**
+ * A batch of Records pulled from a RecordCursor in a single call. Record data is copied into an
+ * arena owned by the batch, so records stay valid until the batch is cleared or refilled,
+ * independent of the cursor's position.
+ */
+class RecordBatch {
+public:
+    void clear() {
+        _entries.clear();
+        _arena.clear();
+    }
+
+    bool empty() const {
+        return _entries.empty();
+    }
+
+    size_t size() const {
+        return _entries.size();
+    }
+
+    /**
+     * Returns the i-th record. The record's data points into this batch's arena and is
+     * invalidated by clear() or append().
+     */
+    Record at(size_t i) const {
+        const auto& entry = _entries[i];
+        return {entry.id, RecordData(_arena.data() + entry.offset, entry.length)};
+    }
+
+    void append(RecordId id, const char* data, int length) {
+        _entries.push_back({std::move(id), _arena.size(), length});
+        _arena.insert(_arena.end(), data, data + length);
+    }
+
+private:
+    struct Entry {
+        RecordId id;
+        size_t offset;
+        int length;
+    };
+
+    std::vector<Entry> _entries;
+    std::vector<char> _arena;
+};
+
 /**
  * Retrieves Records from a RecordStore.
  *
@@ -136,6 +181,20 @@ public:
      */
     virtual boost::optional<Record> next() = 0;
 
+    /**
+     * Moves forward up to 'n' times, filling 'batch' with the records visited, and returns the
+     * number of records read. Record data is copied into the batch, which amortizes the
+     * per-record cost of crossing the storage engine API for bulk consumers like collection
+     * scans. Reading fewer than 'n' records does not necessarily indicate EOF; only an empty
+     * batch does.
+     *
+     * The default implementation calls next() in a loop. Implementations overriding this method
+     * may return a non-empty partial batch when a WriteConflictException is encountered
+     * mid-batch; the cursor's position is then unchanged from the last batched record and the
+     * conflict recurs on the following call.
+     */
+    virtual size_t nextBatch(RecordBatch* batch, size_t n);
+
     //
     // Saving and restoring state
     //
@@ -570,6 +629,14 @@ public:
         return {};
     }
 
+    /**
+     * Best-effort hint that the records with the given ids are about to be read, so the storage
+     * engine can warm its caches ahead of the actual reads. Ids that do not correspond to a
+     * record are ignored; the reader will discover their absence itself. The default
+     * implementation does nothing.
+     */
+    virtual void prefetchRecords(OperationContext* opCtx, const std::vector<RecordId>& ids) const {}
+
     // higher level
 
     /**
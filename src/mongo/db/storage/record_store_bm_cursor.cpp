@@ -28,6 +28,8 @@
  */
 
 
+#include <algorithm>
+
 #include <benchmark/benchmark.h>
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
@@ -159,6 +161,29 @@ void BM_RecordStoreAdvance(benchmark::State& state, Direction direction) {
     state.SetItemsProcessed(fix.itemsProcessed);
 };
 
+void BM_RecordStoreAdvanceBatch(benchmark::State& state, Direction direction) {
+    Fixture fix(direction, 100'000);
+    int start;
+    if (direction == kBackward) {
+        start = fix.nToInsert;
+    } else {
+        start = 1;
+    }
+    RecordBatch batch;
+    for (auto _ : state) {
+        fix.cursor->seekExact(RecordId(start));
+        size_t remaining = fix.nToInsert - 1;
+        while (remaining > 0) {
+            size_t read = fix.cursor->nextBatch(&batch, std::min(remaining, size_t{64}));
+            ASSERT(read > 0);
+            remaining -= read;
+        }
+        fix.itemsProcessed += fix.nToInsert;
+    }
+    ASSERT(!fix.cursor->next());
+    state.SetItemsProcessed(fix.itemsProcessed);
+};
+
 void BM_RecordStoreSaveRestore(benchmark::State& state) {
     Fixture fix(kForward, 100'000);
     for (auto _ : state) {
@@ -184,6 +209,9 @@ BENCHMARK_CAPTURE(BM_RecordStoreSeekExact, SeekExactBackward, kBackward);
 BENCHMARK_CAPTURE(BM_RecordStoreAdvance, AdvanceForward, kForward);
 BENCHMARK_CAPTURE(BM_RecordStoreAdvance, AdvanceBackward, kBackward);
 
+BENCHMARK_CAPTURE(BM_RecordStoreAdvanceBatch, AdvanceBatchForward, kForward);
+BENCHMARK_CAPTURE(BM_RecordStoreAdvanceBatch, AdvanceBatchBackward, kBackward);
+
 BENCHMARK(BM_RecordStoreSaveRestore);
 
 }  // namespace
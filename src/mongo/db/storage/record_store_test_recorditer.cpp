@@ -103,6 +103,52 @@ TEST(RecordStoreTestHarness, IterateOverMultipleRecords) {
     }
 }
 
+// Insert multiple records and read them back through nextBatch(), checking that batches observe
+// the same records in the same order as next() and that the final batch is short at EOF.
+TEST(RecordStoreTestHarness, IterateOverMultipleRecordsBatched) {
+    const auto harnessHelper(newRecordStoreHarnessHelper());
+    std::unique_ptr<RecordStore> rs(harnessHelper->newRecordStore());
+
+    const int nToInsert = 10;
+    RecordId locs[nToInsert];
+    std::string datas[nToInsert];
+    for (int i = 0; i < nToInsert; i++) {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        {
+            std::stringstream ss;
+            ss << "record " << i;
+            std::string data = ss.str();
+
+            WriteUnitOfWork uow(opCtx.get());
+            StatusWith<RecordId> res =
+                rs->insertRecord(opCtx.get(), data.c_str(), data.size() + 1, Timestamp());
+            ASSERT_OK(res.getStatus());
+            locs[i] = res.getValue();
+            datas[i] = data;
+            uow.commit();
+        }
+    }
+
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        auto cursor = rs->getCursor(opCtx.get());
+
+        const size_t batchSize = 4;
+        RecordBatch batch;
+        int i = 0;
+        while (size_t read = cursor->nextBatch(&batch, batchSize)) {
+            ASSERT_EQUALS(read, batch.size());
+            for (size_t j = 0; j < batch.size(); j++, i++) {
+                const auto record = batch.at(j);
+                ASSERT_EQUALS(locs[i], record.id);
+                ASSERT_EQUALS(datas[i], record.data.data());
+            }
+        }
+        ASSERT_EQUALS(nToInsert, i);
+        ASSERT(!cursor->next());
+    }
+}
+
 // Insert multiple records and iterate through them in the reverse direction.
 // When curr() or getNext() is called on an iterator positioned at EOF,
 // the iterator returns RecordId() and stays at EOF.
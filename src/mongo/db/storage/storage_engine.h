@@ -504,6 +504,13 @@ public:
      */
     virtual void checkpoint() = 0;
 
+    /**
+     * Returns the number of dirty bytes currently held in the storage engine's cache, or 0 if the
+     * engine does not track this statistic. The checkpoint thread uses this to pace checkpoints
+     * under bursty write loads.
+     */
+    virtual int64_t getCacheDirtyBytes() = 0;
+
     /**
      * Returns the checkpoint iteration the committed write will be part of.
      *
@@ -84,9 +84,11 @@
 #include "mongo/platform/compiler.h"
 #include "mongo/stdx/unordered_set.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/database_name_util.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/str.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
@@ -108,6 +110,11 @@ namespace {
 const std::string kCatalogInfo = DatabaseName::kMdbCatalog.db(omitTenant).toString();
 const NamespaceString kCatalogInfoNamespace = NamespaceString(DatabaseName::kMdbCatalog);
 const auto kCatalogLogLevel = logv2::LogSeverity::Debug(2);
+
+// Catalogs smaller than this are loaded without spinning up a worker pool; the pool setup cost
+// would dominate.
+constexpr size_t kMinEntriesForParallelRecordStoreOpen = 16;
+constexpr size_t kMaxRecordStoreOpenThreads = 16;
 }  // namespace
 
 StorageEngineImpl::StorageEngineImpl(OperationContext* opCtx,
@@ -214,8 +221,9 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
     std::vector<std::string> identsKnownToStorageEngine = _engine->getAllIdents(opCtx);
     std::sort(identsKnownToStorageEngine.begin(), identsKnownToStorageEngine.end());
 
-    std::vector<DurableCatalog::EntryIdentifier> catalogEntries =
-        _catalog->getAllCatalogEntries(opCtx);
+    // Parse the catalog entries as they are read off the scan so that the startup loop below does
+    // not have to re-read and re-decode each entry from the record store.
+    std::vector<DurableCatalogEntry> catalogEntries = _catalog->getAllParsedCatalogEntries(opCtx);
 
     // Perform a read on the catalog at the `oldestTimestamp` and record the record stores (via
     // their catalogId) that existed.
@@ -248,7 +256,7 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
             if (DurableCatalog::isCollectionIdent(ident)) {
                 bool isOrphan = !std::any_of(catalogEntries.begin(),
                                              catalogEntries.end(),
-                                             [this, &ident](DurableCatalog::EntryIdentifier entry) {
+                                             [this, &ident](const DurableCatalogEntry& entry) {
                                                  return entry.ident == ident;
                                              });
                 if (isOrphan) {
@@ -322,7 +330,14 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
         // Let the CollectionCatalog know that we are maintaining timestamps from minValidTs
         catalog.catalogIdTracker().rollback(minValidTs);
     });
-    for (DurableCatalog::EntryIdentifier entry : catalogEntries) {
+
+    // Catalog entries that survive the scan below, paired with the minimum valid timestamp to
+    // register them with.
+    std::vector<std::pair<const DurableCatalogEntry*, Timestamp>> entriesToInit;
+    entriesToInit.reserve(catalogEntries.size());
+
+    for (const DurableCatalogEntry& entry : catalogEntries) {
+        const NamespaceString& nss = entry.metadata->nss;
         if (_options.forRestore) {
             // When restoring a subset of user collections from a backup, the collections not
             // restored are in the catalog but are unknown to the storage engine. The catalog
@@ -335,7 +350,7 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
             if (!restoredIdent) {
                 LOGV2(6260800,
                       "Removing catalog entry for collection not restored",
-                      logAttrs(entry.nss),
+                      logAttrs(nss),
                       "ident"_attr = collectionIdent);
 
                 WriteUnitOfWork wuow(opCtx);
@@ -363,11 +378,11 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
             // following logic.
             if (orphan) {
                 auto status =
-                    _recoverOrphanedCollection(opCtx, entry.catalogId, entry.nss, collectionIdent);
+                    _recoverOrphanedCollection(opCtx, entry.catalogId, nss, collectionIdent);
                 if (!status.isOK()) {
                     LOGV2_WARNING(22266,
                                   "Failed to recover orphaned data file for collection",
-                                  logAttrs(entry.nss),
+                                  logAttrs(nss),
                                   "error"_attr = status);
                     WriteUnitOfWork wuow(opCtx);
                     fassert(50716, _catalog->_removeEntry(opCtx, entry.catalogId));
@@ -375,7 +390,7 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
                     if (_options.forRepair) {
                         StorageRepairObserver::get(getGlobalServiceContext())
                             ->invalidatingModification(
-                                str::stream() << "Collection " << entry.nss.toStringForErrorMsg()
+                                str::stream() << "Collection " << nss.toStringForErrorMsg()
                                               << " dropped: " << status.reason());
                     }
                     wuow.commit();
@@ -384,7 +399,7 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
             }
         }
 
-        if (!entry.nss.isReplicated() &&
+        if (!nss.isReplicated() &&
             !std::binary_search(identsKnownToStorageEngine.begin(),
                                 identsKnownToStorageEngine.end(),
                                 entry.ident)) {
@@ -399,7 +414,7 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
             LOGV2_INFO(5555201,
                        "Removed unknown unreplicated collection from the catalog",
                        "catalogId"_attr = entry.catalogId,
-                       logAttrs(entry.nss),
+                       logAttrs(nss),
                        "ident"_attr = entry.ident);
             continue;
         }
@@ -422,7 +437,7 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
                 const auto catalog = CollectionCatalog::latest(opCtx);
                 const auto& tracker = catalog->catalogIdTracker();
                 auto oldestTs = _engine->getOldestTimestamp();
-                auto lookup = tracker.lookup(entry.nss, oldestTs);
+                auto lookup = tracker.lookup(nss, oldestTs);
                 return lookup.result !=
                     HistoricalCatalogIdTracker::LookupResult::Existence::kNotExists;
             }();
@@ -434,11 +449,80 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
             }
         }
 
-        _initCollection(
-            opCtx, entry.catalogId, entry.nss, _options.forRepair, collectionMinValidTs);
+        entriesToInit.emplace_back(&entry, collectionMinValidTs);
+    }
+
+    // Open the record stores for the surviving entries in parallel before registering them with
+    // the CollectionCatalog. Opening a record store verifies the underlying table (metadata
+    // format version and logging settings), which is the dominant startup cost for catalogs with
+    // many tables. Registration stays on this thread because it requires the global exclusive
+    // lock. In a repair context record stores are deliberately not opened, so there is nothing to
+    // parallelize.
+    std::vector<std::unique_ptr<RecordStore>> recordStores(entriesToInit.size());
+    if (!_options.forRepair && entriesToInit.size() >= kMinEntriesForParallelRecordStoreOpen) {
+        ThreadPool::Options threadPoolOptions;
+        threadPoolOptions.poolName = "StartupRecordStoreOpen";
+        threadPoolOptions.maxThreads = std::min<size_t>(
+            static_cast<size_t>(ProcessInfo::getNumAvailableCores()), kMaxRecordStoreOpenThreads);
+        threadPoolOptions.onCreateThread = [](const std::string& threadName) {
+            Client::initThread(threadName,
+                               getGlobalServiceContext()->getService(ClusterRole::ShardServer));
+        };
+        ThreadPool pool(threadPoolOptions);
+        pool.startup();
+
+        const size_t numWorkers = threadPoolOptions.maxThreads;
+        std::vector<Status> workerStatuses(numWorkers, Status::OK());
+        for (size_t workerId = 0; workerId < numWorkers; ++workerId) {
+            pool.schedule([&, workerId](Status scheduleStatus) {
+                invariant(scheduleStatus.isOK());
+
+                auto workerOpCtx = Client::getCurrent()->makeOperationContext();
+                shard_role_details::setRecoveryUnit(
+                    workerOpCtx.get(),
+                    std::unique_ptr<RecoveryUnit>(_engine->newRecoveryUnit()),
+                    WriteUnitOfWork::RecoveryUnitState::kNotInUnitOfWork);
+
+                for (size_t i = workerId; i < entriesToInit.size(); i += numWorkers) {
+                    const auto md = entriesToInit[i].first->metadata;
+                    // The oplog starts its visibility machinery when opened, which must happen
+                    // on the startup thread; leave it for the registration loop below.
+                    if (md->nss.isOplog()) {
+                        continue;
+                    }
+                    try {
+                        recordStores[i] = _engine->getRecordStore(
+                            workerOpCtx.get(), md->nss, entriesToInit[i].first->ident, md->options);
+                    } catch (...) {
+                        workerStatuses[workerId] = exceptionToStatus();
+                        break;
+                    }
+                }
+                shard_role_details::getRecoveryUnit(workerOpCtx.get())->abandonSnapshot();
+            });
+        }
+        pool.shutdown();
+        pool.join();
 
-        if (entry.nss.isOrphanCollection()) {
-            LOGV2(22248, "Orphaned collection found", logAttrs(entry.nss));
+        for (const auto& workerStatus : workerStatuses) {
+            uassertStatusOK(workerStatus);
+        }
+    }
+
+    for (size_t i = 0; i < entriesToInit.size(); ++i) {
+        const DurableCatalogEntry& entry = *entriesToInit[i].first;
+        const Timestamp collectionMinValidTs = entriesToInit[i].second;
+
+        if (recordStores[i]) {
+            _initCollectionWithRecordStore(
+                opCtx, entry, std::move(recordStores[i]), collectionMinValidTs);
+        } else {
+            // Not pre-opened above: a repair context, the oplog, or a small catalog.
+            _initCollection(opCtx, entry, _options.forRepair, collectionMinValidTs);
+        }
+
+        if (entry.metadata->nss.isOrphanCollection()) {
+            LOGV2(22248, "Orphaned collection found", logAttrs(entry.metadata->nss));
         }
     }
 
@@ -446,18 +530,10 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
 }
 
 void StorageEngineImpl::_initCollection(OperationContext* opCtx,
-                                        RecordId catalogId,
-                                        const NamespaceString& nss,
+                                        const DurableCatalogEntry& catalogEntry,
                                         bool forRepair,
                                         Timestamp minValidTs) {
-    const auto catalogEntry = _catalog->getParsedCatalogEntry(opCtx, catalogId);
-    const auto md = catalogEntry->metadata;
-    uassert(ErrorCodes::MustDowngrade,
-            str::stream() << "Collection does not have UUID in KVCatalog. Collection: "
-                          << nss.toStringForErrorMsg(),
-            md->options.uuid);
-
-    auto ident = _catalog->getEntry(catalogId).ident;
+    const auto md = catalogEntry.metadata;
 
     std::unique_ptr<RecordStore> rs;
     if (forRepair) {
@@ -465,12 +541,27 @@ void StorageEngineImpl::_initCollection(OperationContext* opCtx,
         // repaired. This also ensures that if we try to use it, it will blow up.
         rs = nullptr;
     } else {
-        rs = _engine->getRecordStore(opCtx, nss, ident, md->options);
+        rs = _engine->getRecordStore(opCtx, md->nss, catalogEntry.ident, md->options);
         invariant(rs);
     }
 
+    _initCollectionWithRecordStore(opCtx, catalogEntry, std::move(rs), minValidTs);
+}
+
+void StorageEngineImpl::_initCollectionWithRecordStore(OperationContext* opCtx,
+                                                       const DurableCatalogEntry& catalogEntry,
+                                                       std::unique_ptr<RecordStore> rs,
+                                                       Timestamp minValidTs) {
+    const auto md = catalogEntry.metadata;
+    const auto& nss = md->nss;
+    uassert(ErrorCodes::MustDowngrade,
+            str::stream() << "Collection does not have UUID in KVCatalog. Collection: "
+                          << nss.toStringForErrorMsg(),
+            md->options.uuid);
+
     auto collectionFactory = Collection::Factory::get(getGlobalServiceContext());
-    auto collection = collectionFactory->make(opCtx, nss, catalogId, md, std::move(rs));
+    auto collection =
+        collectionFactory->make(opCtx, nss, catalogEntry.catalogId, md, std::move(rs));
 
     CollectionCatalog::write(opCtx, [&](CollectionCatalog& catalog) {
         catalog.registerCollection(opCtx, std::move(collection), /*commitTime*/ minValidTs);
@@ -527,10 +618,10 @@ Status StorageEngineImpl::_recoverOrphanedCollection(OperationContext* opCtx,
 
 void StorageEngineImpl::_checkForIndexFiles(
     OperationContext* opCtx,
-    const DurableCatalog::EntryIdentifier& entry,
+    const DurableCatalogEntry& catalogEntry,
     std::vector<std::string>& identsKnownToStorageEngine) const {
-    std::vector<std::string> indexIdents = _catalog->getIndexIdents(opCtx, entry.catalogId);
-    for (const std::string& indexIdent : indexIdents) {
+    for (const BSONElement& indexIdentElem : catalogEntry.indexIdents) {
+        const auto indexIdent = indexIdentElem.String();
         bool restoredIndexIdent = std::binary_search(
             identsKnownToStorageEngine.begin(), identsKnownToStorageEngine.end(), indexIdent);
 
@@ -540,8 +631,8 @@ void StorageEngineImpl::_checkForIndexFiles(
 
         LOGV2_FATAL_NOTRACE(6261000,
                             "Collection is missing an index file",
-                            logAttrs(entry.nss),
-                            "collectionIdent"_attr = entry.ident,
+                            logAttrs(catalogEntry.metadata->nss),
+                            "collectionIdent"_attr = catalogEntry.ident,
                             "missingIndexIdent"_attr = indexIdent);
     }
 }
@@ -718,15 +809,14 @@ StatusWith<StorageEngine::ReconcileResult> StorageEngineImpl::reconcileCatalogAn
     // engine. An omission here is fatal. A missing ident could mean a collection drop was rolled
     // back. Note that startup already attempts to open tables; this should only catch errors in
     // other contexts such as `recoverToStableTimestamp`.
-    std::vector<DurableCatalog::EntryIdentifier> catalogEntries =
-        _catalog->getAllCatalogEntries(opCtx);
+    std::vector<DurableCatalogEntry> catalogEntries = _catalog->getAllParsedCatalogEntries(opCtx);
     if (!_options.forRepair) {
-        for (const DurableCatalog::EntryIdentifier& entry : catalogEntries) {
+        for (const DurableCatalogEntry& entry : catalogEntries) {
             if (engineIdents.find(entry.ident) == engineIdents.end()) {
                 return {ErrorCodes::UnrecoverableRollbackError,
-                        str::stream()
-                            << "Expected collection does not exist. Collection: "
-                            << entry.nss.toStringForErrorMsg() << " Ident: " << entry.ident};
+                        str::stream() << "Expected collection does not exist. Collection: "
+                                      << entry.metadata->nss.toStringForErrorMsg()
+                                      << " Ident: " << entry.ident};
             }
         }
     }
@@ -736,15 +826,14 @@ StatusWith<StorageEngine::ReconcileResult> StorageEngineImpl::reconcileCatalogAn
     //
     // Also, remove unfinished builds except those that were background index builds started on a
     // secondary.
-    for (const DurableCatalog::EntryIdentifier& entry : catalogEntries) {
-        const auto catalogEntry = _catalog->getParsedCatalogEntry(opCtx, entry.catalogId);
-        auto md = catalogEntry->metadata;
+    for (const DurableCatalogEntry& entry : catalogEntries) {
+        auto md = entry.metadata;
 
         // Batch up the indexes to remove them from `metaData` outside of the iterator.
         std::vector<std::string> indexesToDrop;
         for (const auto& indexMetaData : md->indexes) {
             auto indexName = indexMetaData.nameStringData();
-            auto indexIdent = _catalog->getIndexIdent(opCtx, entry.catalogId, indexName);
+            auto indexIdent = entry.indexIdents[indexName].String();
 
             // Warn in case of incorrect "multikeyPath" information in catalog documents. This is
             // the result of a concurrency bug which has since been fixed, but may persist in
@@ -858,7 +947,7 @@ StatusWith<StorageEngine::ReconcileResult> StorageEngineImpl::reconcileCatalogAn
             WriteUnitOfWork wuow(opCtx);
             auto collection =
                 CollectionCatalog::get(opCtx)->lookupCollectionByNamespaceForMetadataWrite(
-                    opCtx, entry.nss);
+                    opCtx, md->nss);
             invariant(collection->getCatalogId() == entry.catalogId);
             collection->replaceMetadata(opCtx, std::move(md));
             wuow.commit();
@@ -1075,7 +1164,9 @@ Status StorageEngineImpl::repairRecordStore(OperationContext* opCtx,
 
     // When repairing a record store, keep the existing behavior of not installing a minimum visible
     // timestamp.
-    _initCollection(opCtx, catalogId, nss, false, Timestamp::min());
+    const auto catalogEntry = _catalog->getParsedCatalogEntry(opCtx, catalogId);
+    invariant(catalogEntry);
+    _initCollection(opCtx, *catalogEntry, false, Timestamp::min());
 
     return status;
 }
@@ -1245,6 +1336,10 @@ void StorageEngineImpl::checkpoint() {
     _engine->checkpoint();
 }
 
+int64_t StorageEngineImpl::getCacheDirtyBytes() {
+    return _engine->getCacheDirtyBytes();
+}
+
 StorageEngine::CheckpointIteration StorageEngineImpl::getCheckpointIteration() const {
     return _engine->getCheckpointIteration();
 }
@@ -339,6 +339,8 @@ public:
 
     void checkpoint() override;
 
+    int64_t getCacheDirtyBytes() override;
+
     StorageEngine::CheckpointIteration getCheckpointIteration() const override;
 
     bool hasDataBeenCheckpointed(
@@ -404,11 +406,19 @@ private:
     using CollIter = std::list<std::string>::iterator;
 
     void _initCollection(OperationContext* opCtx,
-                         RecordId catalogId,
-                         const NamespaceString& nss,
+                         const DurableCatalogEntry& catalogEntry,
                          bool forRepair,
                          Timestamp minValidTs);
 
+    /**
+     * Registers a collection with the CollectionCatalog using an already-opened record store.
+     * 'rs' may be null in a repair context, where record stores are opened after repair instead.
+     */
+    void _initCollectionWithRecordStore(OperationContext* opCtx,
+                                        const DurableCatalogEntry& catalogEntry,
+                                        std::unique_ptr<RecordStore> rs,
+                                        Timestamp minValidTs);
+
     Status _dropCollections(OperationContext* opCtx,
                             const std::vector<UUID>& toDrop,
                             const std::string& collectionNamePrefix = "");
@@ -433,7 +443,7 @@ private:
      * the given catalog entry.
      */
     void _checkForIndexFiles(OperationContext* opCtx,
-                             const DurableCatalog::EntryIdentifier& entry,
+                             const DurableCatalogEntry& catalogEntry,
                              std::vector<std::string>& identsKnownToStorageEngine) const;
 
     void _dumpCatalog(OperationContext* opCtx);
@@ -177,6 +177,10 @@ public:
 
     void checkpoint() final {}
 
+    int64_t getCacheDirtyBytes() final {
+        return 0;
+    }
+
     StorageEngine::CheckpointIteration getCheckpointIteration() const final {
         return StorageEngine::CheckpointIteration{0};
     }
@@ -509,11 +509,26 @@ std::unique_ptr<ColumnStore::Cursor> WiredTigerColumnStore::newCursor(
 class WiredTigerColumnStore::BulkBuilder final : public ColumnStore::BulkBuilder {
 public:
     BulkBuilder(WiredTigerColumnStore* idx, OperationContext* opCtx)
-        : _opCtx(opCtx), _cursor(*WiredTigerRecoveryUnit::get(opCtx), idx->uri()) {}
+        : _opCtx(opCtx),
+          _metrics(ResourceConsumption::MetricsCollector::get(opCtx)),
+          _cursor(*WiredTigerRecoveryUnit::get(opCtx), idx->uri()) {}
 
     void addCell(PathView path, RowId rid, CellView cell) override {
-        const std::string& key = makeKeyInBuffer(_buffer, path, rid);
-        WiredTigerItem keyItem(key.c_str(), key.size());
+        // The sorter hands cells over in (path, rid) order, so a bulk load sees long runs of
+        // cells sharing one path. Keep the path/NUL key prefix buffered across the run and only
+        // rewrite the RowId suffix, rebuilding the whole key when the path changes.
+        if (_keyPrefixLen == 0 || path != StringData(_buffer.data(), _pathLen)) {
+            makeKeyInBuffer(_buffer, path, rid);
+            _pathLen = path.size();
+            _keyPrefixLen = _buffer.size() - (rid > 0 ? sizeof(RowId) : 0);
+        } else {
+            _buffer.resize(_keyPrefixLen);
+            if (rid > 0) {
+                const RowId num = endian::nativeToBig(rid);
+                _buffer.append(reinterpret_cast<const char*>(&num), sizeof(num));
+            }
+        }
+        WiredTigerItem keyItem(_buffer.c_str(), _buffer.size());
         _cursor->set_key(_cursor.get(), keyItem.Get());
 
         WiredTigerItem cellItem(cell.rawData(), cell.size());
@@ -522,13 +537,15 @@ public:
         invariantWTOK(wiredTigerCursorInsert(*WiredTigerRecoveryUnit::get(_opCtx), _cursor.get()),
                       _cursor->session);
 
-        ResourceConsumption::MetricsCollector::get(_opCtx).incrementOneIdxEntryWritten(
-            _cursor->uri, keyItem.size);
+        _metrics.incrementOneIdxEntryWritten(_cursor->uri, keyItem.size);
     }
 
 private:
     std::string _buffer;
+    size_t _pathLen = 0;       // Length of the path at the front of _buffer.
+    size_t _keyPrefixLen = 0;  // Length of the path/NUL prefix in _buffer, or 0 if empty.
     OperationContext* const _opCtx;
+    ResourceConsumption::MetricsCollector& _metrics;
     WiredTigerBulkLoadCursor _cursor;
 };
 
@@ -2100,6 +2100,13 @@ void WiredTigerKVEngine::checkpoint() {
     return _checkpoint(s);
 }
 
+int64_t WiredTigerKVEngine::getCacheDirtyBytes() {
+    UniqueWiredTigerSession session = _sessionCache->getSession();
+    auto dirtyBytes = WiredTigerUtil::getStatisticsValue(
+        session->getSession(), "statistics:", "", WT_STAT_CONN_CACHE_BYTES_DIRTY);
+    return dirtyBytes.isOK() ? dirtyBytes.getValue() : 0;
+}
+
 void WiredTigerKVEngine::forceCheckpoint(bool useStableTimestamp) {
     UniqueWiredTigerSession session = _sessionCache->getSession();
     WT_SESSION* s = session->getSession();
@@ -233,6 +233,8 @@ public:
 
     void checkpoint() override;
 
+    int64_t getCacheDirtyBytes() override;
+
     // Force a WT checkpoint, this will not update internal timestamps.
     void forceCheckpoint(bool useStableTimestamp);
 
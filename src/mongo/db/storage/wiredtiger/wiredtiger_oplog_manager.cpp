@@ -140,9 +140,18 @@ void WiredTigerOplogManager::haltVisibilityThread() {
 }
 
 void WiredTigerOplogManager::triggerOplogVisibilityUpdate() {
+    // If an update is already scheduled, the visibility thread has yet to sample the all_durable
+    // timestamp and that sample will cover this commit, so there is nothing left to do. The flag
+    // is only cleared under the mutex immediately before sampling, so observing it set here is
+    // sufficient. This keeps the oplog commit path off the mutex in the steady state, where many
+    // writers commit between visibility thread wakeups.
+    if (_triggerOplogVisibilityUpdate.load()) {
+        return;
+    }
+
     stdx::lock_guard<Latch> lk(_oplogVisibilityStateMutex);
-    if (!_triggerOplogVisibilityUpdate) {
-        _triggerOplogVisibilityUpdate = true;
+    if (!_triggerOplogVisibilityUpdate.load()) {
+        _triggerOplogVisibilityUpdate.store(true);
         _oplogVisibilityThreadCV.notify_one();
     }
 }
@@ -171,13 +180,12 @@ void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
     // Close transaction before we wait.
     shard_role_details::getRecoveryUnit(opCtx)->abandonSnapshot();
 
-    stdx::unique_lock<Latch> lk(_oplogVisibilityStateMutex);
+    stdx::unique_lock<Latch> lk(_oplogVisibilityWaitersMutex);
 
     // Prevent any scheduled oplog visibility updates from being delayed for batching and blocking
     // this wait excessively.
-    ++_opsWaitingForOplogVisibilityUpdate;
-    invariant(_opsWaitingForOplogVisibilityUpdate > 0);
-    ScopeGuard exitGuard([&] { --_opsWaitingForOplogVisibilityUpdate; });
+    invariant(_opsWaitingForOplogVisibilityUpdate.fetchAndAdd(1) >= 0);
+    ScopeGuard exitGuard([&] { _opsWaitingForOplogVisibilityUpdate.fetchAndSubtract(1); });
 
     // Out of order writes to the oplog always call triggerOplogVisibilityUpdate() on commit to
     // prompt the OplogVisibilityThread to run and update the oplog visibility. We simply need to
@@ -226,7 +234,7 @@ void WiredTigerOplogManager::_updateOplogVisibilityLoop(WiredTigerSessionCache*
         {
             MONGO_IDLE_THREAD_BLOCK;
             _oplogVisibilityThreadCV.wait(
-                lk, [&] { return _shuttingDown || _triggerOplogVisibilityUpdate; });
+                lk, [&] { return _shuttingDown || _triggerOplogVisibilityUpdate.load(); });
 
             // If we are not shutting down and nobody is actively waiting for the oplog to become
             // visible, delay a bit to batch more requests into one update and reduce system load.
@@ -234,7 +242,7 @@ void WiredTigerOplogManager::_updateOplogVisibilityLoop(WiredTigerSessionCache*
             auto deadline = now + Milliseconds(kDelayMillis);
 
             auto wakeUpEarlyForWaitersPredicate = [&] {
-                return _shuttingDown || _opsWaitingForOplogVisibilityUpdate ||
+                return _shuttingDown || _opsWaitingForOplogVisibilityUpdate.load() ||
                     oplogRecordStore->haveCappedWaiters();
             };
 
@@ -258,8 +266,10 @@ void WiredTigerOplogManager::_updateOplogVisibilityLoop(WiredTigerSessionCache*
             return;
         }
 
-        invariant(_triggerOplogVisibilityUpdate);
-        _triggerOplogVisibilityUpdate = false;
+        invariant(_triggerOplogVisibilityUpdate.load());
+        // Clear the flag before sampling the all_durable timestamp: commits that race with this
+        // update and see the flag still set are guaranteed to be covered by the sample below.
+        _triggerOplogVisibilityUpdate.store(false);
 
         // Fetch the all_durable timestamp from the storage engine, which is guaranteed not to have
         // any holes behind it in-memory.
@@ -302,7 +312,12 @@ void WiredTigerOplogManager::setOplogReadTimestamp(Timestamp ts) {
 }
 
 void WiredTigerOplogManager::_setOplogReadTimestamp(WithLock, uint64_t newTimestamp) {
-    _oplogReadTimestamp.store(newTimestamp);
+    {
+        // Publish under the waiters mutex so a waiter cannot check the timestamp and then block
+        // after this store but before the notification below.
+        stdx::lock_guard<Latch> waitersLock(_oplogVisibilityWaitersMutex);
+        _oplogReadTimestamp.store(newTimestamp);
+    }
     _oplogEntriesBecameVisibleCV.notify_all();
     LOGV2_DEBUG(22374,
                 2,
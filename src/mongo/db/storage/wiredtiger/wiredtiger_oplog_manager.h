@@ -120,9 +120,16 @@ private:
     // Signaled to trigger the oplog visibility thread to run.
     mutable stdx::condition_variable _oplogVisibilityThreadCV;
 
-    // Signaled when oplog visibility has been updated.
+    // Signaled when oplog visibility has been updated. Guarded by _oplogVisibilityWaitersMutex,
+    // which is separate from the visibility thread's state mutex so that the herd of waiters woken
+    // by a visibility advance does not contend with committing writers or the visibility thread.
     mutable stdx::condition_variable _oplogEntriesBecameVisibleCV;
 
+    // Serializes visibility waiters against publication of a new oplog read timestamp. Never
+    // acquired before _oplogVisibilityStateMutex.
+    mutable Mutex _oplogVisibilityWaitersMutex =
+        MONGO_MAKE_LATCH("WiredTigerOplogManager::_oplogVisibilityWaitersMutex");
+
     // Protects the state below.
     mutable Mutex _oplogVisibilityStateMutex =
         MONGO_MAKE_LATCH("WiredTigerOplogManager::_oplogVisibilityStateMutex");
@@ -132,11 +139,13 @@ private:
     bool _shuttingDown = false;
 
     // Triggers an oplog visibility update -- can be delayed if no callers are waiting for an
-    // update, per the _opsWaitingForOplogVisibility counter.
-    bool _triggerOplogVisibilityUpdate = false;
+    // update, per the _opsWaitingForOplogVisibility counter. Only transitions to true while
+    // holding _oplogVisibilityStateMutex, which lets triggerOplogVisibilityUpdate() skip the
+    // mutex entirely when an update is already pending.
+    AtomicWord<bool> _triggerOplogVisibilityUpdate{false};
 
     // Incremented when a caller is waiting for more of the oplog to become visible, to avoid update
     // delays for batching.
-    int64_t _opsWaitingForOplogVisibilityUpdate = 0;
+    AtomicWord<int64_t> _opsWaitingForOplogVisibilityUpdate{0};
 };
 }  // namespace mongo
@@ -38,6 +38,7 @@
 #include <wiredtiger.h>
 // IWYU pragma: no_include "cxxabi.h"
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <deque>
 #include <iostream>
@@ -56,6 +57,8 @@
 #include "mongo/db/catalog/health_log_gen.h"
 #include "mongo/db/catalog/health_log_interface.h"
 #include "mongo/db/catalog/validate_results.h"
+#include "mongo/db/client.h"
+#include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/exception_util.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
@@ -72,6 +75,7 @@
 #include "mongo/db/storage/ident.h"
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/storage_options.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/db/storage/wiredtiger/oplog_truncate_marker_parameters_gen.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_begin_transaction_block.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_compiled_configuration.h"
@@ -95,6 +99,7 @@
 #include "mongo/logv2/log_options.h"
 #include "mongo/logv2/redaction.h"
 #include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/concurrency/idle_thread_block.h"
 #include "mongo/util/debug_util.h"
@@ -219,6 +224,131 @@ MONGO_FAIL_POINT_DEFINE(WTRecordStoreUassertOutOfOrder);
 MONGO_FAIL_POINT_DEFINE(WTWriteConflictException);
 MONGO_FAIL_POINT_DEFINE(WTWriteConflictExceptionForReads);
 
+namespace {
+
+/**
+ * Draws 'numSamples' random samples from the oplog on 'numThreads' worker threads, each with its
+ * own client and storage engine session, and returns the merged estimates. Returns boost::none if
+ * any worker fails to obtain a sample, in which case the caller should fall back to the
+ * single-threaded path.
+ */
+boost::optional<std::vector<CollectionTruncateMarkers::RecordIdAndWallTime>> sampleOplogInParallel(
+    WiredTigerRecordStore* rs,
+    int64_t numSamples,
+    int numThreads,
+    const std::function<CollectionTruncateMarkers::RecordIdAndWallTime(const Record&)>&
+        getRecordIdAndWallTime) {
+    std::vector<std::vector<CollectionTruncateMarkers::RecordIdAndWallTime>> perThread(numThreads);
+    AtomicWord<bool> failed{false};
+    std::vector<stdx::thread> workers;
+    workers.reserve(numThreads);
+    for (int t = 0; t < numThreads; ++t) {
+        workers.emplace_back([&, t] {
+            try {
+                ThreadClient tc("OplogTruncationPointSampler",
+                                getGlobalServiceContext()->getService(ClusterRole::ShardServer));
+                auto opCtx = tc->makeOperationContext();
+                Lock::GlobalLock globalLock(opCtx.get(), MODE_IS);
+
+                // Sampling must observe the whole oplog, including entries ahead of the visible
+                // timestamp, just like the single-threaded path.
+                ScopedOplogVisibleTimestamp scopedOplogVisibleTimestamp(
+                    shard_role_details::getRecoveryUnit(opCtx.get()), boost::none);
+
+                const int64_t samplesForThisThread =
+                    numSamples / numThreads + (t < numSamples % numThreads ? 1 : 0);
+                auto cursor = rs->getRandomCursor(opCtx.get());
+                auto& estimates = perThread[t];
+                estimates.reserve(samplesForThisThread);
+                for (int64_t i = 0; i < samplesForThisThread && !failed.load(); ++i) {
+                    auto record = cursor->next();
+                    if (!record) {
+                        failed.store(true);
+                        return;
+                    }
+                    estimates.emplace_back(getRecordIdAndWallTime(*record));
+                }
+            } catch (const AssertionException& ex) {
+                LOGV2_WARNING(10968410,
+                              "Parallel oplog sampling worker failed",
+                              "error"_attr = redact(ex));
+                failed.store(true);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    if (failed.load()) {
+        return boost::none;
+    }
+
+    std::vector<CollectionTruncateMarkers::RecordIdAndWallTime> merged;
+    merged.reserve(numSamples);
+    for (auto& estimates : perThread) {
+        merged.insert(merged.end(),
+                      std::make_move_iterator(estimates.begin()),
+                      std::make_move_iterator(estimates.end()));
+    }
+    return merged;
+}
+
+/**
+ * Parallel counterpart of CollectionTruncateMarkers::createFromCollectionIterator for the oplog.
+ * Returns boost::none if sampling is not the applicable creation method or if parallel sampling
+ * fails, in which case the caller should use the single-threaded path.
+ */
+boost::optional<CollectionTruncateMarkers::InitialSetOfMarkers>
+createOplogTruncateMarkersInParallel(
+    OperationContext* opCtx,
+    WiredTigerRecordStore* rs,
+    const NamespaceString& ns,
+    int64_t minBytesPerTruncateMarker,
+    int64_t numberOfMarkersToKeep,
+    int numThreads,
+    const std::function<CollectionTruncateMarkers::RecordIdAndWallTime(const Record&)>&
+        getRecordIdAndWallTime) {
+    int64_t numRecords = rs->numRecords(opCtx);
+    int64_t dataSize = rs->dataSize(opCtx);
+    if (CollectionTruncateMarkers::computeInitialCreationMethod(
+            numRecords, dataSize, minBytesPerTruncateMarker, numberOfMarkersToKeep) !=
+        CollectionTruncateMarkers::MarkersCreationMethod::Sampling) {
+        return boost::none;
+    }
+
+    auto startTime = curTimeMicros64();
+    double avgRecordSize = double(dataSize) / double(numRecords);
+    double estimatedRecordsPerMarker = std::ceil(minBytesPerTruncateMarker / avgRecordSize);
+    double estimatedBytesPerMarker = estimatedRecordsPerMarker * avgRecordSize;
+    int64_t numSamples = (CollectionTruncateMarkers::kRandomSamplesPerMarker * numRecords) /
+        static_cast<int64_t>(estimatedRecordsPerMarker);
+
+    LOGV2(10968411,
+          "Sampling the oplog in parallel to determine where to place markers for truncation",
+          "namespace"_attr = ns,
+          "numSamples"_attr = numSamples,
+          "samplingThreads"_attr = numThreads);
+
+    auto estimates = sampleOplogInParallel(rs, numSamples, numThreads, getRecordIdAndWallTime);
+    if (!estimates) {
+        LOGV2(10968412,
+              "Parallel oplog sampling failed, falling back to single-threaded marker creation",
+              "namespace"_attr = ns);
+        return boost::none;
+    }
+
+    return CollectionTruncateMarkers::createMarkersFromSampleEstimates(
+        std::move(*estimates),
+        ns,
+        numRecords,
+        dataSize,
+        static_cast<int64_t>(estimatedRecordsPerMarker),
+        static_cast<int64_t>(estimatedBytesPerMarker),
+        Microseconds{static_cast<int64_t>(curTimeMicros64() - startTime)});
+}
+
+}  // namespace
+
 std::shared_ptr<WiredTigerRecordStore::OplogTruncateMarkers>
 WiredTigerRecordStore::OplogTruncateMarkers::createOplogTruncateMarkers(OperationContext* opCtx,
                                                                         WiredTigerRecordStore* rs,
@@ -247,23 +377,37 @@ WiredTigerRecordStore::OplogTruncateMarkers::createOplogTruncateMarkers(Operatio
             fmt::format("Cannot create oplog of size less than {} bytes", numTruncateMarkersToKeep),
             minBytesPerTruncateMarker > 0);
 
+    auto getRecordIdAndWallTime = [](const Record& record) {
+        BSONObj obj = record.data.toBson();
+        auto wallTime = obj.hasField(repl::DurableOplogEntry::kWallClockTimeFieldName)
+            ? obj[repl::DurableOplogEntry::kWallClockTimeFieldName].Date()
+            : obj[repl::DurableOplogEntry::kTimestampFieldName].timestampTime();
+        return RecordIdAndWallTime(record.id, wallTime);
+    };
+
     // We need to read the whole oplog, override the recoveryUnit's oplogVisibleTimestamp.
     ScopedOplogVisibleTimestamp scopedOplogVisibleTimestamp(
         shard_role_details::getRecoveryUnit(opCtx), boost::none);
-    UnyieldableCollectionIterator iterator(opCtx, rs);
-    auto initialSetOfMarkers = CollectionTruncateMarkers::createFromCollectionIterator(
-        opCtx,
-        iterator,
-        ns,
-        minBytesPerTruncateMarker,
-        [](const Record& record) {
-            BSONObj obj = record.data.toBson();
-            auto wallTime = obj.hasField(repl::DurableOplogEntry::kWallClockTimeFieldName)
-                ? obj[repl::DurableOplogEntry::kWallClockTimeFieldName].Date()
-                : obj[repl::DurableOplogEntry::kTimestampFieldName].timestampTime();
-            return RecordIdAndWallTime(record.id, wallTime);
-        },
-        numTruncateMarkersToKeep);
+    auto initialSetOfMarkers = [&] {
+        if (const int samplingThreads = gOplogTruncationPointSamplingThreads; samplingThreads > 1) {
+            if (auto markers = createOplogTruncateMarkersInParallel(opCtx,
+                                                                    rs,
+                                                                    ns,
+                                                                    minBytesPerTruncateMarker,
+                                                                    numTruncateMarkersToKeep,
+                                                                    samplingThreads,
+                                                                    getRecordIdAndWallTime)) {
+                return std::move(*markers);
+            }
+        }
+        UnyieldableCollectionIterator iterator(opCtx, rs);
+        return CollectionTruncateMarkers::createFromCollectionIterator(opCtx,
+                                                                       iterator,
+                                                                       ns,
+                                                                       minBytesPerTruncateMarker,
+                                                                       getRecordIdAndWallTime,
+                                                                       numTruncateMarkersToKeep);
+    }();
     LOGV2(22382,
           "WiredTiger record store oplog processing finished",
           "duration"_attr = duration_cast<Milliseconds>(initialSetOfMarkers.timeTaken));
@@ -731,6 +875,10 @@ WiredTigerRecordStore::WiredTigerRecordStore(WiredTigerKVEngine* kvEngine,
             .markCollectionAsAlwaysNeedsSizeAdjustment(getIdent());
     }
 
+    if (gTrackRecordAccessHeat && _keyFormat == KeyFormat::Long && !_isOplog) {
+        _heatSketch = std::make_unique<RecordIdHeatSketch>();
+    }
+
     // If no SizeStorer is in use, start counting at zero. In practice, this will only ever be the
     // case for temporary RecordStores (those not associated with any collection) and in unit
     // tests. Persistent size information is not required in either case. If a RecordStore needs
@@ -1530,6 +1678,24 @@ std::unique_ptr<RecordCursor> WiredTigerRecordStore::getRandomCursor(
     return std::make_unique<RandomCursor>(opCtx, *this, "");
 }
 
+void WiredTigerRecordStore::prefetchRecords(OperationContext* opCtx,
+                                            const std::vector<RecordId>& ids) const {
+    // Positioning a cursor on each id pulls the backing leaf page into the storage engine cache
+    // so that the upcoming reads do not stall on it. This is only a hint: a missing record will
+    // be discovered by the actual read, and any other error (e.g. a prepare conflict or cache
+    // pressure) simply ends the prefetch rather than being waited out or surfaced.
+    WiredTigerCursor cursor(*WiredTigerRecoveryUnit::get(opCtx), _uri, _tableId, true);
+    WT_CURSOR* c = cursor.get();
+    for (const auto& id : ids) {
+        const CursorKey key = makeCursorKey(id, _keyFormat);
+        setKey(c, &key);
+        const int ret = c->search(c);
+        if (ret != 0 && ret != WT_NOTFOUND) {
+            break;
+        }
+    }
+}
+
 Status WiredTigerRecordStore::doTruncate(OperationContext* opCtx) {
     WiredTigerCursor startWrap(*WiredTigerRecoveryUnit::get(opCtx), _uri, _tableId, true);
     WT_CURSOR* start = startWrap.get();
@@ -1703,6 +1869,13 @@ void WiredTigerRecordStore::appendNumericCustomStats(OperationContext* opCtx,
     BSONObjBuilder bob(result->subobjStart(_engineName));
 
     appendNumericStats(s, getURI(), bob);
+
+    if (_heatSketch) {
+        const auto stats = _heatSketch->getStats();
+        BSONObjBuilder heatBob(result->subobjStart("recordAccessHeat"));
+        heatBob.appendNumber("accesses", stats.accesses);
+        heatBob.appendNumber("distinctBucketsEstimate", stats.distinctBucketsEstimate);
+    }
 }
 
 void WiredTigerRecordStore::appendAllCustomStats(OperationContext* opCtx,
@@ -2078,7 +2251,8 @@ WiredTigerRecordStoreCursor::WiredTigerRecordStoreCursor(OperationContext* opCtx
       _keyFormat(rs.keyFormat()),
       _forward(forward),
       _uuid(rs.uuid()),
-      _assertOutOfOrderForTest(MONGO_unlikely(WTRecordStoreUassertOutOfOrder.shouldFail())) {
+      _assertOutOfOrderForTest(MONGO_unlikely(WTRecordStoreUassertOutOfOrder.shouldFail())),
+      _heatSketch(rs.recordAccessHeatSketch()) {
     _cursor.emplace(*WiredTigerRecoveryUnit::get(opCtx), _uri, _tableId, true);
     auto metrics = &ResourceConsumption::MetricsCollector::get(opCtx);
 
@@ -2100,6 +2274,50 @@ boost::optional<Record> WiredTigerRecordStoreCursor::next() {
     return toReturn;
 }
 
+size_t WiredTigerRecordStoreCursor::nextBatch(RecordBatch* batch, size_t n) {
+    invariant(_hasRestored);
+    batch->clear();
+    if (_eof) {
+        return 0;
+    }
+
+    // Ensure an active transaction is open once for the entire batch rather than per record.
+    WiredTigerRecoveryUnit::get(_opCtx)->getSession();
+    WT_CURSOR* c = _cursor->get();
+
+    while (batch->size() < n) {
+        if (!_skipNextAdvance) {
+            int advanceRet;
+            try {
+                advanceRet = wiredTigerPrepareConflictRetry(
+                    _opCtx, [&] { return _forward ? c->next(c) : c->prev(c); });
+            } catch (const WriteConflictException&) {
+                // Surface the conflict immediately if nothing has been read yet. Otherwise
+                // return the records accumulated so far; the cursor position is unchanged by the
+                // failed advance, so the conflict recurs on the next call.
+                if (batch->empty()) {
+                    throw;
+                }
+                break;
+            }
+            if (advanceRet == WT_NOTFOUND) {
+                _eof = true;
+                _positioned = false;
+                break;
+            }
+            invariantWTOK(advanceRet, c->session);
+        }
+        _skipNextAdvance = false;
+        _positioned = true;
+
+        Record record = {getKey(c, _keyFormat), getRecordData(c)};
+        checkOrder(record.id);
+        trackReturn(record);
+        batch->append(std::move(record.id), record.data.data(), record.data.size());
+    }
+    return batch->size();
+}
+
 RecordId WiredTigerRecordStoreCursor::nextIdCommon() {
     invariant(_hasRestored);
     if (_eof)
@@ -2193,6 +2411,9 @@ void WiredTigerRecordStoreCursor::trackReturn(const Record& record) {
     if (_metrics) {
         _metrics->incrementOneDocRead(_uri, record.data.size() + computeRecordIdSize(record.id));
     }
+    if (_heatSketch) {
+        _heatSketch->recordAccess(record.id);
+    }
     _lastReturnedId = record.id;
 }
 
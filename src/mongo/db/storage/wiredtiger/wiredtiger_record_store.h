@@ -58,6 +58,7 @@
 #include "mongo/db/storage/collection_truncate_markers.h"
 #include "mongo/db/storage/key_format.h"
 #include "mongo/db/storage/record_data.h"
+#include "mongo/db/storage/record_id_heat_sketch.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_cursor.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
@@ -192,6 +193,9 @@ public:
 
     std::unique_ptr<RecordCursor> getRandomCursor(OperationContext* opCtx) const override;
 
+    void prefetchRecords(OperationContext* opCtx,
+                         const std::vector<RecordId>& ids) const override;
+
     Status doTruncate(OperationContext* opCtx) override;
     Status doRangeTruncate(OperationContext* opCtx,
                            const RecordId& minRecordId,
@@ -281,6 +285,14 @@ public:
 
     bool isOpHidden_forTest(const RecordId& id) const;
 
+    /**
+     * Returns the sketch tracking RecordId access frequency for this record store, or nullptr if
+     * heat tracking is disabled or unsupported for this record store.
+     */
+    RecordIdHeatSketch* recordAccessHeatSketch() const {
+        return _heatSketch.get();
+    }
+
     class OplogTruncateMarkers;
 
     // Exposed only for testing.
@@ -388,6 +400,10 @@ private:
     AtomicWord<int64_t>
         _totalTimeTruncating;            // Cumulative amount of time spent truncating the oplog.
     AtomicWord<int64_t> _truncateCount;  // Cumulative number of truncates of the oplog.
+
+    // Non-null only when trackRecordAccessHeat is enabled and this record store uses long-format
+    // RecordIds and is not the oplog.
+    std::unique_ptr<RecordIdHeatSketch> _heatSketch;
 };
 
 
@@ -399,6 +415,8 @@ public:
 
     boost::optional<Record> next() override;
 
+    size_t nextBatch(RecordBatch* batch, size_t n) override;
+
     boost::optional<Record> seek(const RecordId& start, BoundInclusion boundInclusion) override;
 
     boost::optional<Record> seekExact(const RecordId& id) override;
@@ -478,6 +496,8 @@ protected:
     // Whether or not the underlying WT cursor is positioned on a record.
     bool _positioned = false;
     const bool _assertOutOfOrderForTest = false;
+    // Owned by the record store this cursor was opened against; may be null.
+    RecordIdHeatSketch* const _heatSketch;
 
 private:
     void reportOutOfOrderRead(const RecordId& id, bool failWithOutOfOrderForTest) const;
@@ -500,6 +520,12 @@ public:
 
     boost::optional<Record> next() override;
 
+    size_t nextBatch(RecordBatch* batch, size_t n) override {
+        // Capped visibility rules are enforced by next(); use the generic one-record-at-a-time
+        // path rather than the batched WiredTigerRecordStoreCursor implementation.
+        return RecordCursor::nextBatch(batch, n);
+    }
+
     boost::optional<Record> seek(const RecordId& start, BoundInclusion boundInclusion) override;
 
     boost::optional<Record> seekExact(const RecordId& id) override;
@@ -165,9 +165,11 @@ void WiredTigerRecoveryUnit::prepareUnitOfWork() {
                 "preparing transaction at time: {prepareTimestamp}",
                 "prepareTimestamp"_attr = _prepareTimestamp);
 
-    const std::string conf = "prepare_timestamp=" + unsignedHex(_prepareTimestamp.asULL());
-    // Prepare the transaction.
-    invariantWTOK(s->prepare_transaction(s, conf.c_str()), s);
+    // Set the prepare timestamp through the integer API and prepare the transaction. This avoids
+    // formatting a configuration string for every prepared transaction.
+    invariantWTOK(
+        s->timestamp_transaction_uint(s, WT_TS_TXN_TYPE_PREPARE, _prepareTimestamp.asULL()), s);
+    invariantWTOK(s->prepare_transaction(s, nullptr), s);
 }
 
 void WiredTigerRecoveryUnit::doCommitUnitOfWork() {
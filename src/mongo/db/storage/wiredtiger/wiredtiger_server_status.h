@@ -33,6 +33,7 @@
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/commands/server_status.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/util/duration.h"
 
 namespace mongo {
 
@@ -45,6 +46,7 @@ class WiredTigerServerStatusSection : public ServerStatusSection {
 public:
     using ServerStatusSection::ServerStatusSection;
     bool includeByDefault() const override;
+    Milliseconds stalenessBudget() const override;
     BSONObj generateSection(OperationContext* opCtx,
                             const BSONElement& configElement) const override;
 };
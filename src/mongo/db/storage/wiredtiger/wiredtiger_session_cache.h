@@ -432,9 +432,23 @@ private:
     AtomicWord<unsigned> _shuttingDown{0};
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    Mutex _cacheLock = MONGO_MAKE_LATCH("WiredTigerSessionCache::_cacheLock");
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    // Cached idle sessions are sharded across a fixed number of partitions, each guarded by its
+    // own mutex, so that session acquisition and release do not funnel through a single lock when
+    // many client threads are active. Each thread is assigned a home partition; getSession() falls
+    // back to stealing from the other partitions when the home partition is empty.
+    static constexpr size_t kSessionCachePartitions = 16;
+
+    struct SessionCachePartition {
+        Mutex lock = MONGO_MAKE_LATCH("WiredTigerSessionCache::SessionCachePartition::lock");
+        // Tracks sessions.size(), so threads searching other partitions for a cached session can
+        // skip empty ones without taking their locks.
+        AtomicWord<size_t> count{0};
+        SessionCache sessions;
+    };
+
+    SessionCachePartition _partitions[kSessionCachePartitions];
 
     // Bumped when all open sessions need to be closed
     AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the lock
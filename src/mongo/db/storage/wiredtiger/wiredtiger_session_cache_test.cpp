@@ -29,6 +29,7 @@
 
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <wiredtiger.h>
 
@@ -37,6 +38,7 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/unittest/temp_dir.h"
@@ -116,6 +118,40 @@ TEST(WiredTigerSessionCacheTest, CheckSessionCacheCleanup) {
     ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
 }
 
+// Sessions released from different threads land in different cache partitions; a thread must be
+// able to reuse sessions released by any other thread, and cache-wide operations must observe all
+// partitions.
+TEST(WiredTigerSessionCacheTest, ReuseSessionsAcrossThreads) {
+    const size_t kThreads = 8;
+    WiredTigerSessionCacheHarnessHelper harnessHelper("");
+    WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
+
+    std::vector<stdx::thread> threads;
+    for (size_t i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&] {
+            UniqueWiredTigerSession session = sessionCache->getSession();
+            // Releasing the session on thread exit puts it in the releasing thread's partition.
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), kThreads);
+
+    // Draining the whole cache from a single thread must find the sessions cached by the others.
+    {
+        std::vector<UniqueWiredTigerSession> sessions;
+        for (size_t i = 0; i < kThreads; ++i) {
+            sessions.push_back(sessionCache->getSession());
+        }
+        ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+    }
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), kThreads);
+
+    sessionCache->closeAll();
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+}
+
 TEST(WiredTigerSessionCacheTest, ReleaseCursorDuringShutdown) {
     WiredTigerSessionCacheHarnessHelper harnessHelper("");
     WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
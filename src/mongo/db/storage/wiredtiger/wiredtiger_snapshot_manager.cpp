@@ -57,31 +57,36 @@ MONGO_FAIL_POINT_DEFINE(hangBeforeMajorityReadTransactionStarted);
 void WiredTigerSnapshotManager::setCommittedSnapshot(const Timestamp& timestamp) {
     stdx::lock_guard<Latch> lock(_committedSnapshotMutex);
 
-    invariant(!_committedSnapshot || *_committedSnapshot <= timestamp);
-    _committedSnapshot = timestamp;
+    auto current = _committedSnapshot.load();
+    invariant(current == 0 || Timestamp(current) <= timestamp);
+    _committedSnapshot.store(timestamp.asULL());
 }
 
 void WiredTigerSnapshotManager::setLastApplied(const Timestamp& timestamp) {
     stdx::lock_guard<Latch> lock(_lastAppliedMutex);
-    if (timestamp.isNull())
-        _lastApplied = boost::none;
-    else
-        _lastApplied = timestamp;
+    // A null timestamp clears the last applied; readers treat zero as "not set".
+    _lastApplied.store(timestamp.asULL());
 }
 
 boost::optional<Timestamp> WiredTigerSnapshotManager::getLastApplied() {
-    stdx::lock_guard<Latch> lock(_lastAppliedMutex);
-    return _lastApplied;
+    auto lastApplied = _lastApplied.load();
+    if (!lastApplied) {
+        return boost::none;
+    }
+    return Timestamp(lastApplied);
 }
 
 void WiredTigerSnapshotManager::clearCommittedSnapshot() {
     stdx::lock_guard<Latch> lock(_committedSnapshotMutex);
-    _committedSnapshot = boost::none;
+    _committedSnapshot.store(0);
 }
 
 boost::optional<Timestamp> WiredTigerSnapshotManager::getMinSnapshotForNextCommittedRead() const {
-    stdx::lock_guard<Latch> lock(_committedSnapshotMutex);
-    return _committedSnapshot;
+    auto committedSnapshot = _committedSnapshot.load();
+    if (!committedSnapshot) {
+        return boost::none;
+    }
+    return Timestamp(committedSnapshot);
 }
 
 Timestamp WiredTigerSnapshotManager::beginTransactionOnCommittedSnapshot(
@@ -90,13 +95,12 @@ Timestamp WiredTigerSnapshotManager::beginTransactionOnCommittedSnapshot(
     RoundUpPreparedTimestamps roundUpPreparedTimestamps,
     RecoveryUnit::UntimestampedWriteAssertionLevel untimestampedWriteAssertion) const {
 
-    auto committedSnapshot = [this]() {
-        stdx::lock_guard<Latch> lock(_committedSnapshotMutex);
-        uassert(ErrorCodes::ReadConcernMajorityNotAvailableYet,
-                "Committed view disappeared while running operation",
-                _committedSnapshot);
-        return _committedSnapshot.value();
-    }();
+    // Lock-free read of the rolling committed snapshot; this runs once per majority read.
+    auto rawCommittedSnapshot = _committedSnapshot.load();
+    uassert(ErrorCodes::ReadConcernMajorityNotAvailableYet,
+            "Committed view disappeared while running operation",
+            rawCommittedSnapshot);
+    auto committedSnapshot = Timestamp(rawCommittedSnapshot);
 
     if (MONGO_unlikely(hangBeforeMajorityReadTransactionStarted.shouldFail())) {
         sleepmillis(100);
@@ -38,6 +38,7 @@
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/snapshot_manager.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_begin_transaction_block.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 
 namespace mongo {
@@ -85,14 +86,19 @@ public:
     boost::optional<Timestamp> getMinSnapshotForNextCommittedRead() const;
 
 private:
+    // The published timestamps below are read on every eligible read operation when selecting a
+    // read timestamp, so they are stored as atomics that readers load without locking. A null
+    // Timestamp encodes "not set". The mutexes only serialize the (rare) writers, which must
+    // check the previous value before publishing a new one.
+
     // Snapshot to use for reads at a commit timestamp.
-    mutable Mutex _committedSnapshotMutex =  // Guards _committedSnapshot.
+    mutable Mutex _committedSnapshotMutex =  // Serializes writers of _committedSnapshot.
         MONGO_MAKE_LATCH("WiredTigerSnapshotManager::_committedSnapshotMutex");
-    boost::optional<Timestamp> _committedSnapshot;
+    AtomicWord<unsigned long long> _committedSnapshot{0};
 
     // Timestamp to use for reads at a the lastApplied timestamp.
-    mutable Mutex _lastAppliedMutex =  // Guards _lastApplied.
+    mutable Mutex _lastAppliedMutex =  // Serializes writers of _lastApplied.
         MONGO_MAKE_LATCH("WiredTigerSnapshotManager::_lastAppliedMutex");
-    boost::optional<Timestamp> _lastApplied;
+    AtomicWord<unsigned long long> _lastApplied{0};
 };
 }  // namespace mongo
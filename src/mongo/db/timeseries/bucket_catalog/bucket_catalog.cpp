@@ -29,6 +29,7 @@
 
 #include <absl/container/node_hash_map.h>
 #include <absl/meta/type_traits.h>
+#include <algorithm>
 #include <boost/container/small_vector.hpp>
 #include <boost/container/vector.hpp>
 #include <iterator>
@@ -58,8 +59,11 @@
 #include "mongo/util/debug_util.h"
 #include "mongo/util/decorable.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/base/init.h"  // IWYU pragma: keep
 #include "mongo/util/future.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/string_map.h"
+#include "mongo/util/tracked_memory_registry.h"
 #include "mongo/util/tracking_context.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
@@ -73,7 +77,17 @@ MONGO_FAIL_POINT_DEFINE(hangTimeseriesDirectModificationBeforeFinish);
 MONGO_FAIL_POINT_DEFINE(hangTimeseriesInsertBeforeReopeningBucket);
 MONGO_FAIL_POINT_DEFINE(runPostCommitDebugChecks);
 
-constexpr std::size_t kDefaultNumberOfStripes = 32;
+constexpr std::size_t kMinNumberOfStripes = 32;
+constexpr std::size_t kMaxNumberOfStripes = 128;
+
+/**
+ * Scales the stripe count with the host's core count so that concurrent writers on large machines
+ * rarely contend on the same stripe mutex, while small machines keep the historical count of 32.
+ */
+std::size_t defaultNumberOfStripes() {
+    return std::clamp<std::size_t>(
+        2 * ProcessInfo::getNumAvailableCores(), kMinNumberOfStripes, kMaxNumberOfStripes);
+}
 
 /**
  * Prepares the batch for commit. Sets min/max appropriately, records the number of
@@ -157,6 +171,12 @@ void updateBucketFetchAndQueryStats(const ReopeningContext& context,
         }
     }
 }
+
+MONGO_INITIALIZER(RegisterBucketCatalogTrackedMemory)(InitializerContext*) {
+    tracked_memory_registry::registerSubsystem("timeseriesBucketCatalog", [](ServiceContext* svc) {
+        return getMemoryUsage(BucketCatalog::get(svc));
+    });
+}
 }  // namespace
 
 SuccessfulInsertion::SuccessfulInsertion(std::shared_ptr<WriteBatch>&& b, ClosedBuckets&& c)
@@ -179,6 +199,13 @@ Stripe::Stripe(TrackingContexts& trackingContexts)
                                      tracked_map<Date_t, ArchivedBucket, std::greater<Date_t>>,
                                      BucketHasher>(
               getTrackingContext(trackingContexts, TrackingScope::kArchivedBuckets))),
+      recentlyClosedBuckets(
+          make_tracked_unordered_map<BucketKey::Hash,
+                                     tracked_map<Date_t, RecentlyClosedBucket, std::greater<Date_t>>,
+                                     BucketHasher>(
+              getTrackingContext(trackingContexts, TrackingScope::kRecentlyClosedBuckets))),
+      recentlyClosedBucketsClosureOrder(make_tracked_list<std::pair<BucketKey::Hash, Date_t>>(
+          getTrackingContext(trackingContexts, TrackingScope::kRecentlyClosedBuckets))),
       outstandingReopeningRequests(
           make_tracked_unordered_map<
               BucketKey,
@@ -187,7 +214,7 @@ Stripe::Stripe(TrackingContexts& trackingContexts)
               getTrackingContext(trackingContexts, TrackingScope::kReopeningRequests))) {}
 
 BucketCatalog::BucketCatalog()
-    : BucketCatalog(kDefaultNumberOfStripes,
+    : BucketCatalog(defaultNumberOfStripes(),
                     getTimeseriesIdleBucketExpiryMemoryUsageThresholdBytes) {}
 
 BucketCatalog::BucketCatalog(size_t numberOfStripes, std::function<uint64_t()> memoryUsageThreshold)
@@ -234,6 +261,7 @@ uint64_t getMemoryUsage(const BucketCatalog& catalog) {
         catalog.trackingContexts.miscellaneous.allocated() +
         catalog.trackingContexts.openBucketsById.allocated() +
         catalog.trackingContexts.openBucketsByKey.allocated() +
+        catalog.trackingContexts.recentlyClosedBuckets.allocated() +
         catalog.trackingContexts.reopeningRequests.allocated() +
         catalog.trackingContexts.stats.allocated() + catalog.trackingContexts.summaries.allocated();
 #endif
@@ -265,6 +293,9 @@ void getDetailedMemoryUsage(const BucketCatalog& catalog, BSONObjBuilder& builde
     subBuilder.appendNumber(
         "openBucketsByKey",
         static_cast<long long>(catalog.trackingContexts.openBucketsByKey.allocated()));
+    subBuilder.appendNumber(
+        "recentlyClosedBuckets",
+        static_cast<long long>(catalog.trackingContexts.recentlyClosedBuckets.allocated()));
     subBuilder.appendNumber(
         "reopeningRequests",
         static_cast<long long>(catalog.trackingContexts.reopeningRequests.allocated()));
@@ -658,8 +689,10 @@ boost::optional<ClosedBucket> finish(OperationContext* opCtx,
         }
     } else if (allCommitted(*bucket)) {
         switch (bucket->rolloverAction) {
-            case RolloverAction::kHardClose:
-            case RolloverAction::kSoftClose: {
+            case RolloverAction::kSoftClose:
+                internal::recordRecentlyClosedBucket(catalog, stripe, stripeLock, *bucket);
+                [[fallthrough]];
+            case RolloverAction::kHardClose: {
                 internal::closeOpenBucket(
                     opCtx, catalog, stripe, stripeLock, *bucket, closedBucket);
                 break;
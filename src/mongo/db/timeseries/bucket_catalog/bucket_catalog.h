@@ -174,6 +174,19 @@ struct Stripe {
                           BucketHasher>
         archivedBuckets;
 
+    // Buckets that were recently soft-closed and may still accept measurements if reopened. The
+    // map mirrors the structure of 'archivedBuckets', but unlike archived buckets these buckets
+    // retain no registry state; the entries only serve to route a late-arriving measurement to
+    // archive-style reopening (a fetch by '_id') instead of query-based reopening. Entries are
+    // evicted in closure order, tracked by 'recentlyClosedBucketsClosureOrder', once the stripe
+    // holds 'kMaxRecentlyClosedBuckets' of them.
+    static constexpr size_t kMaxRecentlyClosedBuckets = 1024;
+    tracked_unordered_map<BucketKey::Hash,
+                          tracked_map<Date_t, RecentlyClosedBucket, std::greater<Date_t>>,
+                          BucketHasher>
+        recentlyClosedBuckets;
+    tracked_list<std::pair<BucketKey::Hash, Date_t>> recentlyClosedBucketsClosureOrder;
+
     // All series currently with outstanding reopening operations. Used to coordinate disk access
     // between reopenings and regular writes to prevent stale reads and corrupted updates.
     static constexpr int kInlinedVectorSize = 4;
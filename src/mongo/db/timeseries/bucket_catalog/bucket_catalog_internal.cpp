@@ -182,6 +182,22 @@ boost::optional<InsertWaiter> checkForWait(const Stripe& stripe,
 
     return boost::none;
 }
+
+/**
+ * Connection threads tend to insert runs of measurements carrying an identical metaField value.
+ * Normalization (a recursive field sort plus a rebuild of the object) is a pure function of the
+ * value's bytes, so each thread remembers its last input and result and reuses the result on an
+ * exact binary match, hashing and sorting once per distinct value rather than once per
+ * measurement. Scalar values skip the cache entirely: they need no sorting and caching them
+ * would only add copies. The cached copies are deliberately untracked; the footprint is bounded
+ * by one metadata value per writer thread.
+ */
+struct NormalizedMetadataCache {
+    boost::optional<UUID> collectionUUID;
+    BSONObj rawMetadata;         // Owned copy of {<metaField>: <value>} as supplied by the user.
+    BSONObj normalizedMetadata;  // Owned copy of {<metaField>: <normalized value>}.
+};
+thread_local NormalizedMetadataCache normalizedMetadataCache;
 }  // namespace
 
 StripeNumber getStripeNumber(const BucketCatalog& catalog, const BucketKey& key) {
@@ -223,6 +239,27 @@ StatusWith<std::pair<BucketKey, Date_t>> extractBucketingParameters(
         metadata = swDocTimeAndMeta.getValue().second;
     }
 
+    if (metadata.type() == BSONType::Object || metadata.type() == BSONType::Array) {
+        auto& cache = normalizedMetadataCache;
+        if (cache.collectionUUID == collectionUUID &&
+            metadata.binaryEqual(cache.rawMetadata.firstElement())) {
+            auto key = BucketKey{collectionUUID,
+                                 BucketMetadata{trackingContext,
+                                                BucketMetadata::AlreadyNormalized{},
+                                                cache.normalizedMetadata,
+                                                comparator}};
+            return {std::make_pair(std::move(key), time)};
+        }
+
+        auto key = BucketKey{
+            collectionUUID,
+            BucketMetadata{trackingContext, metadata, comparator, options.getMetaField()}};
+        cache.collectionUUID = collectionUUID;
+        cache.rawMetadata = metadata.wrap();
+        cache.normalizedMetadata = key.metadata.toBSON().getOwned();
+        return {std::make_pair(std::move(key), time)};
+    }
+
     // Buckets are spread across independently-lockable stripes to improve parallelism. We map a
     // bucket to a stripe by hashing the BucketKey.
     auto key =
@@ -572,6 +609,21 @@ StatusWith<std::reference_wrapper<Bucket>> reopenBucket(OperationContext* opCtx,
         }
     }
 
+    // Likewise remove any recently-closed entry for this bucket, so that it cannot be offered as a
+    // reopening candidate while it is open.
+    if (auto setIt = stripe.recentlyClosedBuckets.find(key.hash);
+        setIt != stripe.recentlyClosedBuckets.end()) {
+        auto& closedSet = setIt->second;
+        if (auto bucketIt = closedSet.find(bucket->minTime);
+            bucketIt != closedSet.end() && bucket->bucketId == bucketIt->second.bucketId) {
+            if (closedSet.size() == 1) {
+                stripe.recentlyClosedBuckets.erase(setIt);
+            } else {
+                closedSet.erase(bucketIt);
+            }
+        }
+    }
+
     // Pass ownership of the reopened bucket to the bucket catalog.
     auto [insertedIt, newlyInserted] =
         stripe.openBucketsById.try_emplace(bucket->bucketId, std::move(bucket));
@@ -905,6 +957,79 @@ boost::optional<OID> findArchivedCandidate(
     return boost::none;
 }
 
+void recordRecentlyClosedBucket(BucketCatalog& catalog,
+                                Stripe& stripe,
+                                WithLock stripeLock,
+                                const Bucket& bucket) {
+    auto& closedSet = stripe.recentlyClosedBuckets[bucket.key.hash];
+    auto [it, inserted] = closedSet.try_emplace(
+        bucket.minTime, RecentlyClosedBucket{bucket.bucketId, bucket.numMeasurements});
+    if (!inserted) {
+        // We had a meta hash collision, and already have an entry with the same meta hash and
+        // timestamp. Since it's somewhat arbitrary which bucket we keep, keep the existing one.
+        return;
+    }
+    stripe.recentlyClosedBucketsClosureOrder.emplace_back(bucket.key.hash, bucket.minTime);
+
+    // Entries consumed by 'findRecentlyClosedCandidate' leave stale elements behind in the closure
+    // order list, so an eviction may find nothing left to erase for its element.
+    while (stripe.recentlyClosedBucketsClosureOrder.size() > Stripe::kMaxRecentlyClosedBuckets) {
+        auto oldest = stripe.recentlyClosedBucketsClosureOrder.front();
+        stripe.recentlyClosedBucketsClosureOrder.pop_front();
+        if (auto setIt = stripe.recentlyClosedBuckets.find(oldest.first);
+            setIt != stripe.recentlyClosedBuckets.end()) {
+            setIt->second.erase(oldest.second);
+            if (setIt->second.empty()) {
+                stripe.recentlyClosedBuckets.erase(setIt);
+            }
+        }
+    }
+}
+
+boost::optional<OID> findRecentlyClosedCandidate(
+    BucketCatalog& catalog, Stripe& stripe, WithLock stripeLock, InsertContext& info, Date_t time) {
+    auto setIt = stripe.recentlyClosedBuckets.find(info.key.hash);
+    if (setIt == stripe.recentlyClosedBuckets.end()) {
+        return boost::none;
+    }
+
+    auto& closedSet = setIt->second;
+
+    // As with 'archivedBuckets', the inner map inverts the key comparison, so lower_bound returns
+    // the largest minimum timestamp that is not greater than 'time'.
+    auto it = closedSet.lower_bound(time);
+    if (it == closedSet.end()) {
+        return boost::none;
+    }
+
+    const auto& [candidateTime, candidate] = *it;
+    invariant(candidateTime <= time);
+    // We need to make sure our measurement can fit without violating max span or max count. If
+    // not, we can't use this bucket.
+    if (time - candidateTime >= Seconds(*info.options.getBucketMaxSpanSeconds()) ||
+        candidate.numMeasurements >= static_cast<uint32_t>(gTimeseriesBucketMaxCount)) {
+        return boost::none;
+    }
+
+    // A soft-closed bucket normally has no state in the registry; any state left behind represents
+    // an operation, such as an ongoing direct write, that conflicts with reopening.
+    auto bucketState = getBucketState(catalog.bucketStateRegistry, candidate.bucketId);
+    boost::optional<OID> oid;
+    if (!bucketState.has_value()) {
+        oid = candidate.bucketId.oid;
+    }
+
+    // Consume the entry: either we are about to reopen the bucket, or it conflicts with reopening
+    // and is no longer a useful candidate.
+    if (closedSet.size() == 1) {
+        stripe.recentlyClosedBuckets.erase(setIt);
+    } else {
+        closedSet.erase(it);
+    }
+
+    return oid;
+}
+
 std::pair<int32_t, int32_t> getCacheDerivedBucketMaxSize(uint64_t storageCacheSize,
                                                          uint32_t workloadCardinality) {
     if (workloadCardinality == 0) {
@@ -939,6 +1064,18 @@ InsertResult getReopeningContext(OperationContext* opCtx,
             catalog, stripe, stripeLock, info.key, catalogEra, archived.value()};
     }
 
+    if (auto recentlyClosed = findRecentlyClosedCandidate(catalog, stripe, stripeLock, info, time)) {
+        info.stats.incNumRecentlyClosedBucketCacheHits();
+        // Synchronize concurrent disk accesses, as above for the archived candidate.
+        if (auto waiter = checkForWait(stripe, stripeLock, info.key, recentlyClosed.value())) {
+            return waiter.value();
+        }
+
+        return ReopeningContext{
+            catalog, stripe, stripeLock, info.key, catalogEra, recentlyClosed.value()};
+    }
+    info.stats.incNumRecentlyClosedBucketCacheMisses();
+
     if (allowQueryBasedReopening == AllowQueryBasedReopening::kDisallow) {
         return ReopeningContext{catalog, stripe, stripeLock, info.key, catalogEra, {}};
     }
@@ -1220,6 +1357,9 @@ Bucket& rollover(OperationContext* opCtx,
         if (action == RolloverAction::kArchive) {
             archiveBucket(opCtx, catalog, stripe, stripeLock, bucket, info.closedBuckets);
         } else {
+            if (action == RolloverAction::kSoftClose) {
+                recordRecentlyClosedBucket(catalog, stripe, stripeLock, bucket);
+            }
             closeOpenBucket(opCtx, catalog, stripe, stripeLock, bucket, info.closedBuckets);
         }
     } else {
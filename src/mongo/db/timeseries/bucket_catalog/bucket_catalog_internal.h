@@ -254,6 +254,25 @@ void archiveBucket(OperationContext* opCtx,
 boost::optional<OID> findArchivedCandidate(
     BucketCatalog& catalog, Stripe& stripe, WithLock stripeLock, InsertContext& info, Date_t time);
 
+/**
+ * Records the given soft-closed bucket in the stripe's cache of recently-closed buckets, so that a
+ * late-arriving measurement for it can be routed to archive-style reopening instead of query-based
+ * reopening. Must be called before the bucket is removed from the catalog. Evicts the
+ * longest-closed entries once the stripe holds 'Stripe::kMaxRecentlyClosedBuckets' of them.
+ */
+void recordRecentlyClosedBucket(BucketCatalog& catalog,
+                                Stripe& stripe,
+                                WithLock stripeLock,
+                                const Bucket& bucket);
+
+/**
+ * Identifies a recently soft-closed bucket that may be able to accommodate the measurement
+ * represented by 'info', if one exists. A returned candidate is consumed, i.e. removed from the
+ * cache.
+ */
+boost::optional<OID> findRecentlyClosedCandidate(
+    BucketCatalog& catalog, Stripe& stripe, WithLock stripeLock, InsertContext& info, Date_t time);
+
 /**
  * Calculates the bucket max size constrained by the cache size and the cardinality of active
  * buckets. Returns a pair of the effective value that respects the absolute bucket max and min
@@ -574,6 +574,36 @@ TEST_F(BucketCatalogTest, InsertIntoSameBucketArray) {
               std::get<InsertContext>(insertContextAndTime2));
 }
 
+TEST_F(BucketCatalogTest, InsertIntoSameBucketRepeatedObjectMetadata) {
+    // Byte-identical object metadata hits the per-thread normalization memo; a reordered
+    // spelling misses it. All three must produce the same key.
+    auto insertContextAndTime1 = uassertStatusOK(
+        prepareInsert(*_bucketCatalog,
+                      _uuid1,
+                      _getCollator(_ns1),
+                      _getTimeseriesOptions(_ns1),
+                      BSON(_timeField << Date_t::now() << _metaField << BSON("a" << 0 << "b" << 1))));
+
+    auto insertContextAndTime2 = uassertStatusOK(
+        prepareInsert(*_bucketCatalog,
+                      _uuid1,
+                      _getCollator(_ns1),
+                      _getTimeseriesOptions(_ns1),
+                      BSON(_timeField << Date_t::now() << _metaField << BSON("a" << 0 << "b" << 1))));
+
+    auto insertContextAndTime3 = uassertStatusOK(
+        prepareInsert(*_bucketCatalog,
+                      _uuid1,
+                      _getCollator(_ns1),
+                      _getTimeseriesOptions(_ns1),
+                      BSON(_timeField << Date_t::now() << _metaField << BSON("b" << 1 << "a" << 0))));
+
+    ASSERT_EQ(std::get<InsertContext>(insertContextAndTime1),
+              std::get<InsertContext>(insertContextAndTime2));
+    ASSERT_EQ(std::get<InsertContext>(insertContextAndTime1),
+              std::get<InsertContext>(insertContextAndTime3));
+}
+
 TEST_F(BucketCatalogTest, InsertIntoSameBucketObjArray) {
     auto insertContextAndTime1 = uassertStatusOK(prepareInsert(
         *_bucketCatalog,
@@ -2166,6 +2196,41 @@ TEST_F(BucketCatalogTest,
     ASSERT_EQ(*oid2, id2.oid);
 }
 
+TEST_F(BucketCatalogTest, RecentlyClosedBucketYieldsArchiveStyleReopeningCandidate) {
+    // Simplify test by restricting to a single stripe.
+    FailPointEnableBlock failPoint("alwaysUseSameBucketCatalogStripe");
+
+    AutoGetCollection autoColl(_opCtx, _ns1.makeTimeseriesBucketsNamespace(), MODE_IX);
+
+    // Inject a recently-closed record. Unlike an archived bucket, it retains no registry state.
+    auto options = _getTimeseriesOptions(_ns1);
+    BSONObj doc = ::mongo::fromjson(R"({"time":{"$date":"2022-06-05T15:34:40.000Z"},"tag":"c"})");
+    BucketKey key{_uuid1,
+                  BucketMetadata{getTrackingContext(_bucketCatalog->trackingContexts,
+                                                    TrackingScope::kOpenBucketsByKey),
+                                 doc["tag"],
+                                 nullptr,
+                                 options.getMetaField()}};
+    auto minTime = roundTimestampToGranularity(doc["time"].Date(), options);
+    BucketId id{_uuid1, OID::gen(), 0};
+    _bucketCatalog->stripes[0]->recentlyClosedBuckets[key.hash].emplace(
+        minTime, RecentlyClosedBucket{id, 1});
+
+    // Should route to archive-style reopening of the recently-closed bucket instead of query-based
+    // reopening.
+    boost::optional<StatusWith<InsertResult>> result =
+        _tryInsertOneHelper(_opCtx, *_bucketCatalog, _ns1, _uuid1, doc);
+    ASSERT_OK(result->getStatus());
+    auto* context = get_if<ReopeningContext>(&result->getValue());
+    ASSERT(context);
+    auto* oid = get_if<OID>(&context->candidate);
+    ASSERT(oid);
+    ASSERT_EQ(*oid, id.oid);
+
+    // The candidate is consumed when it is handed out.
+    ASSERT(_bucketCatalog->stripes[0]->recentlyClosedBuckets.empty());
+}
+
 TEST_F(BucketCatalogTest, ArchivingAndClosingUnderSideBucketCatalogMemoryPressure) {
     // Initialize the side bucket catalog.
     auto sideBucketCatalog = std::make_unique<timeseries::bucket_catalog::BucketCatalog>(
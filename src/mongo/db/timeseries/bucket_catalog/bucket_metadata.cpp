@@ -29,6 +29,8 @@
 
 #include "mongo/db/timeseries/bucket_catalog/bucket_metadata.h"
 
+#include <cstring>
+
 #include <boost/move/utility_core.hpp>
 
 #include <boost/optional/optional.hpp>
@@ -61,6 +63,24 @@ BucketMetadata::BucketMetadata(TrackingContext& trackingContext,
       _metadataElement(toBSON().firstElement()),
       _comparator(comparator) {}
 
+BucketMetadata::BucketMetadata(TrackingContext& trackingContext,
+                               AlreadyNormalized,
+                               const BSONObj& normalizedMetadata,
+                               const StringDataComparator* comparator)
+    : _metadata([&] {
+          if (normalizedMetadata.isEmpty()) {
+              return allocator_aware::SharedBuffer<TrackingAllocator<void>>{
+                  trackingContext.makeAllocator<void>()};
+          }
+
+          auto buffer = allocator_aware::SharedBuffer<TrackingAllocator<void>>::allocate(
+              normalizedMetadata.objsize(), trackingContext.makeAllocator<void>());
+          memcpy(buffer.get(), normalizedMetadata.objdata(), normalizedMetadata.objsize());
+          return buffer;
+      }()),
+      _metadataElement(toBSON().firstElement()),
+      _comparator(comparator) {}
+
 bool BucketMetadata::operator==(const BucketMetadata& other) const {
     return _metadataElement.binaryEqualValues(other._metadataElement);
 }
@@ -45,11 +45,25 @@ namespace mongo::timeseries::bucket_catalog {
 
 struct BucketMetadata {
 public:
+    // Tag for the constructor overload below that skips normalization.
+    struct AlreadyNormalized {};
+
     BucketMetadata(TrackingContext&,
                    BSONElement elem,
                    const StringDataComparator* comparator,
                    boost::optional<StringData> trueMetaFieldName);
 
+    /**
+     * Constructs from 'normalizedMetadata', a single-field object of the form
+     * {<trueMetaFieldName>: <value>} whose value has already been normalized, copying its bytes
+     * without re-sorting. Callers are responsible for only passing output of a prior
+     * normalization.
+     */
+    BucketMetadata(TrackingContext&,
+                   AlreadyNormalized,
+                   const BSONObj& normalizedMetadata,
+                   const StringDataComparator* comparator);
+
     bool operator==(const BucketMetadata& other) const;
     bool operator!=(const BucketMetadata& other) const;
 
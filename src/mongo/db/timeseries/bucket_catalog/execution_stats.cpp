@@ -165,6 +165,16 @@ void ExecutionStatsController::incNumDuplicateBucketsReopened(long long incremen
     _globalStats->numDuplicateBucketsReopened.fetchAndAddRelaxed(increment);
 }
 
+void ExecutionStatsController::incNumRecentlyClosedBucketCacheHits(long long increment) {
+    _collectionStats->numRecentlyClosedBucketCacheHits.fetchAndAddRelaxed(increment);
+    _globalStats->numRecentlyClosedBucketCacheHits.fetchAndAddRelaxed(increment);
+}
+
+void ExecutionStatsController::incNumRecentlyClosedBucketCacheMisses(long long increment) {
+    _collectionStats->numRecentlyClosedBucketCacheMisses.fetchAndAddRelaxed(increment);
+    _globalStats->numRecentlyClosedBucketCacheMisses.fetchAndAddRelaxed(increment);
+}
+
 void ExecutionStatsController::incNumBytesUncompressed(long long increment) {
     _collectionStats->numBytesUncompressed.fetchAndAddRelaxed(increment);
     _globalStats->numBytesUncompressed.fetchAndAddRelaxed(increment);
@@ -240,6 +250,10 @@ void appendExecutionStatsToBuilder(const ExecutionStats& stats, BSONObjBuilder&
     builder.appendNumber("numBucketQueriesFailed", stats.numBucketQueriesFailed.load());
     builder.appendNumber("numBucketReopeningsFailed", stats.numBucketReopeningsFailed.load());
     builder.appendNumber("numDuplicateBucketsReopened", stats.numDuplicateBucketsReopened.load());
+    builder.appendNumber("numRecentlyClosedBucketCacheHits",
+                         stats.numRecentlyClosedBucketCacheHits.load());
+    builder.appendNumber("numRecentlyClosedBucketCacheMisses",
+                         stats.numRecentlyClosedBucketCacheMisses.load());
 
     if (feature_flags::gTimeseriesAlwaysUseCompressedBuckets.isEnabled(
             serverGlobalParams.featureCompatibility.acquireFCVSnapshot())) {
@@ -288,6 +302,9 @@ void addCollectionExecutionStats(ExecutionStatsController& stats, const Executio
     stats.incNumBucketQueriesFailed(collStats.numBucketQueriesFailed.load());
     stats.incNumBucketReopeningsFailed(collStats.numBucketReopeningsFailed.load());
     stats.incNumDuplicateBucketsReopened(collStats.numDuplicateBucketsReopened.load());
+    stats.incNumRecentlyClosedBucketCacheHits(collStats.numRecentlyClosedBucketCacheHits.load());
+    stats.incNumRecentlyClosedBucketCacheMisses(
+        collStats.numRecentlyClosedBucketCacheMisses.load());
 
     // TODO(SERVER-70605): Remove these.
     stats.incNumBytesUncompressed(collStats.numBytesUncompressed.load());
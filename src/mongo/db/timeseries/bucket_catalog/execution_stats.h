@@ -64,6 +64,8 @@ struct ExecutionStats {
     AtomicWord<long long> numBucketQueriesFailed;
     AtomicWord<long long> numBucketReopeningsFailed;
     AtomicWord<long long> numDuplicateBucketsReopened;
+    AtomicWord<long long> numRecentlyClosedBucketCacheHits;
+    AtomicWord<long long> numRecentlyClosedBucketCacheMisses;
 
     // TODO SERVER-70605: Remove the metrics below.
     AtomicWord<long long> numBytesUncompressed;
@@ -108,6 +110,8 @@ public:
     void incNumBucketQueriesFailed(long long increment = 1);
     void incNumBucketReopeningsFailed(long long increment = 1);
     void incNumDuplicateBucketsReopened(long long increment = 1);
+    void incNumRecentlyClosedBucketCacheHits(long long increment = 1);
+    void incNumRecentlyClosedBucketCacheMisses(long long increment = 1);
     void incNumBytesUncompressed(long long increment = 1);
     void incNumBytesCompressed(long long increment = 1);
     void incNumSubObjCompressionRestart(long long increment = 1);
@@ -32,6 +32,7 @@
 #include "mongo/logv2/log.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/base64.h"
+#include "mongo/util/string_map.h"
 #include "mongo/util/testing_proctor.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kDefault
@@ -147,6 +148,63 @@ void MeasurementMap::insertOne(const std::vector<BSONElement>& oneMeasurementDat
     _fillSkipsInMissingFields(fieldsSeen);
 }
 
+void MeasurementMap::insertMany(
+    size_t count, const std::function<const std::vector<BSONElement>&(size_t)>& dataFieldsAt) {
+    if (count == 0) {
+        return;
+    }
+
+    // Group the batch by field. Each column holds one element per measurement; a default
+    // (eoo) element marks a measurement in which the field was missing and becomes a skip.
+    StringDataMap<std::vector<BSONElement>> columns;
+    for (size_t i = 0; i < count; ++i) {
+        for (const auto& elem : dataFieldsAt(i)) {
+            auto [columnIt, inserted] = columns.try_emplace(elem.fieldNameStringData());
+            if (inserted) {
+                columnIt->second.resize(count);
+            }
+            columnIt->second[i] = elem;
+        }
+    }
+
+    for (auto& [key, values] : columns) {
+        auto builderIt = _builders.find(key);
+        if (builderIt == _builders.end()) {
+            BSONColumnBuilder<TrackingAllocator<void>> columnBuilder{
+                _trackingContext.get().makeAllocator<void>()};
+            for (size_t i = 0; i < _measurementCount; ++i) {
+                columnBuilder.skip();
+            }
+            builderIt = _builders
+                            .try_emplace(make_tracked_string(_trackingContext, key.data(), key.size()),
+                                         std::move(columnBuilder))
+                            .first;
+        }
+
+        auto& builder = builderIt->second;
+        for (const auto& elem : values) {
+            if (elem.eoo()) {
+                builder.skip();
+            } else {
+                builder.append(elem);
+            }
+        }
+    }
+
+    // Fields that existed in prior measurements but are absent from the entire batch get one
+    // skip per new measurement.
+    for (auto& entry : _builders) {
+        if (columns.contains(StringData(entry.first.c_str(), entry.first.size()))) {
+            continue;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            entry.second.skip();
+        }
+    }
+
+    _measurementCount += count;
+}
+
 Timestamp MeasurementMap::timeOfLastMeasurement(StringData key) const {
     auto it = _builders.find(key);
     invariant(it != _builders.end());
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <functional>
 #include <utility>
 #include <vector>
 
@@ -59,6 +60,17 @@ public:
      */
     void insertOne(const std::vector<BSONElement>& oneMeasurementDataFields);
 
+    /**
+     * Inserts a batch of measurements column by column: the batch is first grouped by data field,
+     * then each builder receives its whole run of values (and skips) in one go. The resulting
+     * builder state is identical to calling insertOne() for each measurement in order, but each
+     * field is looked up once per batch instead of once per measurement, and the column builders
+     * see contiguous runs, which favors their delta/RLE encodings. 'dataFieldsAt' maps an index
+     * in [0, count) to that measurement's data fields, under the same contract as insertOne().
+     */
+    void insertMany(size_t count,
+                    const std::function<const std::vector<BSONElement>&(size_t)>& dataFieldsAt);
+
     /**
      * Sets internal state of builders to that of pre-existing compressed builders.
      * numMeasurements should be equal to the number of measurements in every data field in the
@@ -28,6 +28,7 @@
  */
 
 
+#include <algorithm>
 #include <boost/optional/optional.hpp>
 #include <string>
 #include <utility>
@@ -182,6 +183,83 @@ TEST_F(MeasurementMapTest, FillSkipsRemoveField) {
     invariant(measurementMap.numFields() == 3);
 }
 
+TEST_F(MeasurementMapTest, InsertManyMatchesInsertOne) {
+    // A batch with a field appearing mid-batch ("c") and a field disappearing mid-batch ("b"),
+    // inserted via insertMany, must leave the builders in the same state as inserting each
+    // measurement with insertOne.
+    const std::vector<BSONObj> docs = {
+        fromjson(
+            R"({"time":{"0":{"$date":"2022-06-06T15:34:30.000Z"}},
+                    "a":{"0":1},
+                    "b":{"0":1}})"),
+        fromjson(
+            R"({"time":{"0":{"$date":"2022-06-06T15:34:31.000Z"}},
+                    "a":{"0":2},
+                    "b":{"0":2}})"),
+        fromjson(
+            R"({"time":{"0":{"$date":"2022-06-06T15:34:32.000Z"}},
+                    "a":{"0":3},
+                    "c":{"0":3}})"),
+    };
+
+    std::vector<std::vector<BSONElement>> dataFields;
+    for (const auto& doc : docs) {
+        dataFields.push_back(genMeasurementFieldsFromObj(doc));
+    }
+
+    TrackingContext referenceTrackingContext;
+    MeasurementMap referenceMap{referenceTrackingContext};
+    for (const auto& fields : dataFields) {
+        referenceMap.insertOne(fields);
+    }
+
+    measurementMap.insertMany(
+        dataFields.size(),
+        [&](size_t i) -> const std::vector<BSONElement>& { return dataFields[i]; });
+
+    ASSERT_EQ(measurementMap.numFields(), referenceMap.numFields());
+    ASSERT_EQ(measurementMap.timeOfLastMeasurement("time"),
+              referenceMap.timeOfLastMeasurement("time"));
+
+    int32_t sizeDelta;
+    int32_t referenceSizeDelta;
+    auto intermediates = measurementMap.intermediate(sizeDelta);
+    auto referenceIntermediates = referenceMap.intermediate(referenceSizeDelta);
+    ASSERT_EQ(sizeDelta, referenceSizeDelta);
+    ASSERT_EQ(intermediates.size(), referenceIntermediates.size());
+    for (auto& [key, diff] : intermediates) {
+        auto referenceIt =
+            std::find_if(referenceIntermediates.begin(),
+                         referenceIntermediates.end(),
+                         [key = key](const auto& entry) { return entry.first == key; });
+        ASSERT(referenceIt != referenceIntermediates.end()) << key;
+        ASSERT_EQ(diff.size(), referenceIt->second.size()) << key;
+        ASSERT_EQ(StringData(diff.data(), diff.size()),
+                  StringData(referenceIt->second.data(), referenceIt->second.size()))
+            << key;
+    }
+}
+
+TEST_F(MeasurementMapTest, InsertManyAfterInsertOneFillsSkips) {
+    // insertMany on a map with existing measurements must prepend skips for new fields and
+    // fill skips for existing fields absent from the whole batch.
+    measurementMap.insertOne(genMeasurementFieldsFromObj(fromjson(
+        R"({"time":{"0":{"$date":"2022-06-06T15:34:30.000Z"}},
+                    "a":{"0":1},
+                    "b":{"0":1}})")));
+
+    std::vector<std::vector<BSONElement>> dataFields;
+    dataFields.push_back(genMeasurementFieldsFromObj(fromjson(
+        R"({"time":{"0":{"$date":"2022-06-06T15:34:31.000Z"}},
+                    "a":{"0":2},
+                    "c":{"0":2}})")));
+    measurementMap.insertMany(
+        dataFields.size(),
+        [&](size_t i) -> const std::vector<BSONElement>& { return dataFields[i]; });
+
+    ASSERT_EQ(measurementMap.numFields(), 4);
+}
+
 TEST_F(MeasurementMapTest, InitBuilders) {
     BSONObj bucketDataDoc;
     BSONObjBuilder bucket;
@@ -155,6 +155,9 @@ void ReopeningContext::clear(WithLock) {
 ArchivedBucket::ArchivedBucket(const BucketId& b, const tracked_string& t)
     : bucketId{b}, timeField{t} {}
 
+RecentlyClosedBucket::RecentlyClosedBucket(const BucketId& b, uint32_t n)
+    : bucketId{b}, numMeasurements{n} {}
+
 
 ReopeningRequest::ReopeningRequest(ExecutionStatsController&& s, boost::optional<OID> o)
     : stats{std::move(s)}, oid{o} {}
@@ -81,6 +81,19 @@ struct ArchivedBucket {
     tracked_string timeField;
 };
 
+/**
+ * Information about a bucket that was recently soft-closed but remains eligible to receive more
+ * measurements. Retained so that a late-arriving measurement can reopen the bucket with a fetch by
+ * '_id' instead of a query against the buckets collection.
+ */
+struct RecentlyClosedBucket {
+    RecentlyClosedBucket() = delete;
+    RecentlyClosedBucket(const BucketId& bucketId, uint32_t numMeasurements);
+
+    BucketId bucketId;
+    uint32_t numMeasurements;
+};
+
 
 /**
  * A light wrapper around a promise type to allow potentially conflicting operations to ensure
@@ -44,6 +44,7 @@ enum class TrackingScope {
     kMiscellaneous,
     kOpenBucketsById,
     kOpenBucketsByKey,
+    kRecentlyClosedBuckets,
     kReopeningRequests,
     kStats,
     kSummaries,
@@ -65,6 +66,7 @@ struct TrackingContexts {
     TrackingContext miscellaneous;
     TrackingContext openBucketsById;
     TrackingContext openBucketsByKey;
+    TrackingContext recentlyClosedBuckets;
     TrackingContext reopeningRequests;
     TrackingContext stats;
     TrackingContext summaries;
@@ -93,6 +95,8 @@ constexpr TrackingContext& getTrackingContext(TrackingContexts& contexts, Tracki
             return contexts.openBucketsById;
         case TrackingScope::kOpenBucketsByKey:
             return contexts.openBucketsByKey;
+        case TrackingScope::kRecentlyClosedBuckets:
+            return contexts.recentlyClosedBuckets;
         case TrackingScope::kReopeningRequests:
             return contexts.reopeningRequests;
         case TrackingScope::kStats:
@@ -0,0 +1,173 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/timeseries/bucket_compression_pipeline.h"
+
+#include <utility>
+
+#include "mongo/db/client.h"
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/timeseries/timeseries_gen.h"
+#include "mongo/logv2/log.h"
+#include "mongo/util/decorable.h"
+#include "mongo/util/scopeguard.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
+
+namespace mongo {
+namespace timeseries {
+namespace {
+
+const auto getBucketCompressionPipeline =
+    ServiceContext::declareDecoration<BucketCompressionPipeline>();
+
+constexpr size_t kNumWorkers = 2;
+
+class BucketCompressionServerStatusSection : public ServerStatusSection {
+public:
+    using ServerStatusSection::ServerStatusSection;
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        BSONObjBuilder builder;
+        BucketCompressionPipeline::get(opCtx->getServiceContext()).appendStats(builder);
+        return builder.obj();
+    }
+};
+
+auto& bucketCompressionServerStatusSection =
+    *ServerStatusSectionBuilder<BucketCompressionServerStatusSection>(
+         "timeseriesBucketCompression")
+         .forShard();
+
+}  // namespace
+
+BucketCompressionPipeline& BucketCompressionPipeline::get(ServiceContext* svcCtx) {
+    return getBucketCompressionPipeline(svcCtx);
+}
+
+BucketCompressionPipeline::~BucketCompressionPipeline() {
+    shutdown();
+}
+
+bool BucketCompressionPipeline::wouldAccept(long long approxBytes) const {
+    auto maxBacklogBytes = gTimeseriesBucketCompressionBacklogMaxBytes.load();
+    if (maxBacklogBytes <= 0 || _backlogBytes.loadRelaxed() + approxBytes > maxBacklogBytes) {
+        _totalRefused.fetchAndAddRelaxed(1);
+        return false;
+    }
+    stdx::lock_guard lk(_mutex);
+    return !_shutdown;
+}
+
+bool BucketCompressionPipeline::trySubmit(Task task, long long approxBytes) {
+    auto maxBacklogBytes = gTimeseriesBucketCompressionBacklogMaxBytes.load();
+    if (maxBacklogBytes <= 0 || _backlogBytes.loadRelaxed() + approxBytes > maxBacklogBytes) {
+        _totalRefused.fetchAndAddRelaxed(1);
+        return false;
+    }
+
+    stdx::lock_guard lk(_mutex);
+    if (_shutdown) {
+        _totalRefused.fetchAndAddRelaxed(1);
+        return false;
+    }
+    _ensureStarted(lk);
+
+    _backlogBytes.fetchAndAdd(approxBytes);
+    _totalQueued.fetchAndAddRelaxed(1);
+    _pool->schedule([this, task = std::move(task), approxBytes](Status status) mutable {
+        ON_BLOCK_EXIT([&] { _backlogBytes.fetchAndSubtract(approxBytes); });
+        if (!status.isOK()) {
+            // The pool is shutting down; drop the task. The bucket stays uncompressed, which is
+            // an already-tolerated outcome.
+            _totalFailed.fetchAndAddRelaxed(1);
+            return;
+        }
+        try {
+            auto opCtx = cc().makeOperationContext();
+            task(opCtx.get());
+        } catch (const DBException& ex) {
+            // Best effort: losing a rewrite (e.g. to stepdown) leaves the bucket uncompressed.
+            _totalFailed.fetchAndAddRelaxed(1);
+            LOGV2_DEBUG(9931400,
+                        1,
+                        "Background time-series bucket compression failed",
+                        "error"_attr = redact(ex));
+        }
+    });
+    return true;
+}
+
+void BucketCompressionPipeline::shutdown() {
+    std::unique_ptr<ThreadPool> pool;
+    {
+        stdx::lock_guard lk(_mutex);
+        _shutdown = true;
+        pool = std::move(_pool);
+    }
+    if (pool) {
+        pool->shutdown();
+        pool->join();
+    }
+}
+
+void BucketCompressionPipeline::appendStats(BSONObjBuilder& builder) const {
+    builder.appendNumber("backlogBytes", _backlogBytes.loadRelaxed());
+    builder.appendNumber("queued", _totalQueued.loadRelaxed());
+    builder.appendNumber("refused", _totalRefused.loadRelaxed());
+    builder.appendNumber("failed", _totalFailed.loadRelaxed());
+}
+
+void BucketCompressionPipeline::_ensureStarted(WithLock) {
+    if (_pool) {
+        return;
+    }
+
+    ThreadPool::Options options;
+    options.poolName = "BucketCompressionPipeline";
+    options.threadNamePrefix = "TimeseriesCompression-";
+    options.minThreads = 0;
+    options.maxThreads = kNumWorkers;
+    options.onCreateThread = [svcCtx = getBucketCompressionPipeline.owner(this)](
+                                 const std::string& threadName) {
+        Client::initThread(threadName.c_str(), svcCtx->getService());
+    };
+    _pool = std::make_unique<ThreadPool>(std::move(options));
+    _pool->startup();
+}
+
+}  // namespace timeseries
+}  // namespace mongo
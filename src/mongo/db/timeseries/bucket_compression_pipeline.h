@@ -0,0 +1,110 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/concurrency/thread_pool.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/functional.h"
+
+namespace mongo {
+
+class OperationContext;
+class ServiceContext;
+
+namespace timeseries {
+
+/**
+ * Runs opportunistic bucket compression rewrites on a small dedicated worker pool so that the
+ * inserting thread which happened to roll a bucket over does not pay the multi-millisecond
+ * compress-and-update inline. Compression of closed buckets is best-effort by design -- a bucket
+ * that is not rewritten stays uncompressed and remains fully usable -- so tasks that fail (e.g.
+ * due to stepdown or shutdown) are simply dropped.
+ *
+ * Back-pressure: each queued task accounts an estimated byte size against a backlog budget
+ * ('timeseriesBucketCompressionBacklogMaxBytes'). When the budget is exceeded, trySubmit()
+ * refuses the task and the caller compresses inline, so a sustained ingest burst degrades to
+ * today's behavior rather than growing the queue without bound.
+ */
+class BucketCompressionPipeline {
+public:
+    using Task = unique_function<void(OperationContext*)>;
+
+    static BucketCompressionPipeline& get(ServiceContext* svcCtx);
+
+    ~BucketCompressionPipeline();
+
+    /**
+     * Returns whether a task of 'approxBytes' would currently be admitted. Lets callers whose
+     * task construction consumes move-only state check admission first; a subsequent
+     * trySubmit() may still refuse on a shutdown race.
+     */
+    bool wouldAccept(long long approxBytes) const;
+
+    /**
+     * Queues 'task' to run on a worker thread with a worker-owned operation context. Returns
+     * false, without consuming the task's work, when the pipeline is shut down or the backlog
+     * budget is exceeded; the caller should then perform the work inline. 'approxBytes' is the
+     * caller's estimate of the bucket size, used only for backlog accounting.
+     */
+    bool trySubmit(Task task, long long approxBytes);
+
+    /**
+     * Stops accepting work and joins the workers. Queued tasks are drained first. Called from
+     * the destructor if not called explicitly.
+     */
+    void shutdown();
+
+    /**
+     * Appends backlog and throughput counters, for serverStatus.
+     */
+    void appendStats(BSONObjBuilder& builder) const;
+
+private:
+    void _ensureStarted(WithLock);
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("BucketCompressionPipeline::_mutex");
+    std::unique_ptr<ThreadPool> _pool;
+    bool _shutdown = false;
+
+    // Estimated bytes of queued, not-yet-completed compression work.
+    AtomicWord<long long> _backlogBytes;
+
+    AtomicWord<long long> _totalQueued;
+    mutable AtomicWord<long long> _totalRefused;
+    AtomicWord<long long> _totalFailed;
+};
+
+}  // namespace timeseries
+}  // namespace mongo
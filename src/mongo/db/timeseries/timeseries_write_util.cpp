@@ -1004,10 +1004,12 @@ write_ops::InsertCommandRequest makeTimeseriesInsertOp(
         std::vector<details::Measurement> sortedMeasurements =
             details::sortMeasurementsOnTimeField(batch);
 
-        // Insert measurements, and appropriate skips, into all column builders.
-        for (const auto& measurement : sortedMeasurements) {
-            batch->measurementMap.insertOne(measurement.dataFields);
-        }
+        // Insert measurements, and appropriate skips, into all column builders, column by
+        // column so each builder sees its whole run of values at once.
+        batch->measurementMap.insertMany(
+            sortedMeasurements.size(), [&](size_t i) -> const std::vector<BSONElement>& {
+                return sortedMeasurements[i].dataFields;
+            });
         int32_t compressedSizeDelta;
         auto intermediates = batch->measurementMap.intermediate(compressedSizeDelta);
         batch->sizes.uncommittedVerifiedSize = compressedSizeDelta;
@@ -1069,10 +1071,12 @@ write_ops::UpdateCommandRequest makeTimeseriesCompressedDiffUpdateOp(
         batch->stats.incNumCompressedBucketsConvertedToUnsorted();
     }
 
-    // Insert new measurements, and appropriate skips, into all column builders.
-    for (const auto& measurement : sortedMeasurements) {
-        batch->measurementMap.insertOne(measurement.dataFields);
-    }
+    // Insert new measurements, and appropriate skips, into all column builders, column by
+    // column so each builder sees its whole run of values at once.
+    batch->measurementMap.insertMany(sortedMeasurements.size(),
+                                     [&](size_t i) -> const std::vector<BSONElement>& {
+                                         return sortedMeasurements[i].dataFields;
+                                     });
 
     // Generates a delta update request using the before and after compressed bucket documents' data
     // fields. The only other items that will be different are the min, max, and count fields in the
@@ -38,8 +38,10 @@
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
 #include <boost/smart_ptr.hpp>
+#include <algorithm>
 #include <cstdint>
 #include <limits>
+#include <map>
 #include <mutex>
 #include <tuple>
 #include <utility>
@@ -221,6 +223,83 @@ void updateCollSubpassHistory(stdx::unordered_map<UUID, long long, UUID::Hash>&
     }
 }
 
+// Returns the key under which the expiry estimate for 'info' is tracked. Clustered collections
+// have a single TTL "index" which is tracked under an empty name.
+std::string ttlExpiryEstimateKey(const TTLCollectionCache::Info& info) {
+    return info.isClustered() ? std::string{} : info.getIndexName();
+}
+
+// Orders the sub-pass work so that the databases with the largest predicted expirable volume are
+// visited first, and so that collections sharing a database are visited back to back to amortize
+// catalog lookups and ticket acquisitions across them. The prediction for an index is the
+// exponentially-weighted moving average of the documents it yielded on previous visits; indexes
+// without history are assumed to yield a full index pass so that they are not starved.
+std::vector<std::pair<UUID, std::vector<TTLCollectionCache::Info>>> scheduleSubPassWork(
+    OperationContext* opCtx,
+    const TTLCollectionCache::InfoMap& work,
+    const stdx::unordered_map<UUID, StringMap<double>, UUID::Hash>& expiryEstimates) {
+    struct ScheduledEntry {
+        UUID uuid;
+        std::vector<TTLCollectionCache::Info> infos;
+        DatabaseName dbName;
+        double predicted;
+    };
+
+    const double defaultPrediction = std::max(1, ttlIndexDeleteTargetDocs.load());
+    auto collectionCatalog = CollectionCatalog::get(opCtx);
+
+    std::vector<ScheduledEntry> entries;
+    entries.reserve(work.size());
+    std::map<DatabaseName, double> dbTotals;
+    for (const auto& [uuid, infos] : work) {
+        const StringMap<double>* indexEstimates = nullptr;
+        if (auto it = expiryEstimates.find(uuid); it != expiryEstimates.end()) {
+            indexEstimates = &it->second;
+        }
+
+        double predicted = 0;
+        for (const auto& info : infos) {
+            if (indexEstimates) {
+                if (auto it = indexEstimates->find(ttlExpiryEstimateKey(info));
+                    it != indexEstimates->end()) {
+                    predicted += it->second;
+                    continue;
+                }
+            }
+            predicted += defaultPrediction;
+        }
+
+        // A dropped collection sorts into the (empty) default database name; its work items clean
+        // themselves up when visited.
+        auto nss = collectionCatalog->lookupNSSByUUID(opCtx, uuid);
+        DatabaseName dbName = nss ? nss->dbName() : DatabaseName{};
+        dbTotals[dbName] += predicted;
+        entries.push_back({uuid, infos, std::move(dbName), predicted});
+    }
+
+    std::sort(entries.begin(), entries.end(), [&](const auto& lhs, const auto& rhs) {
+        auto lhsDbTotal = dbTotals.at(lhs.dbName);
+        auto rhsDbTotal = dbTotals.at(rhs.dbName);
+        if (lhsDbTotal != rhsDbTotal) {
+            return lhsDbTotal > rhsDbTotal;
+        }
+        if (lhs.dbName != rhs.dbName) {
+            return lhs.dbName < rhs.dbName;
+        }
+        if (lhs.predicted != rhs.predicted) {
+            return lhs.predicted > rhs.predicted;
+        }
+        return lhs.uuid < rhs.uuid;
+    });
+
+    std::vector<std::pair<UUID, std::vector<TTLCollectionCache::Info>>> scheduled;
+    scheduled.reserve(entries.size());
+    for (auto& entry : entries) {
+        scheduled.emplace_back(entry.uuid, std::move(entry.infos));
+    }
+    return scheduled;
+}
+
 // Generates an expiration date based on the user-configured expireAfterSeconds. Includes special
 // 'safe' handling for time-series collections.
 Date_t safeExpirationDate(OperationContext* opCtx,
@@ -539,10 +618,14 @@ bool TTLMonitor::_doTTLSubPass(
     //
     // When batching is disabled, _doTTLIndexDelete will delete as many documents as
     // possible without limit.
+    // Drop expiry estimates for collections that no longer have TTL indexes.
+    stdx::erase_if(_expiryEstimates,
+                   [&](auto&& entry) { return work.find(entry.first) == work.end(); });
+
     Timer timer;
     do {
         TTLCollectionCache::InfoMap moreWork;
-        for (const auto& [uuid, infos] : work) {
+        for (const auto& [uuid, infos] : scheduleSubPassWork(opCtx, work, _expiryEstimates)) {
             // If there are multiple TTL indexes on a TTL collection, and any of those have fallen
             // behind TTL inserts over consecutive subpasses, raising the priority to
             // 'AdmissionContext::Priority::kNormal' for one index means the priority will be
@@ -551,7 +634,10 @@ bool TTLMonitor::_doTTLSubPass(
             ScopedAdmissionPriority<ExecutionAdmissionContext> priorityGuard(opCtx, priority);
 
             for (const auto& info : infos) {
-                bool moreToDelete = _doTTLIndexDelete(opCtx, &ttlCollectionCache, uuid, info);
+                long long docsDeleted = 0;
+                bool moreToDelete =
+                    _doTTLIndexDelete(opCtx, &ttlCollectionCache, uuid, info, &docsDeleted);
+                _recordExpiryEstimate(uuid, info, docsDeleted);
                 if (moreToDelete) {
                     moreWork[uuid].push_back(info);
                 }
@@ -568,10 +654,27 @@ bool TTLMonitor::_doTTLSubPass(
     return !work.empty();
 }
 
+void TTLMonitor::_recordExpiryEstimate(const UUID& uuid,
+                                       const TTLCollectionCache::Info& info,
+                                       long long docsDeleted) {
+    // Chosen so that the estimate adapts within a few passes when a collection's expiry rate
+    // changes, without a single outlier pass dominating the schedule.
+    constexpr double kEwmaWeight = 0.3;
+
+    auto& indexEstimates = _expiryEstimates[uuid];
+    auto [it, inserted] =
+        indexEstimates.try_emplace(ttlExpiryEstimateKey(info), static_cast<double>(docsDeleted));
+    if (!inserted) {
+        it->second = kEwmaWeight * static_cast<double>(docsDeleted) +
+            (1.0 - kEwmaWeight) * it->second;
+    }
+}
+
 bool TTLMonitor::_doTTLIndexDelete(OperationContext* opCtx,
                                    TTLCollectionCache* ttlCollectionCache,
                                    const UUID& uuid,
-                                   const TTLCollectionCache::Info& info) {
+                                   const TTLCollectionCache::Info& info,
+                                   long long* docsDeleted) {
     auto collectionCatalog = CollectionCatalog::get(opCtx);
 
     // The collection was dropped.
@@ -652,9 +755,10 @@ bool TTLMonitor::_doTTLIndexDelete(OperationContext* opCtx,
         ResourceConsumption::ScopedMetricsCollector scopedMetrics(opCtx, nss->dbName());
 
         if (info.isClustered()) {
-            return _deleteExpiredWithCollscan(opCtx, ttlCollectionCache, coll);
+            return _deleteExpiredWithCollscan(opCtx, ttlCollectionCache, coll, docsDeleted);
         } else {
-            return _deleteExpiredWithIndex(opCtx, ttlCollectionCache, coll, info.getIndexName());
+            return _deleteExpiredWithIndex(
+                opCtx, ttlCollectionCache, coll, info.getIndexName(), docsDeleted);
         }
     } catch (const ExceptionForCat<ErrorCategory::StaleShardVersionError>& ex) {
         // The TTL index tried to delete some information from a sharded collection
@@ -718,7 +822,8 @@ bool TTLMonitor::_doTTLIndexDelete(OperationContext* opCtx,
 bool TTLMonitor::_deleteExpiredWithIndex(OperationContext* opCtx,
                                          TTLCollectionCache* ttlCollectionCache,
                                          const CollectionAcquisition& collection,
-                                         std::string indexName) {
+                                         std::string indexName,
+                                         long long* docsDeleted) {
     const auto& collectionPtr = collection.getCollectionPtr();
     if (!collectionPtr->isIndexPresent(indexName)) {
         ttlCollectionCache->deregisterTTLIndexByName(collection.uuid(), indexName);
@@ -788,6 +893,7 @@ bool TTLMonitor::_deleteExpiredWithIndex(OperationContext* opCtx,
     try {
         const auto numDeleted = exec->executeDelete();
         ttlDeletedDocuments.increment(numDeleted);
+        *docsDeleted = numDeleted;
 
         const auto duration = Milliseconds(timer.millis());
         if (shouldLogSlowOpWithSampling(opCtx,
@@ -817,7 +923,8 @@ bool TTLMonitor::_deleteExpiredWithIndex(OperationContext* opCtx,
 
 bool TTLMonitor::_deleteExpiredWithCollscan(OperationContext* opCtx,
                                             TTLCollectionCache* ttlCollectionCache,
-                                            const CollectionAcquisition& collection) {
+                                            const CollectionAcquisition& collection,
+                                            long long* docsDeleted) {
     const auto& collectionPtr = collection.getCollectionPtr();
     const auto& collOptions = collectionPtr->getCollectionOptions();
     uassert(5400701,
@@ -863,6 +970,7 @@ bool TTLMonitor::_deleteExpiredWithCollscan(OperationContext* opCtx,
     try {
         const auto numDeleted = exec->executeDelete();
         ttlDeletedDocuments.increment(numDeleted);
+        *docsDeleted = numDeleted;
 
         const auto duration = Milliseconds(timer.millis());
         if (shouldLogSlowOpWithSampling(opCtx,
@@ -42,6 +42,7 @@
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/util/background.h"
 #include "mongo/util/duration.h"
+#include "mongo/util/string_map.h"
 #include "mongo/util/uuid.h"
 
 namespace mongo {
@@ -135,7 +136,8 @@ private:
     bool _doTTLIndexDelete(OperationContext* opCtx,
                            TTLCollectionCache* ttlCollectionCache,
                            const UUID& uuid,
-                           const TTLCollectionCache::Info& info);
+                           const TTLCollectionCache::Info& info,
+                           long long* docsDeleted);
 
     /**
      * Removes documents from the collection using the specified TTL index after a sufficient
@@ -150,7 +152,8 @@ private:
     bool _deleteExpiredWithIndex(OperationContext* opCtx,
                                  TTLCollectionCache* ttlCollectionCache,
                                  const CollectionAcquisition& collection,
-                                 std::string indexName);
+                                 std::string indexName,
+                                 long long* docsDeleted);
 
     /*
      * Removes expired documents from a clustered collection using a bounded collection scan.
@@ -165,7 +168,16 @@ private:
      */
     bool _deleteExpiredWithCollscan(OperationContext* opCtx,
                                     TTLCollectionCache* ttlCollectionCache,
-                                    const CollectionAcquisition& collection);
+                                    const CollectionAcquisition& collection,
+                                    long long* docsDeleted);
+
+    /**
+     * Folds the number of documents removed from a TTL index during the latest visit into the
+     * per-index exponentially-weighted moving average used to schedule future sub-pass work.
+     */
+    void _recordExpiryEstimate(const UUID& uuid,
+                               const TTLCollectionCache::Info& info,
+                               long long docsDeleted);
 
     // Protects the state below.
     mutable Mutex _stateMutex = MONGO_MAKE_LATCH("TTLMonitorStateMutex");
@@ -179,6 +191,13 @@ private:
 
     bool _shuttingDown = false;
     Seconds _ttlMonitorSleepSecs;
+
+    // Exponentially-weighted moving average of documents deleted per TTL index, keyed by
+    // collection UUID and index name (clustered collections use an empty index name). Used to
+    // visit the databases and collections with the largest predicted expirable volume first within
+    // a sub-pass; indexes without history are scheduled ahead of ones with a known small yield.
+    // Only accessed from the monitor thread, so it requires no synchronization.
+    stdx::unordered_map<UUID, StringMap<double>, UUID::Hash> _expiryEstimates;
 };
 
 }  // namespace mongo
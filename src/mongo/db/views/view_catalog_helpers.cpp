@@ -165,7 +165,10 @@ StatusWith<ResolvedView> resolveView(OperationContext* opCtx,
     // Points to the name of the most resolved namespace.
     const NamespaceString* resolvedNss = &nss;
 
-    // Holds the combination of all the resolved views.
+    // Holds the combination of all the resolved views. Each view's pipeline must be prepended to
+    // the stages resolved so far. To avoid re-copying the accumulated pipeline at every level of
+    // the view chain, stages are appended in reverse and the vector is reversed once before
+    // returning.
     std::vector<BSONObj> resolvedPipeline;
 
     // If the catalog has not been tampered with, all views seen during the resolution will have
@@ -198,6 +201,8 @@ StatusWith<ResolvedView> resolveView(OperationContext* opCtx,
                                       << ViewGraph::kMaxViewPipelineSizeBytes};
             }
 
+            std::reverse(resolvedPipeline.begin(), resolvedPipeline.end());
+
             auto curOp = CurOp::get(opCtx);
             curOp->debug().addResolvedViews(dependencyChain, resolvedPipeline);
 
@@ -241,12 +246,16 @@ StatusWith<ResolvedView> resolveView(OperationContext* opCtx,
             }
         }
 
-        // Prepend the underlying view's pipeline to the current working pipeline.
+        // Prepend the underlying view's pipeline to the current working pipeline. Per the note
+        // above, the stages are appended in reverse so that reversing the vector at the end yields
+        // the prepended order.
         const std::vector<BSONObj>& toPrepend = view->pipeline();
-        resolvedPipeline.insert(resolvedPipeline.begin(), toPrepend.begin(), toPrepend.end());
+        resolvedPipeline.insert(resolvedPipeline.end(), toPrepend.rbegin(), toPrepend.rend());
 
         // If the first stage is a $collStats, then we return early with the viewOn namespace.
         if (toPrepend.size() > 0 && !toPrepend[0]["$collStats"].eoo()) {
+            std::reverse(resolvedPipeline.begin(), resolvedPipeline.end());
+
             auto curOp = CurOp::get(opCtx);
             curOp->debug().addResolvedViews(dependencyChain, resolvedPipeline);
 
@@ -102,8 +102,13 @@ void RamLog::trimIfNeeded(size_t newStr) {
         trimmedSpace += size;
         _totalSizeBytes -= size;
 
+        // Keep the trimmed line's allocation so the slot can be rewritten without a free/malloc
+        // pair per logged line at steady state. Only outsized allocations are returned, so a
+        // single huge line cannot pin memory in its slot indefinitely.
         _lines[_firstLinePosition].clear();
-        _lines[_firstLinePosition].shrink_to_fit();
+        if (_lines[_firstLinePosition].capacity() > kMaxRetainedLineSizeBytes) {
+            _lines[_firstLinePosition].shrink_to_fit();
+        }
 
         _firstLinePosition = (_firstLinePosition + 1) % kMaxLines;
     }
@@ -118,6 +118,10 @@ private:
     // Maximum capacity of RamLog of string data
     static constexpr size_t kMaxSizeBytes = 1024 * 1024;
 
+    // Maximum allocation a trimmed line slot may retain for reuse. Larger allocations are
+    // released when the line is trimmed.
+    static constexpr size_t kMaxRetainedLineSizeBytes = 2 * 1024;
+
     // Guards all non-static data.
     // stdx::recursive_mutex // NOLINT is intentional, mongo::Mutex can not be used here
     mutable stdx::recursive_mutex _mutex;  // NOLINT
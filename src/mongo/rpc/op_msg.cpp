@@ -95,7 +95,10 @@ uint32_t calculateChecksum(const Message& message) {
     }
 
     invariant(OpMsg::isFlagSet(message, OpMsg::kChecksumPresent));
-    return wiredtiger_crc32c_func()(message.singleData().view2ptr(), message.size() - kCrc32Size);
+    // Resolving the function involves a runtime CPU feature check to select the
+    // hardware-accelerated implementation; do it once rather than per message.
+    static const auto crc32c = wiredtiger_crc32c_func();
+    return crc32c(message.singleData().view2ptr(), message.size() - kCrc32Size);
 }
 #endif  // MONGO_CONFIG_WIREDTIGER_ENABLED
 }  // namespace
@@ -0,0 +1,92 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/rpc/message.h"
+#include "mongo/rpc/op_msg.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Builds an OP_MSG request with the given number of extra body fields and document sequence
+ * documents, optionally carrying a checksum. The zero-extra-fields case models the small
+ * (sub-1KB) messages that dominate ingress traffic.
+ */
+Message makeMessage(int bodyFields, int sequenceDocs, bool withChecksum) {
+    OpMsgBuilder builder;
+    if (sequenceDocs > 0) {
+        auto seq = builder.beginDocSequence("documents");
+        for (int i = 0; i < sequenceDocs; ++i) {
+            seq.appendBuilder().append("_id", i).append("field", "value");
+        }
+    }
+    {
+        auto body = builder.beginBody();
+        body.append("insert", "collection");
+        for (int i = 0; i < bodyFields; ++i) {
+            body.append("field" + std::to_string(i), i);
+        }
+    }
+    auto message = builder.finish();
+    message.header().setId(0);
+    message.header().setResponseToMsgId(0);
+    if (withChecksum) {
+        OpMsg::appendChecksum(&message);
+    }
+    return message;
+}
+
+void BM_OpMsgParseBody(benchmark::State& state) {
+    const auto message = makeMessage(state.range(0), 0, state.range(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(OpMsg::parse(message));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * message.size());
+}
+
+void BM_OpMsgParseDocSequence(benchmark::State& state) {
+    const auto message = makeMessage(0, state.range(0), state.range(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(OpMsg::parse(message));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * message.size());
+}
+
+// The second argument toggles the checksum so that its verification cost is visible separately.
+BENCHMARK(BM_OpMsgParseBody)->ArgsProduct({{0, 16, 128}, {0, 1}});
+BENCHMARK(BM_OpMsgParseDocSequence)->ArgsProduct({{1, 64, 1024}, {0, 1}});
+
+}  // namespace
+}  // namespace mongo
@@ -312,6 +312,10 @@ StatusWith<CachedDatabaseInfo> CatalogCache::_getDatabase(OperationContext* opCt
             DatabaseType(dbName, ShardId::kConfigServerId, DatabaseVersion::makeFixed())};
     }
 
+    if (auto status = _checkDatabaseNotFoundCache(dbName); !status.isOK()) {
+        return status;
+    }
+
     Timer t{};
     ScopeGuard finishTiming([&] {
         CurOp::get(opCtx)->debug().catalogCacheDatabaseLookupMillis += Milliseconds(t.millis());
@@ -338,9 +342,12 @@ StatusWith<CachedDatabaseInfo> CatalogCache::_getDatabase(OperationContext* opCt
 
         // From this point we can guarantee that allowLocks is false.
         auto dbEntry = dbEntryFuture.get(opCtx);
-        uassert(ErrorCodes::NamespaceNotFound,
-                str::stream() << "database " << dbName.toStringForErrorMsg() << " not found",
-                dbEntry);
+        if (!dbEntry) {
+            _rememberDatabaseNotFound(dbName);
+            return Status{ErrorCodes::NamespaceNotFound,
+                          str::stream()
+                              << "database " << dbName.toStringForErrorMsg() << " not found"};
+        }
 
         return dbEntry;
     } catch (const DBException& ex) {
@@ -604,6 +611,7 @@ boost::optional<ShardingIndexesCatalogCache> CatalogCache::_getCollectionIndexIn
 
 StatusWith<CachedDatabaseInfo> CatalogCache::getDatabaseWithRefresh(OperationContext* opCtx,
                                                                     const DatabaseName& dbName) {
+    _forgetDatabaseNotFound(dbName);
     _databaseCache.advanceTimeInStore(
         dbName, ComparableDatabaseVersion::makeComparableDatabaseVersionForForcedRefresh());
     return getDatabase(opCtx, dbName);
@@ -751,6 +759,7 @@ StatusWith<CollectionRoutingInfo> CatalogCache::getTrackedCollectionRoutingInfoW
 
 void CatalogCache::onStaleDatabaseVersion(const DatabaseName& dbName,
                                           const boost::optional<DatabaseVersion>& databaseVersion) {
+    _forgetDatabaseNotFound(dbName);
     if (databaseVersion) {
         const auto version =
             ComparableDatabaseVersion::makeComparableDatabaseVersion(databaseVersion.value());
@@ -823,6 +832,7 @@ void CatalogCache::invalidateEntriesThatReferenceShard(const ShardId& shardId) {
 }
 
 void CatalogCache::purgeDatabase(const DatabaseName& dbName) {
+    _forgetDatabaseNotFound(dbName);
     _databaseCache.invalidateKey(dbName);
     _collectionCache.invalidateKeyIf(
         [&](const NamespaceString& nss) { return nss.dbName() == dbName; });
@@ -830,11 +840,50 @@ void CatalogCache::purgeDatabase(const DatabaseName& dbName) {
 }
 
 void CatalogCache::purgeAllDatabases() {
+    {
+        stdx::lock_guard<Latch> lg(_databaseNotFoundCacheMutex);
+        _databaseNotFoundCache.clear();
+    }
     _databaseCache.invalidateAll();
     _collectionCache.invalidateAll();
     _indexCache.invalidateAll();
 }
 
+Status CatalogCache::_checkDatabaseNotFoundCache(const DatabaseName& dbName) {
+    if (gCatalogCacheDatabaseNotFoundTTLMS.load() == 0) {
+        return Status::OK();
+    }
+
+    stdx::lock_guard<Latch> lg(_databaseNotFoundCacheMutex);
+    auto it = _databaseNotFoundCache.find(dbName);
+    if (it == _databaseNotFoundCache.end()) {
+        return Status::OK();
+    }
+
+    if (it->second <= Date_t::now()) {
+        _databaseNotFoundCache.erase(it);
+        return Status::OK();
+    }
+
+    return Status{ErrorCodes::NamespaceNotFound,
+                  str::stream() << "database " << dbName.toStringForErrorMsg() << " not found"};
+}
+
+void CatalogCache::_rememberDatabaseNotFound(const DatabaseName& dbName) {
+    const auto ttl = Milliseconds(gCatalogCacheDatabaseNotFoundTTLMS.load());
+    if (ttl == Milliseconds(0)) {
+        return;
+    }
+
+    stdx::lock_guard<Latch> lg(_databaseNotFoundCacheMutex);
+    _databaseNotFoundCache[dbName] = Date_t::now() + ttl;
+}
+
+void CatalogCache::_forgetDatabaseNotFound(const DatabaseName& dbName) {
+    stdx::lock_guard<Latch> lg(_databaseNotFoundCacheMutex);
+    _databaseNotFoundCache.erase(dbName);
+}
+
 void CatalogCache::report(BSONObjBuilder* builder) const {
     BSONObjBuilder cacheStatsBuilder(
         builder->subobjStart("catalogCache" + (_kind.empty() ? "" : "::" + _kind)));
@@ -852,6 +901,7 @@ void CatalogCache::report(BSONObjBuilder* builder) const {
 }
 
 void CatalogCache::invalidateDatabaseEntry_LINEARIZABLE(const DatabaseName& dbName) {
+    _forgetDatabaseNotFound(dbName);
     _databaseCache.invalidateKey(dbName);
 }
 
@@ -48,6 +48,7 @@
 #include "mongo/db/shard_id.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/s/catalog/type_database_gen.h"
 #include "mongo/s/catalog/type_index_catalog.h"
 #include "mongo/s/catalog_cache_loader.h"
@@ -60,6 +61,7 @@
 #include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/concurrency/thread_pool_interface.h"
 #include "mongo/util/read_through_cache.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
@@ -465,6 +467,23 @@ private:
         ChunkManager&& cm,
         boost::optional<ShardingIndexesCatalogCache>&& sii);
 
+    /**
+     * Returns a NamespaceNotFound error if 'dbName' was recently found not to exist and the
+     * negative entry has not yet expired, and Status::OK() otherwise. Expired entries are removed.
+     */
+    Status _checkDatabaseNotFoundCache(const DatabaseName& dbName);
+
+    /**
+     * Records that 'dbName' was not found on the config server so that requests for it can be
+     * answered without a lookup for the next 'catalogCacheDatabaseNotFoundTTLMS' milliseconds.
+     */
+    void _rememberDatabaseNotFound(const DatabaseName& dbName);
+
+    /**
+     * Removes any negative entry for 'dbName' so that the next request performs a lookup.
+     */
+    void _forgetDatabaseNotFound(const DatabaseName& dbName);
+
     // (Optional) the kind of catalog cache instantiated. Used for logging and reporting purposes.
     std::string _kind;
 
@@ -480,6 +499,15 @@ private:
 
     IndexCache _indexCache;
 
+    // Protects '_databaseNotFoundCache'.
+    Mutex _databaseNotFoundCacheMutex =
+        MONGO_MAKE_LATCH("CatalogCache::_databaseNotFoundCacheMutex");
+
+    // Expiration times of databases which were recently found not to exist. Only consulted and
+    // populated when 'catalogCacheDatabaseNotFoundTTLMS' is non-zero. The DatabaseCache cannot
+    // remember these answers itself because a not-found lookup leaves no entry in it.
+    stdx::unordered_map<DatabaseName, Date_t> _databaseNotFoundCache;
+
     /**
      * Encapsulates runtime statistics across all databases and collections in this catalog cache
      */
@@ -291,6 +291,31 @@ TEST_F(CatalogCacheTest, GetDatabaseDrop) {
     ASSERT_EQUALS(ErrorCodes::NamespaceNotFound, swDatabase.getStatus());
 }
 
+TEST_F(CatalogCacheTest, GetDatabaseNotFoundIsCachedWhenTTLIsSet) {
+    RAIIServerParameterControllerForTest notFoundTTLController{
+        "catalogCacheDatabaseNotFoundTTLMS", 60 * 60 * 1000};
+
+    _catalogCacheLoader->setDatabaseRefreshReturnValue(
+        Status(ErrorCodes::NamespaceNotFound, "dummy errmsg"));
+    auto swDatabase = _catalogCache->getDatabase(operationContext(), kDbName);
+    ASSERT_EQUALS(ErrorCodes::NamespaceNotFound, swDatabase.getStatus());
+
+    // The negative entry is served without consulting the loader, even though the database now
+    // exists.
+    const auto dbVersion = DatabaseVersion(UUID::gen(), Timestamp(1, 1));
+    _catalogCacheLoader->setDatabaseRefreshReturnValue(
+        DatabaseType(kDbName, kShards[0], dbVersion));
+    swDatabase = _catalogCache->getDatabase(operationContext(), kDbName);
+    ASSERT_EQUALS(ErrorCodes::NamespaceNotFound, swDatabase.getStatus());
+
+    // A stale database version notification invalidates the negative entry, after which the
+    // database is found again.
+    _catalogCache->onStaleDatabaseVersion(kDbName, boost::none);
+    swDatabase = _catalogCache->getDatabase(operationContext(), kDbName);
+    ASSERT_OK(swDatabase.getStatus());
+    ASSERT_EQ(swDatabase.getValue()->getPrimary(), kShards[0]);
+}
+
 TEST_F(CatalogCacheTest, InvalidateSingleDbOnShardRemoval) {
     const auto dbVersion = DatabaseVersion(UUID::gen(), Timestamp(1, 1));
     loadDatabases({DatabaseType(kDbName, kShards[0], dbVersion)});
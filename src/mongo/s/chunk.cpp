@@ -47,6 +47,7 @@ namespace mongo {
 
 ChunkInfo::ChunkInfo(const ChunkType& from)
     : _range(from.getMin(), from.getMax()),
+      _minKeyString(ShardKeyPattern::toKeyString(from.getMin())),
       _maxKeyString(ShardKeyPattern::toKeyString(from.getMax())),
       _shardId(from.getShard()),
       _lastmod(from.getVersion()),
@@ -62,6 +63,7 @@ ChunkInfo::ChunkInfo(ChunkRange range,
                      std::vector<ChunkHistory> history,
                      bool jumbo)
     : _range(std::move(range)),
+      _minKeyString(ShardKeyPattern::toKeyString(_range.getMin())),
       _maxKeyString(std::move(maxKeyString)),
       _shardId(shardId),
       _lastmod(std::move(version)),
@@ -73,9 +73,12 @@ public:
 
     bool overlapsWith(const ChunkInfo& other) const {
         // Comparing keystrings is more performant than comparing BSONObj
-        const auto minKeyString = ShardKeyPattern::toKeyString(getMin());
-        return minKeyString < other.getMaxKeyString() &&
-            getMaxKeyString() > ShardKeyPattern::toKeyString(other.getMin());
+        return getMinKeyString() < other.getMaxKeyString() &&
+            getMaxKeyString() > other.getMinKeyString();
+    }
+
+    const std::string& getMinKeyString() const {
+        return _minKeyString;
     }
 
     const std::string& getMaxKeyString() const {
@@ -128,6 +131,7 @@ public:
 
 private:
     const ChunkRange _range;
+    const std::string _minKeyString;
     const std::string _maxKeyString;
 
     const ShardId _shardId;
@@ -67,7 +67,7 @@ void checkAllElementsAreOfType(BSONType type, const BSONObj& o) {
 
 void checkChunksAreContiguous(const ChunkInfo& left, const ChunkInfo& right) {
     const auto& leftKeyString = left.getMaxKeyString();
-    const auto rightKeyString = ShardKeyPattern::toKeyString(right.getMin());
+    const auto& rightKeyString = right.getMinKeyString();
     if (leftKeyString == rightKeyString) {
         return;
     }
@@ -427,8 +427,7 @@ ChunkMap ChunkMap::_makeUpdated(ChunkVector&& updateChunks) const {
     updateChunkIt = updateChunks.begin();
     updateChunkWrittenBytesIt = updateChunkIt;
     // Skip first vectors that were not affected by this update since we don't need to modify them
-    auto mapIt = newMap._chunkVectorMap.upper_bound(
-        ShardKeyPattern::toKeyString((*updateChunkIt)->getRange().getMin()));
+    auto mapIt = newMap._chunkVectorMap.upper_bound((*updateChunkIt)->getMinKeyString());
     oldVectorPtr =
         mapIt != newMap._chunkVectorMap.end() ? mapIt->second : std::make_shared<ChunkVector>();
     oldChunkIt = oldVectorPtr->begin();
@@ -483,8 +482,8 @@ ChunkMap ChunkMap::_makeUpdated(ChunkVector&& updateChunks) const {
                     // next update doesn't overlap with current old vector so we need to jump
                     // forward to the first overlapping old vector.
                     // This is an optimization to skip vectors that are not affected by any updates.
-                    auto nextOvelappingMapIt = newMap._chunkVectorMap.upper_bound(
-                        ShardKeyPattern::toKeyString((*updateChunkIt)->getRange().getMin()));
+                    auto nextOvelappingMapIt =
+                        newMap._chunkVectorMap.upper_bound((*updateChunkIt)->getMinKeyString());
                     invariant(nextOvelappingMapIt != newMap._chunkVectorMap.end());
                     return nextOvelappingMapIt;
                 }();
@@ -497,7 +496,7 @@ ChunkMap ChunkMap::_makeUpdated(ChunkVector&& updateChunks) const {
                 if (mapIt != followingMapIt ||
                     (newVectorPtr->size() >= _maxChunkVectorSize &&
                      (updateChunkIt == updateChunks.end() ||
-                      ShardKeyPattern::toKeyString((*updateChunkIt)->getRange().getMin()) !=
+                      (*updateChunkIt)->getMinKeyString() !=
                           newVectorPtr->back()->getMaxKeyString()))) {
                     newMap._commitUpdatedChunkVector(std::move(newVectorPtr), true);
                     newVectorPtr = std::make_shared<ChunkVector>();
@@ -716,6 +715,7 @@ void ChunkManager::getShardIdsForRange(const BSONObj& min,
         if (chunkRanges) {
             getAllChunkRanges(chunkRanges);
         }
+        return;
     }
 
     _rt->optRt->forEachOverlappingChunk(min, max, includeMaxBound, [&](const auto& chunkInfo) {
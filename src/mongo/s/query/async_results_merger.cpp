@@ -50,6 +50,7 @@
 #include "mongo/db/query/kill_cursors_gen.h"
 #include "mongo/db/server_feature_flags_gen.h"
 #include "mongo/db/session/logical_session_id_gen.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/executor/remote_command_request.h"
 #include "mongo/rpc/metadata.h"
 #include "mongo/s/multi_statement_transaction_requests_sender.h"
@@ -109,6 +110,37 @@ int compareSortKeys(BSONObj leftSortKey, BSONObj rightSortKey, BSONObj sortKeyPa
     return leftSortKey.woCompare(rightSortKey, sortKeyPattern, rules);
 }
 
+/**
+ * Encodes 'sortKey' (as returned by extractSortKey()) into a KeyString. The encoding folds the
+ * sort directions from 'ordering' into the bytes, so that two encoded sort keys compare in sort
+ * order under a plain binary comparison. Like compareSortKeys(), this does not need a collator,
+ * since mongod has already mapped strings to their ICU comparison keys.
+ */
+std::string encodeSortKey(const BSONObj& sortKey, const Ordering& ordering) {
+    key_string::Builder ks(key_string::Version::kLatestVersion, ordering);
+
+    BSONObjIterator it(sortKey);
+    while (auto elem = it.next()) {
+        ks.appendBSONElement(elem);
+    }
+
+    return {ks.getBuffer(), ks.getSize()};
+}
+
+// Smoothing factor for the moving averages used to decide when to request a remote's next batch
+// ahead of its buffer draining. Higher values weight recent samples more heavily.
+constexpr double kEwmaSmoothingFactor = 0.2;
+
+/**
+ * Folds 'sample' into 'ewma', seeding the average with the first sample.
+ */
+double updateEwma(double ewma, double sample) {
+    if (ewma == 0) {
+        return sample;
+    }
+    return kEwmaSmoothingFactor * sample + (1 - kEwmaSmoothingFactor) * ewma;
+}
+
 void processAdditionalTransactionParticipantFromResponse(
     OperationContext* opCtx,
     const ShardId& shardId,
@@ -140,8 +172,8 @@ AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
       // support a default value for an enum. The default tailable mode should be 'kNormal', but
       // since that is not supported we treat boost::none (unspecified) to mean 'kNormal'.
       _tailableMode(_params.getTailableMode().value_or(TailableModeEnum::kNormal)),
-      _mergeQueue(MergingComparator(
-          _remotes, _params.getSort().value_or(BSONObj()), _params.getCompareWholeSortKey())),
+      _sortKeyOrdering(Ordering::make(_params.getSort().value_or(BSONObj()))),
+      _mergeQueue(MergingComparator(_remotes)),
       _promisedMinSortKeys(PromisedMinSortKeyComparator(_params.getSort().value_or(BSONObj()))) {
     if (_params.getTxnNumber()) {
         invariant(_params.getSessionId());
@@ -417,7 +449,7 @@ void AsyncResultsMerger::_processAdditionalTransactionParticipants(OperationCont
     }
 }
 
-ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
+ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock lk) {
     // Tailable non-awaitData cursors cannot have a sort.
     invariant(_tailableMode != TailableModeEnum::kTailable);
 
@@ -425,6 +457,12 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
         return {};
     }
 
+    // Update the estimate of how quickly the merged stream is being consumed. The time since the
+    // previous result was popped is one inter-result interval.
+    _sortedConsumeIntervalEwmaMicros =
+        updateEwma(_sortedConsumeIntervalEwmaMicros, static_cast<double>(_sortedConsumeTimer.micros()));
+    _sortedConsumeTimer.reset();
+
     size_t smallestRemote = _mergeQueue.top();
     _mergeQueue.pop();
 
@@ -433,6 +471,7 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
 
     ClusterQueryResult front = _remotes[smallestRemote].docBuffer.front();
     _remotes[smallestRemote].docBuffer.pop();
+    _remotes[smallestRemote].sortKeyBuffer.pop();
 
     // Re-populate the merging queue with the next result from 'smallestRemote', if it has a
     // next result.
@@ -440,6 +479,27 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
         _mergeQueue.push(smallestRemote);
     }
 
+    // If 'smallestRemote' is running low on buffered results and its cursor is not exhausted,
+    // request the next batch now, while the merge can still make progress from the results that
+    // are already buffered. This overlaps the getMore round trip with consumption instead of
+    // stalling the merge once the buffer drains. "Running low" means down to the last buffered
+    // result, or, for a remote whose response times are running behind the rate at which the
+    // merged stream is consumed, that the buffer is expected to drain before a response would
+    // arrive. Failures are ignored here; the regular path in _scheduleGetMores() will retry and
+    // surface them once the buffer is empty.
+    auto& smallest = _remotes[smallestRemote];
+    const bool expectedToDrainBeforeResponse = smallest.responseLatencyEwmaMicros > 0 &&
+        _sortedConsumeIntervalEwmaMicros > 0 &&
+        static_cast<double>(smallest.docBuffer.size()) * _sortedConsumeIntervalEwmaMicros <
+            smallest.responseLatencyEwmaMicros;
+    if (_tailableMode == TailableModeEnum::kNormal && _opCtx && !smallest.docBuffer.empty() &&
+        (smallest.docBuffer.size() == 1 || expectedToDrainBeforeResponse) &&
+        !smallest.exhausted() && !smallest.cbHandle.isValid() && smallest.status.isOK() &&
+        _opCtx->checkForInterruptNoAssert().isOK()) {
+        const auto fcvSnapshot = serverGlobalParams.featureCompatibility.acquireFCVSnapshot();
+        _scheduleGetMoresForRemotes(lk, {smallestRemote}, fcvSnapshot).ignore();
+    }
+
     // For sorted tailable awaitData cursors, update the high water mark to the document's sort key.
     if (_tailableMode == TailableModeEnum::kTailableAndAwaitData) {
         if (_remotes[smallestRemote].eligibleForHighWaterMark) {
@@ -560,7 +620,6 @@ Status AsyncResultsMerger::_scheduleGetMores(WithLock lk) {
 
     // Schedule remote work on hosts for which we need more results.
     std::vector<size_t> remoteIdxs;
-    std::vector<AsyncRequestsSender::Request> asyncRequests;
     for (size_t i = 0; i < _remotes.size(); ++i) {
         auto& remote = _remotes[i];
 
@@ -572,12 +631,23 @@ Status AsyncResultsMerger::_scheduleGetMores(WithLock lk) {
         if (!remote.hasNext() && !remote.exhausted() && !remote.cbHandle.isValid()) {
             // If this remote is not exhausted and there is no outstanding request for it, schedule
             // work to retrieve the next batch.
-            auto req = _makeRequest(lk, i, fcvSnapshot);
             remoteIdxs.emplace_back(i);
-            asyncRequests.emplace_back(remote.shardId, std::move(req));
         }
     }
 
+    return _scheduleGetMoresForRemotes(lk, remoteIdxs, fcvSnapshot);
+}
+
+Status AsyncResultsMerger::_scheduleGetMoresForRemotes(
+    WithLock lk,
+    const std::vector<size_t>& remoteIdxs,
+    const ServerGlobalParams::FCVSnapshot& fcvSnapshot) {
+    std::vector<AsyncRequestsSender::Request> asyncRequests;
+    for (size_t remoteIndex : remoteIdxs) {
+        auto req = _makeRequest(lk, remoteIndex, fcvSnapshot);
+        asyncRequests.emplace_back(_remotes[remoteIndex].shardId, std::move(req));
+    }
+
     // Build the batch of requests to send if inside a transaction.
     std::vector<executor::RemoteCommandRequest> executorRequests;
     auto txnRequests = [&] {
@@ -791,6 +861,15 @@ void AsyncResultsMerger::_handleBatchResponse(WithLock lk,
     auto& remote = _remotes[remoteIndex];
     remote.cbHandle = executor::TaskExecutor::CallbackHandle();
 
+    if (cbData.response.elapsed) {
+        // Track a per-remote response time estimate so that the sorted merge can request a slow
+        // remote's next batch early enough for the round trip to overlap consumption of its
+        // buffered results.
+        remote.responseLatencyEwmaMicros =
+            updateEwma(remote.responseLatencyEwmaMicros,
+                       static_cast<double>(durationCount<Microseconds>(*cbData.response.elapsed)));
+    }
+
     if (cbData.response.isOK()) {
         // We store the original unprocessed response in order to process additional transaction
         // participants when reading it. Additional transaction participants processing cannot occur
@@ -841,10 +920,12 @@ void AsyncResultsMerger::_cleanUpFailedBatch(WithLock lk, Status status, size_t
     // the error to the user. In order to avoid polluting the user's error message, we ignore such
     // errors with the expectation that all outstanding cursors will be closed promptly.
     if (_params.getAllowPartialResults() || remote.status == ErrorCodes::ExchangePassthrough) {
-        // Clear the results buffer and cursor id, and set 'partialResultsReturned' if appropriate.
+        // Swallow the error and clear the cursor id so that we stop asking this remote for further
+        // batches, and set 'partialResultsReturned' if appropriate. Results that were already
+        // buffered remain eligible to be returned; this also keeps '_mergeQueue' consistent in the
+        // sorted case, where a prefetched batch may fail while this remote still has buffered
+        // results.
         remote.partialResultsReturned = (remote.status != ErrorCodes::ExchangePassthrough);
-        std::queue<ClusterQueryResult> emptyBuffer;
-        std::swap(remote.docBuffer, emptyBuffer);
         remote.status = Status::OK();
         remote.cursorId = 0;
     }
@@ -898,6 +979,7 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
                                            const CursorResponse& response) {
     auto& remote = _remotes[remoteIndex];
     _updateRemoteMetadata(lk, remoteIndex, response);
+    const bool bufferWasEmpty = remote.docBuffer.empty();
     for (const auto& obj : response.getBatch()) {
         // If there's a sort, we're expecting the remote node to have given us back a sort key.
         if (_params.getSort()) {
@@ -915,6 +997,8 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
                                          << "' was not of type Object in document: " << obj);
                 return false;
             }
+            remote.sortKeyBuffer.push(encodeSortKey(
+                extractSortKey(obj, _params.getCompareWholeSortKey()), _sortKeyOrdering));
         }
 
         ClusterQueryResult result(obj, remote.shardId);
@@ -923,8 +1007,10 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
     }
 
     // If we're doing a sorted merge, then we have to make sure to put this remote onto the merge
-    // queue.
-    if (_params.getSort() && !response.getBatch().empty()) {
+    // queue. A remote is on the merge queue whenever it has buffered results, so only add it when
+    // this batch transitions the buffer from empty to non-empty; a prefetched batch may arrive
+    // while the remote is already on the queue.
+    if (_params.getSort() && bufferWasEmpty && !remote.docBuffer.empty()) {
         _mergeQueue.push(remoteIndex);
     }
     return true;
@@ -1088,12 +1174,7 @@ bool AsyncResultsMerger::RemoteCursorData::exhausted() const {
 //
 
 bool AsyncResultsMerger::MergingComparator::operator()(const size_t& lhs, const size_t& rhs) {
-    const ClusterQueryResult& leftDoc = _remotes[lhs].docBuffer.front();
-    const ClusterQueryResult& rightDoc = _remotes[rhs].docBuffer.front();
-
-    return compareSortKeys(extractSortKey(*leftDoc.getResult(), _compareWholeSortKey),
-                           extractSortKey(*rightDoc.getResult(), _compareWholeSortKey),
-                           _sort) > 0;
+    return _remotes[lhs].sortKeyBuffer.front() > _remotes[rhs].sortKeyBuffer.front();
 }
 
 bool AsyncResultsMerger::PromisedMinSortKeyComparator::operator()(
@@ -37,6 +37,7 @@
 #include <memory>
 #include <queue>
 #include <set>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -44,6 +45,7 @@
 #include "mongo/base/status_with.h"
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobj.h"
+#include "mongo/bson/ordering.h"
 #include "mongo/db/cursor_id.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
@@ -60,6 +62,7 @@
 #include "mongo/util/duration.h"
 #include "mongo/util/net/hostandport.h"
 #include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
@@ -349,6 +352,17 @@ private:
         // The buffer of results that have been retrieved but not yet returned to the caller.
         std::queue<ClusterQueryResult> docBuffer;
 
+        // The KeyString-encoded sort key of each result in 'docBuffer', in the same order. Only
+        // maintained if there is a sort. Each sort key is encoded once when the result is buffered
+        // so that every subsequent merge comparison is a simple binary comparison rather than a
+        // BSON comparison of the extracted sort keys.
+        std::queue<std::string> sortKeyBuffer;
+
+        // Exponentially-weighted moving average of this remote's command response time, in
+        // microseconds. Zero until the first response arrives. Used by the sorted merge to start
+        // fetching from historically slow remotes before their buffers drain.
+        double responseLatencyEwmaMicros = 0;
+
         // Is valid if there is currently a pending request to this remote.
         executor::TaskExecutor::CallbackHandle cbHandle;
 
@@ -364,24 +378,18 @@ private:
         bool invalidated = false;
     };
 
+    /**
+     * Compares the front results of two remotes by their KeyString-encoded sort keys. The sort
+     * direction is baked into the encoding, so the comparison is a plain binary comparison.
+     */
     class MergingComparator {
     public:
-        MergingComparator(const std::vector<RemoteCursorData>& remotes,
-                          const BSONObj& sort,
-                          bool compareWholeSortKey)
-            : _remotes(remotes), _sort(sort), _compareWholeSortKey(compareWholeSortKey) {}
+        MergingComparator(const std::vector<RemoteCursorData>& remotes) : _remotes(remotes) {}
 
         bool operator()(const size_t& lhs, const size_t& rhs);
 
     private:
         const std::vector<RemoteCursorData>& _remotes;
-
-        const BSONObj _sort;
-
-        // When '_compareWholeSortKey' is true, $sortKey is a scalar value, rather than an object.
-        // We extract the sort key {$sortKey: <value>}. The sort key pattern '_sort' is verified to
-        // be {$sortKey: 1}.
-        const bool _compareWholeSortKey;
     };
 
     using MinSortKeyRemoteIdPair = std::pair<BSONObj, size_t>;
@@ -501,6 +509,14 @@ private:
      */
     Status _scheduleGetMores(WithLock);
 
+    /**
+     * Schedules a getMore against each of the remotes in 'remoteIndexes'. Returns an error if we
+     * encounter an error while scheduling any of the requests.
+     */
+    Status _scheduleGetMoresForRemotes(WithLock,
+                                       const std::vector<size_t>& remoteIndexes,
+                                       const ServerGlobalParams::FCVSnapshot& fcvSnapshot);
+
     /**
      * Schedules a killCursors command to be run on all remote hosts that have open cursors.
      */
@@ -541,6 +557,18 @@ private:
     AsyncResultsMergerParams _params;
     TailableModeEnum _tailableMode;
 
+    // The ordering derived from the sort pattern, used to KeyString-encode the sort key of each
+    // buffered result. Unused if there is no sort.
+    const Ordering _sortKeyOrdering;
+
+    // Exponentially-weighted moving average of the time between successive results popped by the
+    // sorted merge, in microseconds. Zero until the first result has been popped. Together with a
+    // remote's response latency estimate this determines how early its next batch is requested.
+    double _sortedConsumeIntervalEwmaMicros = 0;
+
+    // Measures the time since the sorted merge last popped a result.
+    Timer _sortedConsumeTimer;
+
     // Must be acquired before accessing any data members (other than _params, which is read-only).
     mutable Mutex _mutex = MONGO_MAKE_LATCH("AsyncResultsMerger::_mutex");
 
@@ -69,6 +69,7 @@
 #include "mongo/db/pipeline/document_source.h"
 #include "mongo/db/pipeline/document_source_limit.h"
 #include "mongo/db/pipeline/document_source_skip.h"
+#include "mongo/db/pipeline/pipeline.h"
 #include "mongo/db/pipeline/search/search_helper.h"
 #include "mongo/db/pipeline/stage_constraints.h"
 #include "mongo/db/pipeline/variables.h"
@@ -156,6 +157,24 @@ Status appendCursorResponseToCommandResult(const ShardId& shardId,
     return getStatusFromCommandResult(result->asTempObj());
 }
 
+/**
+ * Returns true if the first stage of 'mergePipeline' to execute after the $mergeCursors stage must
+ * consume all of its input before producing any output, as is the case for the merging half of a
+ * split $group. In that case there is no benefit to limiting the size of the batches requested
+ * from the shards, since nothing can be returned to the client until the shard cursors have been
+ * drained in their entirety.
+ */
+bool mergingPipelineBlocksOnAllInput(const Pipeline& mergePipeline) {
+    for (const auto& stage : mergePipeline.getSources()) {
+        if (dynamic_cast<DocumentSourceMergeCursors*>(stage.get())) {
+            continue;
+        }
+        return stage->constraints(Pipeline::SplitState::kSplitForMerge).streamType ==
+            StageConstraints::StreamType::kBlocking;
+    }
+    return false;
+}
+
 AsyncRequestsSender::Response establishMergingShardCursor(OperationContext* opCtx,
                                                           const NamespaceString& nss,
                                                           const BSONObj mergeCmdObj,
@@ -479,8 +498,13 @@ BSONObj establishMergingMongosCursor(OperationContext* opCtx,
     params.tailableMode = pipelineForMerging->getContext()->tailableMode;
     // A batch size of 0 is legal for the initial aggregate, but not valid for getMores, the batch
     // size we pass here is used for getMores, so do not specify a batch size if the initial request
-    // had a batch size of 0.
-    params.batchSize = batchSize == 0 ? boost::none : boost::make_optional(batchSize);
+    // had a batch size of 0. We also ignore the batch size when the merging pipeline opens with a
+    // blocking stage: applying the client's batch size to the shard getMores would only multiply
+    // the number of round trips needed to drain the shard cursors, so we let the shards fill each
+    // batch of partial results to the maximum size instead.
+    params.batchSize = batchSize == 0 || mergingPipelineBlocksOnAllInput(*pipelineForMerging)
+        ? boost::none
+        : boost::make_optional(batchSize);
     params.originatingPrivileges = privileges;
     params.requestQueryStatsFromRemotes = requestQueryStatsFromRemotes;
 
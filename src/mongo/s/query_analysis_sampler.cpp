@@ -228,11 +228,11 @@ void QueryAnalysisSampler::QueryStats::refreshTotalCount() {
     long long newTotalCount = [&] {
         if (serverGlobalParams.clusterRole.hasExclusively(ClusterRole::RouterServer) ||
             serverGlobalParams.clusterRole.has(ClusterRole::None)) {
-            return globalOpCounters.getUpdate()->load() + globalOpCounters.getDelete()->load() +
-                _lastFindAndModifyQueriesCount + globalOpCounters.getQuery()->load() +
+            return globalOpCounters.getUpdate() + globalOpCounters.getDelete() +
+                _lastFindAndModifyQueriesCount + globalOpCounters.getQuery() +
                 _lastAggregateQueriesCount + _lastCountQueriesCount + _lastDistinctQueriesCount;
         } else if (serverGlobalParams.clusterRole.has(ClusterRole::ShardServer)) {
-            return globalOpCounters.getNestedAggregate()->load();
+            return globalOpCounters.getNestedAggregate();
         }
         MONGO_UNREACHABLE;
     }();
@@ -128,11 +128,11 @@ bool isValidShardKeyElement(const BSONElement& element) {
     return !element.eoo() && element.type() != Array;
 }
 
-BSONElement extractKeyElementFromDoc(const BSONObj& obj, StringData pathStr) {
+BSONElement extractKeyElementFromDoc(const BSONObj& obj, const FieldRef& path) {
     // Any arrays found get immediately returned. We are equipped up the call stack to specifically
     // deal with array values.
     size_t idxPath;
-    return getFieldDottedOrArray(obj, FieldRef(pathStr), &idxPath);
+    return getFieldDottedOrArray(obj, path, &idxPath);
 }
 
 /**
@@ -367,8 +367,11 @@ BSONObj ShardKeyPattern::extractShardKeyFromDocumentKeyThrows(const BSONObj& doc
 
 BSONObj ShardKeyPattern::extractShardKeyFromDoc(const BSONObj& doc) const {
     BSONObjBuilder keyBuilder;
+    size_t pathIdx = 0;
     for (auto&& patternEl : _keyPattern.toBSON()) {
-        BSONElement matchEl = extractKeyElementFromDoc(doc, patternEl.fieldNameStringData());
+        // "_keyPatternPaths" parallels the pattern elements, so the pre-parsed path can be reused
+        // instead of re-parsing the dotted field name for every document.
+        BSONElement matchEl = extractKeyElementFromDoc(doc, *_keyPatternPaths[pathIdx++]);
 
         if (matchEl.eoo()) {
             matchEl = kNullObj.firstElement();
@@ -405,12 +408,14 @@ BSONObj ShardKeyPattern::extractShardKeyFromDocThrows(const BSONObj& doc) const
 
 BSONObj ShardKeyPattern::emplaceMissingShardKeyValuesForDocument(const BSONObj doc) const {
     BSONObjBuilder fullDocBuilder(doc);
+    size_t pathIdx = 0;
     for (const auto& skField : _keyPattern.toBSON()) {
+        const auto& skPath = *_keyPatternPaths[pathIdx++];
         // Illegal to emplace a null _id.
         if (skField.fieldNameStringData() == kIdField) {
             continue;
         }
-        auto matchEl = extractKeyElementFromDoc(doc, skField.fieldNameStringData());
+        auto matchEl = extractKeyElementFromDoc(doc, skPath);
         if (matchEl.eoo()) {
             fullDocBuilder << skField.fieldNameStringData() << BSONNULL;
         }
@@ -33,6 +33,7 @@
 #include <absl/meta/type_traits.h>
 #include <algorithm>
 #include <boost/move/utility_core.hpp>
+#include <cmath>
 #include <set>
 
 #include <boost/optional/optional.hpp>
@@ -265,6 +266,26 @@ auto ShardingTaskExecutorPoolController::updateHost(PoolId id, const HostState&
     // Update the target for just the pool first
     poolData.target = stats.requests + stats.active + stats.leased;
 
+    if (const auto halfLifeMS = gParameters.demandHalfLifeMS.load(); halfLifeMS > 0) {
+        // Hold the target at a decaying floor of recent demand: rises are taken immediately,
+        // while falls are spread over a few half-lives. This keeps connections established
+        // during a burst warm for the next burst instead of paying maxConnecting-paced
+        // handshakes all over again.
+        const auto now = Date_t::now();
+        const auto demand = static_cast<double>(poolData.target);
+        if (demand >= poolData.decayedDemand) {
+            poolData.decayedDemand = demand;
+        } else {
+            const auto elapsedMS = std::max(
+                static_cast<long long>(0),
+                durationCount<Milliseconds>(now - poolData.lastDemandUpdate));
+            const auto decay = std::exp2(-static_cast<double>(elapsedMS) / halfLifeMS);
+            poolData.decayedDemand = demand + (poolData.decayedDemand - demand) * decay;
+            poolData.target = static_cast<size_t>(std::ceil(poolData.decayedDemand));
+        }
+        poolData.lastDemandUpdate = now;
+    }
+
     if (poolData.target < minConns) {
         poolData.target = minConns;
     } else if (poolData.target > maxConns) {
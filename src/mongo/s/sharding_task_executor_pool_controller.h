@@ -51,6 +51,7 @@
 #include "mongo/util/duration.h"
 #include "mongo/util/net/hostandport.h"
 #include "mongo/util/synchronized_value.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
@@ -111,6 +112,7 @@ public:
         AtomicWord<int> minConnections;
         AtomicWord<int> maxConnections;
         AtomicWord<int> maxConnecting;
+        AtomicWord<int> demandHalfLifeMS;
 
         AtomicWord<int> hostTimeoutMS;
         AtomicWord<int> pendingTimeoutMS;
@@ -216,6 +218,15 @@ private:
         // The number of connections the host should maintain
         size_t target = 0;
 
+        // A decaying record of recent demand on this pool. While demandHalfLifeMS is set, the
+        // target is held at this floor so that connections established for a burst stay warm
+        // instead of draining away and forcing a paced storm of fresh handshakes when the next
+        // burst arrives.
+        double decayedDemand = 0;
+
+        // When decayedDemand was last updated
+        Date_t lastDemandUpdate;
+
         // This host is able to shutdown
         bool isAbleToShutdown = false;
     };
@@ -486,7 +486,7 @@ BSONObj TransactionRouter::Participant::attachTxnFieldsIfNeeded(
     bool hasTxnCreatedAnyDatabase) const {
     bool hasStartTxn = false;
     bool hasAutoCommit = false;
-    bool hasTxnNum = false;
+    boost::optional<TxnNumber> cmdTxnNumber;
 
     BSONObjIterator iter(cmd);
     while (iter.more()) {
@@ -500,7 +500,8 @@ BSONObj TransactionRouter::Participant::attachTxnFieldsIfNeeded(
             hasAutoCommit = true;
         } else if (OperationSessionInfoFromClient::kTxnNumberFieldName ==
                    elem.fieldNameStringData()) {
-            hasTxnNum = true;
+            // Capture the value here since 'cmd' may be rebuilt below, invalidating the element.
+            cmdTxnNumber = elem.numberLong();
         }
     }
 
@@ -544,13 +545,11 @@ BSONObj TransactionRouter::Participant::attachTxnFieldsIfNeeded(
         newCmd.append(OperationSessionInfoFromClient::kAutocommitFieldName, false);
     }
 
-    if (!hasTxnNum) {
+    if (!cmdTxnNumber) {
         newCmd.append(OperationSessionInfoFromClient::kTxnNumberFieldName,
                       sharedOptions.txnNumberAndRetryCounter.getTxnNumber());
     } else {
-        auto osi = OperationSessionInfoFromClient::parse(IDLParserContext{"OperationSessionInfo"},
-                                                         newCmd.asTempObj());
-        invariant(sharedOptions.txnNumberAndRetryCounter.getTxnNumber() == *osi.getTxnNumber());
+        invariant(sharedOptions.txnNumberAndRetryCounter.getTxnNumber() == *cmdTxnNumber);
     }
 
     if (auto txnRetryCounter = sharedOptions.txnNumberAndRetryCounter.getTxnRetryCounter();
@@ -921,19 +920,10 @@ void TransactionRouter::Router::_setReadOnlyForParticipant(OperationContext* opC
                                                            const Participant::ReadOnly readOnly) {
     invariant(readOnly != Participant::ReadOnly::kUnset);
 
-    const auto iter = o().participants.find(shard.toString());
-    invariant(iter != o().participants.end());
-    const auto currentParticipant = iter->second;
-
-    auto newParticipant =
-        TransactionRouter::Participant(currentParticipant.isCoordinator,
-                                       currentParticipant.stmtIdCreatedAt,
-                                       readOnly,
-                                       std::move(currentParticipant.sharedOptions));
-
     stdx::lock_guard<Client> lk(*opCtx->getClient());
-    o(lk).participants.erase(iter);
-    o(lk).participants.try_emplace(shard.toString(), std::move(newParticipant));
+    const auto iter = o(lk).participants.find(shard.toString());
+    invariant(iter != o(lk).participants.end());
+    iter->second.readOnly = readOnly;
 }
 
 void TransactionRouter::Router::_assertAbortStatusIsOkOrNoSuchTransaction(
@@ -142,8 +142,9 @@ public:
         const bool isCoordinator{false};
 
         // Is updated to kReadOnly or kNotReadOnly based on the readOnly field in the participant's
-        // responses to statements.
-        const ReadOnly readOnly{ReadOnly::kUnset};
+        // responses to statements. Modified in place under the client lock so the participant does
+        // not need to be copied and re-inserted for every response.
+        ReadOnly readOnly{ReadOnly::kUnset};
 
         // Returns the shared transaction options this participant was created with
         const SharedTransactionOptions sharedOptions;
@@ -62,6 +62,7 @@
 #include "mongo/platform/mutex.h"
 #include "mongo/scripting/dbdirectclient_factory.h"
 #include "mongo/scripting/engine.h"
+#include "mongo/scripting/engine_gen.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/util/ctype.h"
 #include "mongo/util/decorable.h"
@@ -401,7 +402,8 @@ public:
             return;
         }
 
-        if (Date_t::now() - scope->getCreateTime() > kMaxScopeReuseTime) {
+        if (Date_t::now() - scope->getCreateTime() >
+            Seconds(gJSScopeCacheMaxReuseSeconds.load())) {
             return;  // too old to save
         }
 
@@ -409,7 +411,11 @@ public:
             return;  // not saving errored scopes
         }
 
-        if (_pools.size() >= kMaxPoolSize) {
+        const auto maxPoolSize = static_cast<size_t>(gJSScopeCacheMaxPoolSize.load());
+        if (maxPoolSize == 0) {
+            return;  // pooling disabled
+        }
+        while (_pools.size() >= maxPoolSize) {
             // prefer to keep recently-used scopes
             _pools.pop_back();
         }
@@ -426,7 +432,8 @@ public:
             if (it->poolName == poolName) {
                 std::shared_ptr<Scope> scope = it->scope;
                 _pools.erase(it);
-                scope->reset();
+                // Scopes are reset on their way into the pool, so handing one out does not
+                // need a second reset.
                 scope->registerOperation(opCtx);
                 return scope;
             }
@@ -447,10 +454,8 @@ private:
         std::tuple<DatabaseName, string /*scopeType*/> poolName;
     };
 
-    // Note: if these numbers change, reconsider choice of datastructure for _pools
-    static const unsigned kMaxPoolSize = 10;
-    constexpr static inline Seconds kMaxScopeReuseTime = Seconds(10);
-
+    // Note: if 'jsScopeCacheMaxPoolSize' is raised well above its default, reconsider the
+    // choice of datastructure for _pools.
     typedef std::deque<ScopeAndPool> Pools;  // More-recently used Scopes are kept at the front.
     Pools _pools;                            // protected by _mutex
     Mutex _mutex = MONGO_MAKE_LATCH("ScopeCache::_mutex");
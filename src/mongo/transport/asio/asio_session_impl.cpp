@@ -36,9 +36,12 @@
 #include "mongo/db/server_feature_flags_gen.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/logv2/log.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
 #include "mongo/transport/asio/asio_utils.h"
 #include "mongo/transport/proxy_protocol_header_parser.h"
 #include "mongo/transport/session_util.h"
+#include "mongo/transport/transport_options_gen.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/future_util.h"
 #include "mongo/util/net/socket_utils.h"
@@ -117,6 +120,48 @@ auto& totalIngressTLSConnections =  //
     *MetricBuilder<Counter64>("network.totalIngressTLSConnections");
 auto& totalIngressTLSHandshakeTimeMillis =  //
     *MetricBuilder<Counter64>("network.totalIngressTLSHandshakeTimeMillis");
+
+#ifdef MONGO_CONFIG_SSL
+/**
+ * RAII slot in the bounded set of concurrently running ingress TLS handshakes.
+ *
+ * Full handshakes are CPU-bound in asymmetric crypto, so a reconnect storm of them can
+ * saturate every core and starve threads serving established sessions. When
+ * tlsMaxConcurrentIngressHandshakes is set, excess connections wait here for a slot before
+ * handshaking. Only used by synchronous sessions, which each own a dedicated thread that is
+ * safe to block.
+ */
+class IngressTLSHandshakeSlot {
+public:
+    IngressTLSHandshakeSlot() {
+        if (gTLSMaxConcurrentIngressHandshakes.load() <= 0)
+            return;
+        stdx::unique_lock lk(_mutex);
+        // Re-load the limit on each pass so runtime changes take effect for waiters.
+        _cv.wait(lk, [&] {
+            auto limit = gTLSMaxConcurrentIngressHandshakes.load();
+            return limit <= 0 || _active < limit;
+        });
+        ++_active;
+        _held = true;
+    }
+
+    ~IngressTLSHandshakeSlot() {
+        if (!_held)
+            return;
+        stdx::lock_guard lk(_mutex);
+        --_active;
+        _cv.notify_one();
+    }
+
+private:
+    static inline stdx::mutex _mutex;  // NOLINT
+    static inline stdx::condition_variable _cv;
+    static inline int _active = 0;
+
+    bool _held = false;
+};
+#endif  // MONGO_CONFIG_SSL
 }  // namespace
 
 
@@ -748,6 +793,7 @@ Future<bool> CommonAsioSession::maybeHandshakeSSLForIngress(const MutableBufferS
 
         auto doHandshake = [&] {
             if (_blockingMode == sync) {
+                IngressTLSHandshakeSlot handshakeSlot;
                 std::error_code ec;
                 _sslSocket->handshake(asio::ssl::stream_base::server, buffer, ec);
                 return futurize(ec, asio::buffer_size(buffer));
@@ -0,0 +1,86 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+
+#include <grpcpp/support/byte_buffer.h>
+
+#include "mongo/transport/grpc/serialization.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/shared_buffer.h"
+
+namespace mongo::transport::grpc {
+namespace {
+
+/**
+ * Measures the per-message marshalling costs that are unique to the gRPC path. The ASIO
+ * transport writes a Message's buffer to the socket directly, so these conversions between
+ * SharedBuffer and grpc::ByteBuffer are the extra work a stream performs for each operation.
+ */
+SharedBuffer makeBuffer(size_t size) {
+    auto buffer = SharedBuffer::allocate(size);
+    std::memset(buffer.get(), 'x', size);
+    return buffer;
+}
+
+void BM_GRPCSerializeMessage(benchmark::State& state) {
+    ConstSharedBuffer source = makeBuffer(state.range(0));
+    for (auto _ : state) {
+        ::grpc::ByteBuffer buffer;
+        bool ownBuffer = false;
+        invariant(::grpc::SerializationTraits<ConstSharedBuffer>::Serialize(
+                      source, &buffer, &ownBuffer)
+                      .ok());
+        benchmark::DoNotOptimize(buffer);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * source.capacity());
+}
+
+void BM_GRPCDeserializeMessage(benchmark::State& state) {
+    auto source = makeBuffer(state.range(0));
+    ::grpc::Slice slice(source.get(), source.capacity());
+    ::grpc::ByteBuffer byteBuffer(&slice, /* n_slices */ 1);
+    for (auto _ : state) {
+        SharedBuffer dest;
+        invariant(::grpc::SerializationTraits<SharedBuffer>::Deserialize(&byteBuffer, &dest).ok());
+        benchmark::DoNotOptimize(dest);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * source.capacity());
+}
+
+// Sweep from the small messages that dominate command traffic up to batches near the 16MB
+// message size limit.
+BENCHMARK(BM_GRPCSerializeMessage)->RangeMultiplier(64)->Range(1 << 10, 16 << 20);
+BENCHMARK(BM_GRPCDeserializeMessage)->RangeMultiplier(64)->Range(1 << 10, 16 << 20);
+
+}  // namespace
+}  // namespace mongo::transport::grpc
@@ -69,6 +69,7 @@ public:
         bool useUnixDomainSockets;
         int unixDomainSocketPermissions;
         int maxServerThreads;
+        int maxServerConcurrentStreams;
         boost::optional<BSONObj> clientMetadata;
     };
 
@@ -55,6 +55,7 @@ GRPCTransportLayerImpl::Options::Options(const ServerGlobalParams& params) {
     useUnixDomainSockets = !params.noUnixSocket;
     unixDomainSocketPermissions = params.unixSocketPermissions;
     maxServerThreads = params.grpcServerMaxThreads;
+    maxServerConcurrentStreams = params.grpcServerMaxConcurrentStreams;
 }
 
 GRPCTransportLayerImpl::GRPCTransportLayerImpl(ServiceContext* svcCtx,
@@ -124,6 +125,7 @@ Status GRPCTransportLayerImpl::setup() {
             }
             serverOptions.addresses = std::move(addresses);
             serverOptions.maxThreads = _options.maxServerThreads;
+            serverOptions.maxConcurrentStreams = _options.maxServerConcurrentStreams;
 
             uassert(ErrorCodes::InvalidOptions,
                     "Unable to start GRPC transport for ingress without tlsCertificateKeyFile",
@@ -31,6 +31,7 @@
 
 #include <grpc/compression.h>
 #include <grpc/grpc_security_constants.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpcpp/resource_quota.h>
 #include <grpcpp/security/credentials.h>
 #include <grpcpp/server_builder.h>
@@ -229,6 +230,12 @@ void Server::start() {
     builder.SetMaxReceiveMessageSize(MaxMessageSizeBytes);
     builder.SetMaxSendMessageSize(MaxMessageSizeBytes);
     builder.SetDefaultCompressionAlgorithm(::grpc_compression_algorithm::GRPC_COMPRESS_NONE);
+    if (_options.maxConcurrentStreams > 0) {
+        // Advertised to clients as SETTINGS_MAX_CONCURRENT_STREAMS on each HTTP/2 connection;
+        // bounds how many multiplexed operations a single channel may run in parallel.
+        builder.AddChannelArgument(GRPC_ARG_MAX_CONCURRENT_STREAMS,
+                                   _options.maxConcurrentStreams);
+    }
     ::grpc::ResourceQuota quota;
     quota.SetMaxThreads(_options.maxThreads);
     builder.SetResourceQuota(quota);
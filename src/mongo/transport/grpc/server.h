@@ -47,6 +47,11 @@ public:
          */
         std::vector<HostAndPort> addresses;
         size_t maxThreads;
+        /**
+         * Maximum number of streams (i.e. concurrent operations) permitted on a single HTTP/2
+         * connection. If set to a non-positive value, the gRPC library's default is used.
+         */
+        int maxConcurrentStreams = -1;
         StringData tlsCertificateKeyFile;
         boost::optional<StringData> tlsCAFile;
         bool tlsAllowConnectionsWithoutCertificates;
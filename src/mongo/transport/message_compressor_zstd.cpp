@@ -39,10 +39,30 @@
 #include "mongo/base/status.h"
 #include "mongo/transport/message_compressor_registry.h"
 #include "mongo/transport/message_compressor_zstd.h"
+#include "mongo/transport/message_compressor_zstd_gen.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
 
+namespace {
+
+// The one-shot ZSTD_compress()/ZSTD_decompress() entry points build and tear down a full
+// (de)compression context per call, which dominates the cost of compressing small messages.
+// Reuse a per-thread context instead; zstd reuses the workspace memory across calls.
+ZSTD_CCtx* getThreadLocalCCtx() {
+    thread_local std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> cctx(ZSTD_createCCtx(),
+                                                                           &ZSTD_freeCCtx);
+    return cctx.get();
+}
+
+ZSTD_DCtx* getThreadLocalDCtx() {
+    thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> dctx(ZSTD_createDCtx(),
+                                                                           &ZSTD_freeDCtx);
+    return dctx.get();
+}
+
+}  // namespace
+
 ZstdMessageCompressor::ZstdMessageCompressor() : MessageCompressorBase(MessageCompressor::kZstd) {}
 
 std::size_t ZstdMessageCompressor::getMaxCompressedSize(size_t inputSize) {
@@ -51,11 +71,12 @@ std::size_t ZstdMessageCompressor::getMaxCompressedSize(size_t inputSize) {
 
 StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input,
                                                             DataRange output) {
-    size_t ret = ZSTD_compress(const_cast<char*>(output.data()),
-                               output.length(),
-                               input.data(),
-                               input.length(),
-                               ZSTD_CLEVEL_DEFAULT);
+    size_t ret = ZSTD_compressCCtx(getThreadLocalCCtx(),
+                                   const_cast<char*>(output.data()),
+                                   output.length(),
+                                   input.data(),
+                                   input.length(),
+                                   gZstdNetworkCompressionLevel);
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
@@ -67,8 +88,11 @@ StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input
 
 StatusWith<std::size_t> ZstdMessageCompressor::decompressData(ConstDataRange input,
                                                               DataRange output) {
-    size_t ret = ZSTD_decompress(
-        const_cast<char*>(output.data()), output.length(), input.data(), input.length());
+    size_t ret = ZSTD_decompressDCtx(getThreadLocalDCtx(),
+                                     const_cast<char*>(output.data()),
+                                     output.length(),
+                                     input.data(),
+                                     input.length());
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
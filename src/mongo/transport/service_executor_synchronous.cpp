@@ -40,6 +40,7 @@
 #include "mongo/logv2/log_component.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/condition_variable.h"
+#include "mongo/transport/service_executor_gen.h"
 #include "mongo/transport/service_executor_utils.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/decorable.h"
@@ -62,6 +63,14 @@ private:
             return _p->_threads;
         }
 
+        size_t idleThreads() const {
+            return _p->_idleThreads;
+        }
+
+        void wakeIdleThreads() {
+            _p->_workAvailable.notify_all();
+        }
+
         bool waitForDrain(Milliseconds dur) {
             return _p->_cv.wait_for(_lk, dur.toSystemDuration(), [&] { return !_p->_threads; });
         }
@@ -100,11 +109,28 @@ public:
 private:
     class WorkerThreadInfo;
 
+    /**
+     * Runs the worker's task queue to completion. Then, unless the keep-alive is disabled, parks
+     * the thread so that it can pick up the initial task of another session instead of exiting,
+     * sparing that session a thread launch. Returns when the keep-alive expires without work
+     * arriving, or at shutdown.
+     */
+    void runWorker(WorkerThreadInfo& worker);
+
     const RunTaskInline _runTaskInline;
     mutable stdx::mutex _mutex;  // NOLINT
     stdx::condition_variable _cv;
     AtomicWord<bool> _isRunning;
     size_t _threads = 0;
+
+    /** Parked worker threads waiting for a task hand-off. Guarded by `_mutex`. */
+    size_t _idleThreads = 0;
+
+    /** Initial tasks awaiting pickup by a parked worker thread. Guarded by `_mutex`. */
+    std::deque<Task> _pendingTasks;
+
+    /** Signaled when a task is added to `_pendingTasks` and at shutdown. */
+    stdx::condition_variable _workAvailable;
 };
 
 class ServiceExecutorSyncImpl::SharedState::WorkerThreadInfo {
@@ -123,6 +149,36 @@ public:
     std::deque<Task> queue;
 };
 
+void ServiceExecutorSyncImpl::SharedState::runWorker(WorkerThreadInfo& worker) {
+    worker.run();
+    if (_runTaskInline == RunTaskInline{true}) {
+        // Tasks run on the caller's thread, which must not be parked here.
+        return;
+    }
+
+    while (isRunning()) {
+        stdx::unique_lock<stdx::mutex> lk(_mutex);  // NOLINT
+        auto keepAlive = Seconds{synchronousServiceExecutorIdleThreadKeepAliveSecs.load()};
+        if (keepAlive <= Seconds{0})
+            return;
+
+        ++_idleThreads;
+        bool haveWork = _workAvailable.wait_for(lk, keepAlive.toSystemDuration(), [&] {
+            return !isRunning() || !_pendingTasks.empty();
+        });
+        --_idleThreads;
+
+        if (!isRunning() || !haveWork || _pendingTasks.empty())
+            return;
+
+        worker.queue.push_back(std::move(_pendingTasks.front()));
+        _pendingTasks.pop_front();
+        lk.unlock();
+
+        worker.run();
+    }
+}
+
 void ServiceExecutorSyncImpl::SharedState::schedule(Task task, StringData name) {
     using namespace fmt::literals;
     if (!isRunning()) {
@@ -137,6 +193,18 @@ void ServiceExecutorSyncImpl::SharedState::schedule(Task task, StringData name)
         return;
     }
 
+    if (_runTaskInline == RunTaskInline{false}) {
+        // Hand the task off to a parked worker thread if one is available, sparing the cost of
+        // launching a thread. Each parked worker consumes at most one pending task before either
+        // parking again or exiting, so only hand off as many tasks as there are parked workers.
+        stdx::lock_guard<stdx::mutex> lk(_mutex);  // NOLINT
+        if (_idleThreads > _pendingTasks.size()) {
+            _pendingTasks.push_back(std::move(task));
+            _workAvailable.notify_one();
+            return;
+        }
+    }
+
     auto workerInfo = std::make_unique<WorkerThreadInfo>(shared_from_this());
     workerInfo->queue.push_back(std::move(task));
 
@@ -151,7 +219,7 @@ void ServiceExecutorSyncImpl::SharedState::schedule(Task task, StringData name)
             workerThreadInfoTls = nullptr;
         };
 
-        w->run();
+        w->sharedState->runWorker(*w);
     };
 
     if (_runTaskInline == RunTaskInline{true}) {
@@ -180,6 +248,7 @@ Status ServiceExecutorSyncImpl::shutdown(Milliseconds timeout) {
     LOGV2_DEBUG(22982, 3, "Shutting down passthrough executor");
     auto stopLock = _sharedState->lock();
     _sharedState->setIsRunning(false);
+    stopLock.wakeIdleThreads();
     if (!stopLock.waitForDrain(timeout))
         return Status(ErrorCodes::Error::ExceededTimeLimit,
                       "passthrough executor couldn't shutdown "
@@ -191,13 +260,27 @@ size_t ServiceExecutorSyncImpl::getRunningThreads() const {
     return _sharedState->lock().threads();
 }
 
+size_t ServiceExecutorSyncImpl::getIdleThreads() const {
+    return _sharedState->lock().idleThreads();
+}
+
 void ServiceExecutorSyncImpl::appendStats(BSONObjBuilder* bob) const {
-    // Has one client per thread and waits synchronously on that thread.
-    int threads = getRunningThreads();
+    // Has one client per thread and waits synchronously on that thread, except for parked worker
+    // threads, which have no client until a new session's task is handed to them.
+    struct Statlet {
+        int threads;
+        int idle;
+    };
+
+    auto statlet = [&] {
+        auto lk = _sharedState->lock();
+        return Statlet{static_cast<int>(lk.threads()), static_cast<int>(lk.idleThreads())};
+    }();
+
     BSONObjBuilder{bob->subobjStart(_statsFieldName)}
-        .append("threadsRunning", threads)
-        .append("clientsInTotal", threads)
-        .append("clientsRunning", threads)
+        .append("threadsRunning", statlet.threads)
+        .append("clientsInTotal", statlet.threads - statlet.idle)
+        .append("clientsRunning", statlet.threads - statlet.idle)
         .append("clientsWaitingForData", 0);
 }
 
@@ -70,6 +70,9 @@ public:
 
     size_t getRunningThreads() const override;
 
+    /** Returns the number of parked worker threads awaiting a task hand-off. */
+    size_t getIdleThreads() const;
+
     void appendStats(BSONObjBuilder* bob) const override;
 
     StringData getName() const override {
@@ -90,9 +93,11 @@ private:
 }  // namespace service_executor_synchronous_detail
 
 /**
- * Creates a fresh worker thread for each top-level scheduled task. Any tasks
- * scheduled during the execution of that top-level task as it runs on such a
- * worker thread are pushed to the queue of that worker thread.
+ * Runs each top-level scheduled task on a dedicated worker thread, reusing a
+ * parked worker thread if one is available and creating a fresh one otherwise
+ * (see synchronousServiceExecutorIdleThreadKeepAliveSecs). Any tasks scheduled
+ * during the execution of that top-level task as it runs on such a worker
+ * thread are pushed to the queue of that worker thread.
  *
  * Thus, the top-level task is expected to represent a chain of operations, each
  * of which schedules its successor before returning. The entire chain of
@@ -50,6 +50,7 @@
 #include "mongo/base/status.h"
 #include "mongo/base/string_data.h"
 #include "mongo/db/service_context.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
@@ -312,9 +313,42 @@ void doTestTaskPostQueueing(ServiceExecutor* executor) {
 }
 
 TEST_F(ServiceExecutorSynchronousTest, TaskPostQueueing) {
+    // Disable the idle thread keep-alive so that the worker thread exits once its queue drains,
+    // as this test's wait for the running thread count to reach zero requires.
+    RAIIServerParameterControllerForTest keepAlive{
+        "synchronousServiceExecutorIdleThreadKeepAliveSecs", 0};
     doTestTaskPostQueueing(&executor);
 }
 
+// A worker thread whose task queue has drained parks itself for the keep-alive period and picks
+// up the initial task of the next session instead of a new thread being launched for it.
+TEST_F(ServiceExecutorSynchronousTest, ReusesIdleWorkerThread) {
+    RAIIServerParameterControllerForTest keepAlive{
+        "synchronousServiceExecutorIdleThreadKeepAliveSecs", 3600};
+    executor.start();
+    auto runner = executor.makeTaskRunner();
+
+    PromiseAndFuture<void> first;
+    runner->schedule([&](Status st) { first.promise.setFrom(st); });
+    ASSERT_DOES_NOT_THROW(first.future.get());
+
+    // Wait for the worker thread to finish the first task queue and park itself.
+    auto endWait = Date_t::now() + Seconds{10};
+    while (executor.getIdleThreads() == 0) {
+        sleepFor(Milliseconds{10});
+        ASSERT_LT(Date_t::now(), endWait);
+    }
+
+    PromiseAndFuture<void> second;
+    runner->schedule([&](Status st) { second.promise.setFrom(st); });
+    ASSERT_DOES_NOT_THROW(second.future.get());
+
+    // The parked worker took the second task, so no further thread was launched.
+    ASSERT_EQ(executor.getRunningThreads(), 1);
+
+    ASSERT_OK(executor.shutdown(kShutdownTime));
+}
+
 TEST_F(ServiceExecutorInlineTest, TaskPostQueueing) {
     doTestTaskPostQueueing(&executor);
 }
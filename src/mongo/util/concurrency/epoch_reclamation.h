@@ -0,0 +1,282 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "mongo/platform/atomic.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/static_immortal.h"
+
+namespace mongo {
+
+/**
+ * Note: This is a generic utility with no dependency on `ServiceContext` or other core types, so
+ * it sits in a separate header alongside the other lock-free building blocks in this directory.
+ * It is optimized for publishing immutable snapshots of the collection catalog, but is suitable
+ * for any value that is read very frequently and replaced rarely (e.g. read-through caches).
+ *
+ * Publishes immutable versions of a value to concurrent readers with epoch-based deferred
+ * reclamation. Readers enter a read-side critical section through `read()`, which costs a couple
+ * of writes to the calling thread's own cache-line-aligned registration record: no mutex, no
+ * reference count, and no cache line shared with readers on other cores. Writers publish a new
+ * version with `store()` (or `compareAndSet()`) and retire the previous one; a retired version is
+ * destroyed only once every registered reader is either outside any critical section or entered
+ * one after the retirement, so the raw pointer observed through a `ReadGuard` remains valid for
+ * the guard's entire lifetime.
+ *
+ * `ReadGuard`s are meant for short critical sections (a lookup, not the lifetime of an
+ * operation); a live guard on any thread pins every version retired after it was created.
+ * Callers that need to hold a version across blocking or long-running work must take a
+ * reference-counted copy with `loadShared()` instead, which costs one uncontended atomic
+ * increment on top of the guard.
+ *
+ * Writers serialize on an internal mutex and bear the full cost of scanning reader records and
+ * destroying retired versions; readers never block and never reclaim.
+ *
+ * Design details: every version lives in a node of an internal list, and `_current` points at the
+ * newest node. Each reader thread lazily registers a record holding the epoch at which its
+ * outermost critical section began (or `kIdle`). A reader publishes the current epoch to its
+ * record with sequential consistency before loading `_current`, so a writer that retires a
+ * version at epoch `e` and then observes a record that is idle or at an epoch >= `e` knows that
+ * record can no longer be referencing the retired version. Records are shared by all instances
+ * with the same value type; this only ever delays reclamation, never allows it prematurely.
+ */
+template <typename T>
+class EpochVersioned {
+    struct Version;
+    struct ReaderRecord;
+
+public:
+    /**
+     * Pins the version that was current at construction and exposes it as a raw pointer. Cheap
+     * to create and destroy, but delays reclamation of every subsequently retired version while
+     * alive. Guards may nest freely on a thread; holding one across a `store()` on the same
+     * thread is also safe, since writers never wait for readers.
+     */
+    class ReadGuard {
+    public:
+        explicit ReadGuard(const EpochVersioned* domain) : _record(localRecord()) {
+            if (_record->nesting++ == 0) {
+                // Publishing the epoch must not be reordered after the load of `_current`: both
+                // operations are sequentially consistent, so a writer that retires a version and
+                // then finds this record idle (or past the retirement epoch) can be certain the
+                // retired version is unreachable from here.
+                _record->epoch.store(globalEpoch().load());
+            }
+            _version = domain->_current.load();
+        }
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        ~ReadGuard() {
+            if (--_record->nesting == 0) {
+                _record->epoch.store(kIdle);
+            }
+        }
+
+        const T* get() const {
+            return _version->value.get();
+        }
+
+        const T* operator->() const {
+            return get();
+        }
+
+        const T& operator*() const {
+            return *get();
+        }
+
+        explicit operator bool() const {
+            return get() != nullptr;
+        }
+
+    private:
+        friend class EpochVersioned;
+
+        ReaderRecord* const _record;
+        const Version* _version;
+    };
+
+    /**
+     * The published value starts out as `initial`, which may be empty.
+     */
+    explicit EpochVersioned(std::shared_ptr<T> initial = nullptr) {
+        _current.store(&_versions.emplace_back(Version{std::move(initial)}));
+    }
+
+    EpochVersioned(const EpochVersioned&) = delete;
+    EpochVersioned& operator=(const EpochVersioned&) = delete;
+
+    /**
+     * The caller must guarantee no concurrent readers or writers at destruction, as with any
+     * other type.
+     */
+    ~EpochVersioned() = default;
+
+    /**
+     * Pins and returns the current version without touching any shared cache line.
+     */
+    ReadGuard read() const {
+        return ReadGuard(this);
+    }
+
+    /**
+     * Returns a reference-counted copy of the current version, for callers that outlive the
+     * scope of a `ReadGuard`. Never blocks behind writers.
+     */
+    std::shared_ptr<T> loadShared() const {
+        ReadGuard guard(this);
+        return guard._version->value;
+    }
+
+    /**
+     * Publishes `next` as the current version and retires the previous one, destroying any
+     * retired versions that no reader can still observe. Does not wait for readers.
+     */
+    void store(std::shared_ptr<T> next) {
+        stdx::lock_guard lk(_writeMutex);
+        _publish(lk, std::move(next));
+    }
+
+    /**
+     * Publishes `next` only if `expected` is still the current version, as established by
+     * `loadShared()`. Returns whether the exchange happened.
+     */
+    bool compareAndSet(const std::shared_ptr<T>& expected, std::shared_ptr<T> next) {
+        stdx::lock_guard lk(_writeMutex);
+        if (_current.load()->value != expected) {
+            return false;
+        }
+        _publish(lk, std::move(next));
+        return true;
+    }
+
+private:
+    static constexpr uint64_t kIdle = 0;
+
+    struct Version {
+        std::shared_ptr<T> value;
+
+        // Zero while current; set to the epoch at which the version was replaced. A retired
+        // version may be destroyed once every reader record is idle or at an epoch >= this.
+        uint64_t retireEpoch = 0;
+    };
+
+    // One record per reader thread, on its own cache line so publishing an epoch never contends
+    // with other readers. Records are registered on first use and recycled on thread exit;
+    // `nesting` is only ever touched by the owning thread.
+    struct alignas(64) ReaderRecord {
+        Atomic<uint64_t> epoch{kIdle};
+        int64_t nesting = 0;
+    };
+
+    struct ReaderRegistry {
+        stdx::mutex mutex;
+        std::list<ReaderRecord> records;  // Stable addresses; grows to the peak thread count.
+        std::vector<ReaderRecord*> freeRecords;
+    };
+
+    // Records and the epoch counter are shared by all instances with the same value type, so a
+    // thread needs only one thread-local registration rather than a per-instance lookup.
+    static Atomic<uint64_t>& globalEpoch() {
+        static StaticImmortal<Atomic<uint64_t>> epoch{kIdle + 1};
+        return *epoch;
+    }
+
+    static ReaderRegistry& registry() {
+        static StaticImmortal<ReaderRegistry> registry;
+        return *registry;
+    }
+
+    static ReaderRecord* localRecord() {
+        struct Registration {
+            Registration() {
+                auto& reg = registry();
+                stdx::lock_guard lk(reg.mutex);
+                if (!reg.freeRecords.empty()) {
+                    record = reg.freeRecords.back();
+                    reg.freeRecords.pop_back();
+                } else {
+                    record = &reg.records.emplace_back();
+                }
+            }
+
+            ~Registration() {
+                auto& reg = registry();
+                stdx::lock_guard lk(reg.mutex);
+                reg.freeRecords.push_back(record);
+            }
+
+            ReaderRecord* record;
+        };
+        thread_local Registration registration;
+        return registration.record;
+    }
+
+    void _publish(WithLock, std::shared_ptr<T> next) {
+        auto previous = _current.load();
+        _current.store(&_versions.emplace_back(Version{std::move(next)}));
+        previous->retireEpoch = globalEpoch().addAndFetch(1);
+        _reclaim();
+    }
+
+    void _reclaim() {
+        // A retired version is unreachable once every record is idle or entered its critical
+        // section at or after the retirement epoch, i.e. once the retirement epoch is no greater
+        // than the oldest active record.
+        auto oldestActive = std::numeric_limits<uint64_t>::max();
+        {
+            auto& reg = registry();
+            stdx::lock_guard lk(reg.mutex);
+            for (auto& record : reg.records) {
+                if (auto epoch = record.epoch.load(); epoch != kIdle) {
+                    oldestActive = std::min(oldestActive, epoch);
+                }
+            }
+        }
+        _versions.remove_if([&](const Version& version) {
+            return version.retireEpoch != kIdle && version.retireEpoch <= oldestActive;
+        });
+    }
+
+    Atomic<Version*> _current;
+    stdx::mutex _writeMutex;  // Serializes writers; guards `_versions`.
+    std::list<Version> _versions;
+};
+
+}  // namespace mongo
@@ -0,0 +1,185 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "mongo/util/concurrency/epoch_reclamation.h"
+
+#include "mongo/platform/atomic.h"
+#include "mongo/unittest/join_thread.h"
+#include "mongo/unittest/thread_assertion_monitor.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * A payload that tracks how many instances are alive, so tests can observe exactly when retired
+ * versions are reclaimed.
+ */
+struct Tracked {
+    Tracked(int value, Atomic<int>* alive) : value(value), alive(alive) {
+        alive->fetchAndAdd(1);
+    }
+
+    ~Tracked() {
+        alive->fetchAndAdd(-1);
+    }
+
+    int value;
+    Atomic<int>* alive;
+};
+
+class EpochVersionedTest : public unittest::Test {
+public:
+    void setUp() override {
+        _versioned =
+            std::make_unique<EpochVersioned<Tracked>>(std::make_shared<Tracked>(0, &_alive));
+    }
+
+    void tearDown() override {
+        _versioned = {};
+        ASSERT_EQ(alive(), 0);
+    }
+
+    EpochVersioned<Tracked>& versioned() {
+        return *_versioned;
+    }
+
+    std::shared_ptr<Tracked> makeVersion(int value) {
+        return std::make_shared<Tracked>(value, &_alive);
+    }
+
+    int alive() const {
+        return _alive.load();
+    }
+
+private:
+    Atomic<int> _alive;
+    std::unique_ptr<EpochVersioned<Tracked>> _versioned;
+};
+
+TEST_F(EpochVersionedTest, ReadObservesInitialValue) {
+    auto guard = versioned().read();
+    ASSERT_TRUE(!!guard);
+    ASSERT_EQ(guard->value, 0);
+    ASSERT_EQ((*guard).value, 0);
+}
+
+TEST_F(EpochVersionedTest, LoadSharedOutlivesReplacement) {
+    auto shared = versioned().loadShared();
+    versioned().store(makeVersion(1));
+    ASSERT_EQ(shared->value, 0);
+    ASSERT_EQ(versioned().read()->value, 1);
+}
+
+TEST_F(EpochVersionedTest, GuardPinsRetiredVersion) {
+    auto guard = versioned().read();
+    versioned().store(makeVersion(1));
+
+    // The old version must stay alive while the guard exists, even though a fresh read already
+    // observes the replacement.
+    ASSERT_EQ(guard->value, 0);
+    ASSERT_EQ(versioned().read()->value, 1);
+    ASSERT_EQ(alive(), 2);
+}
+
+TEST_F(EpochVersionedTest, RetiredVersionReclaimedOnceUnpinned) {
+    // With no guards or shared references outstanding, each store reclaims the version it
+    // retires during publication.
+    versioned().store(makeVersion(1));
+    ASSERT_EQ(alive(), 1);
+
+    {
+        auto guard = versioned().read();
+        versioned().store(makeVersion(2));
+        ASSERT_EQ(alive(), 2);
+    }
+    versioned().store(makeVersion(3));
+    ASSERT_EQ(alive(), 1);
+}
+
+TEST_F(EpochVersionedTest, NestedGuardsObserveTheirOwnVersions) {
+    auto outer = versioned().read();
+    versioned().store(makeVersion(1));
+    {
+        auto inner = versioned().read();
+        ASSERT_EQ(inner->value, 1);
+        ASSERT_EQ(outer->value, 0);
+    }
+    ASSERT_EQ(outer->value, 0);
+}
+
+TEST_F(EpochVersionedTest, CompareAndSetOnlyReplacesCurrent) {
+    auto current = versioned().loadShared();
+    auto stale = makeVersion(99);
+
+    ASSERT_FALSE(versioned().compareAndSet(stale, makeVersion(1)));
+    ASSERT_EQ(versioned().read()->value, 0);
+
+    ASSERT_TRUE(versioned().compareAndSet(current, makeVersion(1)));
+    ASSERT_EQ(versioned().read()->value, 1);
+}
+
+TEST_F(EpochVersionedTest, ConcurrentReadersNeverObserveReclaimedVersions) {
+    constexpr int kReaders = 4;
+    constexpr int kVersions = 1000;
+
+    Atomic<bool> done;
+    unittest::ThreadAssertionMonitor monitor;
+    std::vector<unittest::JoinThread> readers;
+    for (int i = 0; i < kReaders; ++i) {
+        readers.emplace_back(monitor.spawn([&] {
+            int last = 0;
+            while (!done.load()) {
+                auto guard = versioned().read();
+                auto value = guard->value;
+                // Values are published in increasing order, and a guard keeps its version's
+                // payload valid, so every observation must be at least the previous one.
+                ASSERT_GTE(value, last);
+                last = value;
+            }
+        }));
+    }
+
+    for (int i = 1; i <= kVersions; ++i) {
+        versioned().store(makeVersion(i));
+    }
+    done.store(true);
+    monitor.notifyDone();
+    readers.clear();
+
+    // With all readers retired, one more store reclaims everything but itself.
+    versioned().store(makeVersion(kVersions + 1));
+    ASSERT_EQ(alive(), 1);
+}
+
+}  // namespace
+}  // namespace mongo
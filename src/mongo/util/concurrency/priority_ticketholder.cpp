@@ -65,6 +65,11 @@ int64_t PriorityTicketHolder::numFinishedProcessing() const {
         _stats[_enumToInt(QueueType::kNormalPriority)].totalFinishedProcessing.load();
 }
 
+int64_t PriorityTicketHolder::timeQueuedMicros() const {
+    return _stats[_enumToInt(QueueType::kLowPriority)].totalTimeQueuedMicros.load() +
+        _stats[_enumToInt(QueueType::kNormalPriority)].totalTimeQueuedMicros.load();
+}
+
 int64_t PriorityTicketHolder::expedited() const {
     return _pool.getQueue().expedited();
 }
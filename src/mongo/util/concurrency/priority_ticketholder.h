@@ -72,6 +72,8 @@ public:
 
     int64_t numFinishedProcessing() const final;
 
+    int64_t timeQueuedMicros() const final;
+
     std::int64_t expedited() const;
 
     std::int64_t bypassed() const;
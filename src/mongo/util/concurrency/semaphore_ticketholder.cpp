@@ -39,6 +39,10 @@ int64_t SemaphoreTicketHolder::numFinishedProcessing() const {
     return _semaphoreStats.totalFinishedProcessing.load();
 }
 
+int64_t SemaphoreTicketHolder::timeQueuedMicros() const {
+    return _semaphoreStats.totalTimeQueuedMicros.load();
+}
+
 void SemaphoreTicketHolder::_appendImplStats(BSONObjBuilder& b) const {
     {
         BSONObjBuilder bb(b.subobjStart("normalPriority"));
@@ -58,6 +58,8 @@ public:
 
     int64_t numFinishedProcessing() const final;
 
+    int64_t timeQueuedMicros() const final;
+
 private:
     boost::optional<Ticket> _waitForTicketUntilImpl(OperationContext* opCtx,
                                                     AdmissionContext* admCtx,
@@ -140,6 +140,11 @@ public:
      */
     virtual int64_t numFinishedProcessing() const = 0;
 
+    /**
+     * The total number of microseconds operations have spent queued waiting for a ticket.
+     */
+    virtual int64_t timeQueuedMicros() const = 0;
+
     /**
      * Statistics for queueing mechanisms in the TicketHolder implementations. The term "Queue" is a
      * loose abstraction for the way in which operations are queued when there are no available
@@ -251,6 +256,14 @@ public:
         _numFinishedProcessing = numFinishedProcessing;
     }
 
+    int64_t timeQueuedMicros() const override {
+        return _timeQueuedMicros;
+    }
+
+    void setTimeQueuedMicros(int64_t timeQueuedMicros) {
+        _timeQueuedMicros = timeQueuedMicros;
+    }
+
 private:
     void _releaseToTicketPoolImpl(AdmissionContext* admCtx) noexcept override;
 
@@ -268,6 +281,7 @@ private:
     QueueStats _stats;
     int32_t _available = 0;
     int32_t _numFinishedProcessing = 0;
+    int64_t _timeQueuedMicros = 0;
 };
 
 /**
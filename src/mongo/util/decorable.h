@@ -63,9 +63,11 @@
 #include <algorithm>
 #include <boost/optional.hpp>
 #include <cstdint>
+#include <deque>
 #include <fmt/format.h>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <sstream>
 #include <type_traits>
@@ -76,10 +78,42 @@
 #include "mongo/util/assert_util.h"
 #include "mongo/util/static_immortal.h"
 
+#ifdef MONGO_DECORABLE_ACCESS_COUNTS
+#include "mongo/platform/atomic.h"
+#endif
+
 namespace mongo {
 
+/**
+ * A layout hint for `declareDecoration`. Decorations are normally laid out in registration
+ * order, which scatters frequently accessed decorations across cache lines together with ones
+ * that are touched once per object, if at all. Subsystems that know better may say so:
+ *
+ *     auto deco = Client::declareDecoration<HotThing>(DecorationAccess::kHot);
+ *
+ * Hints only affect layout; they never change semantics, so a wrong hint costs performance, not
+ * correctness. Build with MONGO_DECORABLE_ACCESS_COUNTS defined and call
+ * `reportDecorationAccessCounts<D>(os)` to classify decorations empirically.
+ */
+enum class DecorationAccess {
+    /** Laid out in registration order, after the hot decorations. */
+    kDefault,
+
+    /** Accessed on per-operation fast paths: packed into the leading cache lines. */
+    kHot,
+
+    /**
+     * Written concurrently from multiple threads (e.g. counters): placed on an exclusively
+     * owned cache line at the end of the block, so its invalidation traffic cannot drag
+     * neighboring decorations along.
+     */
+    kContended,
+};
+
 namespace decorable_detail {
 
+constexpr inline std::size_t kCacheLineBytes = 64;
+
 template <typename T>
 constexpr inline bool pretendTrivialInit = false;
 template <typename T>
@@ -149,24 +183,62 @@ class Registry {
 public:
     struct Entry {
         const std::type_info* typeInfo;
-        ptrdiff_t offset;
+        ptrdiff_t offset;  // Provisionally -1 until `finalize()` runs the layout pass.
         const LifecycleOperations* ops;
         size_t size;
         size_t align;
+        DecorationAccess access;
     };
 
     /** Return registry position of new entry. */
     template <typename T>
-    size_t declare(const LifecycleOperations* ops) {
+    size_t declare(const LifecycleOperations* ops, DecorationAccess access) {
         static constexpr auto al = alignof(T);
         static constexpr auto sz = sizeof(T);
-        ptrdiff_t offset = (_bufferSize + al - 1) / al * al;  // pad to alignment
-        _entries.push_back({&typeid(T), offset, ops, sz, al});
-        _bufferSize = offset + sz;
-        _bufferAlignment = std::max(_bufferAlignment, al);
+        invariant(!_finalized, "Decorations must be declared before any instances are created");
+        _entries.push_back({&typeid(T), -1, ops, sz, al, access});
+#ifdef MONGO_DECORABLE_ACCESS_COUNTS
+        _accessCounts.emplace_back();
+#endif
         return _entries.size() - 1;
     }
 
+    /**
+     * Runs the layout pass, assigning each entry its final offset: hot decorations pack into
+     * the leading cache lines, then the rest in registration order, then contended decorations
+     * each on an exclusively owned line at the end. Called before the first buffer is
+     * allocated; declarations afterwards are rejected.
+     */
+    void finalize() {
+        std::call_once(_finalizeOnce, [&] {
+            size_t size = sizeof(void*);  // The owner backlink is always present.
+            size_t alignment = 1;
+            auto place = [&](Entry& e) {
+                e.offset = (size + e.align - 1) / e.align * e.align;  // pad to alignment
+                size = e.offset + e.size;
+                alignment = std::max(alignment, e.align);
+            };
+            for (auto& e : _entries)
+                if (e.access == DecorationAccess::kHot)
+                    place(e);
+            for (auto& e : _entries)
+                if (e.access == DecorationAccess::kDefault)
+                    place(e);
+            for (auto& e : _entries)
+                if (e.access == DecorationAccess::kContended) {
+                    auto lineAlign = std::max(e.align, kCacheLineBytes);
+                    e.offset = (size + lineAlign - 1) / lineAlign * lineAlign;
+                    // Pad to the end of the line so no other decoration shares it.
+                    size = e.offset +
+                        (e.size + kCacheLineBytes - 1) / kCacheLineBytes * kCacheLineBytes;
+                    alignment = std::max(alignment, lineAlign);
+                }
+            _bufferSize = size;
+            _bufferAlignment = alignment;
+            _finalized = true;
+        });
+    }
+
     size_t bufferSize() const {
         return _bufferSize;
     }
@@ -189,8 +261,26 @@ public:
         return _entries[i];
     }
 
+#ifdef MONGO_DECORABLE_ACCESS_COUNTS
+    void countAccess(size_t i) const {
+        _accessCounts[i].fetchAndAddRelaxed(1);
+    }
+
+    void reportAccessCounts(std::ostream& os) const {
+        for (size_t i = 0; i != _entries.size(); ++i)
+            os << _entries[i].typeInfo->name() << " " << _accessCounts[i].load() << "\n";
+    }
+#endif
+
 private:
-    std::vector<Entry> _entries;
+    // Deque for address stability: tokens hold pointers to their entries, which learn their
+    // final offsets from the layout pass after all tokens have been handed out.
+    std::deque<Entry> _entries;
+#ifdef MONGO_DECORABLE_ACCESS_COUNTS
+    mutable std::deque<Atomic<uint64_t>> _accessCounts;
+#endif
+    std::once_flag _finalizeOnce;
+    bool _finalized = false;
     size_t _bufferSize = sizeof(void*);  // The owner pointer is always present.
     size_t _bufferAlignment = 1;
 };
@@ -241,7 +331,7 @@ public:
     const DecoratedType& owner(const DecorationType& t) const {
         // The decoration block starts with a backlink to the decorable.
         const void* p = &t;
-        const void* block = static_cast<const char*>(p) - _offset;
+        const void* block = static_cast<const char*>(p) - offsetInBlock();
         return *DecoratedType::downcastBackLink(*reinterpret_cast<const void* const*>(block));
     }
     DecoratedType& owner(DecorationType& t) const {
@@ -276,12 +366,23 @@ public:
     }
 
     ptrdiff_t offsetInBlock() const {
-        return _offset;
+        // The layout pass has necessarily run by the time any decorated instance exists.
+        dassert(_entry->offset >= 0);
+        return _entry->offset;
+    }
+
+    void countAccess() const {
+#ifdef MONGO_DECORABLE_ACCESS_COUNTS
+        decorable_detail::getRegistry<DecoratedType>().countAccess(_registryPosition);
+#endif
     }
 
 private:
     size_t _registryPosition;
-    ptrdiff_t _offset = decorable_detail::getRegistry<DecoratedType>()[_registryPosition].offset;
+    // Offsets are assigned by the registry's layout pass after all declarations, so the token
+    // points at its entry rather than caching the (not yet final) offset.
+    const Registry::Entry* _entry =
+        &decorable_detail::getRegistry<DecoratedType>()[_registryPosition];
 };
 
 template <typename D>
@@ -290,12 +391,12 @@ public:
     using DecoratedType = D;
 
     template <typename T>
-    static DecorationToken<DecoratedType, T> declareDecoration() {
+    static DecorationToken<DecoratedType, T> declareDecoration(DecorationAccess access) {
         // If DecoratedType has either of the copy operations, then T needs them both.
         static constexpr bool needCopy =
             std::is_copy_constructible_v<DecoratedType> || std::is_copy_assignable_v<DecoratedType>;
         return DecorationToken<DecoratedType, T>{
-            _reg().template declare<T>(&lifecycleOperations<T, needCopy>)};
+            _reg().template declare<T>(&lifecycleOperations<T, needCopy>, access)};
     }
 
     template <typename DecoratedBase>
@@ -350,6 +451,8 @@ public:
 private:
     struct AlignedDeleter {
         void operator()(unsigned char* ptr) const {
+            if (_bufferCache().tryPush(ptr))
+                return;
             ::operator delete(ptr, size, alignment);
         }
 
@@ -359,6 +462,50 @@ private:
 
     using OwningPointer = std::unique_ptr<unsigned char, AlignedDeleter>;
 
+    /**
+     * A small per-thread cache of retired decoration blocks. Short-lived decorables
+     * (OperationContext above all) allocate one block per instance, and once the layout pass has
+     * run the block size for a decorated type never changes, so any retired block can satisfy
+     * any later construction. Blocks are typically retired on the thread that allocated them, so
+     * a thread-local cache recycles them without synchronization or a trip through the global
+     * allocator. Reused blocks are zeroed exactly as fresh allocations are.
+     *
+     * The cache is deliberately trivially destructible so the thread_local instance is never
+     * torn down: decoration blocks can be freed arbitrarily late in thread exit (e.g. the
+     * Client held in a constant-initialized thread_local, destroyed after every
+     * dynamically-initialized thread_local), and pushing into a destroyed cache would be
+     * undefined behavior. The price is that up to kMaxEntries blocks die with the thread.
+     */
+    class BufferCache {
+    public:
+        static constexpr size_t kMaxEntries = 4;
+
+        unsigned char* tryPop() {
+            if (!_count)
+                return nullptr;
+            return _entries[--_count];
+        }
+
+        bool tryPush(unsigned char* ptr) {
+            if (_count == kMaxEntries)
+                return false;
+            _entries[_count++] = ptr;
+            return true;
+        }
+
+    private:
+        unsigned char* _entries[kMaxEntries] = {};
+        size_t _count = 0;
+    };
+
+    static BufferCache& _bufferCache() {
+        // Constant-initialized and, per the static_assert, never registered for destruction, so
+        // this remains valid through every phase of thread exit. See the BufferCache comment.
+        static_assert(std::is_trivially_destructible_v<BufferCache>);
+        static thread_local BufferCache cache;
+        return cache;
+    }
+
     static Registry& _reg() {
         return getRegistry<DecoratedType>();
     }
@@ -396,10 +543,14 @@ private:
 
     OwningPointer _makeData() {
         auto& reg = _reg();
+        reg.finalize();
         auto alignment = reg.bufferAlignment();
         auto sz = reg.bufferSize();
-        auto rawBuffer =
-            static_cast<unsigned char*>(::operator new(sz, std::align_val_t(alignment)));
+        auto rawBuffer = _bufferCache().tryPop();
+        if (!rawBuffer) {
+            rawBuffer =
+                static_cast<unsigned char*>(::operator new(sz, std::align_val_t(alignment)));
+        }
         std::memset(rawBuffer, 0, sz);
         return OwningPointer{rawBuffer, AlignedDeleter{sz, std::align_val_t{alignment}}};
     }
@@ -427,9 +578,10 @@ public:
     }
 
     template <typename T>
-    static Decoration<T> declareDecoration() {
+    static Decoration<T> declareDecoration(DecorationAccess access = DecorationAccess::kDefault) {
         static_assert(std::is_nothrow_destructible_v<T>);
-        return decorable_detail::DecorationBuffer<DerivedType>::template declareDecoration<T>();
+        return decorable_detail::DecorationBuffer<DerivedType>::template declareDecoration<T>(
+            access);
     }
 
     Decorable() : _decorations{this} {}
@@ -447,6 +599,7 @@ public:
 
     template <typename T>
     const T& decoration(const Decoration<T>& deco) const {
+        deco.countAccess();
         return *static_cast<const T*>(_decorations.getAtOffset(deco.offsetInBlock()));
     }
     template <typename T>
@@ -486,4 +639,15 @@ private:
     decorable_detail::DecorationBuffer<DerivedType> _decorations;
 };
 
+#ifdef MONGO_DECORABLE_ACCESS_COUNTS
+/**
+ * Writes one line per decoration of `D` — mangled decoration type name and access count — to
+ * `os`, so decorations can be classified empirically before assigning `DecorationAccess` hints.
+ */
+template <typename D>
+void reportDecorationAccessCounts(std::ostream& os) {
+    decorable_detail::getRegistry<D>().reportAccessCounts(os);
+}
+#endif
+
 }  // namespace mongo
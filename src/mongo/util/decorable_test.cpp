@@ -33,6 +33,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "mongo/base/error_codes.h"
 #include "mongo/base/string_data.h"
@@ -183,6 +184,39 @@ TEST_F(DecorableTest, ExtendedAlignment) {
     ASSERT_EQ(reinterpret_cast<uintptr_t>(&x[bigBoys].boys[1]) % overAlignedRequirement, 0);
 }
 
+TEST_F(DecorableTest, HotDecorationsPackedFirst) {
+    struct X : Decorable<X> {};
+    static auto cold = X::declareDecoration<int>();
+    static auto hot = X::declareDecoration<int>(DecorationAccess::kHot);
+
+    X x;
+    // Hot decorations lead the block regardless of registration order, right after the owner
+    // backlink.
+    ASSERT_EQ(hot.offsetInBlock(), static_cast<ptrdiff_t>(sizeof(void*)));
+    ASSERT_GT(cold.offsetInBlock(), hot.offsetInBlock());
+    x[hot] = 123;
+    ASSERT_EQ(x[hot], 123);
+    ASSERT_EQ(&hot.owner(x[hot]), &x);
+}
+
+TEST_F(DecorableTest, ContendedDecorationsGetOwnCacheLine) {
+    struct X : Decorable<X> {};
+    static auto contended = X::declareDecoration<int>(DecorationAccess::kContended);
+    static auto plain = X::declareDecoration<int>();
+
+    X x;
+    constexpr auto kLine = decorable_detail::kCacheLineBytes;
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(&x[contended]) % kLine, 0);
+    // The contended decoration sits after everything else and shares its line with nothing.
+    ASSERT_GT(contended.offsetInBlock(), plain.offsetInBlock());
+    ASSERT_GTE(static_cast<size_t>(contended.offsetInBlock() - plain.offsetInBlock()),
+               sizeof(int));
+    x[contended] = 1;
+    x[plain] = 2;
+    ASSERT_EQ(x[contended], 1);
+    ASSERT_EQ(x[plain], 2);
+}
+
 TEST_F(DecorableTest, MaplikeAccess) {
     struct X : Decorable<X> {};
     static auto d = X::declareDecoration<int>();
@@ -382,5 +416,26 @@ TEST_F(DecorableZeroInitTest, ZeroInitStdSharedPtrDecoration) {
     doZeroInitTest<std::shared_ptr<A>>();
 }
 
+TEST_F(DecorableTest, RetiredBufferIsReusedOnSameThread) {
+    struct X : Decorable<X> {};
+    static auto decorator = X::declareDecoration<int>();
+
+    // Warm the per-thread cache past its capacity so the next construction must hit it.
+    std::vector<std::unique_ptr<X>> warmers;
+    for (size_t i = 0; i != 8; ++i)
+        warmers.push_back(std::make_unique<X>());
+    warmers.clear();
+
+    auto first = std::make_unique<X>();
+    (*first)[decorator] = 123;
+    const void* firstAddr = &(*first)[decorator];
+    first.reset();
+
+    // The most recently retired block is handed back first, zeroed like a fresh allocation.
+    auto second = std::make_unique<X>();
+    ASSERT_EQ(&(*second)[decorator], firstAddr);
+    ASSERT_EQ((*second)[decorator], 0);
+}
+
 }  // namespace
 }  // namespace mongo
@@ -96,6 +96,8 @@ void spinWait(const Pred& pred) {
 
 }  // namespace
 
+AtomicWord<int> FailPoint::Impl::_numActive{0};
+
 void FailPoint::setThreadPRNGSeed(int32_t seed) {
     threadPrng = PseudoRandom(seed);
 }
@@ -247,11 +247,13 @@ private:
 
     private:
         void _enable() {
-            _fpInfo.fetchAndBitOr(_kActiveBit);
+            if (!(_fpInfo.fetchAndBitOr(_kActiveBit) & _kActiveBit))
+                _numActive.fetchAndAdd(1);
         }
 
         void _disable() {
-            _fpInfo.fetchAndBitAnd(~_kActiveBit);
+            if (_fpInfo.fetchAndBitAnd(~_kActiveBit) & _kActiveBit)
+                _numActive.subtractAndFetch(1);
         }
 
         /** No default parameters. No-Frills shouldFail implementation. */
@@ -293,6 +295,12 @@ private:
          */
         template <typename Pred>
         LockHandle _tryLock(AlreadyCounted alreadyCounted, Pred&& pred) {
+            // Static-key-style global gate: in the overwhelmingly common state where no fail
+            // point in the process is enabled, every call site reads this one read-mostly line
+            // and never touches the per-fail-point state at all.
+            if (MONGO_likely(_numActive.loadRelaxed() == 0))
+                return LockHandle{nullptr, false};  // Fastest path
+
             if (MONGO_likely((_fpInfo.loadRelaxed() & _kActiveBit) == 0))
                 return LockHandle{nullptr, false};  // Fast path
 
@@ -319,6 +327,11 @@ private:
          */
         bool _evaluateByMode();
 
+        // Process-wide count of enabled fail points, maintained by `_enable`/`_disable` (which
+        // are idempotent so the count stays balanced across `setMode`'s unconditional disable
+        // and the nTimes auto-disable).
+        static AtomicWord<int> _numActive;
+
         // Bit layout:
         // 31: tells whether this fail point is active.
         // 0~30: ref counter: # of outstanding LockHandles.
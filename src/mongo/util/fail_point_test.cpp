@@ -110,6 +110,34 @@ TEST(FailPoint, NTimes) {
     }
 }
 
+// Exercises the process-wide enabled-count gate: repeated disables, the nTimes auto-disable,
+// and overlapping enablement of a second fail point must leave the bookkeeping balanced so
+// enabled fail points keep firing.
+TEST(FailPoint, GlobalGateStaysBalanced) {
+    FailPoint failPoint("testFP");
+    FailPoint otherFailPoint("otherTestFP");
+
+    failPoint.setMode(FailPoint::off);  // Disabling an already-off fail point is a no-op.
+    failPoint.setMode(FailPoint::off);
+    ASSERT_FALSE(failPoint.shouldFail());
+
+    failPoint.setMode(FailPoint::nTimes, 1);
+    ASSERT(failPoint.shouldFail());  // Exhausts the count and auto-disables.
+    ASSERT_FALSE(failPoint.shouldFail());
+    failPoint.setMode(FailPoint::off);  // Already auto-disabled.
+
+    otherFailPoint.setMode(FailPoint::alwaysOn);
+    ASSERT_FALSE(failPoint.shouldFail());
+    ASSERT(otherFailPoint.shouldFail());
+
+    failPoint.setMode(FailPoint::alwaysOn);
+    ASSERT(failPoint.shouldFail());
+    otherFailPoint.setMode(FailPoint::off);
+    ASSERT(failPoint.shouldFail());
+    failPoint.setMode(FailPoint::off);
+    ASSERT_FALSE(failPoint.shouldFail());
+}
+
 TEST(FailPoint, BlockOff) {
     FailPoint failPoint("testFP");
     bool called = false;
@@ -0,0 +1,222 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <boost/optional.hpp>
+
+#include "mongo/base/status_with.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/future.h"
+#include "mongo/util/out_of_line_executor.h"
+
+/**
+ * C++20 coroutine support for this library's future types.
+ *
+ * Including this header makes two things work:
+ *
+ *  - `co_await` on a `Future<T>` or `ExecutorFuture<T>`. The awaiting coroutine resumes with
+ *    the future's value, or the future's error rethrown as a `DBException`, exactly as if it
+ *    had called `get()`. A ready future resumes inline without suspending; a pending future
+ *    parks the coroutine handle as the future's continuation, so a chain of `co_await`s in one
+ *    coroutine reuses a single frame where the equivalent `.then()` chain would build a
+ *    continuation node per step.
+ *
+ *  - Writing a coroutine whose return type is `Future<T>`: `co_return` fulfills the future and
+ *    an escaped exception becomes its error Status, via the `std::coroutine_traits`
+ *    specialization below. The coroutine starts eagerly (like calling a `.then()` chain) and
+ *    the frame is freed as soon as the body finishes.
+ *
+ * `resumeOn(executor)` additionally lets a coroutine hop to an executor or Baton mid-body,
+ * replacing `.thenRunOn()` for the portions of transport and async-rpc flows written this way.
+ *
+ * `SemiFuture` is deliberately not awaitable, for the same reason it has no `getAsync()`: the
+ * producer has not authorized running continuations inline on its completing thread. Route a
+ * `SemiFuture` through `thenRunOn()` and await the resulting `ExecutorFuture` instead.
+ */
+
+namespace mongo {
+namespace future_coroutine_details {
+
+/**
+ * Awaiter for `Future<T>` and `ExecutorFuture<T>`, both of which expose the same `isReady()` /
+ * `getAsync()` / `getNoThrow()` surface. Owns the future for the duration of the await.
+ */
+template <typename T, template <typename> class FutureT>
+class FutureAwaiter {
+public:
+    explicit FutureAwaiter(FutureT<T>&& future) : _future(std::move(future)) {}
+
+    bool await_ready() const noexcept {
+        return _future.isReady();
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) noexcept {
+        // After `handle.resume()` the coroutine frame, and this awaiter with it, may already
+        // have been destroyed, so the callback must not touch `this` afterwards. That includes
+        // the inline case where the future becomes ready between `await_ready` and here and
+        // `getAsync` invokes the callback before returning.
+        std::move(_future).getAsync([this, handle](StatusOrStatusWith<T> result) mutable {
+            _result.emplace(std::move(result));
+            handle.resume();
+        });
+    }
+
+    T await_resume() {
+        if (_result)
+            return uassertStatusOK(std::move(*_result));
+        // Did not suspend: the future was already ready, so this does not block.
+        return uassertStatusOK(std::move(_future).getNoThrow());
+    }
+
+private:
+    FutureT<T> _future;
+    boost::optional<StatusOrStatusWith<T>> _result;
+};
+
+/**
+ * promise_type for coroutines declared to return `Future<T>`. The coroutine body runs eagerly
+ * until its first suspension, and the frame is destroyed as soon as the body completes
+ * (`final_suspend` never suspends); the result outlives it in the future's shared state.
+ */
+template <typename T>
+class FutureCoroutinePromise {
+public:
+    Future<T> get_return_object() noexcept {
+        return std::move(_paf.future);
+    }
+
+    std::suspend_never initial_suspend() const noexcept {
+        return {};
+    }
+
+    std::suspend_never final_suspend() const noexcept {
+        return {};
+    }
+
+    template <typename U>
+    void return_value(U&& value) noexcept {
+        _paf.promise.emplaceValue(std::forward<U>(value));
+    }
+
+    void unhandled_exception() noexcept {
+        _paf.promise.setError(exceptionToStatus());
+    }
+
+private:
+    PromiseAndFuture<T> _paf;
+};
+
+template <>
+class FutureCoroutinePromise<void> {
+public:
+    Future<void> get_return_object() noexcept {
+        return std::move(_paf.future);
+    }
+
+    std::suspend_never initial_suspend() const noexcept {
+        return {};
+    }
+
+    std::suspend_never final_suspend() const noexcept {
+        return {};
+    }
+
+    void return_void() noexcept {
+        _paf.promise.emplaceValue();
+    }
+
+    void unhandled_exception() noexcept {
+        _paf.promise.setError(exceptionToStatus());
+    }
+
+private:
+    PromiseAndFuture<void> _paf;
+};
+
+/** \see resumeOn. */
+class RescheduleAwaiter {
+public:
+    explicit RescheduleAwaiter(ExecutorPtr executor) : _executor(std::move(executor)) {}
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) noexcept {
+        _executor->schedule([this, handle](Status status) {
+            _status = std::move(status);
+            handle.resume();
+        });
+    }
+
+    void await_resume() {
+        uassertStatusOK(std::move(_status));
+    }
+
+private:
+    ExecutorPtr _executor;
+    Status _status = Status::OK();
+};
+
+}  // namespace future_coroutine_details
+
+template <typename T>
+auto operator co_await(Future<T>&& future) noexcept {
+    return future_coroutine_details::FutureAwaiter<T, Future>(std::move(future));
+}
+
+template <typename T>
+auto operator co_await(ExecutorFuture<T>&& future) noexcept {
+    return future_coroutine_details::FutureAwaiter<T, ExecutorFuture>(std::move(future));
+}
+
+/**
+ * Awaitable that reschedules the awaiting coroutine onto `executor`, which may be any
+ * `OutOfLineExecutor`, including a Baton. Throws in the coroutine if the executor refuses the
+ * work (e.g. it is shutting down), so the body does not keep running on a dead executor. The
+ * coroutine's subsequent code runs wherever the executor runs its tasks:
+ *
+ *     co_await resumeOn(executor);
+ */
+inline auto resumeOn(ExecutorPtr executor) noexcept {
+    return future_coroutine_details::RescheduleAwaiter(std::move(executor));
+}
+
+}  // namespace mongo
+
+template <typename T, typename... Args>
+struct std::coroutine_traits<mongo::Future<T>, Args...> {
+    using promise_type = mongo::future_coroutine_details::FutureCoroutinePromise<T>;
+};
@@ -0,0 +1,172 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/util/future_coroutine.h"
+
+#include <string>
+
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/join_thread.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/executor_test_util.h"
+#include "mongo/util/future.h"
+
+namespace mongo {
+namespace {
+
+TEST(FutureCoroutine, CoReturnFulfillsFuture) {
+    auto coro = []() -> Future<int> {
+        co_return 42;
+    };
+    auto fut = coro();
+    ASSERT_TRUE(fut.isReady());
+    ASSERT_EQ(std::move(fut).get(), 42);
+}
+
+TEST(FutureCoroutine, CoReturnVoid) {
+    bool ran = false;
+    auto coro = [&]() -> Future<void> {
+        ran = true;
+        co_return;
+    };
+    auto fut = coro();
+    ASSERT_TRUE(ran);
+    ASSERT_TRUE(fut.isReady());
+    ASSERT_OK(std::move(fut).getNoThrow());
+}
+
+TEST(FutureCoroutine, ThrownExceptionBecomesErrorStatus) {
+    auto coro = []() -> Future<int> {
+        uasserted(ErrorCodes::BadValue, "boom");
+        co_return 0;
+    };
+    auto fut = coro();
+    ASSERT_TRUE(fut.isReady());
+    ASSERT_EQ(std::move(fut).getNoThrow(), ErrorCodes::BadValue);
+}
+
+TEST(FutureCoroutine, AwaitReadyFutureDoesNotSuspend) {
+    auto coro = []() -> Future<int> {
+        auto value = co_await Future<int>::makeReady(10);
+        co_return value + 1;
+    };
+    auto fut = coro();
+    // No suspension point was reached, so the body ran to completion inside the call.
+    ASSERT_TRUE(fut.isReady());
+    ASSERT_EQ(std::move(fut).get(), 11);
+}
+
+TEST(FutureCoroutine, AwaitPendingFutureResumesOnCompletion) {
+    auto [promise, inner] = makePromiseFuture<std::string>();
+    auto coro = [](Future<std::string> inner) -> Future<std::string> {
+        auto value = co_await std::move(inner);
+        co_return value + "!";
+    };
+    auto fut = coro(std::move(inner));
+    ASSERT_FALSE(fut.isReady());
+    promise.emplaceValue("done");
+    ASSERT_TRUE(fut.isReady());
+    ASSERT_EQ(std::move(fut).get(), "done!");
+}
+
+TEST(FutureCoroutine, AwaitedErrorRethrownIntoCoroutine) {
+    auto [promise, inner] = makePromiseFuture<int>();
+    bool caught = false;
+    auto coro = [&](Future<int> inner) -> Future<int> {
+        try {
+            co_await std::move(inner);
+        } catch (const ExceptionFor<ErrorCodes::InternalError>&) {
+            caught = true;
+        }
+        co_return -1;
+    };
+    auto fut = coro(std::move(inner));
+    promise.setError(Status(ErrorCodes::InternalError, "inner failed"));
+    ASSERT_TRUE(caught);
+    ASSERT_EQ(std::move(fut).get(), -1);
+}
+
+TEST(FutureCoroutine, UncaughtAwaitedErrorPropagatesToResult) {
+    auto [promise, inner] = makePromiseFuture<int>();
+    auto coro = [](Future<int> inner) -> Future<int> {
+        co_return co_await std::move(inner) + 1;
+    };
+    auto fut = coro(std::move(inner));
+    promise.setError(Status(ErrorCodes::InternalError, "inner failed"));
+    ASSERT_EQ(std::move(fut).getNoThrow(), ErrorCodes::InternalError);
+}
+
+TEST(FutureCoroutine, AwaitExecutorFuture) {
+    auto exec = InlineQueuedCountingExecutor::make();
+    auto [promise, inner] = makePromiseFuture<int>();
+    auto coro = [](ExecutorFuture<int> inner) -> Future<int> {
+        co_return co_await std::move(inner) * 2;
+    };
+    auto fut = coro(std::move(inner).thenRunOn(exec));
+    ASSERT_FALSE(fut.isReady());
+    promise.emplaceValue(21);
+    ASSERT_EQ(std::move(fut).get(), 42);
+    ASSERT_GT(exec->tasksRun.load(), 0);
+}
+
+TEST(FutureCoroutine, ResumeOnExecutor) {
+    auto exec = InlineQueuedCountingExecutor::make();
+    auto before = exec->tasksRun.load();
+    auto coro = [&]() -> Future<int> {
+        co_await resumeOn(exec);
+        co_return 7;
+    };
+    ASSERT_EQ(coro().get(), 7);
+    ASSERT_EQ(exec->tasksRun.load(), before + 1);
+}
+
+TEST(FutureCoroutine, ResumeOnRejectingExecutorThrowsInBody) {
+    auto coro = []() -> Future<int> {
+        co_await resumeOn(RejectingExecutor::make());
+        co_return 7;
+    };
+    ASSERT_EQ(coro().getNoThrow(), ErrorCodes::ShutdownInProgress);
+}
+
+TEST(FutureCoroutine, CompletionFromAnotherThread) {
+    auto [promise, inner] = makePromiseFuture<int>();
+    auto coro = [](Future<int> inner) -> Future<int> {
+        auto a = co_await std::move(inner);
+        auto b = co_await Future<int>::makeReady(2);
+        co_return a + b;
+    };
+    auto fut = coro(std::move(inner));
+    unittest::JoinThread completer{[&, promise = std::move(promise)]() mutable {
+        promise.emplaceValue(40);
+    }};
+    ASSERT_EQ(std::move(fut).get(), 42);
+}
+
+}  // namespace
+}  // namespace mongo
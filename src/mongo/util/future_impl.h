@@ -31,8 +31,11 @@
 
 #include <boost/intrusive_ptr.hpp>
 #include <boost/optional.hpp>
+#include <cstddef>
 #include <forward_list>
+#include <new>
 #include <type_traits>
+#include <utility>
 
 #include "mongo/base/checked_cast.h"
 #include "mongo/base/status.h"
@@ -400,6 +403,113 @@ enum class SSBState : uint8_t {
     kFinished,
 };
 
+class SharedStateBase;
+
+/**
+ * A move-only, type-erased callable with the fixed continuation signature used by
+ * SharedStateBase. Unlike unique_function, callables that fit in the inline buffer and have a
+ * non-throwing move are stored in place in the shared state rather than behind a heap
+ * allocation. Nearly all continuation wrappers produced by this file qualify, so registering a
+ * continuation on a pending future doesn't allocate separately for the callable; oversized
+ * callables transparently degrade to unique_function and its heap-allocated implementation.
+ */
+class ContinuationCallback {
+public:
+    // Big enough for the continuation wrappers below when they capture a typical user lambda (a
+    // few pointers plus a little state). Sized against the continuation-heavy cases in
+    // future_bm.cpp; growing this enlarges every SharedState, so it should stay small.
+    static constexpr size_t kInlineSize = 64;
+
+    ContinuationCallback() = default;
+
+    ContinuationCallback(const ContinuationCallback&) = delete;
+    ContinuationCallback& operator=(const ContinuationCallback&) = delete;
+
+    ContinuationCallback(ContinuationCallback&& other) noexcept {
+        _moveFrom(other);
+    }
+
+    ContinuationCallback& operator=(ContinuationCallback&& other) noexcept {
+        if (this != &other) {
+            _reset();
+            _moveFrom(other);
+        }
+        return *this;
+    }
+
+    ~ContinuationCallback() {
+        _reset();
+    }
+
+    template <typename F,
+              std::enable_if_t<!std::is_same_v<std::decay_t<F>, ContinuationCallback>, int> = 0>
+    /* implicit */ ContinuationCallback(F&& f) {
+        using Functor = std::decay_t<F>;
+        if constexpr (sizeof(Functor) <= kInlineSize &&
+                      alignof(Functor) <= alignof(std::max_align_t) &&
+                      std::is_nothrow_move_constructible_v<Functor>) {
+            _emplace<Functor>(std::forward<F>(f));
+        } else {
+            // Too big (or has a throwing move) to store in place, so fall back to
+            // unique_function, which is small and nothrow-movable but heap-allocates its
+            // implementation.
+            _emplace<unique_function<void(SharedStateBase*)>>(std::forward<F>(f));
+        }
+    }
+
+    void operator()(SharedStateBase* input) {
+        dassert(_vtable);
+        _vtable->invoke(&_storage, input);
+    }
+
+    explicit operator bool() const noexcept {
+        return _vtable != nullptr;
+    }
+
+private:
+    struct VTable {
+        void (*invoke)(void* storage, SharedStateBase* input);
+        void (*moveConstructAndDestroy)(void* dst, void* src) noexcept;
+        void (*destroy)(void* storage) noexcept;
+    };
+
+    template <typename Functor>
+    static constexpr VTable kVTableFor{
+        [](void* storage, SharedStateBase* input) {
+            (*static_cast<Functor*>(storage))(input);
+        },
+        [](void* dst, void* src) noexcept {
+            new (dst) Functor(std::move(*static_cast<Functor*>(src)));
+            static_cast<Functor*>(src)->~Functor();
+        },
+        [](void* storage) noexcept {
+            static_cast<Functor*>(storage)->~Functor();
+        },
+    };
+
+    template <typename Functor, typename F>
+    void _emplace(F&& f) {
+        static_assert(sizeof(Functor) <= kInlineSize);
+        new (&_storage) Functor(std::forward<F>(f));
+        _vtable = &kVTableFor<Functor>;
+    }
+
+    void _moveFrom(ContinuationCallback& other) noexcept {
+        if (other._vtable) {
+            other._vtable->moveConstructAndDestroy(&_storage, &other._storage);
+            _vtable = std::exchange(other._vtable, nullptr);
+        }
+    }
+
+    void _reset() noexcept {
+        if (auto vtable = std::exchange(_vtable, nullptr))
+            vtable->destroy(&_storage);
+    }
+
+    alignas(std::max_align_t) std::byte _storage[kInlineSize];
+    const VTable* _vtable = nullptr;
+};
+
 class SharedStateBase : public RefCountable {
 public:
     using Children = std::forward_list<boost::intrusive_ptr<SharedStateBase>>;
@@ -533,8 +643,9 @@ public:
     // callback.
     boost::intrusive_ptr<SharedStateBase> continuation;  // F
 
-    // Takes this as argument and usually writes to continuation.
-    unique_function<void(SharedStateBase* input)> callback;  // F
+    // Takes this as argument and usually writes to continuation. Stored inline (no allocation)
+    // for all but oversized callables; see ContinuationCallback.
+    ContinuationCallback callback;  // F
 
     // These are only used to signal completion to blocking waiters. Benchmarks showed that it was
     // worth deferring the construction of cv, so it can be avoided when it isn't necessary.
@@ -2522,6 +2522,13 @@ Status SSLManagerOpenSSL::initSSLContext(SSL_CTX* context,
                                     << getSSLErrorMessage(ERR_get_error()));
     }
 
+    if (direction == ConnectionDirection::kIncoming && gTLSIngressSessionCacheSize > 0) {
+        // Size the session resumption cache for the expected client fleet; an undersized cache
+        // evicts sessions before clients reconnect and forces them back into full handshakes.
+        // TLS 1.3 clients resume via stateless tickets and do not consume cache slots.
+        ::SSL_CTX_sess_set_cache_size(context, gTLSIngressSessionCacheSize);
+    }
+
     // We should accept all SNI extensions advertised by clients
     if (1 != SSL_CTX_set_tlsext_servername_callback(context, &SSLManagerOpenSSL::servername_cb)) {
         return Status(ErrorCodes::InvalidSSLConfiguration,
@@ -0,0 +1,128 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/util/numa_placement.h"
+
+#include <fmt/format.h>
+#include <string>
+
+#include "mongo/util/errno_util.h"
+#include "mongo/util/processinfo.h"
+
+#if defined(__linux__)
+#include <fstream>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace mongo {
+namespace numa {
+
+#if defined(__linux__)
+
+unsigned currentNode() {
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+        return 0;
+    }
+    return node;
+}
+
+std::vector<int> cpusOnNode(unsigned node) {
+    // The cpulist format is comma-separated ranges, e.g. "0-7,16-23".
+    std::ifstream cpulist(
+        fmt::format("/sys/devices/system/node/node{}/cpulist", node));
+    std::vector<int> cpus;
+    std::string range;
+    while (std::getline(cpulist, range, ',')) {
+        int first = 0;
+        int last = 0;
+        if (sscanf(range.c_str(), "%d-%d", &first, &last) == 2) {
+            for (int cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        } else if (sscanf(range.c_str(), "%d", &first) == 1) {
+            cpus.push_back(first);
+        }
+    }
+    return cpus;
+}
+
+Status bindThisThreadToNode(unsigned node) {
+    auto cpus = cpusOnNode(node);
+    if (cpus.empty()) {
+        return Status(ErrorCodes::BadValue,
+                      fmt::format("No CPUs found for NUMA node {}", node));
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (int cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+    if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0) {
+        return Status(ErrorCodes::UnknownError,
+                      fmt::format("Failed to bind thread to NUMA node {}: {}",
+                                  node,
+                                  errorMessage(lastSystemError())));
+    }
+    return Status::OK();
+}
+
+#else  // !defined(__linux__)
+
+unsigned currentNode() {
+    return 0;
+}
+
+std::vector<int> cpusOnNode(unsigned node) {
+    return {};
+}
+
+Status bindThisThreadToNode(unsigned node) {
+    return Status(ErrorCodes::NotImplemented,
+                  "NUMA thread placement is only supported on Linux");
+}
+
+#endif  // defined(__linux__)
+
+unsigned preferredNodeForWorker(size_t workerIndex) {
+    auto nodes = ProcessInfo::getNumNumaNodes();
+    if (nodes <= 1) {
+        return 0;
+    }
+    return static_cast<unsigned>(workerIndex % nodes);
+}
+
+}  // namespace numa
+}  // namespace mongo
@@ -0,0 +1,77 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "mongo/base/status.h"
+
+namespace mongo {
+namespace numa {
+
+/**
+ * Utilities for keeping a thread's work on one NUMA node. On multi-socket machines, memory
+ * first touched by a thread is typically allocated on that thread's node; a worker that stays
+ * put therefore keeps its working memory node-local, while an unpinned worker that migrates
+ * pays remote-node latency for everything it allocated before the move. `ProcessInfo` answers
+ * whether NUMA is in play and how many nodes there are; this header supplies the placement
+ * side. Callers that pin worker groups should spread them with `preferredNodeForWorker` so
+ * load stays balanced across sockets.
+ *
+ * All functions degrade gracefully on kernels or platforms without NUMA topology exposure.
+ */
+
+/**
+ * Returns the NUMA node of the CPU the calling thread is currently running on, or 0 when the
+ * node cannot be determined. Purely advisory: the thread may migrate immediately afterwards
+ * unless it is pinned.
+ */
+unsigned currentNode();
+
+/**
+ * Returns the CPUs belonging to `node`, or an empty vector when the node does not exist or the
+ * topology cannot be read.
+ */
+std::vector<int> cpusOnNode(unsigned node);
+
+/**
+ * Restricts the calling thread to the CPUs of `node`. Fails with `BadValue` for an unknown
+ * node and `NotImplemented` on platforms without affinity support.
+ */
+Status bindThisThreadToNode(unsigned node);
+
+/**
+ * Maps a worker's index within a group onto a node round-robin, so pinned worker groups cover
+ * every node evenly.
+ */
+unsigned preferredNodeForWorker(size_t workerIndex);
+
+}  // namespace numa
+}  // namespace mongo
@@ -0,0 +1,95 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <fmt/format.h>
+#include <string>
+
+#include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/commands/server_status.h"
+#include "mongo/util/processinfo.h"
+
+#if defined(__linux__)
+#include <fstream>
+#endif
+
+namespace mongo {
+namespace {
+
+/**
+ * Reports per-NUMA-node allocation balance, so cross-node memory traffic can be diagnosed
+ * (and improvements from thread/memory placement measured) from serverStatus rather than
+ * host-level tooling. The per-node counters come from the kernel's
+ * /sys/devices/system/node/node<N>/numastat: numa_hit/numa_miss track whether allocations
+ * landed on the node the allocating thread asked for, and local_node/other_node whether they
+ * landed on the allocating thread's own node.
+ */
+class NumaServerStatusSection : public ServerStatusSection {
+public:
+    using ServerStatusSection::ServerStatusSection;
+
+    bool includeByDefault() const override {
+        // Only interesting on multi-socket machines.
+        return ProcessInfo::getNumNumaNodes() > 1;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        BSONObjBuilder builder;
+        auto nodes = ProcessInfo::getNumNumaNodes();
+        builder.appendNumber("numNodes", static_cast<long long>(nodes));
+
+#if defined(__linux__)
+        BSONObjBuilder perNode(builder.subobjStart("perNode"));
+        for (unsigned long node = 0; node < nodes; ++node) {
+            std::ifstream numastat(
+                fmt::format("/sys/devices/system/node/node{}/numastat", node));
+            if (!numastat) {
+                continue;
+            }
+            BSONObjBuilder nodeBuilder(perNode.subobjStart(fmt::format("node{}", node)));
+            std::string name;
+            long long value;
+            while (numastat >> name >> value) {
+                nodeBuilder.appendNumber(name, value);
+            }
+        }
+        perNode.done();
+#endif
+
+        return builder.obj();
+    }
+};
+
+auto& numaServerStatusSection =
+    *ServerStatusSectionBuilder<NumaServerStatusSection>("numa").forShard().forRouter();
+
+}  // namespace
+}  // namespace mongo
@@ -0,0 +1,144 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/aligned.h"
+
+namespace mongo {
+
+/**
+ * A monotonically growing metric counter sharded across cache lines by CPU.
+ *
+ * Padding a shared `AtomicWord` to its own cache line (`CacheExclusive`) stops false sharing,
+ * but every increment from a different core still has to pull the line over in exclusive state.
+ * For counters bumped on per-operation fast paths from every core at once, that RFO traffic is
+ * a measurable tax on large machines. Here each CPU increments its own line instead, and reads
+ * aggregate lazily by summing the stripes; increments never touch a line another core is
+ * writing, at the cost of making reads linear in the stripe count. That trade is right for
+ * metrics, which are written millions of times per second and read about once per
+ * serverStatus.
+ *
+ * Increments use relaxed atomics on the local stripe, since a thread can migrate (or share a
+ * CPU) mid-increment; `sum()` is correspondingly a relaxed snapshot, like the counters this
+ * replaces. `reset()` zeroes the stripes one at a time and may lose concurrent increments, so
+ * it is fit for tests and for wrap protection, not for precise accounting.
+ */
+class ShardedCounter64 {
+public:
+    ShardedCounter64() : _stripes(std::make_unique<Stripe[]>(numStripes())) {}
+
+    /**
+     * Adds `n` to the calling CPU's stripe and returns that stripe's previous value. The return
+     * value is a lower bound on the counter's total, cheap enough for callers that only need to
+     * detect "has grown very large" without paying for a full sum.
+     */
+    long long increment(long long n = 1) {
+        return _stripes[_currentStripe()]->fetchAndAddRelaxed(n);
+    }
+
+    /**
+     * Returns a relaxed snapshot of the counter's total.
+     */
+    long long sum() const {
+        long long total = 0;
+        for (size_t i = 0, n = numStripes(); i != n; ++i) {
+            total += _stripes[i]->loadRelaxed();
+        }
+        return total;
+    }
+
+    /**
+     * Best-effort zeroing; concurrent increments may be lost.
+     */
+    void reset() {
+        for (size_t i = 0, n = numStripes(); i != n; ++i) {
+            _stripes[i]->storeRelaxed(0);
+        }
+    }
+
+    /**
+     * The number of stripes, a power of two covering the machine's logical cores. Shared by all
+     * instances.
+     */
+    static size_t numStripes() {
+        static const size_t n = [] {
+            size_t cores = std::thread::hardware_concurrency();
+            size_t stripes = 1;
+            while (stripes < cores && stripes < kMaxStripes) {
+                stripes <<= 1;
+            }
+            return stripes;
+        }();
+        return n;
+    }
+
+    /**
+     * Index of the calling CPU's stripe, in [0, numStripes()). Exposed so that other per-CPU
+     * sharded structures (e.g. the global latency histograms) can share the stripe-count and
+     * stripe-selection policy rather than reimplementing it.
+     */
+    static size_t currentStripe() {
+        return _currentStripe();
+    }
+
+private:
+    using Stripe = CacheExclusive<AtomicWord<long long>>;
+
+    // Bounds per-counter memory (kMaxStripes cache lines) on very large machines, where a
+    // little residual sharing among groups of cores is still far better than one global line.
+    static constexpr size_t kMaxStripes = 128;
+
+    static size_t _currentStripe() {
+#if defined(__linux__)
+        // A vDSO call: no syscall, just a few nanoseconds. Using a stale CPU after migration
+        // only costs one shared increment.
+        if (int cpu = sched_getcpu(); cpu >= 0) {
+            return static_cast<size_t>(cpu) & (numStripes() - 1);
+        }
+#endif
+        thread_local const size_t fallback =
+            std::hash<std::thread::id>{}(std::this_thread::get_id());
+        return fallback & (numStripes() - 1);
+    }
+
+    std::unique_ptr<Stripe[]> _stripes;
+};
+
+}  // namespace mongo
@@ -0,0 +1,80 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <vector>
+
+#include "mongo/util/sharded_counter.h"
+
+#include "mongo/unittest/join_thread.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(ShardedCounter64Test, IncrementAndSum) {
+    ShardedCounter64 counter;
+    ASSERT_EQ(counter.sum(), 0);
+    counter.increment();
+    counter.increment(41);
+    ASSERT_EQ(counter.sum(), 42);
+}
+
+TEST(ShardedCounter64Test, Reset) {
+    ShardedCounter64 counter;
+    counter.increment(123);
+    counter.reset();
+    ASSERT_EQ(counter.sum(), 0);
+}
+
+TEST(ShardedCounter64Test, StripeCountIsPowerOfTwo) {
+    auto stripes = ShardedCounter64::numStripes();
+    ASSERT_GTE(stripes, 1u);
+    ASSERT_EQ(stripes & (stripes - 1), 0u);
+}
+
+TEST(ShardedCounter64Test, NoIncrementsLostAcrossThreads) {
+    constexpr int kThreads = 8;
+    constexpr int kPerThread = 100'000;
+
+    ShardedCounter64 counter;
+    {
+        std::vector<unittest::JoinThread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&] {
+                for (int i = 0; i < kPerThread; ++i) {
+                    counter.increment();
+                }
+            });
+        }
+    }
+    ASSERT_EQ(counter.sum(), static_cast<long long>(kThreads) * kPerThread);
+}
+
+}  // namespace
+}  // namespace mongo
@@ -38,7 +38,9 @@
 
 #include <fmt/format.h>
 
+#include "mongo/base/data_view.h"
 #include "mongo/base/error_codes.h"
+#include "mongo/platform/bits.h"
 #include "mongo/platform/compiler.h"
 #include "mongo/util/assert_util.h"
 
@@ -152,7 +154,36 @@ void escape(Buffer& buffer,
     };
 
 
+    // Fast-forwards 'it' over printable ASCII that no escaper in this file modifies: every
+    // single-byte handler passes [0x20, 0x7e] through verbatim except for the quote and
+    // backslash. Such bytes stay part of the pending unescaped range and are flushed in bulk,
+    // so this just skips the per-byte dispatch for them, a word at a time.
+    auto skipPlainAscii = [&] {
+        constexpr uint64_t kLowBits = 0x0101010101010101ull;
+        constexpr uint64_t kHighBits = 0x8080808080808080ull;
+        auto zeroBytes = [](uint64_t w) {
+            return (w - kLowBits) & ~w & kHighBits;
+        };
+        while (std::distance(it, inLast) >= static_cast<ptrdiff_t>(sizeof(uint64_t))) {
+            uint64_t word = ConstDataView(it).read<LittleEndian<uint64_t>>();
+            // Flags the high bit of each lane holding a byte outside [0x20, 0x7e] or equal to
+            // a quote or backslash; see the SWAR zero-byte and unsigned-compare tests above.
+            uint64_t special = (word & kHighBits) | zeroBytes(word ^ (kLowBits * 0x7f)) |
+                zeroBytes(word ^ (kLowBits * uint8_t('"'))) |
+                zeroBytes(word ^ (kLowBits * uint8_t('\\'))) |
+                (~((word | kHighBits) - kLowBits * 0x20) & ~word & kHighBits);
+            if (special) {
+                it += countTrailingZerosNonZero64(special) >> 3;
+                return;
+            }
+            it += sizeof(uint64_t);
+        }
+    };
+
     while (it != inLast) {
+        skipPlainAscii();
+        if (it == inLast)
+            break;
         uint8_t c = *it;
         bool bit7 = (c >> 7) & 1;
         if (MONGO_likely(!bit7)) {
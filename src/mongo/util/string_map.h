@@ -88,7 +88,7 @@ struct StringMapHasher {
         return key.hash();
     }
 
-    StringMapHashedKey hashed_key(StringData sd) {
+    StringMapHashedKey hashed_key(StringData sd) const {
         return StringMapHashedKey(sd, operator()(sd));
     }
 };
@@ -29,6 +29,7 @@
 
 
 #include <cstdio>
+#include <string>
 #include <utility>
 
 #include <absl/container/node_hash_map.h>
@@ -227,4 +228,41 @@ TEST(StringMapTest, InitWithInitializerList) {
     ASSERT_EQ(2, smap["coollog"]);
     ASSERT_EQ(3, smap["mango"]);
 }
+
+// Lookups keyed by StringData must go through heterogeneous lookup: no std::string is
+// materialized for the probe.
+TEST(StringMapTest, HeterogeneousLookup) {
+    StringMap<int> smap{{"commandName", 1}};
+
+    char buf[] = {'c', 'o', 'm', 'm', 'a', 'n', 'd', 'N', 'a', 'm', 'e'};
+    StringData notNullTerminated(buf, sizeof(buf));
+    auto it = smap.find(notNullTerminated);
+    ASSERT_TRUE(it != smap.end());
+    ASSERT_EQ(it->second, 1);
+    ASSERT_TRUE(smap.find("missing"_sd) == smap.end());
+}
+
+// A key hashed once up front can be used for both insert and find without rehashing.
+TEST(StringMapTest, PrehashedKey) {
+    StringMap<int> smap;
+    auto hashed = StringMap<int>::hasher{}.hashed_key("field"_sd);
+    smap.try_emplace(hashed, 42);
+
+    ASSERT_EQ(smap.find(hashed)->second, 42);
+    ASSERT_EQ(smap.find("field"_sd)->second, 42);
+}
+
+// Reserving for a known bulk insert keeps the table from rehashing while it is filled.
+TEST(StringMapTest, ReserveForBulkInsert) {
+    constexpr size_t kCount = 1000;
+    StringMap<size_t> smap;
+    smap.reserve(kCount);
+    const auto buckets = smap.bucket_count();
+    for (size_t i = 0; i < kCount; ++i) {
+        smap[std::string("key") + std::to_string(i)] = i;
+    }
+    ASSERT_EQ(smap.bucket_count(), buckets);
+    ASSERT_EQ(smap.size(), kCount);
+    ASSERT_EQ(smap.find("key999"_sd)->second, 999u);
+}
 }  // namespace
@@ -0,0 +1,91 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <map>
+#include <string>
+#include <utility>
+
+#include "mongo/bson/bsonelement.h"
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/tracked_memory_registry.h"
+
+namespace mongo {
+namespace tracked_memory_registry {
+namespace {
+
+// Ordered so that report() emits a stable field order. Mutated only during process
+// initialization, then read-only.
+std::map<std::string, LiveBytesCallback>& subsystems() {
+    static auto* const instance = new std::map<std::string, LiveBytesCallback>();
+    return *instance;
+}
+
+}  // namespace
+
+void registerSubsystem(StringData name, LiveBytesCallback callback) {
+    auto [_, inserted] = subsystems().emplace(std::string{name}, std::move(callback));
+    invariant(inserted, "Duplicate tracked memory subsystem registration");
+}
+
+void report(ServiceContext* svcCtx, BSONObjBuilder* builder) {
+    for (auto&& [name, callback] : subsystems()) {
+        builder->appendNumber(name, static_cast<long long>(callback(svcCtx)));
+    }
+}
+
+}  // namespace tracked_memory_registry
+
+namespace {
+
+class TrackedMemorySection : public ServerStatusSection {
+public:
+    using ServerStatusSection::ServerStatusSection;
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        BSONObjBuilder builder;
+        tracked_memory_registry::report(opCtx->getServiceContext(), &builder);
+        return builder.obj();
+    }
+};
+
+// When no subsystem is registered in a given binary the generated section is empty and therefore
+// omitted from the serverStatus output entirely.
+auto& trackedMemorySection =
+    *ServerStatusSectionBuilder<TrackedMemorySection>("trackedMemory").forShard().forRouter();
+
+}  // namespace
+}  // namespace mongo
@@ -0,0 +1,73 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobjbuilder.h"
+
+namespace mongo {
+
+class ServiceContext;
+
+/**
+ * Process-wide registry attributing live heap bytes to the subsystems that track them.
+ *
+ * Subsystems that already account for their allocations (typically through a TrackingContext)
+ * register a callback resolving their current live byte count; the 'trackedMemory' serverStatus
+ * section reports every registered subsystem on each invocation. This keeps an always-on
+ * attribution of heap growth available, so unexpected RSS growth can be narrowed to a subsystem
+ * without restarting the server under a heap profiler.
+ *
+ * Callbacks must be registered during process initialization (MONGO_INITIALIZER or namespace
+ * scope), must be safe to invoke from any thread for the lifetime of the process, and should be
+ * cheap - at most a relaxed sum over per-thread counters.
+ */
+namespace tracked_memory_registry {
+
+using LiveBytesCallback = std::function<uint64_t(ServiceContext*)>;
+
+/**
+ * Registers 'callback' to report the live bytes of the subsystem named 'name'. Must only be
+ * called during process initialization; the registry is read without synchronization once the
+ * server starts serving commands.
+ */
+void registerSubsystem(StringData name, LiveBytesCallback callback);
+
+/**
+ * Appends one numeric field per registered subsystem to 'builder', in sorted name order so the
+ * resulting document has a stable schema for FTDC.
+ */
+void report(ServiceContext* svcCtx, BSONObjBuilder* builder);
+
+}  // namespace tracked_memory_registry
+}  // namespace mongo
@@ -0,0 +1,169 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/util/tsc_tick_source.h"
+
+#include <memory>
+
+#include "mongo/util/system_tick_source.h"
+#include "mongo/util/tick_source.h"
+
+#if defined(__linux__) && defined(__x86_64__)
+#define MONGO_HAVE_TSC_TICK_SOURCE
+#endif
+
+#ifdef MONGO_HAVE_TSC_TICK_SOURCE
+
+#include <algorithm>
+#include <array>
+#include <chrono>  // NOLINT
+#include <cmath>
+#include <cpuid.h>
+#include <fstream>
+#include <string>
+#include <thread>  // NOLINT
+#include <x86intrin.h>
+
+namespace mongo {
+namespace {
+
+bool hasInvariantTsc() {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    // CPUID.80000007H:EDX[8] is the invariant-TSC bit: the counter runs at a constant rate in
+    // all ACPI P-, C-, and T-states.
+    return edx & (1u << 8);
+}
+
+bool kernelUsesTscClocksource() {
+    // The kernel continuously sanity-checks its tsc clocksource against an independent timer
+    // and demotes it whenever the counters of different CPUs -- including ones on different
+    // sockets -- are observed to drift. Requiring that the kernel still trusts the TSC is the
+    // closest userspace can get to validating cross-socket synchronization.
+    std::ifstream clocksource("/sys/devices/system/clocksource/clocksource0/current_clocksource");
+    std::string name;
+    clocksource >> name;
+    return name == "tsc";
+}
+
+/**
+ * Measures the TSC frequency against the steady clock over several short intervals, taking the
+ * median. Returns 0 when the samples do not agree to within 1%, which indicates the counter is
+ * not advancing at a constant rate after all.
+ */
+int64_t calibrateTscTicksPerSecond() {
+    using SteadyClock = std::chrono::steady_clock;  // NOLINT
+
+    constexpr size_t kRounds = 5;
+    constexpr auto kRoundDuration = std::chrono::milliseconds(2);  // NOLINT
+
+    std::array<double, kRounds> samples;
+    for (auto& sample : samples) {
+        auto startTicks = __rdtsc();
+        auto startTime = SteadyClock::now();
+        std::this_thread::sleep_for(kRoundDuration);  // NOLINT
+        auto endTicks = __rdtsc();
+        auto endTime = SteadyClock::now();
+
+        auto elapsedNanos =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+        if (elapsedNanos <= 0 || endTicks <= startTicks) {
+            return 0;
+        }
+        sample = (endTicks - startTicks) * 1e9 / elapsedNanos;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    auto median = samples[kRounds / 2];
+    if (samples.front() < median * 0.99 || samples.back() > median * 1.01) {
+        return 0;
+    }
+    return static_cast<int64_t>(std::llround(median));
+}
+
+class TscTickSource final : public TickSource {
+public:
+    explicit TscTickSource(int64_t ticksPerSecond) : _ticksPerSecond(ticksPerSecond) {}
+
+    Tick getTicks() override {
+        return static_cast<Tick>(__rdtsc());
+    }
+
+    Tick getTicksPerSecond() override {
+        return _ticksPerSecond;
+    }
+
+private:
+    const int64_t _ticksPerSecond;
+};
+
+}  // namespace
+
+std::unique_ptr<TickSource> makeTscTickSourceIfStable() {
+    if (!hasInvariantTsc() || !kernelUsesTscClocksource()) {
+        return nullptr;
+    }
+
+    auto ticksPerSecond = calibrateTscTicksPerSecond();
+    if (ticksPerSecond <= 0) {
+        return nullptr;
+    }
+
+    return std::make_unique<TscTickSource>(ticksPerSecond);
+}
+
+}  // namespace mongo
+
+#else  // MONGO_HAVE_TSC_TICK_SOURCE
+
+namespace mongo {
+
+std::unique_ptr<TickSource> makeTscTickSourceIfStable() {
+    return nullptr;
+}
+
+}  // namespace mongo
+
+#endif  // MONGO_HAVE_TSC_TICK_SOURCE
+
+namespace mongo {
+
+TickSource* globalDefaultTickSource() {
+    static const auto p = [] {
+        if (auto tsc = makeTscTickSourceIfStable()) {
+            return tsc.release();
+        }
+        return makeSystemTickSource().release();
+    }();
+    return p;
+}
+
+}  // namespace mongo
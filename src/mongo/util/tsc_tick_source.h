@@ -0,0 +1,57 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/util/tick_source.h"
+
+#include <memory>
+
+namespace mongo {
+
+/**
+ * Attempts to construct a TickSource backed by the processor's time stamp counter, calibrated
+ * against the steady clock at construction. Reading it is a single instruction, versus the
+ * clock_gettime path taken by the steady_clock-based system source on every read.
+ *
+ * Returns nullptr when the counter cannot be trusted: on non-x86 platforms, when the CPU does
+ * not advertise an invariant TSC, when the kernel has demoted its own tsc clocksource (which it
+ * does whenever it observes counters on different CPUs or sockets drifting), or when
+ * calibration fails to converge. Callers must fall back to makeSystemTickSource().
+ */
+std::unique_ptr<TickSource> makeTscTickSourceIfStable();
+
+/**
+ * Accesses a singleton tick source for operation timing: the calibrated TSC source when the
+ * platform guarantees it is stable, otherwise the steady_clock-based system source. Safe to
+ * call at any time.
+ */
+TickSource* globalDefaultTickSource();
+
+}  // namespace mongo
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <absl/hash/hash.h>
 #include <array>
 #include <compare>
 #include <cstdint>
@@ -46,6 +47,7 @@
 #include "mongo/bson/bsontypes.h"
 #include "mongo/bson/util/builder_fwd.h"
 #include "mongo/logv2/log_attr.h"
+#include "mongo/stdx/trusted_hasher.h"
 #include "mongo/stdx/type_traits.h"
 #include "mongo/util/assert_util_core.h"
 
@@ -182,14 +184,14 @@ public:
     bool isRFC4122v4() const;
 
     /**
-     * Custom hasher so UUIDs can be used in unordered data structures. Uses the first four bytes
-     * of the UUID itself as the hash, since these are already randomly generated.
+     * Custom hasher so UUIDs can be used in unordered data structures. Hashes all 16 bytes so
+     * that UUID-keyed tables disperse on the full value; this is a trusted hasher, so containers
+     * use the result directly without a second improving hash pass.
      * e.g. std::unordered_set<UUID, UUID::Hash> uuidSet;
      */
     struct Hash {
         std::size_t operator()(const UUID& uuid) const {
-            return uuid.toCDR()
-                .read<BigEndian<uint32_t>>();  // BigEndian because UUID is in network order
+            return absl::Hash<UUID>{}(uuid);
         }
     };
 
@@ -205,6 +207,11 @@ private:
     UUIDStorage _uuid{};  // UUID in network byte order
 };
 
+// UUID::Hash is a trusted hasher, no need to wrap in a secondary layer of hashing when used in
+// stdx unordered containers.
+template <>
+struct IsTrustedHasher<UUID::Hash, UUID> : std::true_type {};
+
 /** Allow IDL-generated parsers to define uninitialized UUID objects. */
 inline auto idlPreparsedValue(stdx::type_identity<UUID>) {
     return UUID::fromCDR(std::array<unsigned char, 16>{});